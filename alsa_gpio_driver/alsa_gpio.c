@@ -5,11 +5,27 @@
 #include <linux/vmalloc.h>
 #include <linux/platform_device.h>
 #include <linux/init.h>
+#include <linux/hrtimer.h>
+#include <linux/timerqueue.h>
+#include <linux/mutex.h>
+#include <linux/gcd.h>
+#include <linux/math64.h>
+#include <linux/fixp-arith.h>
+#include <linux/firmware.h>
+#include <linux/kthread.h>
+#include <linux/workqueue.h>
+#include <linux/sched.h>
+#include <linux/delay.h>
+#include <linux/gpio/consumer.h>
+#include <linux/gpio/machine.h>
+#include <linux/pwm.h>
+#include <asm/unaligned.h>
 #include <sound/core.h>
 #include <sound/initval.h>
 #include <sound/pcm.h>
-
-#include "music.h"
+#include <sound/info.h>
+#include <sound/control.h>
+#include <sound/tlv.h>
 
 #define DRIVER_NAME "alsa-gpio"
 
@@ -24,10 +40,80 @@
 #define MAX_BUFFER_SIZE		(64*1024)
 #define MIN_PERIOD_SIZE		64
 #define MAX_PERIOD_SIZE		MAX_BUFFER_SIZE
+#define TONE_HZ			110
+#define BANK_NAME_MAX		64
+#define BANK_WINDOW		(256 * 1024)	/* bytes of a file read at once */
+#define GAIN_UNITY		256	/* Q8 fixed point */
 
 static int pcm_substream = 1;
 static int pcm_dev = 1;
-static int buffer_counter = 0;
+static bool shared_tick;
+static char sample_bank[BANK_NAME_MAX];
+static char *model_param;
+static int buffer_max_kb = 4096;
+static int prealloc_kb = 64;
+
+module_param(shared_tick, bool, 0444);
+MODULE_PARM_DESC(shared_tick,
+                "Service all substreams from one coalesced per-card timer");
+module_param_string(sample_bank, sample_bank, sizeof(sample_bank), 0644);
+MODULE_PARM_DESC(sample_bank,
+                "Firmware file with raw PCM to play instead of the test tone");
+module_param_named(model, model_param, charp, 0444);
+MODULE_PARM_DESC(model,
+                "Hardware model (alsa_gpio, lowlat, throughput, largebuf, ratelimit)");
+module_param(buffer_max_kb, int, 0444);
+MODULE_PARM_DESC(buffer_max_kb, "Largest PCM buffer in KiB, vmalloc backed");
+module_param(prealloc_kb, int, 0444);
+MODULE_PARM_DESC(prealloc_kb, "Buffer preallocated per substream in KiB");
+
+/* Playback output engine */
+#define OUT_NONE	0
+#define OUT_GPIO	1
+#define OUT_PWM		2
+#define OUT_BATCH_MAX	64	/* samples fetched from the ring at once */
+
+static int out_mode = OUT_NONE;
+static char *out_chip;
+static unsigned int out_line;
+static unsigned int out_batch = 1;
+
+module_param(out_mode, int, 0444);
+MODULE_PARM_DESC(out_mode,
+                "Playback output (0 = none, 1 = PDM on a GPIO, 2 = PWM duty)");
+module_param(out_chip, charp, 0444);
+MODULE_PARM_DESC(out_chip,
+                "GPIO chip label or PWM provider to output on (e.g. gpio-mockup-A)");
+module_param(out_line, uint, 0444);
+MODULE_PARM_DESC(out_line, "GPIO line or PWM channel on out_chip");
+module_param(out_batch, uint, 0444);
+MODULE_PARM_DESC(out_batch,
+                "Samples emitted per wakeup, spaced by a delay loop (1-64, at most a period)");
+
+/* Capture input engine */
+#define IN_NONE		0
+#define IN_LOGIC	1
+#define IN_PDM		2
+#define IN_DECIM_MAX	1024	/* keeps the CIC gain within 32 bits */
+#define IN_BATCH_MAX	64	/* frames read per wakeup */
+
+static int in_mode = IN_NONE;
+static char *in_chip;
+static unsigned int in_line;
+static unsigned int in_decim = 64;
+static unsigned int in_batch = 8;
+
+module_param(in_mode, int, 0444);
+MODULE_PARM_DESC(in_mode,
+                "Capture input (0 = sample bank, 1 = logic probe, 2 = PDM microphone)");
+module_param(in_chip, charp, 0444);
+MODULE_PARM_DESC(in_chip, "GPIO chip label to capture from (e.g. gpio-sim.0-node0)");
+module_param(in_line, uint, 0444);
+MODULE_PARM_DESC(in_line, "GPIO line on in_chip");
+module_param(in_decim, uint, 0444);
+MODULE_PARM_DESC(in_decim, "PDM oversampling ratio, line reads per frame");
+module_param(in_batch, uint, 0444);
+MODULE_PARM_DESC(in_batch, "Frames read back to back per input wakeup (1-64)");
 
 struct alsa_gpio_timer_ops {
         int (*create)(struct snd_pcm_substream *);
@@ -35,14 +121,60 @@ struct alsa_gpio_timer_ops {
         int (*prepare)(struct snd_pcm_substream *);
         int (*start)(struct snd_pcm_substream *);
         int (*stop)(struct snd_pcm_substream *);
+        int (*suspend)(struct snd_pcm_substream *);
+        int (*resume)(struct snd_pcm_substream *);
         snd_pcm_uframes_t (*pointer)(struct snd_pcm_substream *);
 };
 
 #define get_alsa_gpio_ops(substream) \
         (*(const struct alsa_gpio_timer_ops **)(substream)->runtime->private_data)
 
+struct alsa_gpio_bank;
+
+/* Start of every backend's private data */
+struct alsa_gpio_pcm_head {
+        const struct alsa_gpio_timer_ops *timer_ops;
+        struct alsa_gpio_bank *bank;
+        size_t bank_pos;		/* next byte of the bank to stream */
+        u64 filled;			/* frames written to the ring */
+        ktime_t suspended;		/* stream time reached at suspend */
+        u32 mult;			/* frames per ns, scaled by 2^shift */
+        u32 shift;
+};
+
+#define get_alsa_gpio_head(substream) \
+        ((struct alsa_gpio_pcm_head *)(substream)->runtime->private_data)
+
+/*
+ * Stream time to frames for the hrtimer based backends, without a
+ * 64-bit division or a rate * ns product that overflows after a day.
+ * mult stays in (2^30, 2^31] and is rounded up, so a period deadline
+ * always yields the full period.
+ */
+static void alsa_gpio_clock_prepare(struct alsa_gpio_pcm_head *head,
+                unsigned int rate)
+{
+        head->shift = 31 + ilog2(NSEC_PER_SEC / rate);
+        head->mult = div_u64(((u64)rate << head->shift) + NSEC_PER_SEC - 1,
+                        NSEC_PER_SEC);
+}
+
+static u64 alsa_gpio_clock_frames(struct alsa_gpio_pcm_head *head,
+                ktime_t elapsed)
+{
+        return mul_u64_u32_shr(ktime_to_ns(elapsed), head->mult, head->shift);
+}
+
+/* Clock driving a model's periods */
+enum alsa_gpio_timer {
+        ALSA_GPIO_TIMER_SYSTIMER,	/* jiffies timer_list */
+        ALSA_GPIO_TIMER_HRTIMER,	/* hrtimer expiring in softirq */
+        ALSA_GPIO_TIMER_HRTIMER_HARD,	/* hrtimer expiring in hardirq */
+};
+
 struct alsa_gpio_model {
         const char *name;
+        enum alsa_gpio_timer timer;
         int (*playback_constraints)(struct snd_pcm_runtime *runtime);
         int (*capture_constraints)(struct snd_pcm_runtime *runtime);
         u64 formats;
@@ -58,204 +190,2115 @@ struct alsa_gpio_model {
         unsigned int channels_max;
 };
 
-static struct alsa_gpio_model model_gpio = {
-        .name = "alsa_gpio",
-        .formats = SNDRV_PCM_FMTBIT_U8,
-        .channels_min = USE_CHANNELS_MIN,
-        .channels_max = USE_CHANNELS_MAX,
-        .rates = SNDRV_PCM_RATE_8000,
-        .rate_min = USE_RATE_MIN,
-        .rate_max = USE_RATE_MAX,
-};
+static struct alsa_gpio_model model_gpio = {
+        .name = "alsa_gpio",
+        .timer = ALSA_GPIO_TIMER_HRTIMER,
+        .formats = SNDRV_PCM_FMTBIT_U8,
+        .channels_min = USE_CHANNELS_MIN,
+        .channels_max = USE_CHANNELS_MAX,
+        .rates = SNDRV_PCM_RATE_8000,
+        .rate_min = USE_RATE_MIN,
+        .rate_max = USE_RATE_MAX,
+};
+
+/* 64 frame periods serviced from hardirq */
+static struct alsa_gpio_model model_lowlat = {
+        .name = "lowlat",
+        .timer = ALSA_GPIO_TIMER_HRTIMER_HARD,
+        .formats = SNDRV_PCM_FMTBIT_U8,
+        .channels_min = USE_CHANNELS_MIN,
+        .channels_max = USE_CHANNELS_MAX,
+        .rates = SNDRV_PCM_RATE_8000_48000,
+        .rate_min = 8000,
+        .rate_max = 48000,
+        .buffer_bytes_max = 4096,
+        .period_bytes_min = 64 * USE_CHANNELS_MAX,
+        .period_bytes_max = 256 * USE_CHANNELS_MAX,
+        .periods_min = 2,
+        .periods_max = 16,
+};
+
+/* Few, large periods: minimal wakeups per second */
+static struct alsa_gpio_model model_throughput = {
+        .name = "throughput",
+        .timer = ALSA_GPIO_TIMER_SYSTIMER,
+        .formats = SNDRV_PCM_FMTBIT_U8 | SNDRV_PCM_FMTBIT_S16_LE,
+        .channels_min = USE_CHANNELS_MIN,
+        .channels_max = USE_CHANNELS_MAX,
+        .rates = SNDRV_PCM_RATE_8000_48000,
+        .rate_min = 8000,
+        .rate_max = 48000,
+        .period_bytes_min = 16 * 1024,
+        .period_bytes_max = MAX_BUFFER_SIZE / 2,
+        .periods_min = 2,
+        .periods_max = 4,
+};
+
+/* Rings up to buffer_max_kb split into many small periods */
+static struct alsa_gpio_model model_largebuf = {
+        .name = "largebuf",
+        .timer = ALSA_GPIO_TIMER_HRTIMER,
+        .formats = SNDRV_PCM_FMTBIT_U8 | SNDRV_PCM_FMTBIT_S16_LE,
+        .channels_min = USE_CHANNELS_MIN,
+        .channels_max = USE_CHANNELS_MAX,
+        .rates = SNDRV_PCM_RATE_8000_48000,
+        .rate_min = 8000,
+        .rate_max = 48000,
+        .period_bytes_min = MIN_PERIOD_SIZE,
+        .periods_min = 16,
+        .periods_max = USE_PERIODS_MAX,
+};
+
+static const unsigned int ratelimit_rates[] = {
+        8000, 11025, 16000, 22050,
+};
+
+static const struct snd_pcm_hw_constraint_list ratelimit_rate_list = {
+        .count = ARRAY_SIZE(ratelimit_rates),
+        .list = ratelimit_rates,
+};
+
+/*
+ * Like an engine clocked from a fixed set of dividers that moves 32
+ * frames per burst
+ */
+static int ratelimit_constraints(struct snd_pcm_runtime *runtime)
+{
+        int err;
+
+        err = snd_pcm_hw_constraint_list(runtime, 0, SNDRV_PCM_HW_PARAM_RATE,
+                        &ratelimit_rate_list);
+        if (err < 0)
+                return err;
+        err = snd_pcm_hw_constraint_step(runtime, 0,
+                        SNDRV_PCM_HW_PARAM_PERIOD_SIZE, 32);
+        if (err < 0)
+                return err;
+        return snd_pcm_hw_constraint_step(runtime, 0,
+                        SNDRV_PCM_HW_PARAM_BUFFER_SIZE, 32);
+}
+
+static struct alsa_gpio_model model_ratelimit = {
+        .name = "ratelimit",
+        .timer = ALSA_GPIO_TIMER_HRTIMER,
+        .playback_constraints = ratelimit_constraints,
+        .capture_constraints = ratelimit_constraints,
+        .formats = SNDRV_PCM_FMTBIT_U8,
+        .channels_min = USE_CHANNELS_MIN,
+        .channels_max = USE_CHANNELS_MAX,
+        .rates = SNDRV_PCM_RATE_CONTINUOUS,
+        .rate_min = 8000,
+        .rate_max = 22050,
+};
+
+static struct alsa_gpio_model *alsa_gpio_models[] = {
+        &model_gpio,
+        &model_lowlat,
+        &model_throughput,
+        &model_largebuf,
+        &model_ratelimit,
+        NULL
+};
+
+
+struct alsa_gpio_out;
+struct alsa_gpio_in;
+
+/* Card wide timer servicing every substream in deadline order */
+struct alsa_gpio_tick {
+        spinlock_t lock;
+        struct hrtimer timer;
+        struct timerqueue_head queue;
+};
+
+struct snd_alsa_gpio {
+        struct snd_card *card;
+        struct alsa_gpio_tick tick;
+        struct alsa_gpio_out *out;
+        struct alsa_gpio_in *in;
+        struct alsa_gpio_model *model;
+        struct snd_pcm *pcm;
+        struct snd_pcm_hardware pcm_hw;
+        spinlock_t mixer_lock;
+        int mixer_volume[2];		/* capture gain, GAIN_UNITY is 0 dB */
+        int capture_source[2];		/* capture switch per channel */
+};
+
+
+
+/*
+ * Sample banks
+ *
+ * The test tone is generated when a stream is prepared instead of being
+ * compiled in: one exact loop of TONE_HZ, rate / gcd(rate, TONE_HZ)
+ * frames long, in the stream's format. Banks are cached per rate,
+ * format and channel count and shared by all substreams using them.
+ *
+ * When sample_bank names a firmware file, its contents are played as
+ * raw frames in the stream's format instead. The parameter is writable,
+ * so the signal can be swapped at runtime; it takes effect on the next
+ * prepare.
+ *
+ * A file longer than BANK_WINDOW is paged in instead of being read
+ * whole. Every substream streaming it holds two windows of the file:
+ * one is played while a work item reads the next part of the file into
+ * the other. Such banks belong to their substream and are not cached.
+ * When the next window is not in yet the ring gets silence.
+ */
+
+struct alsa_gpio_pager {
+        struct work_struct work;
+        struct device *dev;
+        char name[BANK_NAME_MAX];
+        size_t frame_bytes;
+        u8 *buf[2];
+        size_t len[2];
+        bool ready[2];		/* buf holds file data, owned by the timer */
+        unsigned int cur;	/* window being streamed */
+        size_t pos;		/* next byte of the current window */
+        size_t next;		/* file offset of the window to read next */
+        u64 misses;		/* frames of silence waiting for a window */
+};
+
+struct alsa_gpio_bank {
+        struct list_head list;
+        unsigned int refs;
+        char name[BANK_NAME_MAX];	/* empty for the test tone */
+        unsigned int rate;
+        snd_pcm_format_t format;
+        unsigned int channels;
+        size_t bytes;
+        u8 *data;
+        struct alsa_gpio_pager *pager;	/* set instead of data if paged */
+};
+
+static LIST_HEAD(alsa_gpio_banks);
+static DEFINE_MUTEX(alsa_gpio_banks_lock);
+
+static int alsa_gpio_tone_sample(u8 *dst, snd_pcm_format_t format, s32 v)
+{
+        switch (format) {
+        case SNDRV_PCM_FORMAT_U8:
+                *dst = 0x80 + (v >> 24);
+                return 1;
+        case SNDRV_PCM_FORMAT_S8:
+                *dst = v >> 24;
+                return 1;
+        case SNDRV_PCM_FORMAT_S16_LE:
+                dst[0] = v >> 16;
+                dst[1] = v >> 24;
+                return 2;
+        default:
+                return -EINVAL;
+        }
+}
+
+static struct alsa_gpio_bank *
+alsa_gpio_bank_build(struct snd_pcm_runtime *runtime)
+{
+        struct alsa_gpio_bank *bank;
+        unsigned int frames = runtime->rate / gcd(runtime->rate, TONE_HZ);
+        unsigned int i, ch;
+        u8 *p;
+        s32 v;
+        int n;
+
+        bank = kzalloc(sizeof(*bank), GFP_KERNEL);
+        if (!bank)
+                return NULL;
+        bank->bytes = frames_to_bytes(runtime, frames);
+        bank->data = vmalloc(bank->bytes);
+        if (!bank->data)
+                goto error;
+        p = bank->data;
+        for (i = 0; i < frames; i++) {
+                v = fixp_sin32_rad((u64)i * TONE_HZ % runtime->rate,
+                                runtime->rate);
+                for (ch = 0; ch < runtime->channels; ch++) {
+                        n = alsa_gpio_tone_sample(p, runtime->format, v);
+                        if (n < 0)
+                                goto error;
+                        p += n;
+                }
+        }
+        bank->refs = 1;
+        bank->rate = runtime->rate;
+        bank->format = runtime->format;
+        bank->channels = runtime->channels;
+        return bank;
+
+error:
+        vfree(bank->data);
+        kfree(bank);
+        return NULL;
+}
+
+/*
+ * Read the window at pg->next, wrapping to the start of the file at its
+ * end. Returns the bytes read, trimmed to whole frames, or 0.
+ */
+static size_t alsa_gpio_pager_read(struct alsa_gpio_pager *pg, u8 *buf)
+{
+        const struct firmware *fw;
+        size_t len = 0;
+        int err, tries;
+
+        for (tries = 0; tries < 2 && !len; tries++) {
+                err = request_partial_firmware_into_buf(&fw, pg->name,
+                                pg->dev, buf, BANK_WINDOW, pg->next);
+                if (!err) {
+                        len = rounddown(fw->size, pg->frame_bytes);
+                        pg->next = fw->size < BANK_WINDOW ? 0 :
+                                pg->next + len;
+                        release_firmware(fw);
+                } else if (!pg->next) {
+                        break;
+                } else {
+                        /* the file ended right at the last window */
+                        pg->next = 0;
+                }
+        }
+        if (!len)
+                dev_err_ratelimited(pg->dev,
+                                "cannot page in sample bank %s: %d\n",
+                                pg->name, err);
+        return len;
+}
+
+/* Fill the window the timer has given back */
+static void alsa_gpio_pager_work(struct work_struct *work)
+{
+        struct alsa_gpio_pager *pg = container_of(work,
+                        struct alsa_gpio_pager, work);
+        unsigned int i;
+        size_t len;
+
+        for (i = 0; i < 2; i++) {
+                if (smp_load_acquire(&pg->ready[i]))
+                        continue;
+                len = alsa_gpio_pager_read(pg, pg->buf[i]);
+                if (!len)
+                        return;
+                pg->len[i] = len;
+                smp_store_release(&pg->ready[i], true);
+        }
+}
+
+/* Takes over buf, the first window of the file, holding len bytes */
+static struct alsa_gpio_pager *
+alsa_gpio_pager_new(struct device *dev, const char *name, size_t frame_bytes,
+                u8 *buf, size_t len)
+{
+        struct alsa_gpio_pager *pg;
+
+        pg = kzalloc(sizeof(*pg), GFP_KERNEL);
+        if (!pg)
+                return NULL;
+        pg->buf[1] = vmalloc(BANK_WINDOW);
+        if (!pg->buf[1]) {
+                kfree(pg);
+                return NULL;
+        }
+        INIT_WORK(&pg->work, alsa_gpio_pager_work);
+        pg->dev = dev;
+        strscpy(pg->name, name, sizeof(pg->name));
+        pg->frame_bytes = frame_bytes;
+        pg->buf[0] = buf;
+        pg->len[0] = len;
+        pg->ready[0] = true;
+        pg->next = len;
+        queue_work(system_unbound_wq, &pg->work);
+        return pg;
+}
+
+static void alsa_gpio_pager_free(struct alsa_gpio_pager *pg)
+{
+        if (!pg)
+                return;
+        cancel_work_sync(&pg->work);
+        pr_debug("sample bank %s: %llu frames missed\n", pg->name,
+                        pg->misses);
+        vfree(pg->buf[0]);
+        vfree(pg->buf[1]);
+        kfree(pg);
+}
+
+/*
+ * Timer side: point *src at the next bytes of the file and return how
+ * many follow contiguously, 0 while the next window is still loading.
+ */
+static size_t alsa_gpio_pager_src(struct alsa_gpio_pager *pg,
+                const u8 **src)
+{
+        unsigned int old = pg->cur;
+
+        if (pg->pos == pg->len[old]) {
+                if (!smp_load_acquire(&pg->ready[!old]))
+                        return 0;
+                pg->cur = !old;
+                pg->pos = 0;
+                smp_store_release(&pg->ready[old], false);
+                queue_work(system_unbound_wq, &pg->work);
+        }
+        *src = pg->buf[pg->cur] + pg->pos;
+        return pg->len[pg->cur] - pg->pos;
+}
+
+static void alsa_gpio_bank_free(struct alsa_gpio_bank *bank)
+{
+        alsa_gpio_pager_free(bank->pager);
+        vfree(bank->data);
+        kfree(bank);
+}
+
+/*
+ * Read the start of a firmware file. A file that fits in one window is
+ * copied into a vmalloc'ed bank, trimmed to whole frames so that
+ * wrapping keeps the channels aligned; a longer one gets a pager and
+ * is only ever held two windows at a time.
+ */
+static struct alsa_gpio_bank *
+alsa_gpio_bank_load(struct snd_pcm_runtime *runtime, struct device *dev,
+                const char *name)
+{
+        const struct firmware *fw;
+        struct alsa_gpio_bank *bank;
+        size_t frame_bytes = frames_to_bytes(runtime, 1);
+        size_t size;
+        u8 *buf;
+        int err;
+
+        buf = vmalloc(BANK_WINDOW);
+        if (!buf)
+                return ERR_PTR(-ENOMEM);
+        err = request_partial_firmware_into_buf(&fw, name, dev, buf,
+                        BANK_WINDOW, 0);
+        if (err < 0) {
+                dev_err(dev, "cannot load sample bank %s: %d\n", name, err);
+                vfree(buf);
+                return ERR_PTR(err);
+        }
+        size = fw->size;
+        release_firmware(fw);
+        if (size < frame_bytes) {
+                dev_err(dev, "sample bank %s is shorter than a frame\n", name);
+                vfree(buf);
+                return ERR_PTR(-EINVAL);
+        }
+
+        bank = kzalloc(sizeof(*bank), GFP_KERNEL);
+        if (!bank)
+                goto nomem;
+        INIT_LIST_HEAD(&bank->list);
+        bank->bytes = rounddown(size, frame_bytes);
+        if (size < BANK_WINDOW) {
+                bank->data = vmalloc(bank->bytes);
+                if (!bank->data)
+                        goto nomem;
+                memcpy(bank->data, buf, bank->bytes);
+                vfree(buf);
+        } else {
+                bank->pager = alsa_gpio_pager_new(dev, name, frame_bytes,
+                                buf, bank->bytes);
+                if (!bank->pager)
+                        goto nomem;
+        }
+        strscpy(bank->name, name, sizeof(bank->name));
+        bank->refs = 1;
+        bank->rate = runtime->rate;
+        bank->format = runtime->format;
+        bank->channels = runtime->channels;
+        pr_debug("loaded sample bank %s, %zu bytes%s\n", name, bank->bytes,
+                        bank->pager ? " of a paged file" : "");
+        return bank;
+
+nomem:
+        kfree(bank);
+        vfree(buf);
+        return ERR_PTR(-ENOMEM);
+}
+
+/* Files only have to agree on the frame size, they carry no format */
+static bool alsa_gpio_bank_match(struct alsa_gpio_bank *bank,
+                struct snd_pcm_runtime *runtime, const char *name)
+{
+        if (strcmp(bank->name, name))
+                return false;
+        if (*name)
+                return snd_pcm_format_physical_width(bank->format) *
+                        bank->channels == runtime->frame_bits;
+        return bank->rate == runtime->rate &&
+                bank->format == runtime->format &&
+                bank->channels == runtime->channels;
+}
+
+/* Called with alsa_gpio_banks_lock held, takes a reference */
+static struct alsa_gpio_bank *
+alsa_gpio_bank_find(struct snd_pcm_runtime *runtime, const char *name)
+{
+        struct alsa_gpio_bank *bank;
+
+        list_for_each_entry(bank, &alsa_gpio_banks, list) {
+                if (alsa_gpio_bank_match(bank, runtime, name)) {
+                        bank->refs++;
+                        return bank;
+                }
+        }
+        return NULL;
+}
+
+/*
+ * Banks are built or loaded without the lock, so a slow firmware load
+ * does not hold up other cards. When two streams race for the same
+ * bank the one inserted first wins and the other copy is dropped. Paged
+ * banks stay private to the substream.
+ */
+static struct alsa_gpio_bank *
+alsa_gpio_bank_get(struct snd_pcm_substream *substream)
+{
+        struct snd_alsa_gpio *alsa_gpio = snd_pcm_substream_chip(substream);
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        struct alsa_gpio_bank *bank, *found;
+        char buf[BANK_NAME_MAX];
+        char *name;
+
+        kernel_param_lock(THIS_MODULE);
+        strscpy(buf, sample_bank, sizeof(buf));
+        kernel_param_unlock(THIS_MODULE);
+        name = strim(buf);
+
+        mutex_lock(&alsa_gpio_banks_lock);
+        bank = alsa_gpio_bank_find(runtime, name);
+        mutex_unlock(&alsa_gpio_banks_lock);
+        if (bank)
+                return bank;
+
+        if (*name)
+                bank = alsa_gpio_bank_load(runtime, alsa_gpio->card->dev,
+                                name);
+        else
+                bank = alsa_gpio_bank_build(runtime) ?: ERR_PTR(-ENOMEM);
+        if (IS_ERR(bank) || bank->pager)
+                return bank;
+
+        mutex_lock(&alsa_gpio_banks_lock);
+        found = alsa_gpio_bank_find(runtime, name);
+        if (!found)
+                list_add(&bank->list, &alsa_gpio_banks);
+        mutex_unlock(&alsa_gpio_banks_lock);
+        if (found) {
+                alsa_gpio_bank_free(bank);
+                bank = found;
+        }
+        return bank;
+}
+
+static void alsa_gpio_bank_put(struct alsa_gpio_bank *bank)
+{
+        if (!bank)
+                return;
+        mutex_lock(&alsa_gpio_banks_lock);
+        if (!--bank->refs) {
+                list_del(&bank->list);
+                alsa_gpio_bank_free(bank);
+        }
+        mutex_unlock(&alsa_gpio_banks_lock);
+}
+
+/*
+ * Stream the bank into a capture ring
+ *
+ * Each substream keeps its own cursor in the bank. On every tick only
+ * the frames the pointer has moved past are refilled, keeping the ring
+ * one period ahead of the pointer, so the cost scales with the period
+ * and not with the buffer. Both the ring offset and the bank offset wrap.
+ */
+
+static void alsa_gpio_stream_reset(struct snd_pcm_substream *substream)
+{
+        struct alsa_gpio_pcm_head *head = get_alsa_gpio_head(substream);
+
+        head->bank_pos = 0;
+        head->filled = 0;
+}
+
+/*
+ * Capture gain
+ *
+ * The mixer gain is snapshotted once per fill and applied in Q8 fixed
+ * point. Unity copies the bank untouched and mute writes silence, both
+ * without any arithmetic. Otherwise the samples are scaled eight bytes
+ * at a time: offset binary samples of alternating channels are spread
+ * into double width lanes of a u64, so a single multiply scales every
+ * lane of a channel without carries between them.
+ */
+
+struct alsa_gpio_gain {
+        u32 g[2];
+        bool unity;
+        bool mute;
+};
+
+static void alsa_gpio_gain_get(struct snd_pcm_substream *substream,
+                struct alsa_gpio_gain *gain)
+{
+        struct snd_alsa_gpio *alsa_gpio = snd_pcm_substream_chip(substream);
+        unsigned long flags;
+        int ch;
+
+        spin_lock_irqsave(&alsa_gpio->mixer_lock, flags);
+        for (ch = 0; ch < 2; ch++)
+                gain->g[ch] = alsa_gpio->capture_source[ch] ?
+                        alsa_gpio->mixer_volume[ch] : 0;
+        spin_unlock_irqrestore(&alsa_gpio->mixer_lock, flags);
+        if (substream->runtime->channels == 1)
+                gain->g[1] = gain->g[0];
+        gain->unity = gain->g[0] == GAIN_UNITY && gain->g[1] == GAIN_UNITY;
+        gain->mute = !gain->g[0] && !gain->g[1];
+}
+
+/*
+ * Scale an offset binary sample: v * g + mid * (unity - g) stays in
+ * range and needs no signed arithmetic
+ */
+static u32 alsa_gpio_gain_offset(u32 v, unsigned int bits, u32 g)
+{
+        return ((v * g) >> 8) + (((GAIN_UNITY - g) << (bits - 1)) >> 8);
+}
+
+/* Same rounding as the word path, so results don't depend on alignment */
+static void alsa_gpio_gain_samples(struct snd_pcm_runtime *runtime,
+                const struct alsa_gpio_gain *gain, u8 *p, size_t sample,
+                size_t count)
+{
+        size_t i;
+        u32 g;
+
+        for (i = 0; i < count; i++, sample++) {
+                g = gain->g[min_t(u32, sample % runtime->channels, 1)];
+                switch (runtime->format) {
+                case SNDRV_PCM_FORMAT_U8:
+                        p[i] = alsa_gpio_gain_offset(p[i], 8, g);
+                        break;
+                case SNDRV_PCM_FORMAT_S8:
+                        p[i] = alsa_gpio_gain_offset(p[i] ^ 0x80, 8, g) ^ 0x80;
+                        break;
+                case SNDRV_PCM_FORMAT_S16_LE:
+                        put_unaligned_le16(alsa_gpio_gain_offset(
+                                        get_unaligned_le16(p + 2 * i) ^ 0x8000,
+                                        16, g) ^ 0x8000, p + 2 * i);
+                        break;
+                default:
+                        return;
+                }
+        }
+}
+
+/* Scale the 8 or 16 bit samples of a word, channels alternating */
+static u64 alsa_gpio_gain_word(u64 w, unsigned int bits, u64 sign,
+                u32 g_even, u32 g_odd)
+{
+        u64 lane = bits == 8 ? 0x0001000100010001ULL : 0x0000000100000001ULL;
+        u64 mask = lane * ((1U << bits) - 1);
+        u64 even, odd;
+
+        w ^= sign;
+        even = (((w & mask) * g_even) >> 8) & mask;
+        odd = ((((w >> bits) & mask) * g_odd) >> 8) & mask;
+        even += lane * alsa_gpio_gain_offset(0, bits, g_even);
+        odd += lane * alsa_gpio_gain_offset(0, bits, g_odd);
+        return (even | odd << bits) ^ sign;
+}
+
+static void alsa_gpio_gain_apply(struct snd_pcm_runtime *runtime,
+                const struct alsa_gpio_gain *gain, size_t ofs, size_t bytes)
+{
+        u8 *p = runtime->dma_area + ofs;
+        unsigned int width = snd_pcm_format_physical_width(runtime->format);
+        size_t ss = width / 8, head, words, i;
+        u64 sign, *w;
+
+        switch (runtime->format) {
+        case SNDRV_PCM_FORMAT_U8:
+                sign = 0;
+                break;
+        case SNDRV_PCM_FORMAT_S8:
+                sign = 0x8080808080808080ULL;
+                break;
+        case SNDRV_PCM_FORMAT_S16_LE:
+                sign = 0x8000800080008000ULL;
+                break;
+        default:
+                return;
+        }
+        if (IS_ENABLED(CONFIG_CPU_BIG_ENDIAN) || runtime->channels > 2) {
+                alsa_gpio_gain_samples(runtime, gain, p, ofs / ss, bytes / ss);
+                return;
+        }
+
+        /* The ring is page aligned, so words start on the first channel */
+        head = min_t(size_t, bytes, PTR_ALIGN(p, 8) - p);
+        alsa_gpio_gain_samples(runtime, gain, p, ofs / ss, head / ss);
+        p += head;
+        ofs += head;
+        bytes -= head;
+
+        words = bytes / 8;
+        w = (u64 *)p;
+        for (i = 0; i < words; i++)
+                w[i] = alsa_gpio_gain_word(w[i], width, sign,
+                                gain->g[0], gain->g[1]);
+        p += words * 8;
+        ofs += words * 8;
+        bytes -= words * 8;
+
+        alsa_gpio_gain_samples(runtime, gain, p, ofs / ss, bytes / ss);
+}
+
+/* Next contiguous bytes of the bank, 0 if a paged one is not in yet */
+static size_t alsa_gpio_stream_src(struct alsa_gpio_pcm_head *head,
+                const u8 **src)
+{
+        struct alsa_gpio_bank *bank = head->bank;
+
+        if (bank->pager)
+                return alsa_gpio_pager_src(bank->pager, src);
+        *src = bank->data + head->bank_pos;
+        return bank->bytes - head->bank_pos;
+}
+
+static void alsa_gpio_stream_advance(struct alsa_gpio_pcm_head *head,
+                size_t n)
+{
+        struct alsa_gpio_bank *bank = head->bank;
+
+        if (bank->pager) {
+                bank->pager->pos += n;
+                return;
+        }
+        head->bank_pos += n;
+        if (head->bank_pos == bank->bytes)
+                head->bank_pos = 0;
+}
+
+static void alsa_gpio_stream_write(struct snd_pcm_substream *substream,
+                snd_pcm_uframes_t frames)
+{
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        struct alsa_gpio_pcm_head *head = get_alsa_gpio_head(substream);
+        struct alsa_gpio_gain gain;
+        size_t ofs, bytes, avail, n;
+        const u8 *src;
+        u32 ring;
+
+        alsa_gpio_gain_get(substream, &gain);
+        div_u64_rem(head->filled, runtime->buffer_size, &ring);
+        head->filled += frames;
+        ofs = frames_to_bytes(runtime, ring);
+        bytes = frames_to_bytes(runtime, frames);
+        while (bytes) {
+                avail = alsa_gpio_stream_src(head, &src);
+                n = min(bytes, runtime->dma_bytes - ofs);
+                if (avail)
+                        n = min(n, avail);
+                else
+                        head->bank->pager->misses +=
+                                bytes_to_frames(runtime, n);
+                if (gain.mute || !avail) {
+                        snd_pcm_format_set_silence(runtime->format,
+                                        runtime->dma_area + ofs,
+                                        bytes_to_samples(runtime, n));
+                } else {
+                        memcpy(runtime->dma_area + ofs, src, n);
+                        if (!gain.unity)
+                                alsa_gpio_gain_apply(runtime, &gain, ofs, n);
+                }
+                if (avail)
+                        alsa_gpio_stream_advance(head, n);
+                bytes -= n;
+                ofs += n;
+                if (ofs == runtime->dma_bytes)
+                        ofs = 0;
+        }
+}
+
+/*
+ * Called from the timer with the frames its clock has passed. The
+ * pointer does not pass filled, so a tick late by more than a period
+ * writes the frames it missed, up to a buffer at a time, before the
+ * pointer is let over them.
+ */
+static void alsa_gpio_stream_bank(struct snd_pcm_substream *substream,
+                u64 frames)
+{
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        struct alsa_gpio_pcm_head *head = get_alsa_gpio_head(substream);
+        u64 target;
+
+        if (substream->stream != SNDRV_PCM_STREAM_CAPTURE || !head->bank)
+                return;
+        target = frames + min(runtime->period_size, runtime->buffer_size);
+        if (target > head->filled + runtime->buffer_size)
+                target = head->filled + runtime->buffer_size;
+        if (target > head->filled)
+                alsa_gpio_stream_write(substream, target - head->filled);
+}
+
+/*
+ * Ring position for the frames the clock has passed, held at the last
+ * frame written when a bank is streamed. Serialised against
+ * alsa_gpio_stream_bank by the caller.
+ */
+static snd_pcm_uframes_t alsa_gpio_stream_pointer(struct
+                snd_pcm_substream *substream, u64 frames)
+{
+        struct alsa_gpio_pcm_head *head = get_alsa_gpio_head(substream);
+        u32 pos;
+
+        if (head->bank)
+                frames = min(frames, head->filled);
+        div_u64_rem(frames, substream->runtime->buffer_size, &pos);
+        return pos;
+}
+
+/*
+ * system timer interface
+ */
+
+struct alsa_gpio_systimer_pcm {
+        /* head must be the first item */
+        struct alsa_gpio_pcm_head head;
+        spinlock_t lock;
+        struct timer_list timer;
+        unsigned long base_time;
+        u64 frac_frames;	/* frames passed since prepare (based HZ) */
+        unsigned int frac_period_rest;
+        unsigned int frac_period_size;	/* period_size * HZ */
+        unsigned int rate;
+        int elapsed;
+        struct snd_pcm_substream *substream;
+};
+
+static void alsa_gpio_systimer_rearm(struct alsa_gpio_systimer_pcm *dpcm)
+{
+        mod_timer(&dpcm->timer, jiffies +
+                        (dpcm->frac_period_rest + dpcm->rate - 1) / dpcm->rate);
+}
+
+static void alsa_gpio_systimer_update(struct alsa_gpio_systimer_pcm *dpcm)
+{
+        unsigned long delta;
+
+        delta = jiffies - dpcm->base_time;
+        if (!delta)
+                return;
+        dpcm->base_time += delta;
+        delta *= dpcm->rate;
+        dpcm->frac_frames += delta;
+        while (dpcm->frac_period_rest <= delta) {
+                dpcm->elapsed++;
+                dpcm->frac_period_rest += dpcm->frac_period_size;
+        }
+        dpcm->frac_period_rest -= delta;
+}
+
+static int alsa_gpio_systimer_start(struct snd_pcm_substream *substream)
+{
+        struct alsa_gpio_systimer_pcm *dpcm = substream->runtime->private_data;
+        spin_lock(&dpcm->lock);
+        dpcm->base_time = jiffies;
+        alsa_gpio_systimer_rearm(dpcm);
+        spin_unlock(&dpcm->lock);
+        return 0;
+}
+
+static int alsa_gpio_systimer_stop(struct snd_pcm_substream *substream)
+{
+        struct alsa_gpio_systimer_pcm *dpcm = substream->runtime->private_data;
+        spin_lock(&dpcm->lock);
+        del_timer(&dpcm->timer);
+        spin_unlock(&dpcm->lock);
+        return 0;
+}
+
+/*
+ * frac_frames and frac_period_rest are brought up to date and then left
+ * alone, start carries on from them
+ */
+static int alsa_gpio_systimer_suspend(struct snd_pcm_substream *substream)
+{
+        struct alsa_gpio_systimer_pcm *dpcm = substream->runtime->private_data;
+        spin_lock(&dpcm->lock);
+        alsa_gpio_systimer_update(dpcm);
+        del_timer(&dpcm->timer);
+        spin_unlock(&dpcm->lock);
+        return 0;
+}
+
+static int alsa_gpio_systimer_prepare(struct snd_pcm_substream *substream)
+{
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        struct alsa_gpio_systimer_pcm *dpcm = runtime->private_data;
+
+        dpcm->frac_frames = 0;
+        dpcm->rate = runtime->rate;
+        dpcm->frac_period_size = runtime->period_size * HZ;
+        dpcm->frac_period_rest = dpcm->frac_period_size;
+        dpcm->elapsed = 0;
+
+        return 0;
+}
+
+static void alsa_gpio_systimer_callback(struct timer_list *t)
+{
+        struct alsa_gpio_systimer_pcm *dpcm = from_timer(dpcm, t, timer);
+        unsigned long flags;
+        int elapsed = 0;
+
+        spin_lock_irqsave(&dpcm->lock, flags);
+        alsa_gpio_systimer_update(dpcm);
+        alsa_gpio_systimer_rearm(dpcm);
+        elapsed = dpcm->elapsed;
+        dpcm->elapsed = 0;
+        alsa_gpio_stream_bank(dpcm->substream,
+                        div_u64(dpcm->frac_frames, HZ));
+        spin_unlock_irqrestore(&dpcm->lock, flags);
+        if (elapsed)
+                snd_pcm_period_elapsed(dpcm->substream);
+}
+
+static snd_pcm_uframes_t alsa_gpio_systimer_pointer(struct 
+                snd_pcm_substream *substream)
+{
+        struct alsa_gpio_systimer_pcm *dpcm = substream->runtime->private_data;
+        snd_pcm_uframes_t pos;
+
+        spin_lock(&dpcm->lock);
+        alsa_gpio_systimer_update(dpcm);
+        pos = alsa_gpio_stream_pointer(substream,
+                        div_u64(dpcm->frac_frames, HZ));
+        spin_unlock(&dpcm->lock);
+        return pos;
+}
+
+static int alsa_gpio_systimer_create(struct snd_pcm_substream *substream)
+{
+        struct alsa_gpio_systimer_pcm *dpcm;
+        int err;
+
+        dpcm = kzalloc(sizeof(*dpcm), GFP_KERNEL);
+        if (!dpcm)
+                return -ENOMEM;
+        substream->runtime->private_data = dpcm;
+        timer_setup(&dpcm->timer, alsa_gpio_systimer_callback, 0);
+        spin_lock_init(&dpcm->lock);
+        dpcm->substream = substream;
+        /* frac_period_size must fit */
+        err = snd_pcm_hw_constraint_minmax(substream->runtime,
+                        SNDRV_PCM_HW_PARAM_BUFFER_SIZE, 1, UINT_MAX / HZ);
+        if (err < 0)
+                kfree(dpcm);
+        return err;
+}
+
+static void alsa_gpio_systimer_free(struct snd_pcm_substream *substream)
+{
+        kfree(substream->runtime->private_data);
+}
+
+static const struct alsa_gpio_timer_ops alsa_gpio_systimer_ops = {
+        .create =	alsa_gpio_systimer_create,
+        .free =		alsa_gpio_systimer_free,
+        .prepare =	alsa_gpio_systimer_prepare,
+        .start =	alsa_gpio_systimer_start,
+        .stop =		alsa_gpio_systimer_stop,
+        .suspend =	alsa_gpio_systimer_suspend,
+        .resume =	alsa_gpio_systimer_start,
+        .pointer =	alsa_gpio_systimer_pointer,
+};
+
+/*
+ * hrtimer interface
+ *
+ * One hrtimer per substream expiring on every period boundary. The
+ * model picks whether it expires in softirq or in hardirq context; the
+ * latter is not deferred behind other softirq work, which short
+ * periods need.
+ */
+
+struct alsa_gpio_hrtimer_pcm {
+        /* head must be the first item */
+        struct alsa_gpio_pcm_head head;
+        struct hrtimer timer;
+        enum hrtimer_mode mode;
+        atomic_t running;
+        ktime_t base_time;
+        ktime_t period_time;
+        struct snd_pcm_substream *substream;
+};
+
+static u64 alsa_gpio_hrtimer_frames(struct alsa_gpio_hrtimer_pcm *dpcm)
+{
+        return alsa_gpio_clock_frames(&dpcm->head,
+                        ktime_sub(hrtimer_cb_get_time(&dpcm->timer),
+                                dpcm->base_time));
+}
+
+static snd_pcm_uframes_t alsa_gpio_hrtimer_pointer(struct
+                snd_pcm_substream *substream)
+{
+        struct alsa_gpio_hrtimer_pcm *dpcm = substream->runtime->private_data;
+
+        return alsa_gpio_stream_pointer(substream,
+                        alsa_gpio_hrtimer_frames(dpcm));
+}
+
+static enum hrtimer_restart alsa_gpio_hrtimer_callback(struct hrtimer *timer)
+{
+        struct alsa_gpio_hrtimer_pcm *dpcm = container_of(timer,
+                        struct alsa_gpio_hrtimer_pcm, timer);
+        unsigned long flags;
+
+        if (!atomic_read(&dpcm->running))
+                return HRTIMER_NORESTART;
+        /* the stream lock keeps the pointer off a half written fill */
+        snd_pcm_stream_lock_irqsave(dpcm->substream, flags);
+        alsa_gpio_stream_bank(dpcm->substream,
+                        alsa_gpio_hrtimer_frames(dpcm));
+        snd_pcm_stream_unlock_irqrestore(dpcm->substream, flags);
+        snd_pcm_period_elapsed(dpcm->substream);
+        if (!atomic_read(&dpcm->running))
+                return HRTIMER_NORESTART;
+
+        hrtimer_forward_now(timer, dpcm->period_time);
+        return HRTIMER_RESTART;
+}
+
+/* Run as if the stream had been playing for elapsed already */
+static void alsa_gpio_hrtimer_arm(struct alsa_gpio_hrtimer_pcm *dpcm,
+                ktime_t elapsed)
+{
+        u64 periods = div64_u64(ktime_to_ns(elapsed),
+                        ktime_to_ns(dpcm->period_time)) + 1;
+
+        dpcm->base_time = ktime_sub(hrtimer_cb_get_time(&dpcm->timer),
+                        elapsed);
+        hrtimer_start(&dpcm->timer, ktime_add_ns(dpcm->base_time,
+                                periods * ktime_to_ns(dpcm->period_time)),
+                        dpcm->mode);
+        atomic_set(&dpcm->running, 1);
+}
+
+static int alsa_gpio_hrtimer_start(struct snd_pcm_substream *substream)
+{
+        alsa_gpio_hrtimer_arm(substream->runtime->private_data, 0);
+        return 0;
+}
+
+static int alsa_gpio_hrtimer_stop(struct snd_pcm_substream *substream)
+{
+        struct alsa_gpio_hrtimer_pcm *dpcm = substream->runtime->private_data;
+
+        atomic_set(&dpcm->running, 0);
+        if (!hrtimer_callback_running(&dpcm->timer))
+                hrtimer_cancel(&dpcm->timer);
+        return 0;
+}
+
+static int alsa_gpio_hrtimer_suspend(struct snd_pcm_substream *substream)
+{
+        struct alsa_gpio_hrtimer_pcm *dpcm = substream->runtime->private_data;
+
+        dpcm->head.suspended = ktime_sub(hrtimer_cb_get_time(&dpcm->timer),
+                        dpcm->base_time);
+        return alsa_gpio_hrtimer_stop(substream);
+}
+
+static int alsa_gpio_hrtimer_resume(struct snd_pcm_substream *substream)
+{
+        struct alsa_gpio_hrtimer_pcm *dpcm = substream->runtime->private_data;
+
+        alsa_gpio_hrtimer_arm(dpcm, dpcm->head.suspended);
+        return 0;
+}
+
+static int alsa_gpio_hrtimer_prepare(struct snd_pcm_substream *substream)
+{
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        struct alsa_gpio_hrtimer_pcm *dpcm = runtime->private_data;
+
+        hrtimer_cancel(&dpcm->timer);
+        dpcm->period_time = ns_to_ktime(div_u64((u64)runtime->period_size *
+                                NSEC_PER_SEC, runtime->rate));
+        alsa_gpio_clock_prepare(&dpcm->head, runtime->rate);
+        return 0;
+}
+
+static int alsa_gpio_hrtimer_create(struct snd_pcm_substream *substream)
+{
+        struct snd_alsa_gpio *alsa_gpio = snd_pcm_substream_chip(substream);
+        struct alsa_gpio_hrtimer_pcm *dpcm;
+
+        dpcm = kzalloc(sizeof(*dpcm), GFP_KERNEL);
+        if (!dpcm)
+                return -ENOMEM;
+        substream->runtime->private_data = dpcm;
+        if (alsa_gpio->model->timer == ALSA_GPIO_TIMER_HRTIMER_HARD)
+                dpcm->mode = HRTIMER_MODE_ABS_HARD;
+        else
+                dpcm->mode = HRTIMER_MODE_ABS_SOFT;
+        hrtimer_init(&dpcm->timer, CLOCK_MONOTONIC, dpcm->mode);
+        dpcm->timer.function = alsa_gpio_hrtimer_callback;
+        dpcm->substream = substream;
+        atomic_set(&dpcm->running, 0);
+        return 0;
+}
+
+static void alsa_gpio_hrtimer_free(struct snd_pcm_substream *substream)
+{
+        struct alsa_gpio_hrtimer_pcm *dpcm = substream->runtime->private_data;
+
+        hrtimer_cancel(&dpcm->timer);
+        kfree(dpcm);
+}
+
+static const struct alsa_gpio_timer_ops alsa_gpio_hrtimer_ops = {
+        .create =	alsa_gpio_hrtimer_create,
+        .free =		alsa_gpio_hrtimer_free,
+        .prepare =	alsa_gpio_hrtimer_prepare,
+        .start =	alsa_gpio_hrtimer_start,
+        .stop =		alsa_gpio_hrtimer_stop,
+        .suspend =	alsa_gpio_hrtimer_suspend,
+        .resume =	alsa_gpio_hrtimer_resume,
+        .pointer =	alsa_gpio_hrtimer_pointer,
+};
+
+/*
+ * shared tick interface
+ *
+ * Substreams are queued by their next period deadline on one hrtimer per
+ * card, so every stream that is due is serviced from a single wakeup.
+ */
+
+struct alsa_gpio_tick_pcm {
+        /* head must be the first item */
+        struct alsa_gpio_pcm_head head;
+        struct alsa_gpio_tick *tick;
+        struct timerqueue_node node;	/* expires is the next deadline */
+        struct list_head due;
+        bool queued;
+        ktime_t base_time;
+        ktime_t period_time;
+        struct snd_pcm_substream *substream;
+};
+
+/* Slack allowed when coalescing deadlines: an eighth of a period */
+static u64 alsa_gpio_tick_slack(struct alsa_gpio_tick_pcm *dpcm)
+{
+        return ktime_to_ns(dpcm->period_time) >> 3;
+}
+
+/* tick->lock must be held */
+static void alsa_gpio_tick_arm(struct alsa_gpio_tick *tick)
+{
+        struct timerqueue_node *node = timerqueue_getnext(&tick->queue);
+
+        if (!node)
+                return;
+        hrtimer_start_range_ns(&tick->timer, node->expires,
+                        alsa_gpio_tick_slack(container_of(node,
+                                        struct alsa_gpio_tick_pcm, node)),
+                        HRTIMER_MODE_ABS_SOFT);
+}
+
+static u64 alsa_gpio_tick_frames(struct alsa_gpio_tick_pcm *dpcm)
+{
+        return alsa_gpio_clock_frames(&dpcm->head,
+                        ktime_sub(ktime_get(), dpcm->base_time));
+}
+
+static snd_pcm_uframes_t alsa_gpio_tick_pointer(struct
+                snd_pcm_substream *substream)
+{
+        struct alsa_gpio_tick_pcm *dpcm = substream->runtime->private_data;
+
+        return alsa_gpio_stream_pointer(substream,
+                        alsa_gpio_tick_frames(dpcm));
+}
+
+static enum hrtimer_restart alsa_gpio_tick_callback(struct hrtimer *timer)
+{
+        struct alsa_gpio_tick *tick = container_of(timer, struct alsa_gpio_tick,
+                        timer);
+        struct alsa_gpio_tick_pcm *dpcm, *tmp;
+        struct timerqueue_node *node;
+        unsigned long flags;
+        LIST_HEAD(due);
+        ktime_t now;
+
+        now = hrtimer_cb_get_time(timer);
+        spin_lock_irqsave(&tick->lock, flags);
+        while ((node = timerqueue_getnext(&tick->queue))) {
+                dpcm = container_of(node, struct alsa_gpio_tick_pcm, node);
+                if (ktime_after(node->expires,
+                                ktime_add_ns(now, alsa_gpio_tick_slack(dpcm))))
+                        break;
+                timerqueue_del(&tick->queue, node);
+                do {
+                        node->expires = ktime_add(node->expires,
+                                        dpcm->period_time);
+                } while (!ktime_after(node->expires, now));
+                timerqueue_add(&tick->queue, node);
+                list_add_tail(&dpcm->due, &due);
+        }
+        spin_unlock_irqrestore(&tick->lock, flags);
+
+        /* stop takes tick->lock, so call into the PCM core without it */
+        list_for_each_entry_safe(dpcm, tmp, &due, due) {
+                list_del(&dpcm->due);
+                if (!READ_ONCE(dpcm->queued))
+                        continue;
+                snd_pcm_stream_lock_irqsave(dpcm->substream, flags);
+                alsa_gpio_stream_bank(dpcm->substream,
+                                alsa_gpio_tick_frames(dpcm));
+                snd_pcm_stream_unlock_irqrestore(dpcm->substream, flags);
+                snd_pcm_period_elapsed(dpcm->substream);
+        }
+
+        spin_lock_irqsave(&tick->lock, flags);
+        alsa_gpio_tick_arm(tick);
+        spin_unlock_irqrestore(&tick->lock, flags);
+        return HRTIMER_NORESTART;
+}
+
+/* Wait for a running callback, then re-arm for the remaining substreams */
+static void alsa_gpio_tick_sync(struct alsa_gpio_tick *tick)
+{
+        hrtimer_cancel(&tick->timer);
+        spin_lock_irq(&tick->lock);
+        alsa_gpio_tick_arm(tick);
+        spin_unlock_irq(&tick->lock);
+}
+
+/* Queue as if the stream had been playing for elapsed already */
+static void alsa_gpio_tick_queue(struct alsa_gpio_tick_pcm *dpcm,
+                ktime_t elapsed)
+{
+        struct alsa_gpio_tick *tick = dpcm->tick;
+        u64 periods = div64_u64(ktime_to_ns(elapsed),
+                        ktime_to_ns(dpcm->period_time)) + 1;
+
+        dpcm->base_time = ktime_sub(ktime_get(), elapsed);
+
+        spin_lock(&tick->lock);
+        dpcm->node.expires = ktime_add_ns(dpcm->base_time,
+                        periods * ktime_to_ns(dpcm->period_time));
+        WRITE_ONCE(dpcm->queued, true);
+        if (timerqueue_add(&tick->queue, &dpcm->node))
+                alsa_gpio_tick_arm(tick);
+        spin_unlock(&tick->lock);
+}
+
+static int alsa_gpio_tick_start(struct snd_pcm_substream *substream)
+{
+        alsa_gpio_tick_queue(substream->runtime->private_data, 0);
+        return 0;
+}
+
+static int alsa_gpio_tick_stop(struct snd_pcm_substream *substream)
+{
+        struct alsa_gpio_tick_pcm *dpcm = substream->runtime->private_data;
+        struct alsa_gpio_tick *tick = dpcm->tick;
+
+        spin_lock(&tick->lock);
+        if (dpcm->queued) {
+                timerqueue_del(&tick->queue, &dpcm->node);
+                WRITE_ONCE(dpcm->queued, false);
+        }
+        spin_unlock(&tick->lock);
+        return 0;
+}
+
+static int alsa_gpio_tick_suspend(struct snd_pcm_substream *substream)
+{
+        struct alsa_gpio_tick_pcm *dpcm = substream->runtime->private_data;
+
+        dpcm->head.suspended = ktime_sub(ktime_get(), dpcm->base_time);
+        return alsa_gpio_tick_stop(substream);
+}
+
+static int alsa_gpio_tick_resume(struct snd_pcm_substream *substream)
+{
+        struct alsa_gpio_tick_pcm *dpcm = substream->runtime->private_data;
+
+        alsa_gpio_tick_queue(dpcm, dpcm->head.suspended);
+        return 0;
+}
+
+static int alsa_gpio_tick_prepare(struct snd_pcm_substream *substream)
+{
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        struct alsa_gpio_tick_pcm *dpcm = runtime->private_data;
+        u64 period_ns;
+
+        alsa_gpio_tick_sync(dpcm->tick);
+        period_ns = div_u64((u64)runtime->period_size * NSEC_PER_SEC,
+                        runtime->rate);
+        dpcm->period_time = ns_to_ktime(period_ns);
+        alsa_gpio_clock_prepare(&dpcm->head, runtime->rate);
+        return 0;
+}
+
+static int alsa_gpio_tick_create(struct snd_pcm_substream *substream)
+{
+        struct snd_alsa_gpio *alsa_gpio = snd_pcm_substream_chip(substream);
+        struct alsa_gpio_tick_pcm *dpcm;
+
+        dpcm = kzalloc(sizeof(*dpcm), GFP_KERNEL);
+        if (!dpcm)
+                return -ENOMEM;
+        substream->runtime->private_data = dpcm;
+        dpcm->tick = &alsa_gpio->tick;
+        timerqueue_init(&dpcm->node);
+        INIT_LIST_HEAD(&dpcm->due);
+        dpcm->substream = substream;
+        return 0;
+}
+
+static void alsa_gpio_tick_free(struct snd_pcm_substream *substream)
+{
+        struct alsa_gpio_tick_pcm *dpcm = substream->runtime->private_data;
+
+        alsa_gpio_tick_stop(substream);
+        alsa_gpio_tick_sync(dpcm->tick);
+        kfree(dpcm);
+}
+
+static const struct alsa_gpio_timer_ops alsa_gpio_tick_ops = {
+        .create =	alsa_gpio_tick_create,
+        .free =		alsa_gpio_tick_free,
+        .prepare =	alsa_gpio_tick_prepare,
+        .start =	alsa_gpio_tick_start,
+        .stop =		alsa_gpio_tick_stop,
+        .suspend =	alsa_gpio_tick_suspend,
+        .resume =	alsa_gpio_tick_resume,
+        .pointer =	alsa_gpio_tick_pointer,
+};
+
+static void alsa_gpio_tick_init(struct alsa_gpio_tick *tick)
+{
+        spin_lock_init(&tick->lock);
+        timerqueue_init_head(&tick->queue);
+        hrtimer_init(&tick->timer, CLOCK_MONOTONIC, HRTIMER_MODE_ABS_SOFT);
+        tick->timer.function = alsa_gpio_tick_callback;
+}
+
+/*
+ * output engine
+ *
+ * Consumes the playback ring of one running substream at the sample
+ * rate and drives a GPIO line or a PWM channel with it. A GPIO line
+ * gets a 1-bit PDM stream from a first order sigma-delta modulator, a
+ * PWM channel gets its duty cycle set per sample. The engine runs in a
+ * SCHED_FIFO thread, so lines that sleep (gpio-sim, gpio-mockup, I2C
+ * expanders) work too. Every out_batch samples are read from the ring
+ * at once under emit_lock. The thread then sleeps on an absolute
+ * hrtimer deadline until the first of them is due and spaces the rest
+ * with a delay loop, holding no lock, so out_batch trades CPU time for
+ * fewer wakeups. Counters for the requested and the achieved sample
+ * rate are in /proc/asound/cardX/gpio_out.
+ */
+
+struct alsa_gpio_out {
+        struct task_struct *thread;
+        struct gpio_desc *gpio;
+        struct pwm_device *pwm;
+        unsigned int batch;
+        spinlock_t lock;		/* protects substream and the counters */
+        struct snd_pcm_substream *substream;
+        struct snd_pcm_substream *suspended;	/* to resume on */
+        struct mutex emit_lock;		/* held while reading the ring */
+        ktime_t base_time;
+        unsigned int rate;
+        u64 period_ns;			/* PWM period, one sample */
+        unsigned int acc;		/* sigma-delta accumulator */
+        u64 emitted;			/* samples put on the line */
+        u64 dropped;			/* samples skipped after falling behind */
+        u64 late;			/* samples emitted past their deadline */
+        u64 wakeups;
+        ktime_t last_time;
+};
+
+/* Most significant byte of the first channel, as unsigned */
+static unsigned int alsa_gpio_out_sample(struct snd_pcm_runtime *runtime,
+                u64 frame)
+{
+        snd_pcm_format_t format = runtime->format;
+        int width = snd_pcm_format_physical_width(format);
+        u32 pos;
+        u8 v;
+
+        div_u64_rem(frame, runtime->buffer_size, &pos);
+        v = runtime->dma_area[frames_to_bytes(runtime, pos) +
+                (snd_pcm_format_big_endian(format) > 0 ? 0 : width / 8 - 1)];
+        if (snd_pcm_format_signed(format) > 0)
+                v ^= 0x80;
+        return v;
+}
+
+static void alsa_gpio_out_put(struct alsa_gpio_out *out, unsigned int v)
+{
+        struct pwm_state state;
+
+        if (out->pwm) {
+                pwm_init_state(out->pwm, &state);
+                state.period = out->period_ns;
+                state.duty_cycle = div_u64(out->period_ns * v, 255);
+                state.enabled = true;
+                pwm_apply_state(out->pwm, &state);
+                return;
+        }
+        out->acc += v;
+        if (out->acc >= 256) {
+                out->acc -= 256;
+                gpiod_set_value_cansleep(out->gpio, 1);
+        } else {
+                gpiod_set_value_cansleep(out->gpio, 0);
+        }
+}
+
+static ktime_t alsa_gpio_out_deadline(ktime_t base, unsigned int rate,
+                u64 sample)
+{
+        return ktime_add_ns(base, div_u64(sample * NSEC_PER_SEC, rate));
+}
+
+/* Busy-wait for the gaps inside a batch, too short to sleep for */
+static void alsa_gpio_delay_until(ktime_t deadline)
+{
+        s64 ns = ktime_to_ns(ktime_sub(deadline, ktime_get()));
+        u32 rem;
+
+        if (ns <= 0)
+                return;
+        udelay(div_u64_rem(ns, NSEC_PER_USEC, &rem));
+        ndelay(rem);
+}
+
+/*
+ * Read the next batch from the ring, catching up first if we fell
+ * behind the clock. Returns the number of samples, 0 if the stream
+ * went away.
+ */
+static unsigned int alsa_gpio_out_fetch(struct alsa_gpio_out *out,
+                struct snd_pcm_substream *substream, u8 *v, u64 *first,
+                ktime_t *base, unsigned int *rate)
+{
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        unsigned int i, n = 0;
+        u64 due;
+
+        mutex_lock(&out->emit_lock);
+        spin_lock_irq(&out->lock);
+        if (out->substream == substream) {
+                due = div_u64(ktime_to_ns(ktime_sub(ktime_get(),
+                                                out->base_time)) * out->rate,
+                                NSEC_PER_SEC);
+                if (due > out->emitted + runtime->buffer_size) {
+                        out->dropped += due - out->emitted;
+                        out->emitted = due;
+                }
+                *first = out->emitted;
+                *base = out->base_time;
+                *rate = out->rate;
+                n = min_t(unsigned int, out->batch, runtime->period_size);
+        }
+        spin_unlock_irq(&out->lock);
+        for (i = 0; i < n; i++)
+                v[i] = alsa_gpio_out_sample(runtime, *first + i);
+        mutex_unlock(&out->emit_lock);
+        return n;
+}
+
+/*
+ * Put one batch on the line: sleep until its first sample is due, then
+ * delay to each following one.
+ */
+static void alsa_gpio_out_emit(struct alsa_gpio_out *out,
+                struct snd_pcm_substream *substream)
+{
+        u8 v[OUT_BATCH_MAX];
+        unsigned int i = 0, n, rate, late = 0;
+        ktime_t base, deadline;
+        u64 first;
+
+        n = alsa_gpio_out_fetch(out, substream, v, &first, &base, &rate);
+        if (!n)
+                return;
+        deadline = alsa_gpio_out_deadline(base, rate, first);
+        while (ktime_before(ktime_get(), deadline)) {
+                /* start/stop wake us early */
+                if (READ_ONCE(out->substream) != substream ||
+                    kthread_should_stop())
+                        goto out;
+                set_current_state(TASK_INTERRUPTIBLE);
+                schedule_hrtimeout_range(&deadline, 0, HRTIMER_MODE_ABS);
+        }
+        for (; i < n; i++) {
+                if (READ_ONCE(out->substream) != substream ||
+                    kthread_should_stop())
+                        break;
+                deadline = alsa_gpio_out_deadline(base, rate, first + i);
+                alsa_gpio_delay_until(deadline);
+                if (ktime_after(ktime_get(), ktime_add_ns(deadline,
+                                                NSEC_PER_SEC / rate)))
+                        late++;
+                alsa_gpio_out_put(out, v[i]);
+        }
+out:
+        spin_lock_irq(&out->lock);
+        if (out->substream == substream && out->emitted == first) {
+                out->emitted += i;
+                out->late += late;
+                out->wakeups++;
+                out->last_time = ktime_get();
+        }
+        spin_unlock_irq(&out->lock);
+}
+
+static int alsa_gpio_out_fn(void *data)
+{
+        struct alsa_gpio_out *out = data;
+        struct snd_pcm_substream *substream;
+
+        while (!kthread_should_stop()) {
+                set_current_state(TASK_INTERRUPTIBLE);
+                spin_lock_irq(&out->lock);
+                substream = out->substream;
+                spin_unlock_irq(&out->lock);
+                if (!substream) {
+                        schedule();
+                        continue;
+                }
+                __set_current_state(TASK_RUNNING);
+                alsa_gpio_out_emit(out, substream);
+        }
+        __set_current_state(TASK_RUNNING);
+        return 0;
+}
+
+/* Called from trigger; the first running playback substream is emitted */
+static void alsa_gpio_out_start(struct alsa_gpio_out *out,
+                struct snd_pcm_substream *substream, bool resume)
+{
+        unsigned long flags;
+
+        if (!out || substream->stream != SNDRV_PCM_STREAM_PLAYBACK)
+                return;
+        spin_lock_irqsave(&out->lock, flags);
+        if (!out->substream && resume && out->suspended == substream) {
+                /* carry on from the sample reached at suspend */
+                out->substream = substream;
+                out->base_time = ktime_sub_ns(ktime_get(),
+                                div_u64(out->emitted * NSEC_PER_SEC,
+                                        out->rate));
+                wake_up_process(out->thread);
+        } else if (!out->substream) {
+                out->substream = substream;
+                out->rate = substream->runtime->rate;
+                out->period_ns = div_u64(NSEC_PER_SEC, out->rate);
+                out->base_time = ktime_get();
+                out->last_time = out->base_time;
+                out->emitted = 0;
+                out->dropped = 0;
+                out->late = 0;
+                out->wakeups = 0;
+                wake_up_process(out->thread);
+        }
+        spin_unlock_irqrestore(&out->lock, flags);
+}
+
+static void alsa_gpio_out_stop(struct alsa_gpio_out *out,
+                struct snd_pcm_substream *substream, bool suspend)
+{
+        unsigned long flags;
+
+        if (!out)
+                return;
+        spin_lock_irqsave(&out->lock, flags);
+        if (out->substream == substream) {
+                out->substream = NULL;
+                out->suspended = suspend ? substream : NULL;
+                wake_up_process(out->thread);
+        }
+        spin_unlock_irqrestore(&out->lock, flags);
+}
+
+/* Wait until the engine no longer reads the ring of a stopped stream */
+static void alsa_gpio_out_sync(struct alsa_gpio_out *out)
+{
+        if (!out)
+                return;
+        mutex_lock(&out->emit_lock);
+        mutex_unlock(&out->emit_lock);
+}
+
+static void alsa_gpio_out_proc_read(struct snd_info_entry *entry,
+                struct snd_info_buffer *buffer)
+{
+        struct alsa_gpio_out *out = entry->private_data;
+        u64 elapsed, emitted, late, dropped, wakeups;
+        unsigned int rate;
 
+        spin_lock_irq(&out->lock);
+        elapsed = ktime_to_ns(ktime_sub(out->last_time, out->base_time));
+        rate = out->rate;
+        emitted = out->emitted;
+        late = out->late;
+        dropped = out->dropped;
+        wakeups = out->wakeups;
+        spin_unlock_irq(&out->lock);
+
+        snd_iprintf(buffer, "output\t\t%s %s:%u\n",
+                        out->pwm ? "pwm" : "gpio", out_chip, out_line);
+        snd_iprintf(buffer, "batch\t\t%u\n", out->batch);
+        snd_iprintf(buffer, "requested rate\t%u\n", rate);
+        snd_iprintf(buffer, "achieved rate\t%llu\n", elapsed ?
+                        div64_u64(emitted * NSEC_PER_SEC, elapsed) : 0);
+        snd_iprintf(buffer, "emitted\t\t%llu\n", emitted);
+        snd_iprintf(buffer, "late\t\t%llu\n", late);
+        snd_iprintf(buffer, "dropped\t\t%llu\n", dropped);
+        snd_iprintf(buffer, "wakeups\t\t%llu\n", wakeups);
+}
 
-struct snd_alsa_gpio {
-        struct snd_card *card;
-        struct alsa_gpio_model *model;
-        struct snd_pcm *pcm;
-        struct snd_pcm_hardware pcm_hw;
-        spinlock_t mixer_lock;
-        int mixer_volume[2];
-        int capture_source[2];
-        int iobox;
-        struct snd_kcontrol *cd_volume_ctl;
-        struct snd_kcontrol *cd_switch_ctl;
-};
+/* Look the line up by chip label, so gpio-sim and gpio-mockup work */
+static struct gpio_desc *alsa_gpio_get_line(struct device *dev,
+                const char *con_id, const char *chip, unsigned int line,
+                enum gpiod_flags flags)
+{
+        struct gpiod_lookup_table *gpios;
+        struct gpio_desc *desc;
+
+        gpios = kzalloc(struct_size(gpios, table, 2), GFP_KERNEL);
+        if (!gpios)
+                return ERR_PTR(-ENOMEM);
+        gpios->dev_id = dev_name(dev);
+        gpios->table[0] = (struct gpiod_lookup)
+                GPIO_LOOKUP(chip, line, con_id, GPIO_ACTIVE_HIGH);
+        gpiod_add_lookup_table(gpios);
+        desc = devm_gpiod_get(dev, con_id, flags);
+        gpiod_remove_lookup_table(gpios);
+        kfree(gpios);
+        return desc;
+}
+
+static int alsa_gpio_out_request(struct alsa_gpio_out *out, struct device *dev)
+{
+        struct pwm_lookup pwms[] = {
+                PWM_LOOKUP(out_chip, out_line, dev_name(dev), "out", 0,
+                                PWM_POLARITY_NORMAL),
+        };
+
+        if (out_mode == OUT_PWM) {
+                pwm_add_table(pwms, ARRAY_SIZE(pwms));
+                out->pwm = devm_pwm_get(dev, "out");
+                pwm_remove_table(pwms, ARRAY_SIZE(pwms));
+                return PTR_ERR_OR_ZERO(out->pwm);
+        }
+
+        out->gpio = alsa_gpio_get_line(dev, "out", out_chip, out_line,
+                        GPIOD_OUT_LOW);
+        return PTR_ERR_OR_ZERO(out->gpio);
+}
+
+static int alsa_gpio_out_create(struct snd_alsa_gpio *alsa_gpio,
+                struct device *dev)
+{
+        struct alsa_gpio_out *out;
+        int err;
+
+        if (out_mode == OUT_NONE)
+                return 0;
+        if (!out_chip || (out_mode != OUT_GPIO && out_mode != OUT_PWM))
+                return -EINVAL;
+
+        out = devm_kzalloc(dev, sizeof(*out), GFP_KERNEL);
+        if (!out)
+                return -ENOMEM;
+        spin_lock_init(&out->lock);
+        mutex_init(&out->emit_lock);
+        out->batch = clamp_t(unsigned int, out_batch, 1, OUT_BATCH_MAX);
+        err = alsa_gpio_out_request(out, dev);
+        if (err < 0) {
+                dev_err(dev, "cannot get output %s:%u: %d\n", out_chip,
+                                out_line, err);
+                return err;
+        }
 
+        out->thread = kthread_create(alsa_gpio_out_fn, out, "alsa_gpio/%d",
+                        alsa_gpio->card->number);
+        if (IS_ERR(out->thread))
+                return PTR_ERR(out->thread);
+        sched_set_fifo(out->thread);
+        wake_up_process(out->thread);
+        alsa_gpio->out = out;
 
+        return snd_card_ro_proc_new(alsa_gpio->card, "gpio_out", out,
+                        alsa_gpio_out_proc_read);
+}
+
+static void alsa_gpio_out_free(struct alsa_gpio_out *out)
+{
+        if (!out)
+                return;
+        kthread_stop(out->thread);
+        if (out->pwm)
+                pwm_disable(out->pwm);
+}
 
 /*
- * system timer interface
+ * input engine
+ *
+ * Captures from a GPIO line into the ring of one running capture
+ * substream and replaces the timer backend for capture: the pointer is
+ * the number of frames captured. The thread sleeps on an hrtimer
+ * deadline until in_batch frames are due and then reads all their bits
+ * back to back, outside any lock. Bit slots are not honoured within a
+ * batch: the line is sampled in a burst once per batch, which keeps
+ * wakeups at rate / in_batch whatever the bit rate, and in_batch = 1
+ * bounds the timing error to one frame. Batches read a frame or more
+ * after they were due count as late, and frames are dropped once a
+ * whole buffer is due. As a logic probe every U8 sample packs eight
+ * line reads, MSB first. As a PDM input in_decim reads go through a
+ * third order CIC decimator and come out as one U8 sample. All channels
+ * carry the same sample. Counters are in /proc/asound/cardX/gpio_in.
  */
 
-struct alsa_gpio_systimer_pcm {
-        /* ops must be the first item */
-        const struct alsa_gpio_timer_ops *timer_ops;
-        spinlock_t lock;
-        struct timer_list timer;
-        unsigned long base_time;
-        unsigned int frac_pos;	/* fractional sample position (based HZ) */
-        unsigned int frac_period_rest;
-        unsigned int frac_buffer_size;	/* buffer_size * HZ */
-        unsigned int frac_period_size;	/* period_size * HZ */
-        unsigned int rate;
-        int elapsed;
+/* Sampling state, copied out for a batch and published back with it */
+struct alsa_gpio_in_state {
+        u64 bits;			/* line reads */
+        u32 integ[3];
+        u32 comb[3];
+};
+
+struct alsa_gpio_in {
+        struct task_struct *thread;
+        struct gpio_desc *gpio;
+        unsigned int bits_per_frame;
+        unsigned int batch;
+        spinlock_t lock;		/* protects everything below */
         struct snd_pcm_substream *substream;
+        struct mutex capture_lock;	/* held while touching the ring */
+        ktime_t base_time;
+        unsigned int rate;
+        u64 frames;			/* frames captured since start */
+        u64 late;			/* batches read past their deadline */
+        u64 dropped;			/* frames skipped after falling behind */
+        u64 wakeups;
+        ktime_t last_time;
+        u32 cic_gain;			/* in_decim ^ 3 */
+        struct alsa_gpio_in_state st;
 };
 
-static void alsa_gpio_systimer_rearm(struct alsa_gpio_systimer_pcm *dpcm)
+struct alsa_gpio_in_pcm {
+        /* head must be the first item */
+        struct alsa_gpio_pcm_head head;
+        struct alsa_gpio_in *in;
+};
+
+static ktime_t alsa_gpio_in_deadline(ktime_t base, unsigned int rate,
+                u64 frame)
 {
-        mod_timer(&dpcm->timer, jiffies +
-                        (dpcm->frac_period_rest + dpcm->rate - 1) / dpcm->rate);
+        return ktime_add_ns(base, div_u64(frame * NSEC_PER_SEC, rate));
 }
 
-static void alsa_gpio_systimer_update(struct alsa_gpio_systimer_pcm *dpcm)
+static int alsa_gpio_in_read(struct alsa_gpio_in *in,
+                struct alsa_gpio_in_state *st)
 {
-        unsigned long delta;
+        st->bits++;
+        return gpiod_get_value_cansleep(in->gpio) > 0;
+}
 
-        delta = jiffies - dpcm->base_time;
-        if (!delta)
-                return;
-        dpcm->base_time += delta;
-        delta *= dpcm->rate;
-        dpcm->frac_pos += delta;
-        while (dpcm->frac_pos >= dpcm->frac_buffer_size)
-                dpcm->frac_pos -= dpcm->frac_buffer_size;
-        while (dpcm->frac_period_rest <= delta) {
-                dpcm->elapsed++;
-                dpcm->frac_period_rest += dpcm->frac_period_size;
+static u8 alsa_gpio_in_logic(struct alsa_gpio_in *in,
+                struct alsa_gpio_in_state *st)
+{
+        unsigned int i;
+        u8 v = 0;
+
+        for (i = 0; i < 8; i++)
+                v = v << 1 | alsa_gpio_in_read(in, st);
+        return v;
+}
+
+/* Integrators run at the bit rate, combs at the frame rate */
+static u8 alsa_gpio_in_pdm(struct alsa_gpio_in *in,
+                struct alsa_gpio_in_state *st)
+{
+        unsigned int i;
+        u32 y, d;
+
+        for (i = 0; i < in->bits_per_frame; i++) {
+                st->integ[0] += alsa_gpio_in_read(in, st);
+                st->integ[1] += st->integ[0];
+                st->integ[2] += st->integ[1];
         }
-        dpcm->frac_period_rest -= delta;
+        y = st->integ[2];
+        for (i = 0; i < 3; i++) {
+                d = y - st->comb[i];
+                st->comb[i] = y;
+                y = d;
+        }
+        return min_t(u64, div_u64((u64)y * 255, in->cic_gain), 255);
 }
 
-static int alsa_gpio_systimer_start(struct snd_pcm_substream *substream)
+/*
+ * Read one batch and publish it. The reads work on a copy of the
+ * sampling state; a start or stop meanwhile makes the batch stale and
+ * it is thrown away.
+ */
+static void alsa_gpio_in_capture(struct alsa_gpio_in *in,
+                struct snd_pcm_substream *substream)
 {
-        struct alsa_gpio_systimer_pcm *dpcm = substream->runtime->private_data;
-        spin_lock(&dpcm->lock);
-        buffer_counter = 0;
-        dpcm->base_time = jiffies;
-        alsa_gpio_systimer_rearm(dpcm);
-        spin_unlock(&dpcm->lock);
-        return 0;
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        struct alsa_gpio_in_state st;
+        unsigned int i, j, n = in->batch;
+        bool elapsed = false, late;
+        u8 v[IN_BATCH_MAX];
+        ktime_t base;
+        u64 first, due;
+        u32 pos;
+
+        spin_lock_irq(&in->lock);
+        if (in->substream != substream) {
+                spin_unlock_irq(&in->lock);
+                return;
+        }
+        due = div_u64(ktime_to_ns(ktime_sub(ktime_get(), in->base_time)) *
+                        in->rate, NSEC_PER_SEC);
+        if (due > in->frames + runtime->buffer_size) {
+                in->dropped += due - in->frames;
+                in->frames = due;
+        }
+        first = in->frames;
+        base = in->base_time;
+        late = due > first + n;
+        st = in->st;
+        spin_unlock_irq(&in->lock);
+
+        for (i = 0; i < n; i++) {
+                if (READ_ONCE(in->substream) != substream ||
+                    kthread_should_stop())
+                        break;
+                if (in->bits_per_frame == 8)
+                        v[i] = alsa_gpio_in_logic(in, &st);
+                else
+                        v[i] = alsa_gpio_in_pdm(in, &st);
+        }
+
+        mutex_lock(&in->capture_lock);
+        spin_lock_irq(&in->lock);
+        if (in->substream == substream && in->frames == first &&
+            in->base_time == base) {
+                for (j = 0; j < i; j++) {
+                        div_u64_rem(first + j, runtime->buffer_size, &pos);
+                        memset(runtime->dma_area +
+                                        frames_to_bytes(runtime, pos), v[j],
+                                        frames_to_bytes(runtime, 1));
+                }
+                WRITE_ONCE(in->frames, first + i);
+                in->st = st;
+                in->late += late;
+                in->wakeups++;
+                in->last_time = ktime_get();
+                elapsed = div_u64(first, runtime->period_size) !=
+                        div_u64(first + i, runtime->period_size);
+        }
+        spin_unlock_irq(&in->lock);
+        if (elapsed)
+                snd_pcm_period_elapsed(substream);
+        mutex_unlock(&in->capture_lock);
 }
 
-static int alsa_gpio_systimer_stop(struct snd_pcm_substream *substream)
+static int alsa_gpio_in_fn(void *data)
 {
-        struct alsa_gpio_systimer_pcm *dpcm = substream->runtime->private_data;
-        spin_lock(&dpcm->lock);
-        del_timer(&dpcm->timer);
-        spin_unlock(&dpcm->lock);
+        struct alsa_gpio_in *in = data;
+        struct snd_pcm_substream *substream;
+        ktime_t expires;
+
+        while (!kthread_should_stop()) {
+                set_current_state(TASK_INTERRUPTIBLE);
+                spin_lock_irq(&in->lock);
+                substream = in->substream;
+                /* the last frame of the next batch has been sampled */
+                if (substream)
+                        expires = alsa_gpio_in_deadline(in->base_time,
+                                        in->rate, in->frames + in->batch);
+                spin_unlock_irq(&in->lock);
+                if (!substream) {
+                        schedule();
+                        continue;
+                }
+
+                /* start/stop wake us early, re-evaluate the stream */
+                schedule_hrtimeout_range(&expires, 0, HRTIMER_MODE_ABS);
+                if (ktime_before(ktime_get(), expires))
+                        continue;
+                alsa_gpio_in_capture(in, substream);
+        }
+        __set_current_state(TASK_RUNNING);
         return 0;
 }
 
-static int alsa_gpio_systimer_prepare(struct snd_pcm_substream *substream)
+/* One line, so one capture at a time */
+static int alsa_gpio_in_start(struct snd_pcm_substream *substream)
 {
-        struct snd_pcm_runtime *runtime = substream->runtime;
-        struct alsa_gpio_systimer_pcm *dpcm = runtime->private_data;
+        struct alsa_gpio_in *in = ((struct alsa_gpio_in_pcm *)
+                        substream->runtime->private_data)->in;
+        unsigned long flags;
+        int err = 0;
 
-        dpcm->frac_pos = 0;
-        dpcm->rate = runtime->rate;
-        dpcm->frac_buffer_size = runtime->buffer_size * HZ;
-        dpcm->frac_period_size = runtime->period_size * HZ;
-        dpcm->frac_period_rest = dpcm->frac_period_size;
-        dpcm->elapsed = 0;
+        spin_lock_irqsave(&in->lock, flags);
+        if (in->substream) {
+                err = -EBUSY;
+                goto out;
+        }
+        in->substream = substream;
+        in->rate = substream->runtime->rate;
+        in->frames = 0;
+        in->late = 0;
+        in->dropped = 0;
+        in->wakeups = 0;
+        memset(&in->st, 0, sizeof(in->st));
+        in->base_time = ktime_get();
+        in->last_time = in->base_time;
+        wake_up_process(in->thread);
+out:
+        spin_unlock_irqrestore(&in->lock, flags);
+        return err;
+}
+
+static int alsa_gpio_in_stop(struct snd_pcm_substream *substream)
+{
+        struct alsa_gpio_in *in = ((struct alsa_gpio_in_pcm *)
+                        substream->runtime->private_data)->in;
+        unsigned long flags;
 
+        spin_lock_irqsave(&in->lock, flags);
+        if (in->substream == substream) {
+                in->substream = NULL;
+                wake_up_process(in->thread);
+        }
+        spin_unlock_irqrestore(&in->lock, flags);
         return 0;
 }
 
-static void alsa_gpio_systimer_callback(struct timer_list *t)
+/* Counters and the filter state are kept, time is rebased */
+static int alsa_gpio_in_resume(struct snd_pcm_substream *substream)
 {
-        int tmp_bufsize = 0;
-        pr_info("Systimer callback\n");
-        struct alsa_gpio_systimer_pcm *dpcm = from_timer(dpcm, t, timer);
+        struct alsa_gpio_in *in = ((struct alsa_gpio_in_pcm *)
+                        substream->runtime->private_data)->in;
         unsigned long flags;
-        int elapsed = 0;
+        int err = 0;
 
-        spin_lock_irqsave(&dpcm->lock, flags);
-        alsa_gpio_systimer_update(dpcm);
-        alsa_gpio_systimer_rearm(dpcm);
-        elapsed = dpcm->elapsed;
-        dpcm->elapsed = 0;
-        
-        tmp_bufsize = dpcm->substream->runtime->dma_bytes / 2;
-
-        memcpy(dpcm->substream->runtime->dma_area, &music[tmp_bufsize * buffer_counter], 
-                        dpcm->substream->runtime->dma_bytes);
-        
-        if ((tmp_bufsize * buffer_counter) == 48000)
-                buffer_counter = 0;
-        else
-                buffer_counter++;
+        spin_lock_irqsave(&in->lock, flags);
+        if (in->substream) {
+                err = -EBUSY;
+                goto out;
+        }
+        in->substream = substream;
+        in->base_time = ktime_sub_ns(ktime_get(),
+                        div_u64(in->frames * NSEC_PER_SEC, in->rate));
+        wake_up_process(in->thread);
+out:
+        spin_unlock_irqrestore(&in->lock, flags);
+        return err;
+}
 
-        spin_unlock_irqrestore(&dpcm->lock, flags);
-        if (elapsed)
-                snd_pcm_period_elapsed(dpcm->substream);
+static int alsa_gpio_in_prepare(struct snd_pcm_substream *substream)
+{
+        return 0;
 }
 
-static snd_pcm_uframes_t alsa_gpio_systimer_pointer(struct 
+static snd_pcm_uframes_t alsa_gpio_in_pointer(struct
                 snd_pcm_substream *substream)
 {
-        struct alsa_gpio_systimer_pcm *dpcm = substream->runtime->private_data;
-        snd_pcm_uframes_t pos;
+        struct alsa_gpio_in *in = ((struct alsa_gpio_in_pcm *)
+                        substream->runtime->private_data)->in;
+        u32 pos;
 
-        spin_lock(&dpcm->lock);
-        alsa_gpio_systimer_update(dpcm);
-        pos = dpcm->frac_pos / HZ;
-        pr_info("Pointer: %ld",pos);
-        spin_unlock(&dpcm->lock);
+        if (READ_ONCE(in->substream) != substream)
+                return 0;
+        div_u64_rem(READ_ONCE(in->frames), substream->runtime->buffer_size,
+                        &pos);
         return pos;
 }
 
-static int alsa_gpio_systimer_create(struct snd_pcm_substream *substream)
+static int alsa_gpio_in_create(struct snd_pcm_substream *substream)
 {
-        struct alsa_gpio_systimer_pcm *dpcm;
+        struct snd_alsa_gpio *alsa_gpio = snd_pcm_substream_chip(substream);
+        struct alsa_gpio_in_pcm *dpcm;
 
         dpcm = kzalloc(sizeof(*dpcm), GFP_KERNEL);
         if (!dpcm)
                 return -ENOMEM;
+        dpcm->in = alsa_gpio->in;
         substream->runtime->private_data = dpcm;
-        timer_setup(&dpcm->timer, alsa_gpio_systimer_callback, 0);
-        spin_lock_init(&dpcm->lock);
-        dpcm->substream = substream;
         return 0;
 }
 
-static void alsa_gpio_systimer_free(struct snd_pcm_substream *substream)
+/* Wait until the engine no longer reads the ring of a stopped stream */
+static void alsa_gpio_in_sync(struct alsa_gpio_in *in)
 {
-        kfree(substream->runtime->private_data);
+        if (!in)
+                return;
+        mutex_lock(&in->capture_lock);
+        mutex_unlock(&in->capture_lock);
 }
 
-static const struct alsa_gpio_timer_ops alsa_gpio_systimer_ops = {
-        .create =	alsa_gpio_systimer_create,
-        .free =		alsa_gpio_systimer_free,
-        .prepare =	alsa_gpio_systimer_prepare,
-        .start =	alsa_gpio_systimer_start,
-        .stop =		alsa_gpio_systimer_stop,
-        .pointer =	alsa_gpio_systimer_pointer,
+static void alsa_gpio_in_free(struct snd_pcm_substream *substream)
+{
+        struct alsa_gpio_in_pcm *dpcm = substream->runtime->private_data;
+
+        alsa_gpio_in_stop(substream);
+        alsa_gpio_in_sync(dpcm->in);
+        kfree(dpcm);
+}
+
+static const struct alsa_gpio_timer_ops alsa_gpio_in_ops = {
+        .create =	alsa_gpio_in_create,
+        .free =		alsa_gpio_in_free,
+        .prepare =	alsa_gpio_in_prepare,
+        .start =	alsa_gpio_in_start,
+        .stop =		alsa_gpio_in_stop,
+        .suspend =	alsa_gpio_in_stop,
+        .resume =	alsa_gpio_in_resume,
+        .pointer =	alsa_gpio_in_pointer,
 };
 
+static void alsa_gpio_in_proc_read(struct snd_info_entry *entry,
+                struct snd_info_buffer *buffer)
+{
+        struct alsa_gpio_in *in = entry->private_data;
+        u64 elapsed;
+
+        mutex_lock(&in->capture_lock);
+        elapsed = ktime_to_ns(ktime_sub(in->last_time, in->base_time));
+        snd_iprintf(buffer, "input\t\t%s %s:%u\n",
+                        in->bits_per_frame == 8 ? "logic" : "pdm",
+                        in_chip, in_line);
+        snd_iprintf(buffer, "batch\t\t%u\n", in->batch);
+        snd_iprintf(buffer, "requested rate\t%u\n", in->rate);
+        snd_iprintf(buffer, "achieved rate\t%llu\n", elapsed ?
+                        div64_u64(in->frames * NSEC_PER_SEC, elapsed) : 0);
+        snd_iprintf(buffer, "bit rate\t%llu\n", elapsed ?
+                        div64_u64(in->st.bits * NSEC_PER_SEC, elapsed) : 0);
+        snd_iprintf(buffer, "frames\t\t%llu\n", in->frames);
+        snd_iprintf(buffer, "late\t\t%llu\n", in->late);
+        snd_iprintf(buffer, "dropped\t\t%llu\n", in->dropped);
+        snd_iprintf(buffer, "wakeups\t\t%llu\n", in->wakeups);
+        mutex_unlock(&in->capture_lock);
+}
+
+static int alsa_gpio_in_new(struct snd_alsa_gpio *alsa_gpio,
+                struct device *dev)
+{
+        struct alsa_gpio_in *in;
+
+        if (in_mode == IN_NONE)
+                return 0;
+        if (!in_chip || (in_mode != IN_LOGIC && in_mode != IN_PDM) ||
+            (in_mode == IN_PDM && (in_decim < 2 || in_decim > IN_DECIM_MAX)))
+                return -EINVAL;
+
+        in = devm_kzalloc(dev, sizeof(*in), GFP_KERNEL);
+        if (!in)
+                return -ENOMEM;
+        spin_lock_init(&in->lock);
+        mutex_init(&in->capture_lock);
+        in->batch = clamp_t(unsigned int, in_batch, 1, IN_BATCH_MAX);
+        in->bits_per_frame = in_mode == IN_LOGIC ? 8 : in_decim;
+        in->cic_gain = in_decim * in_decim * in_decim;
+        in->gpio = alsa_gpio_get_line(dev, "in", in_chip, in_line, GPIOD_IN);
+        if (IS_ERR(in->gpio)) {
+                dev_err(dev, "cannot get input %s:%u: %ld\n", in_chip,
+                                in_line, PTR_ERR(in->gpio));
+                return PTR_ERR(in->gpio);
+        }
+
+        in->thread = kthread_create(alsa_gpio_in_fn, in, "alsa_gpio_in/%d",
+                        alsa_gpio->card->number);
+        if (IS_ERR(in->thread))
+                return PTR_ERR(in->thread);
+        sched_set_fifo(in->thread);
+        wake_up_process(in->thread);
+        alsa_gpio->in = in;
+
+        return snd_card_ro_proc_new(alsa_gpio->card, "gpio_in", in,
+                        alsa_gpio_in_proc_read);
+}
+
+static void alsa_gpio_in_destroy(struct alsa_gpio_in *in)
+{
+        if (in)
+                kthread_stop(in->thread);
+}
+
 /*
  * PCM interface
  */
 
 static int alsa_gpio_pcm_trigger(struct snd_pcm_substream *substream, int cmd)
 {
+        struct snd_alsa_gpio *alsa_gpio = snd_pcm_substream_chip(substream);
+
         pr_info("PCM triggerd\n");
         switch (cmd) {
                 case SNDRV_PCM_TRIGGER_START:
-                case SNDRV_PCM_TRIGGER_RESUME:
+                        alsa_gpio_out_start(alsa_gpio->out, substream, false);
                         return get_alsa_gpio_ops(substream)->start(substream);
+                case SNDRV_PCM_TRIGGER_RESUME:
+                        alsa_gpio_out_start(alsa_gpio->out, substream, true);
+                        return get_alsa_gpio_ops(substream)->resume(substream);
                 case SNDRV_PCM_TRIGGER_STOP:
-                case SNDRV_PCM_TRIGGER_SUSPEND:
                         pr_info("Stopping timer\n");
+                        alsa_gpio_out_stop(alsa_gpio->out, substream, false);
                         return get_alsa_gpio_ops(substream)->stop(substream);
+                case SNDRV_PCM_TRIGGER_SUSPEND:
+                        alsa_gpio_out_stop(alsa_gpio->out, substream, true);
+                        return get_alsa_gpio_ops(substream)->suspend(substream);
         }
         return -EINVAL;
 }
 
+/* Playback and the input engine's capture never read the bank */
+static bool alsa_gpio_streams_bank(struct snd_pcm_substream *substream)
+{
+        return substream->stream == SNDRV_PCM_STREAM_CAPTURE &&
+                get_alsa_gpio_ops(substream) != &alsa_gpio_in_ops;
+}
+
 static int alsa_gpio_pcm_prepare(struct snd_pcm_substream *substream)
 {
-        return get_alsa_gpio_ops(substream)->prepare(substream);
+        struct alsa_gpio_pcm_head *head;
+        int err;
+
+        err = get_alsa_gpio_ops(substream)->prepare(substream);
+        if (err < 0)
+                return err;
+        head = get_alsa_gpio_head(substream);
+        alsa_gpio_bank_put(head->bank);
+        head->bank = NULL;
+        if (alsa_gpio_streams_bank(substream)) {
+                head->bank = alsa_gpio_bank_get(substream);
+                if (IS_ERR(head->bank)) {
+                        err = PTR_ERR(head->bank);
+                        head->bank = NULL;
+                        return err;
+                }
+        }
+        alsa_gpio_stream_reset(substream);
+        alsa_gpio_stream_bank(substream, 0);
+        return 0;
 }
 
 static snd_pcm_uframes_t alsa_gpio_pcm_pointer(struct snd_pcm_substream *substream)
@@ -291,6 +2334,10 @@ static int alsa_gpio_pcm_hw_params(struct snd_pcm_substream *substream,
 
 static int alsa_gpio_pcm_hw_free(struct snd_pcm_substream *substream)
 {
+        struct snd_alsa_gpio *alsa_gpio = snd_pcm_substream_chip(substream);
+
+        alsa_gpio_out_sync(alsa_gpio->out);
+        alsa_gpio_in_sync(alsa_gpio->in);
         return snd_pcm_lib_free_pages(substream);
 }
 
@@ -302,13 +2349,22 @@ static int alsa_gpio_pcm_open(struct snd_pcm_substream *substream)
         const struct alsa_gpio_timer_ops *ops;
         int err;
 
-        ops = &alsa_gpio_systimer_ops;
+        if (alsa_gpio->in && substream->stream == SNDRV_PCM_STREAM_CAPTURE)
+                ops = &alsa_gpio_in_ops;
+        else if (shared_tick)
+                ops = &alsa_gpio_tick_ops;
+        else if (!model || model->timer == ALSA_GPIO_TIMER_SYSTIMER)
+                ops = &alsa_gpio_systimer_ops;
+        else
+                ops = &alsa_gpio_hrtimer_ops;
         err = ops->create(substream);
         if (err < 0)
                 return err;
         get_alsa_gpio_ops(substream) = ops;
 
         runtime->hw = alsa_gpio->pcm_hw;
+        if (ops == &alsa_gpio_in_ops)
+                runtime->hw.formats &= SNDRV_PCM_FMTBIT_U8;
         if (substream->pcm->device & 1) {
                 runtime->hw.info &= ~SNDRV_PCM_INFO_INTERLEAVED;
                 runtime->hw.info |= SNDRV_PCM_INFO_NONINTERLEAVED;
@@ -336,6 +2392,7 @@ static int alsa_gpio_pcm_open(struct snd_pcm_substream *substream)
 
 static int alsa_gpio_pcm_close(struct snd_pcm_substream *substream)
 {
+        alsa_gpio_bank_put(get_alsa_gpio_head(substream)->bank);
         get_alsa_gpio_ops(substream)->free(substream);
         return 0;
 }
@@ -376,19 +2433,137 @@ static int snd_card_alsa_gpio_pcm(struct snd_alsa_gpio *alsa_gpio, int device,
         strcpy(pcm->name, "alsa_gpio PCM");
 
         snd_pcm_lib_preallocate_pages_for_all(pcm,
-                        SNDRV_DMA_TYPE_CONTINUOUS,
-                        snd_dma_continuous_data(GFP_KERNEL),
-                        0, 64*1024);
+                        SNDRV_DMA_TYPE_VMALLOC, NULL,
+                        (size_t)prealloc_kb * 1024,
+                        (size_t)buffer_max_kb * 1024);
+
+        return 0;
+}
+
+
+/*
+ * Mixer interface
+ */
+
+static const DECLARE_TLV_DB_LINEAR(alsa_gpio_db_linear, TLV_DB_GAIN_MUTE, 0);
+
+static int alsa_gpio_volume_info(struct snd_kcontrol *kcontrol,
+                struct snd_ctl_elem_info *uinfo)
+{
+        uinfo->type = SNDRV_CTL_ELEM_TYPE_INTEGER;
+        uinfo->count = 2;
+        uinfo->value.integer.min = 0;
+        uinfo->value.integer.max = GAIN_UNITY;
+        return 0;
+}
+
+static int alsa_gpio_volume_get(struct snd_kcontrol *kcontrol,
+                struct snd_ctl_elem_value *ucontrol)
+{
+        struct snd_alsa_gpio *alsa_gpio = snd_kcontrol_chip(kcontrol);
+
+        spin_lock_irq(&alsa_gpio->mixer_lock);
+        ucontrol->value.integer.value[0] = alsa_gpio->mixer_volume[0];
+        ucontrol->value.integer.value[1] = alsa_gpio->mixer_volume[1];
+        spin_unlock_irq(&alsa_gpio->mixer_lock);
+        return 0;
+}
+
+static int alsa_gpio_volume_put(struct snd_kcontrol *kcontrol,
+                struct snd_ctl_elem_value *ucontrol)
+{
+        struct snd_alsa_gpio *alsa_gpio = snd_kcontrol_chip(kcontrol);
+        long left = ucontrol->value.integer.value[0];
+        long right = ucontrol->value.integer.value[1];
+        int change;
+
+        if (left < 0 || left > GAIN_UNITY || right < 0 || right > GAIN_UNITY)
+                return -EINVAL;
+        spin_lock_irq(&alsa_gpio->mixer_lock);
+        change = alsa_gpio->mixer_volume[0] != left ||
+                alsa_gpio->mixer_volume[1] != right;
+        alsa_gpio->mixer_volume[0] = left;
+        alsa_gpio->mixer_volume[1] = right;
+        spin_unlock_irq(&alsa_gpio->mixer_lock);
+        return change;
+}
+
+static int alsa_gpio_switch_get(struct snd_kcontrol *kcontrol,
+                struct snd_ctl_elem_value *ucontrol)
+{
+        struct snd_alsa_gpio *alsa_gpio = snd_kcontrol_chip(kcontrol);
 
+        spin_lock_irq(&alsa_gpio->mixer_lock);
+        ucontrol->value.integer.value[0] = alsa_gpio->capture_source[0];
+        ucontrol->value.integer.value[1] = alsa_gpio->capture_source[1];
+        spin_unlock_irq(&alsa_gpio->mixer_lock);
         return 0;
 }
 
+static int alsa_gpio_switch_put(struct snd_kcontrol *kcontrol,
+                struct snd_ctl_elem_value *ucontrol)
+{
+        struct snd_alsa_gpio *alsa_gpio = snd_kcontrol_chip(kcontrol);
+        int left = !!ucontrol->value.integer.value[0];
+        int right = !!ucontrol->value.integer.value[1];
+        int change;
+
+        spin_lock_irq(&alsa_gpio->mixer_lock);
+        change = alsa_gpio->capture_source[0] != left ||
+                alsa_gpio->capture_source[1] != right;
+        alsa_gpio->capture_source[0] = left;
+        alsa_gpio->capture_source[1] = right;
+        spin_unlock_irq(&alsa_gpio->mixer_lock);
+        return change;
+}
+
+static const struct snd_kcontrol_new alsa_gpio_controls[] = {
+{
+        .iface = SNDRV_CTL_ELEM_IFACE_MIXER,
+        .name = "Capture Volume",
+        .access = SNDRV_CTL_ELEM_ACCESS_READWRITE |
+                SNDRV_CTL_ELEM_ACCESS_TLV_READ,
+        .info = alsa_gpio_volume_info,
+        .get = alsa_gpio_volume_get,
+        .put = alsa_gpio_volume_put,
+        .tlv = { .p = alsa_gpio_db_linear },
+},
+{
+        .iface = SNDRV_CTL_ELEM_IFACE_MIXER,
+        .name = "Capture Switch",
+        .info = snd_ctl_boolean_stereo_info,
+        .get = alsa_gpio_switch_get,
+        .put = alsa_gpio_switch_put,
+},
+};
+
+static int snd_card_alsa_gpio_new_mixer(struct snd_alsa_gpio *alsa_gpio)
+{
+        struct snd_card *card = alsa_gpio->card;
+        unsigned int i;
+        int err;
+
+        spin_lock_init(&alsa_gpio->mixer_lock);
+        alsa_gpio->mixer_volume[0] = alsa_gpio->mixer_volume[1] = GAIN_UNITY;
+        alsa_gpio->capture_source[0] = alsa_gpio->capture_source[1] = 1;
+        strcpy(card->mixername, "Alsa-GPIO Mixer");
+
+        for (i = 0; i < ARRAY_SIZE(alsa_gpio_controls); i++) {
+                err = snd_ctl_add(card, snd_ctl_new1(&alsa_gpio_controls[i],
+                                        alsa_gpio));
+                if (err < 0)
+                        return err;
+        }
+        return 0;
+}
 
 static int alsa_gpio_probe(struct platform_device *dev)
 {
         struct snd_card *card;
         struct snd_alsa_gpio *alsa_gpio;
-        struct alsa_gpio_model *m = NULL;
+        struct alsa_gpio_model *m = NULL, **mdl;
+        struct alsa_gpio_out *out;
+        struct alsa_gpio_in *in;
         int err;
 
         pr_info("Probing sound driver\n");
@@ -401,13 +2576,39 @@ static int alsa_gpio_probe(struct platform_device *dev)
 
         alsa_gpio = card->private_data;
         alsa_gpio->card = card;
-        m = alsa_gpio->model = &model_gpio;
+        alsa_gpio_tick_init(&alsa_gpio->tick);
+        m = &model_gpio;
+        if (model_param) {
+                for (mdl = alsa_gpio_models; *mdl; mdl++) {
+                        if (strcmp(model_param, (*mdl)->name) == 0)
+                                break;
+                }
+                if (*mdl)
+                        m = *mdl;
+                else
+                        dev_warn(&dev->dev, "unknown model %s, using %s\n",
+                                        model_param, m->name);
+        }
+        pr_info("Using model '%s'\n", m->name);
+        alsa_gpio->model = m;
 
-        snd_card_alsa_gpio_pcm(alsa_gpio, 0, pcm_substream);
+        err = alsa_gpio_out_create(alsa_gpio, &dev->dev);
+        if (err < 0)
+                goto error;
+        err = alsa_gpio_in_new(alsa_gpio, &dev->dev);
+        if (err < 0)
+                goto error;
+
+        err = snd_card_alsa_gpio_pcm(alsa_gpio, 0, pcm_substream);
+        if (err < 0)
+                goto error;
+        err = snd_card_alsa_gpio_new_mixer(alsa_gpio);
         if (err < 0)
                 goto error;
 
         alsa_gpio->pcm_hw = alsa_gpio_pcm_hardware;
+        alsa_gpio->pcm_hw.buffer_bytes_max = (size_t)buffer_max_kb * 1024;
+        alsa_gpio->pcm_hw.period_bytes_max = alsa_gpio->pcm_hw.buffer_bytes_max;
         if (m) {
                 if (m->formats)
                         alsa_gpio->pcm_hw.formats = m->formats;
@@ -447,22 +2648,64 @@ static int alsa_gpio_probe(struct platform_device *dev)
         }
 
 error:
+        out = alsa_gpio->out;
+        in = alsa_gpio->in;
         snd_card_free(card);
+        alsa_gpio_in_destroy(in);
+        alsa_gpio_out_free(out);
         return err;
 }
 
 static int alsa_gpio_remove(struct platform_device *dev)
 {
+        struct snd_card *card = platform_get_drvdata(dev);
+        struct snd_alsa_gpio *alsa_gpio = card->private_data;
+        struct alsa_gpio_out *out = alsa_gpio->out;
+        struct alsa_gpio_in *in = alsa_gpio->in;
+
         pr_info("Removing sound driver\n");
-        snd_card_free(platform_get_drvdata(dev));
+        hrtimer_cancel(&alsa_gpio->tick.timer);
+        /* closing the streams still wakes the engine threads */
+        snd_card_free(card);
+        alsa_gpio_in_destroy(in);
+        alsa_gpio_out_free(out);
+        return 0;
+}
+
+#ifdef CONFIG_PM_SLEEP
+/*
+ * The PCM core suspends the running streams before us; the backends keep
+ * their position and the bank cursor, so RESUME carries on without a
+ * prepare
+ */
+static int alsa_gpio_suspend(struct device *pdev)
+{
+        struct snd_card *card = dev_get_drvdata(pdev);
+
+        snd_power_change_state(card, SNDRV_CTL_POWER_D3hot);
         return 0;
 }
 
+static int alsa_gpio_resume(struct device *pdev)
+{
+        struct snd_card *card = dev_get_drvdata(pdev);
+
+        snd_power_change_state(card, SNDRV_CTL_POWER_D0);
+        return 0;
+}
+
+static SIMPLE_DEV_PM_OPS(alsa_gpio_pm, alsa_gpio_suspend, alsa_gpio_resume);
+#define ALSA_GPIO_PM_OPS	&alsa_gpio_pm
+#else
+#define ALSA_GPIO_PM_OPS	NULL
+#endif
+
 static struct platform_driver alsa_gpio_driver = {
         .probe = alsa_gpio_probe,
         .remove = alsa_gpio_remove,
         .driver = {
                 .name = DRIVER_NAME,
+                .pm = ALSA_GPIO_PM_OPS,
         },
 };
 
@@ -472,6 +2715,13 @@ static int __init alsa_gpio_init(void)
 {
         int ret = 0;
 
+        if (buffer_max_kb < 1 || prealloc_kb < 0 ||
+            prealloc_kb > buffer_max_kb) {
+                pr_err("Invalid buffer sizes %d/%d KiB\n", prealloc_kb,
+                                buffer_max_kb);
+                return -EINVAL;
+        }
+
         // Register platform driver
         ret = platform_driver_register(&alsa_gpio_driver);
         if (ret < 0) goto end;
@@ -1,2672 +0,0 @@
-#define music_length 48000
-const char music [] = {
-        0x2F, 0x00, 0x2F, 0x00, 0x93, 0x08, 0x93, 0x08, 0x1D, 0x14, 0x1D, 0x14, 0xA3, 0x1E, 0xA3, 0x1E, 0x77, 0x29,
-        0x77, 0x29, 0x96, 0x33, 0x96, 0x33, 0xA6, 0x3D, 0xA6, 0x3D, 0xF9, 0x46, 0xF9, 0x46, 0x01, 0x50, 0x01, 0x50,
-        0x3D, 0x58, 0x3D, 0x58, 0xFD, 0x5F, 0xFD, 0x5F, 0xDE, 0x66, 0xDE, 0x66, 0x1E, 0x6D, 0x1E, 0x6D, 0x6E, 0x72,
-        0x6E, 0x72, 0xFF, 0x76, 0xFF, 0x76, 0x96, 0x7A, 0x96, 0x7A, 0x56, 0x7D, 0x56, 0x7D, 0x16, 0x7F, 0x16, 0x7F,
-        0xF2, 0x7F, 0xF2, 0x7F, 0xCD, 0x7F, 0xCD, 0x7F, 0xBE, 0x7E, 0xBE, 0x7E, 0xB6, 0x7C, 0xB6, 0x7C, 0xC4, 0x79,
-        0xC4, 0x79, 0xE7, 0x75, 0xE7, 0x75, 0x2B, 0x71, 0x2B, 0x71, 0x95, 0x6B, 0x95, 0x6B, 0x32, 0x65, 0x32, 0x65,
-        0x0F, 0x5E, 0x0F, 0x5E, 0x36, 0x56, 0x36, 0x56, 0xBC, 0x4D, 0xBC, 0x4D, 0xA9, 0x44, 0xA9, 0x44, 0x18, 0x3B,
-        0x18, 0x3B, 0x11, 0x31, 0x11, 0x31, 0xB1, 0x26, 0xB1, 0x26, 0x02, 0x1C, 0x02, 0x1C, 0x24, 0x11, 0x24, 0x11,
-        0x1E, 0x06, 0x1E, 0x06, 0x14, 0xFB, 0x14, 0xFB, 0x0D, 0xF0, 0x0D, 0xF0, 0x29, 0xE5, 0x29, 0xE5, 0x73, 0xDA,
-        0x73, 0xDA, 0x0B, 0xD0, 0x0B, 0xD0, 0xF9, 0xC5, 0xF9, 0xC5, 0x5A, 0xBC, 0x5A, 0xBC, 0x39, 0xB3, 0x39, 0xB3,
-        0xAD, 0xAA, 0xAD, 0xAA, 0xC2, 0xA2, 0xC2, 0xA2, 0x8B, 0x9B, 0x8B, 0x9B, 0x12, 0x95, 0x12, 0x95, 0x67, 0x8F,
-        0x67, 0x8F, 0x91, 0x8A, 0x91, 0x8A, 0x9D, 0x86, 0x9D, 0x86, 0x8F, 0x83, 0x8F, 0x83, 0x71, 0x81, 0x71, 0x81,
-        0x42, 0x80, 0x42, 0x80, 0x09, 0x80, 0x09, 0x80, 0xC3, 0x80, 0xC3, 0x80, 0x71, 0x82, 0x71, 0x82, 0x0E, 0x85,
-        0x0E, 0x85, 0x96, 0x88, 0x96, 0x88, 0x03, 0x8D, 0x03, 0x8D, 0x4B, 0x92, 0x4B, 0x92, 0x64, 0x98, 0x64, 0x98,
-        0x43, 0x9F, 0x43, 0x9F, 0xDB, 0xA6, 0xDB, 0xA6, 0x1D, 0xAF, 0x1D, 0xAF, 0xFA, 0xB7, 0xFA, 0xB7, 0x60, 0xC1,
-        0x60, 0xC1, 0x3E, 0xCB, 0x3E, 0xCB, 0x80, 0xD5, 0x80, 0xD5, 0x14, 0xE0, 0x14, 0xE0, 0xE4, 0xEA, 0xE4, 0xEA,
-        0xDD, 0xF5, 0xDD, 0xF5, 0xE9, 0x00, 0xE9, 0x00, 0xF3, 0x0B, 0xF3, 0x0B, 0xE6, 0x16, 0xE6, 0x16, 0xAE, 0x21,
-        0xAE, 0x21, 0x36, 0x2C, 0x36, 0x2C, 0x69, 0x36, 0x69, 0x36, 0x35, 0x40, 0x35, 0x40, 0x85, 0x49, 0x85, 0x49,
-        0x4A, 0x52, 0x4A, 0x52, 0x71, 0x5A, 0x71, 0x5A, 0xEB, 0x61, 0xEB, 0x61, 0xAA, 0x68, 0xAA, 0x68, 0xA2, 0x6E,
-        0xA2, 0x6E, 0xC6, 0x73, 0xC6, 0x73, 0x0E, 0x78, 0x0E, 0x78, 0x70, 0x7B, 0x70, 0x7B, 0xE7, 0x7D, 0xE7, 0x7D,
-        0x6C, 0x7F, 0x6C, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x47, 0x7E, 0x47, 0x7E, 0x00, 0x7C,
-        0x00, 0x7C, 0xCD, 0x78, 0xCD, 0x78, 0xB2, 0x74, 0xB2, 0x74, 0xBA, 0x6F, 0xBA, 0x6F, 0xEB, 0x69, 0xEB, 0x69,
-        0x53, 0x63, 0x53, 0x63, 0xFC, 0x5B, 0xFC, 0x5B, 0xF6, 0x53, 0xF6, 0x53, 0x50, 0x4B, 0x50, 0x4B, 0x1A, 0x42,
-        0x1A, 0x42, 0x66, 0x38, 0x66, 0x38, 0x46, 0x2E, 0x46, 0x2E, 0xCD, 0x23, 0xCD, 0x23, 0x10, 0x19, 0x10, 0x19,
-        0x24, 0x0E, 0x24, 0x0E, 0x1C, 0x03, 0x1C, 0x03, 0x10, 0xF8, 0x10, 0xF8, 0x11, 0xED, 0x11, 0xED, 0x37, 0xE2,
-        0x37, 0xE2, 0x95, 0xD7, 0x95, 0xD7, 0x41, 0xCD, 0x41, 0xCD, 0x4E, 0xC3, 0x4E, 0xC3, 0xCE, 0xB9, 0xCE, 0xB9,
-        0xD5, 0xB0, 0xD5, 0xB0, 0x73, 0xA8, 0x73, 0xA8, 0xB8, 0xA0, 0xB8, 0xA0, 0xB3, 0x99, 0xB3, 0x99, 0x71, 0x93,
-        0x71, 0x93, 0xFF, 0x8D, 0xFF, 0x8D, 0x67, 0x89, 0x67, 0x89, 0xB0, 0x85, 0xB0, 0x85, 0xE4, 0x82, 0xE4, 0x82,
-        0x05, 0x81, 0x05, 0x81, 0x1B, 0x80, 0x1B, 0x80, 0x23, 0x80, 0x23, 0x80, 0x21, 0x81, 0x21, 0x81, 0x10, 0x83,
-        0x10, 0x83, 0xEE, 0x85, 0xEE, 0x85, 0xB5, 0x89, 0xB5, 0x89, 0x5E, 0x8E, 0x5E, 0x8E, 0xE0, 0x93, 0xE0, 0x93,
-        0x31, 0x9A, 0x31, 0x9A, 0x44, 0xA1, 0x44, 0xA1, 0x0B, 0xA9, 0x0B, 0xA9, 0x79, 0xB1, 0x79, 0xB1, 0x7D, 0xBA,
-        0x7D, 0xBA, 0x06, 0xC4, 0x06, 0xC4, 0x01, 0xCE, 0x01, 0xCE, 0x5B, 0xD8, 0x5B, 0xD8, 0x01, 0xE3, 0x01, 0xE3,
-        0xDF, 0xED, 0xDF, 0xED, 0xE0, 0xF8, 0xE0, 0xF8, 0xED, 0x03, 0xED, 0x03, 0xF3, 0x0E, 0xF3, 0x0E, 0xDD, 0x19,
-        0xDD, 0x19, 0x95, 0x24, 0x95, 0x24, 0x07, 0x2F, 0x07, 0x2F, 0x20, 0x39, 0x20, 0x39, 0xCC, 0x42, 0xCC, 0x42,
-        0xF8, 0x4B, 0xF8, 0x4B, 0x93, 0x54, 0x93, 0x54, 0x8D, 0x5C, 0x8D, 0x5C, 0xD5, 0x63, 0xD5, 0x63, 0x60, 0x6A,
-        0x60, 0x6A, 0x1F, 0x70, 0x1F, 0x70, 0x08, 0x75, 0x08, 0x75, 0x11, 0x79, 0x11, 0x79, 0x34, 0x7C, 0x34, 0x7C,
-        0x68, 0x7E, 0x68, 0x7E, 0xAD, 0x7F, 0xAD, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0x58, 0x7F, 0x58, 0x7F, 0xC0, 0x7D,
-        0xC0, 0x7D, 0x38, 0x7B, 0x38, 0x7B, 0xC5, 0x77, 0xC5, 0x77, 0x6D, 0x73, 0x6D, 0x73, 0x39, 0x6E, 0x39, 0x6E,
-        0x32, 0x68, 0x32, 0x68, 0x65, 0x61, 0x65, 0x61, 0xDD, 0x59, 0xDD, 0x59, 0xAA, 0x51, 0xAA, 0x51, 0xDB, 0x48,
-        0xDB, 0x48, 0x80, 0x3F, 0x80, 0x3F, 0xAD, 0x35, 0xAD, 0x35, 0x72, 0x2B, 0x72, 0x2B, 0xE5, 0x20, 0xE5, 0x20,
-        0x19, 0x16, 0x19, 0x16, 0x23, 0x0B, 0x23, 0x0B, 0x18, 0x00, 0x18, 0x00, 0x0D, 0xF5, 0x0D, 0xF5, 0x17, 0xEA,
-        0x17, 0xEA, 0x4A, 0xDF, 0x4A, 0xDF, 0xBC, 0xD4, 0xBC, 0xD4, 0x80, 0xCA, 0x80, 0xCA, 0xAA, 0xC0, 0xAA, 0xC0,
-        0x4E, 0xB7, 0x4E, 0xB7, 0x7C, 0xAE, 0x7C, 0xAE, 0x47, 0xA6, 0x47, 0xA6, 0xBC, 0x9E, 0xBC, 0x9E, 0xEB, 0x97,
-        0xEB, 0x97, 0xE0, 0x91, 0xE0, 0x91, 0xA8, 0x8C, 0xA8, 0x8C, 0x4C, 0x88, 0x4C, 0x88, 0xD5, 0x84, 0xD5, 0x84,
-        0x49, 0x82, 0x49, 0x82, 0xAE, 0x80, 0xAE, 0x80, 0x05, 0x80, 0x05, 0x80, 0x51, 0x80, 0x51, 0x80, 0x90, 0x81,
-        0x90, 0x81, 0xC1, 0x83, 0xC1, 0x83, 0xDF, 0x86, 0xDF, 0x86, 0xE5, 0x8A, 0xE5, 0x8A, 0xCA, 0x8F, 0xCA, 0x8F,
-        0x85, 0x95, 0x85, 0x95, 0x0C, 0x9C, 0x0C, 0x9C, 0x52, 0xA3, 0x52, 0xA3, 0x48, 0xAB, 0x48, 0xAB, 0xE1, 0xB3,
-        0xE1, 0xB3, 0x0A, 0xBD, 0x0A, 0xBD, 0xB4, 0xC6, 0xB4, 0xC6, 0xCB, 0xD0, 0xCB, 0xD0, 0x3C, 0xDB, 0x3C, 0xDB,
-        0xF4, 0xE5, 0xF4, 0xE5, 0xDD, 0xF0, 0xDD, 0xF0, 0xE3, 0xFB, 0xE3, 0xFB, 0xEF, 0x06, 0xEF, 0x06, 0xF0, 0x11,
-        0xF0, 0x11, 0xCF, 0x1C, 0xCF, 0x1C, 0x76, 0x27, 0x76, 0x27, 0xD2, 0x31, 0xD2, 0x31, 0xCF, 0x3B, 0xCF, 0x3B,
-        0x5A, 0x45, 0x5A, 0x45, 0x60, 0x4E, 0x60, 0x4E, 0xD1, 0x56, 0xD1, 0x56, 0x9B, 0x5E, 0x9B, 0x5E, 0xB2, 0x65,
-        0xB2, 0x65, 0x05, 0x6C, 0x05, 0x6C, 0x8B, 0x71, 0x8B, 0x71, 0x38, 0x76, 0x38, 0x76, 0x03, 0x7A, 0x03, 0x7A,
-        0xE5, 0x7C, 0xE5, 0x7C, 0xD9, 0x7E, 0xD9, 0x7E, 0xDA, 0x7F, 0xDA, 0x7F, 0xE7, 0x7F, 0xE7, 0x7F, 0x00, 0x7F,
-        0x00, 0x7F, 0x27, 0x7D, 0x27, 0x7D, 0x5E, 0x7A, 0x5E, 0x7A, 0xAC, 0x76, 0xAC, 0x76, 0x17, 0x72, 0x17, 0x72,
-        0xA9, 0x6C, 0xA9, 0x6C, 0x6A, 0x66, 0x6A, 0x66, 0x69, 0x5F, 0x69, 0x5F, 0xB1, 0x57, 0xB1, 0x57, 0x51, 0x4F,
-        0x51, 0x4F, 0x5A, 0x46, 0x5A, 0x46, 0xDD, 0x3C, 0xDD, 0x3C, 0xEC, 0x32, 0xEC, 0x32, 0x99, 0x28, 0x99, 0x28,
-        0xF9, 0x1D, 0xF9, 0x1D, 0x20, 0x13, 0x20, 0x13, 0x21, 0x08, 0x21, 0x08, 0x15, 0xFD, 0x15, 0xFD, 0x0D, 0xF2,
-        0x0D, 0xF2, 0x20, 0xE7, 0x20, 0xE7, 0x62, 0xDC, 0x62, 0xDC, 0xE8, 0xD1, 0xE8, 0xD1, 0xC7, 0xC7, 0xC7, 0xC7,
-        0x10, 0xBE, 0x10, 0xBE, 0xD8, 0xB4, 0xD8, 0xB4, 0x2F, 0xAC, 0x2F, 0xAC, 0x26, 0xA4, 0x26, 0xA4, 0xCD, 0x9C,
-        0xCD, 0x9C, 0x30, 0x96, 0x30, 0x96, 0x5F, 0x90, 0x5F, 0x90, 0x62, 0x8B, 0x62, 0x8B, 0x44, 0x87, 0x44, 0x87,
-        0x0C, 0x84, 0x0C, 0x84, 0xC1, 0x81, 0xC1, 0x81, 0x67, 0x80, 0x67, 0x80, 0x01, 0x80, 0x01, 0x80, 0x8F, 0x80,
-        0x8F, 0x80, 0x11, 0x82, 0x11, 0x82, 0x83, 0x84, 0x83, 0x84, 0xE1, 0x87, 0xE1, 0x87, 0x24, 0x8C, 0x24, 0x8C,
-        0x46, 0x91, 0x46, 0x91, 0x39, 0x97, 0x39, 0x97, 0xF5, 0x9D, 0xF5, 0x9D, 0x6D, 0xA5, 0x6D, 0xA5, 0x91, 0xAD,
-        0x91, 0xAD, 0x53, 0xB6, 0x53, 0xB6, 0xA1, 0xBF, 0xA1, 0xBF, 0x6A, 0xC9, 0x6A, 0xC9, 0x9C, 0xD3, 0x9C, 0xD3,
-        0x22, 0xDE, 0x22, 0xDE, 0xEA, 0xE8, 0xEA, 0xE8, 0xDD, 0xF3, 0xDD, 0xF3, 0xE6, 0xFE, 0xE6, 0xFE, 0xF2, 0x09,
-        0xF2, 0x09, 0xEB, 0x14, 0xEB, 0x14, 0xBD, 0x1F, 0xBD, 0x1F, 0x52, 0x2A, 0x52, 0x2A, 0x96, 0x34, 0x96, 0x34,
-        0x75, 0x3E, 0x75, 0x3E, 0xDD, 0x47, 0xDD, 0x47, 0xBD, 0x50, 0xBD, 0x50, 0x02, 0x59, 0x02, 0x59, 0x9D, 0x60,
-        0x9D, 0x60, 0x7F, 0x67, 0x7F, 0x67, 0x9C, 0x6D, 0x9C, 0x6D, 0xE7, 0x72, 0xE7, 0x72, 0x57, 0x77, 0x57, 0x77,
-        0xE4, 0x7A, 0xE4, 0x7A, 0x86, 0x7D, 0x86, 0x7D, 0x37, 0x7F, 0x37, 0x7F, 0xF6, 0x7F, 0xF6, 0x7F, 0xC0, 0x7F,
-        0xC0, 0x7F, 0x97, 0x7E, 0x97, 0x7E, 0x7C, 0x7C, 0x7C, 0x7C, 0x73, 0x79, 0x73, 0x79, 0x82, 0x75, 0x82, 0x75,
-        0xB1, 0x70, 0xB1, 0x70, 0x09, 0x6B, 0x09, 0x6B, 0x94, 0x64, 0x94, 0x64, 0x5F, 0x5D, 0x5F, 0x5D, 0x78, 0x55,
-        0x78, 0x55, 0xED, 0x4C, 0xED, 0x4C, 0xD1, 0x43, 0xD1, 0x43, 0x32, 0x3A, 0x32, 0x3A, 0x24, 0x30, 0x24, 0x30,
-        0xBA, 0x25, 0xBA, 0x25, 0x08, 0x1B, 0x08, 0x1B, 0x23, 0x10, 0x23, 0x10, 0x1E, 0x05, 0x1E, 0x05, 0x11, 0xFA,
-        0x11, 0xFA, 0x0F, 0xEF, 0x0F, 0xEF, 0x2C, 0xE4, 0x2C, 0xE4, 0x7F, 0xD9, 0x7F, 0xD9, 0x1B, 0xCF, 0x1B, 0xCF,
-        0x15, 0xC5, 0x15, 0xC5, 0x7F, 0xBB, 0x7F, 0xBB, 0x6C, 0xB2, 0x6C, 0xB2, 0xED, 0xA9, 0xED, 0xA9, 0x13, 0xA2,
-        0x13, 0xA2, 0xEC, 0x9A, 0xEC, 0x9A, 0x85, 0x94, 0x85, 0x94, 0xED, 0x8E, 0xED, 0x8E, 0x2C, 0x8A, 0x2C, 0x8A,
-        0x4C, 0x86, 0x4C, 0x86, 0x54, 0x83, 0x54, 0x83, 0x4B, 0x81, 0x4B, 0x81, 0x34, 0x80, 0x34, 0x80, 0x10, 0x80,
-        0x10, 0x80, 0xE1, 0x80, 0xE1, 0x80, 0xA4, 0x82, 0xA4, 0x82, 0x57, 0x85, 0x57, 0x85, 0xF4, 0x88, 0xF4, 0x88,
-        0x75, 0x8D, 0x75, 0x8D, 0xD0, 0x92, 0xD0, 0x92, 0xFC, 0x98, 0xFC, 0x98, 0xED, 0x9F, 0xED, 0x9F, 0x94, 0xA7,
-        0x94, 0xA7, 0xE5, 0xAF, 0xE5, 0xAF, 0xD0, 0xB8, 0xD0, 0xB8, 0x41, 0xC2, 0x41, 0xC2, 0x29, 0xCC, 0x29, 0xCC,
-        0x73, 0xD6, 0x73, 0xD6, 0x0D, 0xE1, 0x0D, 0xE1, 0xE2, 0xEB, 0xE2, 0xEB, 0xDE, 0xF6, 0xDE, 0xF6, 0xEA, 0x01,
-        0xEA, 0x01, 0xF3, 0x0C, 0xF3, 0x0C, 0xE4, 0x17, 0xE4, 0x17, 0xA6, 0x22, 0xA6, 0x22, 0x27, 0x2D, 0x27, 0x2D,
-        0x52, 0x37, 0x52, 0x37, 0x13, 0x41, 0x13, 0x41, 0x57, 0x4A, 0x57, 0x4A, 0x0E, 0x53, 0x0E, 0x53, 0x26, 0x5B,
-        0x26, 0x5B, 0x90, 0x62, 0x90, 0x62, 0x3E, 0x69, 0x3E, 0x69, 0x23, 0x6F, 0x23, 0x6F, 0x33, 0x74, 0x33, 0x74,
-        0x66, 0x78, 0x66, 0x78, 0xB3, 0x7B, 0xB3, 0x7B, 0x14, 0x7E, 0x14, 0x7E, 0x83, 0x7F, 0x83, 0x7F, 0xFF, 0x7F,
-        0xFF, 0x7F, 0x88, 0x7F, 0x88, 0x7F, 0x1C, 0x7E, 0x1C, 0x7E, 0xBF, 0x7B, 0xBF, 0x7B, 0x77, 0x78, 0x77, 0x78,
-        0x48, 0x74, 0x48, 0x74, 0x3B, 0x6F, 0x3B, 0x6F, 0x5A, 0x69, 0x5A, 0x69, 0xAF, 0x62, 0xAF, 0x62, 0x49, 0x5B,
-        0x49, 0x5B, 0x33, 0x53, 0x33, 0x53, 0x80, 0x4A, 0x80, 0x4A, 0x3D, 0x41, 0x3D, 0x41, 0x7E, 0x37, 0x7E, 0x37,
-        0x55, 0x2D, 0x55, 0x2D, 0xD6, 0x22, 0xD6, 0x22, 0x14, 0x18, 0x14, 0x18, 0x24, 0x0D, 0x24, 0x0D, 0x1B, 0x02,
-        0x1B, 0x02, 0x0E, 0xF7, 0x0E, 0xF7, 0x13, 0xEC, 0x13, 0xEC, 0x3D, 0xE1, 0x3D, 0xE1, 0xA2, 0xD6, 0xA2, 0xD6,
-        0x55, 0xCC, 0x55, 0xCC, 0x6C, 0xC2, 0x6C, 0xC2, 0xF8, 0xB8, 0xF8, 0xB8, 0x0C, 0xB0, 0x0C, 0xB0, 0xB8, 0xA7,
-        0xB8, 0xA7, 0x0D, 0xA0, 0x0D, 0xA0, 0x19, 0x99, 0x19, 0x99, 0xEA, 0x92, 0xEA, 0x92, 0x8B, 0x8D, 0x8B, 0x8D,
-        0x07, 0x89, 0x07, 0x89, 0x65, 0x85, 0x65, 0x85, 0xAE, 0x82, 0xAE, 0x82, 0xE6, 0x80, 0xE6, 0x80, 0x11, 0x80,
-        0x11, 0x80, 0x30, 0x80, 0x30, 0x80, 0x44, 0x81, 0x44, 0x81, 0x49, 0x83, 0x49, 0x83, 0x3D, 0x86, 0x3D, 0x86,
-        0x18, 0x8A, 0x18, 0x8A, 0xD6, 0x8E, 0xD6, 0x8E, 0x6B, 0x94, 0x6B, 0x94, 0xCD, 0x9A, 0xCD, 0x9A, 0xF2, 0xA1,
-        0xF2, 0xA1, 0xC9, 0xA9, 0xC9, 0xA9, 0x45, 0xB2, 0x45, 0xB2, 0x55, 0xBB, 0x55, 0xBB, 0xE9, 0xC4, 0xE9, 0xC4,
-        0xEE, 0xCE, 0xEE, 0xCE, 0x50, 0xD9, 0x50, 0xD9, 0xFC, 0xE3, 0xFC, 0xE3, 0xDE, 0xEE, 0xDE, 0xEE, 0xE0, 0xF9,
-        0xE0, 0xF9, 0xEE, 0x04, 0xEE, 0x04, 0xF2, 0x0F, 0xF2, 0x0F, 0xD9, 0x1A, 0xD9, 0x1A, 0x8B, 0x25, 0x8B, 0x25,
-        0xF6, 0x2F, 0xF6, 0x2F, 0x06, 0x3A, 0x06, 0x3A, 0xA7, 0x43, 0xA7, 0x43, 0xC6, 0x4C, 0xC6, 0x4C, 0x54, 0x55,
-        0x54, 0x55, 0x3E, 0x5D, 0x3E, 0x5D, 0x76, 0x64, 0x76, 0x64, 0xEE, 0x6A, 0xEE, 0x6A, 0x9A, 0x70, 0x9A, 0x70,
-        0x6F, 0x75, 0x6F, 0x75, 0x63, 0x79, 0x63, 0x79, 0x71, 0x7C, 0x71, 0x7C, 0x90, 0x7E, 0x90, 0x7E, 0xBE, 0x7F,
-        0xBE, 0x7F, 0xF7, 0x7F, 0xF7, 0x7F, 0x3C, 0x7F, 0x3C, 0x7F, 0x8F, 0x7D, 0x8F, 0x7D, 0xF1, 0x7A, 0xF1, 0x7A,
-        0x69, 0x77, 0x69, 0x77, 0xFD, 0x72, 0xFD, 0x72, 0xB5, 0x6D, 0xB5, 0x6D, 0x9C, 0x67, 0x9C, 0x67, 0xBD, 0x60,
-        0xBD, 0x60, 0x25, 0x59, 0x25, 0x59, 0xE3, 0x50, 0xE3, 0x50, 0x06, 0x48, 0x06, 0x48, 0xA0, 0x3E, 0xA0, 0x3E,
-        0xC3, 0x34, 0xC3, 0x34, 0x80, 0x2A, 0x80, 0x2A, 0xEC, 0x1F, 0xEC, 0x1F, 0x1C, 0x15, 0x1C, 0x15, 0x23, 0x0A,
-        0x23, 0x0A, 0x18, 0xFF, 0x18, 0xFF, 0x0D, 0xF4, 0x0D, 0xF4, 0x19, 0xE9, 0x19, 0xE9, 0x51, 0xDE, 0x51, 0xDE,
-        0xCA, 0xD3, 0xCA, 0xD3, 0x97, 0xC9, 0x97, 0xC9, 0xCB, 0xBF, 0xCB, 0xBF, 0x7B, 0xB6, 0x7B, 0xB6, 0xB6, 0xAD,
-        0xB6, 0xAD, 0x8F, 0xA5, 0x8F, 0xA5, 0x15, 0x9E, 0x15, 0x9E, 0x55, 0x97, 0x55, 0x97, 0x5E, 0x91, 0x5E, 0x91,
-        0x39, 0x8C, 0x39, 0x8C, 0xF2, 0x87, 0xF2, 0x87, 0x90, 0x84, 0x90, 0x84, 0x1A, 0x82, 0x1A, 0x82, 0x94, 0x80,
-        0x94, 0x80, 0x01, 0x80, 0x01, 0x80, 0x64, 0x80, 0x64, 0x80, 0xB9, 0x81, 0xB9, 0x81, 0x00, 0x84, 0x00, 0x84,
-        0x33, 0x87, 0x33, 0x87, 0x4E, 0x8B, 0x4E, 0x8B, 0x46, 0x90, 0x46, 0x90, 0x15, 0x96, 0x15, 0x96, 0xAD, 0x9C,
-        0xAD, 0x9C, 0x04, 0xA4, 0x04, 0xA4, 0x09, 0xAC, 0x09, 0xAC, 0xB0, 0xB4, 0xB0, 0xB4, 0xE7, 0xBD, 0xE7, 0xBD,
-        0x9A, 0xC7, 0x9A, 0xC7, 0xBA, 0xD1, 0xBA, 0xD1, 0x33, 0xDC, 0x33, 0xDC, 0xF0, 0xE6, 0xF0, 0xE6, 0xDC, 0xF1,
-        0xDC, 0xF1, 0xE4, 0xFC, 0xE4, 0xFC, 0xF1, 0x07, 0xF1, 0x07, 0xEF, 0x12, 0xEF, 0x12, 0xC9, 0x1D, 0xC9, 0x1D,
-        0x6A, 0x28, 0x6A, 0x28, 0xBF, 0x32, 0xBF, 0x32, 0xB2, 0x3C, 0xB2, 0x3C, 0x31, 0x46, 0x31, 0x46, 0x2B, 0x4F,
-        0x2B, 0x4F, 0x8D, 0x57, 0x8D, 0x57, 0x48, 0x5F, 0x48, 0x5F, 0x4D, 0x66, 0x4D, 0x66, 0x8E, 0x6C, 0x8E, 0x6C,
-        0x01, 0x72, 0x01, 0x72, 0x9A, 0x76, 0x9A, 0x76, 0x50, 0x7A, 0x50, 0x7A, 0x1C, 0x7D, 0x1C, 0x7D, 0xFA, 0x7E,
-        0xFA, 0x7E, 0xE5, 0x7F, 0xE5, 0x7F, 0xDD, 0x7F, 0xDD, 0x7F, 0xDF, 0x7E, 0xDF, 0x7E, 0xF0, 0x7C, 0xF0, 0x7C,
-        0x12, 0x7A, 0x12, 0x7A, 0x4B, 0x76, 0x4B, 0x76, 0xA1, 0x71, 0xA1, 0x71, 0x20, 0x6C, 0x20, 0x6C, 0xCF, 0x65,
-        0xCF, 0x65, 0xBC, 0x5E, 0xBC, 0x5E, 0xF4, 0x56, 0xF4, 0x56, 0x87, 0x4E, 0x87, 0x4E, 0x83, 0x45, 0x83, 0x45,
-        0xFA, 0x3B, 0xFA, 0x3B, 0xFF, 0x31, 0xFF, 0x31, 0xA5, 0x27, 0xA5, 0x27, 0xFE, 0x1C, 0xFE, 0x1C, 0x21, 0x12,
-        0x21, 0x12, 0x21, 0x07, 0x21, 0x07, 0x14, 0xFC, 0x14, 0xFC, 0x0D, 0xF1, 0x0D, 0xF1, 0x23, 0xE6, 0x23, 0xE6,
-        0x6B, 0xDB, 0x6B, 0xDB, 0xF8, 0xD0, 0xF8, 0xD0, 0xE0, 0xC6, 0xE0, 0xC6, 0x34, 0xBD, 0x34, 0xBD, 0x08, 0xB4,
-        0x08, 0xB4, 0x6D, 0xAB, 0x6D, 0xAB, 0x73, 0xA3, 0x73, 0xA3, 0x2B, 0x9C, 0x2B, 0x9C, 0xA1, 0x95, 0xA1, 0x95,
-        0xE1, 0x8F, 0xE1, 0x8F, 0xF8, 0x8A, 0xF8, 0x8A, 0xEF, 0x86, 0xEF, 0x86, 0xCC, 0x83, 0xCC, 0x83, 0x98, 0x81,
-        0x98, 0x81, 0x54, 0x80, 0x54, 0x80, 0x04, 0x80, 0x04, 0x80, 0xA8, 0x80, 0xA8, 0x80, 0x40, 0x82, 0x40, 0x82,
-        0xC8, 0x84, 0xC8, 0x84, 0x3B, 0x88, 0x3B, 0x88, 0x93, 0x8C, 0x93, 0x8C, 0xC7, 0x91, 0xC7, 0x91, 0xCE, 0x97,
-        0xCE, 0x97, 0x9C, 0x9E, 0x9C, 0x9E, 0x23, 0xA6, 0x23, 0xA6, 0x56, 0xAE, 0x56, 0xAE, 0x25, 0xB7, 0x25, 0xB7,
-        0x80, 0xC0, 0x80, 0xC0, 0x53, 0xCA, 0x53, 0xCA, 0x8E, 0xD4, 0x8E, 0xD4, 0x1B, 0xDF, 0x1B, 0xDF, 0xE6, 0xE9,
-        0xE6, 0xE9, 0xDD, 0xF4, 0xDD, 0xF4, 0xE8, 0xFF, 0xE8, 0xFF, 0xF2, 0x0A, 0xF2, 0x0A, 0xE9, 0x15, 0xE9, 0x15,
-        0xB6, 0x20, 0xB6, 0x20, 0x44, 0x2B, 0x44, 0x2B, 0x80, 0x35, 0x80, 0x35, 0x55, 0x3F, 0x55, 0x3F, 0xB2, 0x48,
-        0xB2, 0x48, 0x84, 0x51, 0x84, 0x51, 0xBA, 0x59, 0xBA, 0x59, 0x45, 0x61, 0x45, 0x61, 0x16, 0x68, 0x16, 0x68,
-        0x20, 0x6E, 0x20, 0x6E, 0x58, 0x73, 0x58, 0x73, 0xB4, 0x77, 0xB4, 0x77, 0x2B, 0x7B, 0x2B, 0x7B, 0xB7, 0x7D,
-        0xB7, 0x7D, 0x52, 0x7F, 0x52, 0x7F, 0xFB, 0x7F, 0xFB, 0x7F, 0xAF, 0x7F, 0xAF, 0x7F, 0x70, 0x7E, 0x70, 0x7E,
-        0x3F, 0x7C, 0x3F, 0x7C, 0x21, 0x79, 0x21, 0x79, 0x1B, 0x75, 0x1B, 0x75, 0x37, 0x70, 0x37, 0x70, 0x7A, 0x6A,
-        0x7A, 0x6A, 0xF4, 0x63, 0xF4, 0x63, 0xAE, 0x5C, 0xAE, 0x5C, 0xB8, 0x54, 0xB8, 0x54, 0x20, 0x4C, 0x20, 0x4C,
-        0xF6, 0x42, 0xF6, 0x42, 0x4C, 0x39, 0x4C, 0x39, 0x35, 0x2F, 0x35, 0x2F, 0xC4, 0x24, 0xC4, 0x24, 0x0D, 0x1A,
-        0x0D, 0x1A, 0x23, 0x0F, 0x23, 0x0F, 0x1E, 0x04, 0x1E, 0x04, 0x10, 0xF9, 0x10, 0xF9, 0x10, 0xEE, 0x10, 0xEE,
-        0x32, 0xE3, 0x32, 0xE3, 0x8A, 0xD8, 0x8A, 0xD8, 0x2E, 0xCE, 0x2E, 0xCE, 0x31, 0xC4, 0x31, 0xC4, 0xA6, 0xBA,
-        0xA6, 0xBA, 0xA0, 0xB1, 0xA0, 0xB1, 0x2F, 0xA9, 0x2F, 0xA9, 0x65, 0xA1, 0x65, 0xA1, 0x4F, 0x9A, 0x4F, 0x9A,
-        0xFB, 0x93, 0xFB, 0x93, 0x75, 0x8E, 0x75, 0x8E, 0xC8, 0x89, 0xC8, 0x89, 0xFD, 0x85, 0xFD, 0x85, 0x1B, 0x83,
-        0x1B, 0x83, 0x27, 0x81, 0x27, 0x81, 0x26, 0x80, 0x26, 0x80, 0x18, 0x80, 0x18, 0x80, 0x00, 0x81, 0x00, 0x81,
-        0xD9, 0x82, 0xD9, 0x82, 0xA2, 0x85, 0xA2, 0x85, 0x54, 0x89, 0x54, 0x89, 0xE9, 0x8D, 0xE9, 0x8D, 0x57, 0x93,
-        0x57, 0x93, 0x96, 0x99, 0x96, 0x99, 0x97, 0xA0, 0x97, 0xA0, 0x4F, 0xA8, 0x4F, 0xA8, 0xAF, 0xB0, 0xAF, 0xB0,
-        0xA6, 0xB9, 0xA6, 0xB9, 0x23, 0xC3, 0x23, 0xC3, 0x14, 0xCD, 0x14, 0xCD, 0x67, 0xD7, 0x67, 0xD7, 0x07, 0xE2,
-        0x07, 0xE2, 0xE0, 0xEC, 0xE0, 0xEC, 0xDE, 0xF7, 0xDE, 0xF7, 0xEB, 0x02, 0xEB, 0x02, 0xF3, 0x0D, 0xF3, 0x0D,
-        0xE1, 0x18, 0xE1, 0x18, 0x9E, 0x23, 0x9E, 0x23, 0x18, 0x2E, 0x18, 0x2E, 0x39, 0x38, 0x39, 0x38, 0xF0, 0x41,
-        0xF0, 0x41, 0x29, 0x4B, 0x29, 0x4B, 0xD1, 0x53, 0xD1, 0x53, 0xDA, 0x5B, 0xDA, 0x5B, 0x33, 0x63, 0x33, 0x63,
-        0xD0, 0x69, 0xD0, 0x69, 0xA1, 0x6F, 0xA1, 0x6F, 0x9F, 0x74, 0x9F, 0x74, 0xBC, 0x78, 0xBC, 0x78, 0xF5, 0x7B,
-        0xF5, 0x7B, 0x3F, 0x7E, 0x3F, 0x7E, 0x99, 0x7F, 0x99, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x71, 0x7F, 0x71, 0x7F,
-        0xEF, 0x7D, 0xEF, 0x7D, 0x7D, 0x7B, 0x7D, 0x7B, 0x1E, 0x78, 0x1E, 0x78, 0xDB, 0x73, 0xDB, 0x73, 0xBB, 0x6E,
-        0xBB, 0x6E, 0xC7, 0x68, 0xC7, 0x68, 0x0B, 0x62, 0x0B, 0x62, 0x93, 0x5A, 0x93, 0x5A, 0x6F, 0x52, 0x6F, 0x52,
-        0xAE, 0x49, 0xAE, 0x49, 0x5F, 0x40, 0x5F, 0x40, 0x96, 0x36, 0x96, 0x36, 0x64, 0x2C, 0x64, 0x2C, 0xDE, 0x21,
-        0xDE, 0x21, 0x17, 0x17, 0x17, 0x17, 0x23, 0x0C, 0x23, 0x0C, 0x1A, 0x01, 0x1A, 0x01, 0x0E, 0xF6, 0x0E, 0xF6,
-        0x14, 0xEB, 0x14, 0xEB, 0x43, 0xE0, 0x43, 0xE0, 0xAE, 0xD5, 0xAE, 0xD5, 0x6A, 0xCB, 0x6A, 0xCB, 0x8B, 0xC1,
-        0x8B, 0xC1, 0x22, 0xB8, 0x22, 0xB8, 0x43, 0xAF, 0x43, 0xAF, 0xFE, 0xA6, 0xFE, 0xA6, 0x63, 0x9F, 0x63, 0x9F,
-        0x81, 0x98, 0x81, 0x98, 0x64, 0x92, 0x64, 0x92, 0x19, 0x8D, 0x19, 0x8D, 0xA9, 0x88, 0xA9, 0x88, 0x1D, 0x85,
-        0x1D, 0x85, 0x7A, 0x82, 0x7A, 0x82, 0xC9, 0x80, 0xC9, 0x80, 0x0A, 0x80, 0x0A, 0x80, 0x40, 0x80, 0x40, 0x80,
-        0x68, 0x81, 0x68, 0x81, 0x84, 0x83, 0x84, 0x83, 0x8D, 0x86, 0x8D, 0x86, 0x7E, 0x8A, 0x7E, 0x8A, 0x4F, 0x8F,
-        0x4F, 0x8F, 0xF7, 0x94, 0xF7, 0x94, 0x6C, 0x9B, 0x6C, 0x9B, 0xA1, 0xA2, 0xA1, 0xA2, 0x88, 0xAA, 0x88, 0xAA,
-        0x12, 0xB3, 0x12, 0xB3, 0x2F, 0xBC, 0x2F, 0xBC, 0xCE, 0xC5, 0xCE, 0xC5, 0xDC, 0xCF, 0xDC, 0xCF, 0x46, 0xDA,
-        0x46, 0xDA, 0xF8, 0xE4, 0xF8, 0xE4, 0xDD, 0xEF, 0xDD, 0xEF, 0xE1, 0xFA, 0xE1, 0xFA, 0xEE, 0x05, 0xEE, 0x05,
-        0xF2, 0x10, 0xF2, 0x10, 0xD4, 0x1B, 0xD4, 0x1B, 0x81, 0x26, 0x81, 0x26, 0xE4, 0x30, 0xE4, 0x30, 0xEB, 0x3A,
-        0xEB, 0x3A, 0x81, 0x44, 0x81, 0x44, 0x94, 0x4D, 0x94, 0x4D, 0x13, 0x56, 0x13, 0x56, 0xED, 0x5D, 0xED, 0x5D,
-        0x14, 0x65, 0x14, 0x65, 0x7B, 0x6B, 0x7B, 0x6B, 0x13, 0x71, 0x13, 0x71, 0xD5, 0x75, 0xD5, 0x75, 0xB4, 0x79,
-        0xB4, 0x79, 0xAC, 0x7C, 0xAC, 0x7C, 0xB5, 0x7E, 0xB5, 0x7E, 0xCD, 0x7F, 0xCD, 0x7F, 0xF1, 0x7F, 0xF1, 0x7F,
-        0x1F, 0x7F, 0x1F, 0x7F, 0x5C, 0x7D, 0x5C, 0x7D, 0xA9, 0x7A, 0xA9, 0x7A, 0x0C, 0x77, 0x0C, 0x77, 0x8B, 0x72,
-        0x8B, 0x72, 0x30, 0x6D, 0x30, 0x6D, 0x04, 0x67, 0x04, 0x67, 0x14, 0x60, 0x14, 0x60, 0x6B, 0x58, 0x6B, 0x58,
-        0x1B, 0x50, 0x1B, 0x50, 0x31, 0x47, 0x31, 0x47, 0xBF, 0x3D, 0xBF, 0x3D, 0xD7, 0x33, 0xD7, 0x33, 0x8D, 0x29,
-        0x8D, 0x29, 0xF3, 0x1E, 0xF3, 0x1E, 0x1E, 0x14, 0x1E, 0x14, 0x22, 0x09, 0x22, 0x09, 0x16, 0xFE, 0x16, 0xFE,
-        0x0D, 0xF3, 0x0D, 0xF3, 0x1D, 0xE8, 0x1D, 0xE8, 0x5A, 0xDD, 0x5A, 0xDD, 0xD8, 0xD2, 0xD8, 0xD2, 0xAE, 0xC8,
-        0xAE, 0xC8, 0xED, 0xBE, 0xED, 0xBE, 0xA9, 0xB5, 0xA9, 0xB5, 0xF1, 0xAC, 0xF1, 0xAC, 0xDA, 0xA4, 0xDA, 0xA4,
-        0x70, 0x9D, 0x70, 0x9D, 0xC2, 0x96, 0xC2, 0x96, 0xDD, 0x90, 0xDD, 0x90, 0xCD, 0x8B, 0xCD, 0x8B, 0x9A, 0x87,
-        0x9A, 0x87, 0x4D, 0x84, 0x4D, 0x84, 0xEC, 0x81, 0xEC, 0x81, 0x7D, 0x80, 0x7D, 0x80, 0x00, 0x80, 0x00, 0x80,
-        0x78, 0x80, 0x78, 0x80, 0xE4, 0x81, 0xE4, 0x81, 0x40, 0x84, 0x40, 0x84, 0x89, 0x87, 0x89, 0x87, 0xB8, 0x8B,
-        0xB8, 0x8B, 0xC5, 0x90, 0xC5, 0x90, 0xA6, 0x96, 0xA6, 0x96, 0x51, 0x9D, 0x51, 0x9D, 0xB7, 0xA4, 0xB7, 0xA4,
-        0xCD, 0xAC, 0xCD, 0xAC, 0x81, 0xB5, 0x81, 0xB5, 0xC3, 0xBE, 0xC3, 0xBE, 0x82, 0xC8, 0x82, 0xC8, 0xAB, 0xD2,
-        0xAB, 0xD2, 0x2B, 0xDD, 0x2B, 0xDD, 0xEC, 0xE7, 0xEC, 0xE7, 0xDD, 0xF2, 0xDD, 0xF2, 0xE5, 0xFD, 0xE5, 0xFD,
-        0xF1, 0x08, 0xF1, 0x08, 0xED, 0x13, 0xED, 0x13, 0xC3, 0x1E, 0xC3, 0x1E, 0x5E, 0x29, 0x5E, 0x29, 0xAB, 0x33,
-        0xAB, 0x33, 0x94, 0x3D, 0x94, 0x3D, 0x08, 0x47, 0x08, 0x47, 0xF4, 0x4F, 0xF4, 0x4F, 0x48, 0x58, 0x48, 0x58,
-        0xF3, 0x5F, 0xF3, 0x5F, 0xE7, 0x66, 0xE7, 0x66, 0x16, 0x6D, 0x16, 0x6D, 0x75, 0x72, 0x75, 0x72, 0xF9, 0x76,
-        0xF9, 0x76, 0x9B, 0x7A, 0x9B, 0x7A, 0x52, 0x7D, 0x52, 0x7D, 0x1A, 0x7F, 0x1A, 0x7F, 0xEF, 0x7F, 0xEF, 0x7F,
-        0xCF, 0x7F, 0xCF, 0x7F, 0xBC, 0x7E, 0xBC, 0x7E, 0xB7, 0x7C, 0xB7, 0x7C, 0xC3, 0x79, 0xC3, 0x79, 0xE7, 0x75,
-        0xE7, 0x75, 0x2A, 0x71, 0x2A, 0x71, 0x95, 0x6B, 0x95, 0x6B, 0x33, 0x65, 0x33, 0x65, 0x0E, 0x5E, 0x0E, 0x5E,
-        0x37, 0x56, 0x37, 0x56, 0xBB, 0x4D, 0xBB, 0x4D, 0xAA, 0x44, 0xAA, 0x44, 0x16, 0x3B, 0x16, 0x3B, 0x12, 0x31,
-        0x12, 0x31, 0xB0, 0x26, 0xB0, 0x26, 0x03, 0x1C, 0x03, 0x1C, 0x22, 0x11, 0x22, 0x11, 0x20, 0x06, 0x20, 0x06,
-        0x12, 0xFB, 0x12, 0xFB, 0x0E, 0xF0, 0x0E, 0xF0, 0x28, 0xE5, 0x28, 0xE5, 0x75, 0xDA, 0x75, 0xDA, 0x0A, 0xD0,
-        0x0A, 0xD0, 0xFA, 0xC5, 0xFA, 0xC5, 0x59, 0xBC, 0x59, 0xBC, 0x3A, 0xB3, 0x3A, 0xB3, 0xAD, 0xAA, 0xAD, 0xAA,
-        0xC2, 0xA2, 0xC2, 0xA2, 0x8A, 0x9B, 0x8A, 0x9B, 0x12, 0x95, 0x12, 0x95, 0x66, 0x8F, 0x66, 0x8F, 0x91, 0x8A,
-        0x91, 0x8A, 0x9D, 0x86, 0x9D, 0x86, 0x8F, 0x83, 0x8F, 0x83, 0x71, 0x81, 0x71, 0x81, 0x42, 0x80, 0x42, 0x80,
-        0x09, 0x80, 0x09, 0x80, 0xC3, 0x80, 0xC3, 0x80, 0x71, 0x82, 0x71, 0x82, 0x0E, 0x85, 0x0E, 0x85, 0x97, 0x88,
-        0x97, 0x88, 0x03, 0x8D, 0x03, 0x8D, 0x4B, 0x92, 0x4B, 0x92, 0x64, 0x98, 0x64, 0x98, 0x43, 0x9F, 0x43, 0x9F,
-        0xDB, 0xA6, 0xDB, 0xA6, 0x1D, 0xAF, 0x1D, 0xAF, 0xFA, 0xB7, 0xFA, 0xB7, 0x60, 0xC1, 0x60, 0xC1, 0x3E, 0xCB,
-        0x3E, 0xCB, 0x80, 0xD5, 0x80, 0xD5, 0x14, 0xE0, 0x14, 0xE0, 0xE4, 0xEA, 0xE4, 0xEA, 0xDD, 0xF5, 0xDD, 0xF5,
-        0xE9, 0x00, 0xE9, 0x00, 0xF3, 0x0B, 0xF3, 0x0B, 0xE7, 0x16, 0xE7, 0x16, 0xAE, 0x21, 0xAE, 0x21, 0x36, 0x2C,
-        0x36, 0x2C, 0x69, 0x36, 0x69, 0x36, 0x35, 0x40, 0x35, 0x40, 0x85, 0x49, 0x85, 0x49, 0x4A, 0x52, 0x4A, 0x52,
-        0x71, 0x5A, 0x71, 0x5A, 0xEB, 0x61, 0xEB, 0x61, 0xAA, 0x68, 0xAA, 0x68, 0xA2, 0x6E, 0xA2, 0x6E, 0xC6, 0x73,
-        0xC6, 0x73, 0x0E, 0x78, 0x0E, 0x78, 0x70, 0x7B, 0x70, 0x7B, 0xE7, 0x7D, 0xE7, 0x7D, 0x6C, 0x7F, 0x6C, 0x7F,
-        0xFE, 0x7F, 0xFE, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x47, 0x7E, 0x47, 0x7E, 0x00, 0x7C, 0x00, 0x7C, 0xCD, 0x78,
-        0xCD, 0x78, 0xB2, 0x74, 0xB2, 0x74, 0xBA, 0x6F, 0xBA, 0x6F, 0xEB, 0x69, 0xEB, 0x69, 0x53, 0x63, 0x53, 0x63,
-        0xFC, 0x5B, 0xFC, 0x5B, 0xF6, 0x53, 0xF6, 0x53, 0x50, 0x4B, 0x50, 0x4B, 0x1A, 0x42, 0x1A, 0x42, 0x66, 0x38,
-        0x66, 0x38, 0x46, 0x2E, 0x46, 0x2E, 0xCD, 0x23, 0xCD, 0x23, 0x10, 0x19, 0x10, 0x19, 0x24, 0x0E, 0x24, 0x0E,
-        0x1C, 0x03, 0x1C, 0x03, 0x10, 0xF8, 0x10, 0xF8, 0x11, 0xED, 0x11, 0xED, 0x37, 0xE2, 0x37, 0xE2, 0x95, 0xD7,
-        0x95, 0xD7, 0x41, 0xCD, 0x41, 0xCD, 0x4E, 0xC3, 0x4E, 0xC3, 0xCE, 0xB9, 0xCE, 0xB9, 0xD5, 0xB0, 0xD5, 0xB0,
-        0x73, 0xA8, 0x73, 0xA8, 0xB8, 0xA0, 0xB8, 0xA0, 0xB3, 0x99, 0xB3, 0x99, 0x71, 0x93, 0x71, 0x93, 0xFF, 0x8D,
-        0xFF, 0x8D, 0x67, 0x89, 0x67, 0x89, 0xB0, 0x85, 0xB0, 0x85, 0xE4, 0x82, 0xE4, 0x82, 0x05, 0x81, 0x05, 0x81,
-        0x1B, 0x80, 0x1B, 0x80, 0x23, 0x80, 0x23, 0x80, 0x21, 0x81, 0x21, 0x81, 0x10, 0x83, 0x10, 0x83, 0xEE, 0x85,
-        0xEE, 0x85, 0xB5, 0x89, 0xB5, 0x89, 0x5E, 0x8E, 0x5E, 0x8E, 0xE0, 0x93, 0xE0, 0x93, 0x31, 0x9A, 0x31, 0x9A,
-        0x44, 0xA1, 0x44, 0xA1, 0x0B, 0xA9, 0x0B, 0xA9, 0x79, 0xB1, 0x79, 0xB1, 0x7D, 0xBA, 0x7D, 0xBA, 0x06, 0xC4,
-        0x06, 0xC4, 0x01, 0xCE, 0x01, 0xCE, 0x5B, 0xD8, 0x5B, 0xD8, 0x01, 0xE3, 0x01, 0xE3, 0xDF, 0xED, 0xDF, 0xED,
-        0xE0, 0xF8, 0xE0, 0xF8, 0xED, 0x03, 0xED, 0x03, 0xF3, 0x0E, 0xF3, 0x0E, 0xDD, 0x19, 0xDD, 0x19, 0x95, 0x24,
-        0x95, 0x24, 0x07, 0x2F, 0x07, 0x2F, 0x20, 0x39, 0x20, 0x39, 0xCC, 0x42, 0xCC, 0x42, 0xF8, 0x4B, 0xF8, 0x4B,
-        0x93, 0x54, 0x93, 0x54, 0x8D, 0x5C, 0x8D, 0x5C, 0xD5, 0x63, 0xD5, 0x63, 0x60, 0x6A, 0x60, 0x6A, 0x1F, 0x70,
-        0x1F, 0x70, 0x08, 0x75, 0x08, 0x75, 0x11, 0x79, 0x11, 0x79, 0x34, 0x7C, 0x34, 0x7C, 0x68, 0x7E, 0x68, 0x7E,
-        0xAD, 0x7F, 0xAD, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0x58, 0x7F, 0x58, 0x7F, 0xC0, 0x7D, 0xC0, 0x7D, 0x38, 0x7B,
-        0x38, 0x7B, 0xC5, 0x77, 0xC5, 0x77, 0x6D, 0x73, 0x6D, 0x73, 0x39, 0x6E, 0x39, 0x6E, 0x32, 0x68, 0x32, 0x68,
-        0x65, 0x61, 0x65, 0x61, 0xDD, 0x59, 0xDD, 0x59, 0xAA, 0x51, 0xAA, 0x51, 0xDB, 0x48, 0xDB, 0x48, 0x80, 0x3F,
-        0x80, 0x3F, 0xAD, 0x35, 0xAD, 0x35, 0x72, 0x2B, 0x72, 0x2B, 0xE5, 0x20, 0xE5, 0x20, 0x19, 0x16, 0x19, 0x16,
-        0x23, 0x0B, 0x23, 0x0B, 0x18, 0x00, 0x18, 0x00, 0x0D, 0xF5, 0x0D, 0xF5, 0x17, 0xEA, 0x17, 0xEA, 0x4A, 0xDF,
-        0x4A, 0xDF, 0xBC, 0xD4, 0xBC, 0xD4, 0x80, 0xCA, 0x80, 0xCA, 0xAA, 0xC0, 0xAA, 0xC0, 0x4E, 0xB7, 0x4E, 0xB7,
-        0x7C, 0xAE, 0x7C, 0xAE, 0x47, 0xA6, 0x47, 0xA6, 0xBC, 0x9E, 0xBC, 0x9E, 0xEB, 0x97, 0xEB, 0x97, 0xE0, 0x91,
-        0xE0, 0x91, 0xA8, 0x8C, 0xA8, 0x8C, 0x4C, 0x88, 0x4C, 0x88, 0xD5, 0x84, 0xD5, 0x84, 0x49, 0x82, 0x49, 0x82,
-        0xAE, 0x80, 0xAE, 0x80, 0x05, 0x80, 0x05, 0x80, 0x51, 0x80, 0x51, 0x80, 0x90, 0x81, 0x90, 0x81, 0xC1, 0x83,
-        0xC1, 0x83, 0xDF, 0x86, 0xDF, 0x86, 0xE5, 0x8A, 0xE5, 0x8A, 0xCA, 0x8F, 0xCA, 0x8F, 0x85, 0x95, 0x85, 0x95,
-        0x0C, 0x9C, 0x0C, 0x9C, 0x52, 0xA3, 0x52, 0xA3, 0x48, 0xAB, 0x48, 0xAB, 0xE1, 0xB3, 0xE1, 0xB3, 0x0A, 0xBD,
-        0x0A, 0xBD, 0xB4, 0xC6, 0xB4, 0xC6, 0xCB, 0xD0, 0xCB, 0xD0, 0x3C, 0xDB, 0x3C, 0xDB, 0xF4, 0xE5, 0xF4, 0xE5,
-        0xDD, 0xF0, 0xDD, 0xF0, 0xE3, 0xFB, 0xE3, 0xFB, 0xEF, 0x06, 0xEF, 0x06, 0xF0, 0x11, 0xF0, 0x11, 0xCF, 0x1C,
-        0xCF, 0x1C, 0x76, 0x27, 0x76, 0x27, 0xD2, 0x31, 0xD2, 0x31, 0xCF, 0x3B, 0xCF, 0x3B, 0x5A, 0x45, 0x5A, 0x45,
-        0x60, 0x4E, 0x60, 0x4E, 0xD1, 0x56, 0xD1, 0x56, 0x9B, 0x5E, 0x9B, 0x5E, 0xB2, 0x65, 0xB2, 0x65, 0x05, 0x6C,
-        0x05, 0x6C, 0x8B, 0x71, 0x8B, 0x71, 0x38, 0x76, 0x38, 0x76, 0x03, 0x7A, 0x03, 0x7A, 0xE5, 0x7C, 0xE5, 0x7C,
-        0xD9, 0x7E, 0xD9, 0x7E, 0xDA, 0x7F, 0xDA, 0x7F, 0xE7, 0x7F, 0xE7, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x27, 0x7D,
-        0x27, 0x7D, 0x5E, 0x7A, 0x5E, 0x7A, 0xAC, 0x76, 0xAC, 0x76, 0x17, 0x72, 0x17, 0x72, 0xA9, 0x6C, 0xA9, 0x6C,
-        0x6A, 0x66, 0x6A, 0x66, 0x69, 0x5F, 0x69, 0x5F, 0xB1, 0x57, 0xB1, 0x57, 0x51, 0x4F, 0x51, 0x4F, 0x5A, 0x46,
-        0x5A, 0x46, 0xDD, 0x3C, 0xDD, 0x3C, 0xEC, 0x32, 0xEC, 0x32, 0x99, 0x28, 0x99, 0x28, 0xF9, 0x1D, 0xF9, 0x1D,
-        0x20, 0x13, 0x20, 0x13, 0x21, 0x08, 0x21, 0x08, 0x15, 0xFD, 0x15, 0xFD, 0x0D, 0xF2, 0x0D, 0xF2, 0x20, 0xE7,
-        0x20, 0xE7, 0x62, 0xDC, 0x62, 0xDC, 0xE8, 0xD1, 0xE8, 0xD1, 0xC7, 0xC7, 0xC7, 0xC7, 0x10, 0xBE, 0x10, 0xBE,
-        0xD8, 0xB4, 0xD8, 0xB4, 0x2F, 0xAC, 0x2F, 0xAC, 0x26, 0xA4, 0x26, 0xA4, 0xCD, 0x9C, 0xCD, 0x9C, 0x30, 0x96,
-        0x30, 0x96, 0x5F, 0x90, 0x5F, 0x90, 0x62, 0x8B, 0x62, 0x8B, 0x44, 0x87, 0x44, 0x87, 0x0C, 0x84, 0x0C, 0x84,
-        0xC1, 0x81, 0xC1, 0x81, 0x67, 0x80, 0x67, 0x80, 0x01, 0x80, 0x01, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x11, 0x82,
-        0x11, 0x82, 0x83, 0x84, 0x83, 0x84, 0xE1, 0x87, 0xE1, 0x87, 0x24, 0x8C, 0x24, 0x8C, 0x46, 0x91, 0x46, 0x91,
-        0x39, 0x97, 0x39, 0x97, 0xF5, 0x9D, 0xF5, 0x9D, 0x6D, 0xA5, 0x6D, 0xA5, 0x91, 0xAD, 0x91, 0xAD, 0x53, 0xB6,
-        0x53, 0xB6, 0xA1, 0xBF, 0xA1, 0xBF, 0x6A, 0xC9, 0x6A, 0xC9, 0x9C, 0xD3, 0x9C, 0xD3, 0x22, 0xDE, 0x22, 0xDE,
-        0xEA, 0xE8, 0xEA, 0xE8, 0xDD, 0xF3, 0xDD, 0xF3, 0xE6, 0xFE, 0xE6, 0xFE, 0xF2, 0x09, 0xF2, 0x09, 0xEB, 0x14,
-        0xEB, 0x14, 0xBD, 0x1F, 0xBD, 0x1F, 0x52, 0x2A, 0x52, 0x2A, 0x96, 0x34, 0x96, 0x34, 0x75, 0x3E, 0x75, 0x3E,
-        0xDD, 0x47, 0xDD, 0x47, 0xBD, 0x50, 0xBD, 0x50, 0x02, 0x59, 0x02, 0x59, 0x9D, 0x60, 0x9D, 0x60, 0x7F, 0x67,
-        0x7F, 0x67, 0x9C, 0x6D, 0x9C, 0x6D, 0xE7, 0x72, 0xE7, 0x72, 0x57, 0x77, 0x57, 0x77, 0xE4, 0x7A, 0xE4, 0x7A,
-        0x86, 0x7D, 0x86, 0x7D, 0x37, 0x7F, 0x37, 0x7F, 0xF6, 0x7F, 0xF6, 0x7F, 0xC0, 0x7F, 0xC0, 0x7F, 0x97, 0x7E,
-        0x97, 0x7E, 0x7C, 0x7C, 0x7C, 0x7C, 0x73, 0x79, 0x73, 0x79, 0x82, 0x75, 0x82, 0x75, 0xB1, 0x70, 0xB1, 0x70,
-        0x09, 0x6B, 0x09, 0x6B, 0x94, 0x64, 0x94, 0x64, 0x5F, 0x5D, 0x5F, 0x5D, 0x78, 0x55, 0x78, 0x55, 0xED, 0x4C,
-        0xED, 0x4C, 0xD1, 0x43, 0xD1, 0x43, 0x32, 0x3A, 0x32, 0x3A, 0x24, 0x30, 0x24, 0x30, 0xBA, 0x25, 0xBA, 0x25,
-        0x08, 0x1B, 0x08, 0x1B, 0x23, 0x10, 0x23, 0x10, 0x1E, 0x05, 0x1E, 0x05, 0x11, 0xFA, 0x11, 0xFA, 0x0F, 0xEF,
-        0x0F, 0xEF, 0x2C, 0xE4, 0x2C, 0xE4, 0x7F, 0xD9, 0x7F, 0xD9, 0x1B, 0xCF, 0x1B, 0xCF, 0x15, 0xC5, 0x15, 0xC5,
-        0x7F, 0xBB, 0x7F, 0xBB, 0x6C, 0xB2, 0x6C, 0xB2, 0xED, 0xA9, 0xED, 0xA9, 0x13, 0xA2, 0x13, 0xA2, 0xEC, 0x9A,
-        0xEC, 0x9A, 0x85, 0x94, 0x85, 0x94, 0xED, 0x8E, 0xED, 0x8E, 0x2C, 0x8A, 0x2C, 0x8A, 0x4C, 0x86, 0x4C, 0x86,
-        0x54, 0x83, 0x54, 0x83, 0x4B, 0x81, 0x4B, 0x81, 0x34, 0x80, 0x34, 0x80, 0x10, 0x80, 0x10, 0x80, 0xE1, 0x80,
-        0xE1, 0x80, 0xA4, 0x82, 0xA4, 0x82, 0x57, 0x85, 0x57, 0x85, 0xF4, 0x88, 0xF4, 0x88, 0x75, 0x8D, 0x75, 0x8D,
-        0xD0, 0x92, 0xD0, 0x92, 0xFC, 0x98, 0xFC, 0x98, 0xED, 0x9F, 0xED, 0x9F, 0x94, 0xA7, 0x94, 0xA7, 0xE5, 0xAF,
-        0xE5, 0xAF, 0xD0, 0xB8, 0xD0, 0xB8, 0x41, 0xC2, 0x41, 0xC2, 0x29, 0xCC, 0x29, 0xCC, 0x73, 0xD6, 0x73, 0xD6,
-        0x0D, 0xE1, 0x0D, 0xE1, 0xE2, 0xEB, 0xE2, 0xEB, 0xDE, 0xF6, 0xDE, 0xF6, 0xEA, 0x01, 0xEA, 0x01, 0xF3, 0x0C,
-        0xF3, 0x0C, 0xE4, 0x17, 0xE4, 0x17, 0xA6, 0x22, 0xA6, 0x22, 0x27, 0x2D, 0x27, 0x2D, 0x52, 0x37, 0x52, 0x37,
-        0x13, 0x41, 0x13, 0x41, 0x57, 0x4A, 0x57, 0x4A, 0x0E, 0x53, 0x0E, 0x53, 0x26, 0x5B, 0x26, 0x5B, 0x90, 0x62,
-        0x90, 0x62, 0x3E, 0x69, 0x3E, 0x69, 0x23, 0x6F, 0x23, 0x6F, 0x33, 0x74, 0x33, 0x74, 0x66, 0x78, 0x66, 0x78,
-        0xB3, 0x7B, 0xB3, 0x7B, 0x14, 0x7E, 0x14, 0x7E, 0x83, 0x7F, 0x83, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x88, 0x7F,
-        0x88, 0x7F, 0x1C, 0x7E, 0x1C, 0x7E, 0xBF, 0x7B, 0xBF, 0x7B, 0x77, 0x78, 0x77, 0x78, 0x48, 0x74, 0x48, 0x74,
-        0x3B, 0x6F, 0x3B, 0x6F, 0x5A, 0x69, 0x5A, 0x69, 0xAF, 0x62, 0xAF, 0x62, 0x49, 0x5B, 0x49, 0x5B, 0x33, 0x53,
-        0x33, 0x53, 0x80, 0x4A, 0x80, 0x4A, 0x3D, 0x41, 0x3D, 0x41, 0x7E, 0x37, 0x7E, 0x37, 0x55, 0x2D, 0x55, 0x2D,
-        0xD6, 0x22, 0xD6, 0x22, 0x14, 0x18, 0x14, 0x18, 0x24, 0x0D, 0x24, 0x0D, 0x1B, 0x02, 0x1B, 0x02, 0x0E, 0xF7,
-        0x0E, 0xF7, 0x13, 0xEC, 0x13, 0xEC, 0x3D, 0xE1, 0x3D, 0xE1, 0xA2, 0xD6, 0xA2, 0xD6, 0x55, 0xCC, 0x55, 0xCC,
-        0x6C, 0xC2, 0x6C, 0xC2, 0xF8, 0xB8, 0xF8, 0xB8, 0x0C, 0xB0, 0x0C, 0xB0, 0xB8, 0xA7, 0xB8, 0xA7, 0x0D, 0xA0,
-        0x0D, 0xA0, 0x19, 0x99, 0x19, 0x99, 0xEA, 0x92, 0xEA, 0x92, 0x8B, 0x8D, 0x8B, 0x8D, 0x07, 0x89, 0x07, 0x89,
-        0x65, 0x85, 0x65, 0x85, 0xAE, 0x82, 0xAE, 0x82, 0xE6, 0x80, 0xE6, 0x80, 0x11, 0x80, 0x11, 0x80, 0x30, 0x80,
-        0x30, 0x80, 0x44, 0x81, 0x44, 0x81, 0x49, 0x83, 0x49, 0x83, 0x3D, 0x86, 0x3D, 0x86, 0x18, 0x8A, 0x18, 0x8A,
-        0xD6, 0x8E, 0xD6, 0x8E, 0x6B, 0x94, 0x6B, 0x94, 0xCD, 0x9A, 0xCD, 0x9A, 0xF2, 0xA1, 0xF2, 0xA1, 0xC9, 0xA9,
-        0xC9, 0xA9, 0x45, 0xB2, 0x45, 0xB2, 0x55, 0xBB, 0x55, 0xBB, 0xE9, 0xC4, 0xE9, 0xC4, 0xEE, 0xCE, 0xEE, 0xCE,
-        0x50, 0xD9, 0x50, 0xD9, 0xFC, 0xE3, 0xFC, 0xE3, 0xDE, 0xEE, 0xDE, 0xEE, 0xE0, 0xF9, 0xE0, 0xF9, 0xEE, 0x04,
-        0xEE, 0x04, 0xF2, 0x0F, 0xF2, 0x0F, 0xD9, 0x1A, 0xD9, 0x1A, 0x8B, 0x25, 0x8B, 0x25, 0xF6, 0x2F, 0xF6, 0x2F,
-        0x06, 0x3A, 0x06, 0x3A, 0xA7, 0x43, 0xA7, 0x43, 0xC6, 0x4C, 0xC6, 0x4C, 0x54, 0x55, 0x54, 0x55, 0x3E, 0x5D,
-        0x3E, 0x5D, 0x76, 0x64, 0x76, 0x64, 0xEE, 0x6A, 0xEE, 0x6A, 0x9A, 0x70, 0x9A, 0x70, 0x6F, 0x75, 0x6F, 0x75,
-        0x63, 0x79, 0x63, 0x79, 0x71, 0x7C, 0x71, 0x7C, 0x90, 0x7E, 0x90, 0x7E, 0xBE, 0x7F, 0xBE, 0x7F, 0xF7, 0x7F,
-        0xF7, 0x7F, 0x3C, 0x7F, 0x3C, 0x7F, 0x8F, 0x7D, 0x8F, 0x7D, 0xF1, 0x7A, 0xF1, 0x7A, 0x69, 0x77, 0x69, 0x77,
-        0xFD, 0x72, 0xFD, 0x72, 0xB5, 0x6D, 0xB5, 0x6D, 0x9C, 0x67, 0x9C, 0x67, 0xBD, 0x60, 0xBD, 0x60, 0x25, 0x59,
-        0x25, 0x59, 0xE3, 0x50, 0xE3, 0x50, 0x06, 0x48, 0x06, 0x48, 0xA0, 0x3E, 0xA0, 0x3E, 0xC3, 0x34, 0xC3, 0x34,
-        0x80, 0x2A, 0x80, 0x2A, 0xEC, 0x1F, 0xEC, 0x1F, 0x1C, 0x15, 0x1C, 0x15, 0x23, 0x0A, 0x23, 0x0A, 0x18, 0xFF,
-        0x18, 0xFF, 0x0D, 0xF4, 0x0D, 0xF4, 0x19, 0xE9, 0x19, 0xE9, 0x51, 0xDE, 0x51, 0xDE, 0xCA, 0xD3, 0xCA, 0xD3,
-        0x97, 0xC9, 0x97, 0xC9, 0xCB, 0xBF, 0xCB, 0xBF, 0x7B, 0xB6, 0x7B, 0xB6, 0xB6, 0xAD, 0xB6, 0xAD, 0x8F, 0xA5,
-        0x8F, 0xA5, 0x15, 0x9E, 0x15, 0x9E, 0x55, 0x97, 0x55, 0x97, 0x5E, 0x91, 0x5E, 0x91, 0x39, 0x8C, 0x39, 0x8C,
-        0xF2, 0x87, 0xF2, 0x87, 0x90, 0x84, 0x90, 0x84, 0x1A, 0x82, 0x1A, 0x82, 0x94, 0x80, 0x94, 0x80, 0x01, 0x80,
-        0x01, 0x80, 0x64, 0x80, 0x64, 0x80, 0xB9, 0x81, 0xB9, 0x81, 0x00, 0x84, 0x00, 0x84, 0x33, 0x87, 0x33, 0x87,
-        0x4E, 0x8B, 0x4E, 0x8B, 0x46, 0x90, 0x46, 0x90, 0x15, 0x96, 0x15, 0x96, 0xAD, 0x9C, 0xAD, 0x9C, 0x04, 0xA4,
-        0x04, 0xA4, 0x09, 0xAC, 0x09, 0xAC, 0xB0, 0xB4, 0xB0, 0xB4, 0xE7, 0xBD, 0xE7, 0xBD, 0x9A, 0xC7, 0x9A, 0xC7,
-        0xBA, 0xD1, 0xBA, 0xD1, 0x33, 0xDC, 0x33, 0xDC, 0xF0, 0xE6, 0xF0, 0xE6, 0xDC, 0xF1, 0xDC, 0xF1, 0xE4, 0xFC,
-        0xE4, 0xFC, 0xF1, 0x07, 0xF1, 0x07, 0xEF, 0x12, 0xEF, 0x12, 0xC9, 0x1D, 0xC9, 0x1D, 0x6A, 0x28, 0x6A, 0x28,
-        0xBF, 0x32, 0xBF, 0x32, 0xB2, 0x3C, 0xB2, 0x3C, 0x31, 0x46, 0x31, 0x46, 0x2B, 0x4F, 0x2B, 0x4F, 0x8D, 0x57,
-        0x8D, 0x57, 0x48, 0x5F, 0x48, 0x5F, 0x4D, 0x66, 0x4D, 0x66, 0x8E, 0x6C, 0x8E, 0x6C, 0x01, 0x72, 0x01, 0x72,
-        0x9A, 0x76, 0x9A, 0x76, 0x50, 0x7A, 0x50, 0x7A, 0x1C, 0x7D, 0x1C, 0x7D, 0xFA, 0x7E, 0xFA, 0x7E, 0xE5, 0x7F,
-        0xE5, 0x7F, 0xDD, 0x7F, 0xDD, 0x7F, 0xDF, 0x7E, 0xDF, 0x7E, 0xF0, 0x7C, 0xF0, 0x7C, 0x12, 0x7A, 0x12, 0x7A,
-        0x4B, 0x76, 0x4B, 0x76, 0xA1, 0x71, 0xA1, 0x71, 0x20, 0x6C, 0x20, 0x6C, 0xCF, 0x65, 0xCF, 0x65, 0xBC, 0x5E,
-        0xBC, 0x5E, 0xF4, 0x56, 0xF4, 0x56, 0x87, 0x4E, 0x87, 0x4E, 0x83, 0x45, 0x83, 0x45, 0xFA, 0x3B, 0xFA, 0x3B,
-        0xFF, 0x31, 0xFF, 0x31, 0xA5, 0x27, 0xA5, 0x27, 0xFE, 0x1C, 0xFE, 0x1C, 0x21, 0x12, 0x21, 0x12, 0x21, 0x07,
-        0x21, 0x07, 0x14, 0xFC, 0x14, 0xFC, 0x0D, 0xF1, 0x0D, 0xF1, 0x23, 0xE6, 0x23, 0xE6, 0x6B, 0xDB, 0x6B, 0xDB,
-        0xF8, 0xD0, 0xF8, 0xD0, 0xE0, 0xC6, 0xE0, 0xC6, 0x34, 0xBD, 0x34, 0xBD, 0x08, 0xB4, 0x08, 0xB4, 0x6D, 0xAB,
-        0x6D, 0xAB, 0x73, 0xA3, 0x73, 0xA3, 0x2B, 0x9C, 0x2B, 0x9C, 0xA1, 0x95, 0xA1, 0x95, 0xE1, 0x8F, 0xE1, 0x8F,
-        0xF8, 0x8A, 0xF8, 0x8A, 0xEF, 0x86, 0xEF, 0x86, 0xCC, 0x83, 0xCC, 0x83, 0x98, 0x81, 0x98, 0x81, 0x54, 0x80,
-        0x54, 0x80, 0x04, 0x80, 0x04, 0x80, 0xA8, 0x80, 0xA8, 0x80, 0x40, 0x82, 0x40, 0x82, 0xC8, 0x84, 0xC8, 0x84,
-        0x3B, 0x88, 0x3B, 0x88, 0x93, 0x8C, 0x93, 0x8C, 0xC7, 0x91, 0xC7, 0x91, 0xCE, 0x97, 0xCE, 0x97, 0x9C, 0x9E,
-        0x9C, 0x9E, 0x23, 0xA6, 0x23, 0xA6, 0x56, 0xAE, 0x56, 0xAE, 0x25, 0xB7, 0x25, 0xB7, 0x80, 0xC0, 0x80, 0xC0,
-        0x53, 0xCA, 0x53, 0xCA, 0x8E, 0xD4, 0x8E, 0xD4, 0x1B, 0xDF, 0x1B, 0xDF, 0xE6, 0xE9, 0xE6, 0xE9, 0xDD, 0xF4,
-        0xDD, 0xF4, 0xE8, 0xFF, 0xE8, 0xFF, 0xF2, 0x0A, 0xF2, 0x0A, 0xE9, 0x15, 0xE9, 0x15, 0xB6, 0x20, 0xB6, 0x20,
-        0x44, 0x2B, 0x44, 0x2B, 0x80, 0x35, 0x80, 0x35, 0x55, 0x3F, 0x55, 0x3F, 0xB2, 0x48, 0xB2, 0x48, 0x84, 0x51,
-        0x84, 0x51, 0xBA, 0x59, 0xBA, 0x59, 0x45, 0x61, 0x45, 0x61, 0x16, 0x68, 0x16, 0x68, 0x20, 0x6E, 0x20, 0x6E,
-        0x58, 0x73, 0x58, 0x73, 0xB4, 0x77, 0xB4, 0x77, 0x2B, 0x7B, 0x2B, 0x7B, 0xB7, 0x7D, 0xB7, 0x7D, 0x52, 0x7F,
-        0x52, 0x7F, 0xFB, 0x7F, 0xFB, 0x7F, 0xAF, 0x7F, 0xAF, 0x7F, 0x70, 0x7E, 0x70, 0x7E, 0x3F, 0x7C, 0x3F, 0x7C,
-        0x21, 0x79, 0x21, 0x79, 0x1B, 0x75, 0x1B, 0x75, 0x37, 0x70, 0x37, 0x70, 0x7A, 0x6A, 0x7A, 0x6A, 0xF4, 0x63,
-        0xF4, 0x63, 0xAE, 0x5C, 0xAE, 0x5C, 0xB8, 0x54, 0xB8, 0x54, 0x20, 0x4C, 0x20, 0x4C, 0xF6, 0x42, 0xF6, 0x42,
-        0x4C, 0x39, 0x4C, 0x39, 0x35, 0x2F, 0x35, 0x2F, 0xC4, 0x24, 0xC4, 0x24, 0x0D, 0x1A, 0x0D, 0x1A, 0x23, 0x0F,
-        0x23, 0x0F, 0x1E, 0x04, 0x1E, 0x04, 0x10, 0xF9, 0x10, 0xF9, 0x10, 0xEE, 0x10, 0xEE, 0x32, 0xE3, 0x32, 0xE3,
-        0x8A, 0xD8, 0x8A, 0xD8, 0x2E, 0xCE, 0x2E, 0xCE, 0x31, 0xC4, 0x31, 0xC4, 0xA6, 0xBA, 0xA6, 0xBA, 0xA0, 0xB1,
-        0xA0, 0xB1, 0x2F, 0xA9, 0x2F, 0xA9, 0x65, 0xA1, 0x65, 0xA1, 0x4F, 0x9A, 0x4F, 0x9A, 0xFB, 0x93, 0xFB, 0x93,
-        0x75, 0x8E, 0x75, 0x8E, 0xC8, 0x89, 0xC8, 0x89, 0xFD, 0x85, 0xFD, 0x85, 0x1B, 0x83, 0x1B, 0x83, 0x27, 0x81,
-        0x27, 0x81, 0x26, 0x80, 0x26, 0x80, 0x18, 0x80, 0x18, 0x80, 0x00, 0x81, 0x00, 0x81, 0xD9, 0x82, 0xD9, 0x82,
-        0xA2, 0x85, 0xA2, 0x85, 0x54, 0x89, 0x54, 0x89, 0xE9, 0x8D, 0xE9, 0x8D, 0x57, 0x93, 0x57, 0x93, 0x96, 0x99,
-        0x96, 0x99, 0x97, 0xA0, 0x97, 0xA0, 0x4F, 0xA8, 0x4F, 0xA8, 0xAF, 0xB0, 0xAF, 0xB0, 0xA6, 0xB9, 0xA6, 0xB9,
-        0x23, 0xC3, 0x23, 0xC3, 0x14, 0xCD, 0x14, 0xCD, 0x67, 0xD7, 0x67, 0xD7, 0x07, 0xE2, 0x07, 0xE2, 0xE0, 0xEC,
-        0xE0, 0xEC, 0xDE, 0xF7, 0xDE, 0xF7, 0xEB, 0x02, 0xEB, 0x02, 0xF3, 0x0D, 0xF3, 0x0D, 0xE1, 0x18, 0xE1, 0x18,
-        0x9E, 0x23, 0x9E, 0x23, 0x18, 0x2E, 0x18, 0x2E, 0x39, 0x38, 0x39, 0x38, 0xF0, 0x41, 0xF0, 0x41, 0x29, 0x4B,
-        0x29, 0x4B, 0xD1, 0x53, 0xD1, 0x53, 0xDA, 0x5B, 0xDA, 0x5B, 0x33, 0x63, 0x33, 0x63, 0xD0, 0x69, 0xD0, 0x69,
-        0xA1, 0x6F, 0xA1, 0x6F, 0x9F, 0x74, 0x9F, 0x74, 0xBC, 0x78, 0xBC, 0x78, 0xF5, 0x7B, 0xF5, 0x7B, 0x3F, 0x7E,
-        0x3F, 0x7E, 0x99, 0x7F, 0x99, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x71, 0x7F, 0x71, 0x7F, 0xEF, 0x7D, 0xEF, 0x7D,
-        0x7D, 0x7B, 0x7D, 0x7B, 0x1E, 0x78, 0x1E, 0x78, 0xDB, 0x73, 0xDB, 0x73, 0xBB, 0x6E, 0xBB, 0x6E, 0xC7, 0x68,
-        0xC7, 0x68, 0x0B, 0x62, 0x0B, 0x62, 0x93, 0x5A, 0x93, 0x5A, 0x6F, 0x52, 0x6F, 0x52, 0xAE, 0x49, 0xAE, 0x49,
-        0x5F, 0x40, 0x5F, 0x40, 0x96, 0x36, 0x96, 0x36, 0x64, 0x2C, 0x64, 0x2C, 0xDE, 0x21, 0xDE, 0x21, 0x17, 0x17,
-        0x17, 0x17, 0x23, 0x0C, 0x23, 0x0C, 0x1A, 0x01, 0x1A, 0x01, 0x0E, 0xF6, 0x0E, 0xF6, 0x14, 0xEB, 0x14, 0xEB,
-        0x43, 0xE0, 0x43, 0xE0, 0xAE, 0xD5, 0xAE, 0xD5, 0x6A, 0xCB, 0x6A, 0xCB, 0x8B, 0xC1, 0x8B, 0xC1, 0x22, 0xB8,
-        0x22, 0xB8, 0x43, 0xAF, 0x43, 0xAF, 0xFE, 0xA6, 0xFE, 0xA6, 0x63, 0x9F, 0x63, 0x9F, 0x81, 0x98, 0x81, 0x98,
-        0x64, 0x92, 0x64, 0x92, 0x19, 0x8D, 0x19, 0x8D, 0xA9, 0x88, 0xA9, 0x88, 0x1D, 0x85, 0x1D, 0x85, 0x7A, 0x82,
-        0x7A, 0x82, 0xC9, 0x80, 0xC9, 0x80, 0x0A, 0x80, 0x0A, 0x80, 0x40, 0x80, 0x40, 0x80, 0x68, 0x81, 0x68, 0x81,
-        0x84, 0x83, 0x84, 0x83, 0x8D, 0x86, 0x8D, 0x86, 0x7E, 0x8A, 0x7E, 0x8A, 0x4F, 0x8F, 0x4F, 0x8F, 0xF7, 0x94,
-        0xF7, 0x94, 0x6C, 0x9B, 0x6C, 0x9B, 0xA1, 0xA2, 0xA1, 0xA2, 0x88, 0xAA, 0x88, 0xAA, 0x12, 0xB3, 0x12, 0xB3,
-        0x2F, 0xBC, 0x2F, 0xBC, 0xCE, 0xC5, 0xCE, 0xC5, 0xDC, 0xCF, 0xDC, 0xCF, 0x46, 0xDA, 0x46, 0xDA, 0xF8, 0xE4,
-        0xF8, 0xE4, 0xDD, 0xEF, 0xDD, 0xEF, 0xE1, 0xFA, 0xE1, 0xFA, 0xEE, 0x05, 0xEE, 0x05, 0xF2, 0x10, 0xF2, 0x10,
-        0xD4, 0x1B, 0xD4, 0x1B, 0x81, 0x26, 0x81, 0x26, 0xE4, 0x30, 0xE4, 0x30, 0xEB, 0x3A, 0xEB, 0x3A, 0x81, 0x44,
-        0x81, 0x44, 0x94, 0x4D, 0x94, 0x4D, 0x13, 0x56, 0x13, 0x56, 0xED, 0x5D, 0xED, 0x5D, 0x14, 0x65, 0x14, 0x65,
-        0x7B, 0x6B, 0x7B, 0x6B, 0x13, 0x71, 0x13, 0x71, 0xD5, 0x75, 0xD5, 0x75, 0xB4, 0x79, 0xB4, 0x79, 0xAC, 0x7C,
-        0xAC, 0x7C, 0xB5, 0x7E, 0xB5, 0x7E, 0xCD, 0x7F, 0xCD, 0x7F, 0xF1, 0x7F, 0xF1, 0x7F, 0x1F, 0x7F, 0x1F, 0x7F,
-        0x5C, 0x7D, 0x5C, 0x7D, 0xA9, 0x7A, 0xA9, 0x7A, 0x0C, 0x77, 0x0C, 0x77, 0x8B, 0x72, 0x8B, 0x72, 0x30, 0x6D,
-        0x30, 0x6D, 0x04, 0x67, 0x04, 0x67, 0x14, 0x60, 0x14, 0x60, 0x6B, 0x58, 0x6B, 0x58, 0x1B, 0x50, 0x1B, 0x50,
-        0x31, 0x47, 0x31, 0x47, 0xBF, 0x3D, 0xBF, 0x3D, 0xD7, 0x33, 0xD7, 0x33, 0x8D, 0x29, 0x8D, 0x29, 0xF3, 0x1E,
-        0xF3, 0x1E, 0x1E, 0x14, 0x1E, 0x14, 0x22, 0x09, 0x22, 0x09, 0x16, 0xFE, 0x16, 0xFE, 0x0D, 0xF3, 0x0D, 0xF3,
-        0x1D, 0xE8, 0x1D, 0xE8, 0x5A, 0xDD, 0x5A, 0xDD, 0xD8, 0xD2, 0xD8, 0xD2, 0xAE, 0xC8, 0xAE, 0xC8, 0xED, 0xBE,
-        0xED, 0xBE, 0xA9, 0xB5, 0xA9, 0xB5, 0xF1, 0xAC, 0xF1, 0xAC, 0xDA, 0xA4, 0xDA, 0xA4, 0x70, 0x9D, 0x70, 0x9D,
-        0xC2, 0x96, 0xC2, 0x96, 0xDD, 0x90, 0xDD, 0x90, 0xCD, 0x8B, 0xCD, 0x8B, 0x9A, 0x87, 0x9A, 0x87, 0x4D, 0x84,
-        0x4D, 0x84, 0xEC, 0x81, 0xEC, 0x81, 0x7D, 0x80, 0x7D, 0x80, 0x00, 0x80, 0x00, 0x80, 0x78, 0x80, 0x78, 0x80,
-        0xE4, 0x81, 0xE4, 0x81, 0x40, 0x84, 0x40, 0x84, 0x89, 0x87, 0x89, 0x87, 0xB8, 0x8B, 0xB8, 0x8B, 0xC5, 0x90,
-        0xC5, 0x90, 0xA6, 0x96, 0xA6, 0x96, 0x51, 0x9D, 0x51, 0x9D, 0xB7, 0xA4, 0xB7, 0xA4, 0xCD, 0xAC, 0xCD, 0xAC,
-        0x81, 0xB5, 0x81, 0xB5, 0xC3, 0xBE, 0xC3, 0xBE, 0x82, 0xC8, 0x82, 0xC8, 0xAB, 0xD2, 0xAB, 0xD2, 0x2B, 0xDD,
-        0x2B, 0xDD, 0xEC, 0xE7, 0xEC, 0xE7, 0xDD, 0xF2, 0xDD, 0xF2, 0xE5, 0xFD, 0xE5, 0xFD, 0xF1, 0x08, 0xF1, 0x08,
-        0xED, 0x13, 0xED, 0x13, 0xC3, 0x1E, 0xC3, 0x1E, 0x5E, 0x29, 0x5E, 0x29, 0xAB, 0x33, 0xAB, 0x33, 0x94, 0x3D,
-        0x94, 0x3D, 0x08, 0x47, 0x08, 0x47, 0xF4, 0x4F, 0xF4, 0x4F, 0x48, 0x58, 0x48, 0x58, 0xF3, 0x5F, 0xF3, 0x5F,
-        0xE7, 0x66, 0xE7, 0x66, 0x16, 0x6D, 0x16, 0x6D, 0x75, 0x72, 0x75, 0x72, 0xF9, 0x76, 0xF9, 0x76, 0x9B, 0x7A,
-        0x9B, 0x7A, 0x52, 0x7D, 0x52, 0x7D, 0x1A, 0x7F, 0x1A, 0x7F, 0xEF, 0x7F, 0xEF, 0x7F, 0xCF, 0x7F, 0xCF, 0x7F,
-        0xBC, 0x7E, 0xBC, 0x7E, 0xB7, 0x7C, 0xB7, 0x7C, 0xC3, 0x79, 0xC3, 0x79, 0xE7, 0x75, 0xE7, 0x75, 0x2A, 0x71,
-        0x2A, 0x71, 0x95, 0x6B, 0x95, 0x6B, 0x33, 0x65, 0x33, 0x65, 0x0E, 0x5E, 0x0E, 0x5E, 0x37, 0x56, 0x37, 0x56,
-        0xBB, 0x4D, 0xBB, 0x4D, 0xAA, 0x44, 0xAA, 0x44, 0x16, 0x3B, 0x16, 0x3B, 0x12, 0x31, 0x12, 0x31, 0xB0, 0x26,
-        0xB0, 0x26, 0x03, 0x1C, 0x03, 0x1C, 0x22, 0x11, 0x22, 0x11, 0x20, 0x06, 0x20, 0x06, 0x12, 0xFB, 0x12, 0xFB,
-        0x0E, 0xF0, 0x0E, 0xF0, 0x28, 0xE5, 0x28, 0xE5, 0x75, 0xDA, 0x75, 0xDA, 0x0A, 0xD0, 0x0A, 0xD0, 0xFA, 0xC5,
-        0xFA, 0xC5, 0x59, 0xBC, 0x59, 0xBC, 0x3A, 0xB3, 0x3A, 0xB3, 0xAD, 0xAA, 0xAD, 0xAA, 0xC2, 0xA2, 0xC2, 0xA2,
-        0x8A, 0x9B, 0x8A, 0x9B, 0x12, 0x95, 0x12, 0x95, 0x66, 0x8F, 0x66, 0x8F, 0x91, 0x8A, 0x91, 0x8A, 0x9D, 0x86,
-        0x9D, 0x86, 0x8F, 0x83, 0x8F, 0x83, 0x71, 0x81, 0x71, 0x81, 0x42, 0x80, 0x42, 0x80, 0x09, 0x80, 0x09, 0x80,
-        0xC3, 0x80, 0xC3, 0x80, 0x71, 0x82, 0x71, 0x82, 0x0E, 0x85, 0x0E, 0x85, 0x97, 0x88, 0x97, 0x88, 0x03, 0x8D,
-        0x03, 0x8D, 0x4B, 0x92, 0x4B, 0x92, 0x64, 0x98, 0x64, 0x98, 0x43, 0x9F, 0x43, 0x9F, 0xDB, 0xA6, 0xDB, 0xA6,
-        0x1D, 0xAF, 0x1D, 0xAF, 0xFA, 0xB7, 0xFA, 0xB7, 0x60, 0xC1, 0x60, 0xC1, 0x3E, 0xCB, 0x3E, 0xCB, 0x80, 0xD5,
-        0x80, 0xD5, 0x14, 0xE0, 0x14, 0xE0, 0xE4, 0xEA, 0xE4, 0xEA, 0xDD, 0xF5, 0xDD, 0xF5, 0xE9, 0x00, 0xE9, 0x00,
-        0xF3, 0x0B, 0xF3, 0x0B, 0xE7, 0x16, 0xE7, 0x16, 0xAE, 0x21, 0xAE, 0x21, 0x36, 0x2C, 0x36, 0x2C, 0x69, 0x36,
-        0x69, 0x36, 0x35, 0x40, 0x35, 0x40, 0x85, 0x49, 0x85, 0x49, 0x4A, 0x52, 0x4A, 0x52, 0x71, 0x5A, 0x71, 0x5A,
-        0xEB, 0x61, 0xEB, 0x61, 0xAA, 0x68, 0xAA, 0x68, 0xA2, 0x6E, 0xA2, 0x6E, 0xC6, 0x73, 0xC6, 0x73, 0x0E, 0x78,
-        0x0E, 0x78, 0x70, 0x7B, 0x70, 0x7B, 0xE7, 0x7D, 0xE7, 0x7D, 0x6C, 0x7F, 0x6C, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F,
-        0x9C, 0x7F, 0x9C, 0x7F, 0x47, 0x7E, 0x47, 0x7E, 0x00, 0x7C, 0x00, 0x7C, 0xCD, 0x78, 0xCD, 0x78, 0xB2, 0x74,
-        0xB2, 0x74, 0xBA, 0x6F, 0xBA, 0x6F, 0xEB, 0x69, 0xEB, 0x69, 0x53, 0x63, 0x53, 0x63, 0xFC, 0x5B, 0xFC, 0x5B,
-        0xF6, 0x53, 0xF6, 0x53, 0x50, 0x4B, 0x50, 0x4B, 0x1A, 0x42, 0x1A, 0x42, 0x66, 0x38, 0x66, 0x38, 0x46, 0x2E,
-        0x46, 0x2E, 0xCD, 0x23, 0xCD, 0x23, 0x10, 0x19, 0x10, 0x19, 0x24, 0x0E, 0x24, 0x0E, 0x1C, 0x03, 0x1C, 0x03,
-        0x10, 0xF8, 0x10, 0xF8, 0x11, 0xED, 0x11, 0xED, 0x37, 0xE2, 0x37, 0xE2, 0x95, 0xD7, 0x95, 0xD7, 0x41, 0xCD,
-        0x41, 0xCD, 0x4E, 0xC3, 0x4E, 0xC3, 0xCE, 0xB9, 0xCE, 0xB9, 0xD5, 0xB0, 0xD5, 0xB0, 0x73, 0xA8, 0x73, 0xA8,
-        0xB8, 0xA0, 0xB8, 0xA0, 0xB3, 0x99, 0xB3, 0x99, 0x71, 0x93, 0x71, 0x93, 0xFF, 0x8D, 0xFF, 0x8D, 0x67, 0x89,
-        0x67, 0x89, 0xB0, 0x85, 0xB0, 0x85, 0xE4, 0x82, 0xE4, 0x82, 0x05, 0x81, 0x05, 0x81, 0x1B, 0x80, 0x1B, 0x80,
-        0x23, 0x80, 0x23, 0x80, 0x21, 0x81, 0x21, 0x81, 0x10, 0x83, 0x10, 0x83, 0xEE, 0x85, 0xEE, 0x85, 0xB5, 0x89,
-        0xB5, 0x89, 0x5E, 0x8E, 0x5E, 0x8E, 0xE0, 0x93, 0xE0, 0x93, 0x31, 0x9A, 0x31, 0x9A, 0x44, 0xA1, 0x44, 0xA1,
-        0x0B, 0xA9, 0x0B, 0xA9, 0x79, 0xB1, 0x79, 0xB1, 0x7D, 0xBA, 0x7D, 0xBA, 0x06, 0xC4, 0x06, 0xC4, 0x01, 0xCE,
-        0x01, 0xCE, 0x5B, 0xD8, 0x5B, 0xD8, 0x01, 0xE3, 0x01, 0xE3, 0xDF, 0xED, 0xDF, 0xED, 0xE0, 0xF8, 0xE0, 0xF8,
-        0xED, 0x03, 0xED, 0x03, 0xF3, 0x0E, 0xF3, 0x0E, 0xDD, 0x19, 0xDD, 0x19, 0x95, 0x24, 0x95, 0x24, 0x07, 0x2F,
-        0x07, 0x2F, 0x20, 0x39, 0x20, 0x39, 0xCC, 0x42, 0xCC, 0x42, 0xF8, 0x4B, 0xF8, 0x4B, 0x93, 0x54, 0x93, 0x54,
-        0x8D, 0x5C, 0x8D, 0x5C, 0xD5, 0x63, 0xD5, 0x63, 0x60, 0x6A, 0x60, 0x6A, 0x1F, 0x70, 0x1F, 0x70, 0x08, 0x75,
-        0x08, 0x75, 0x11, 0x79, 0x11, 0x79, 0x34, 0x7C, 0x34, 0x7C, 0x68, 0x7E, 0x68, 0x7E, 0xAD, 0x7F, 0xAD, 0x7F,
-        0xFC, 0x7F, 0xFC, 0x7F, 0x58, 0x7F, 0x58, 0x7F, 0xC0, 0x7D, 0xC0, 0x7D, 0x38, 0x7B, 0x38, 0x7B, 0xC5, 0x77,
-        0xC5, 0x77, 0x6D, 0x73, 0x6D, 0x73, 0x39, 0x6E, 0x39, 0x6E, 0x32, 0x68, 0x32, 0x68, 0x65, 0x61, 0x65, 0x61,
-        0xDD, 0x59, 0xDD, 0x59, 0xAA, 0x51, 0xAA, 0x51, 0xDB, 0x48, 0xDB, 0x48, 0x80, 0x3F, 0x80, 0x3F, 0xAD, 0x35,
-        0xAD, 0x35, 0x72, 0x2B, 0x72, 0x2B, 0xE5, 0x20, 0xE5, 0x20, 0x19, 0x16, 0x19, 0x16, 0x23, 0x0B, 0x23, 0x0B,
-        0x18, 0x00, 0x18, 0x00, 0x0D, 0xF5, 0x0D, 0xF5, 0x17, 0xEA, 0x17, 0xEA, 0x4A, 0xDF, 0x4A, 0xDF, 0xBC, 0xD4,
-        0xBC, 0xD4, 0x80, 0xCA, 0x80, 0xCA, 0xAA, 0xC0, 0xAA, 0xC0, 0x4E, 0xB7, 0x4E, 0xB7, 0x7C, 0xAE, 0x7C, 0xAE,
-        0x47, 0xA6, 0x47, 0xA6, 0xBC, 0x9E, 0xBC, 0x9E, 0xEB, 0x97, 0xEB, 0x97, 0xE0, 0x91, 0xE0, 0x91, 0xA8, 0x8C,
-        0xA8, 0x8C, 0x4C, 0x88, 0x4C, 0x88, 0xD5, 0x84, 0xD5, 0x84, 0x49, 0x82, 0x49, 0x82, 0xAE, 0x80, 0xAE, 0x80,
-        0x05, 0x80, 0x05, 0x80, 0x51, 0x80, 0x51, 0x80, 0x90, 0x81, 0x90, 0x81, 0xC1, 0x83, 0xC1, 0x83, 0xDF, 0x86,
-        0xDF, 0x86, 0xE5, 0x8A, 0xE5, 0x8A, 0xCA, 0x8F, 0xCA, 0x8F, 0x85, 0x95, 0x85, 0x95, 0x0C, 0x9C, 0x0C, 0x9C,
-        0x52, 0xA3, 0x52, 0xA3, 0x48, 0xAB, 0x48, 0xAB, 0xE1, 0xB3, 0xE1, 0xB3, 0x0A, 0xBD, 0x0A, 0xBD, 0xB4, 0xC6,
-        0xB4, 0xC6, 0xCB, 0xD0, 0xCB, 0xD0, 0x3C, 0xDB, 0x3C, 0xDB, 0xF4, 0xE5, 0xF4, 0xE5, 0xDD, 0xF0, 0xDD, 0xF0,
-        0xE3, 0xFB, 0xE3, 0xFB, 0xEF, 0x06, 0xEF, 0x06, 0xF0, 0x11, 0xF0, 0x11, 0xCF, 0x1C, 0xCF, 0x1C, 0x76, 0x27,
-        0x76, 0x27, 0xD2, 0x31, 0xD2, 0x31, 0xCF, 0x3B, 0xCF, 0x3B, 0x5A, 0x45, 0x5A, 0x45, 0x60, 0x4E, 0x60, 0x4E,
-        0xD1, 0x56, 0xD1, 0x56, 0x9B, 0x5E, 0x9B, 0x5E, 0xB2, 0x65, 0xB2, 0x65, 0x05, 0x6C, 0x05, 0x6C, 0x8B, 0x71,
-        0x8B, 0x71, 0x38, 0x76, 0x38, 0x76, 0x03, 0x7A, 0x03, 0x7A, 0xE5, 0x7C, 0xE5, 0x7C, 0xD9, 0x7E, 0xD9, 0x7E,
-        0xDA, 0x7F, 0xDA, 0x7F, 0xE7, 0x7F, 0xE7, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x27, 0x7D, 0x27, 0x7D, 0x5E, 0x7A,
-        0x5E, 0x7A, 0xAC, 0x76, 0xAC, 0x76, 0x17, 0x72, 0x17, 0x72, 0xA9, 0x6C, 0xA9, 0x6C, 0x6A, 0x66, 0x6A, 0x66,
-        0x69, 0x5F, 0x69, 0x5F, 0xB1, 0x57, 0xB1, 0x57, 0x51, 0x4F, 0x51, 0x4F, 0x5A, 0x46, 0x5A, 0x46, 0xDD, 0x3C,
-        0xDD, 0x3C, 0xEC, 0x32, 0xEC, 0x32, 0x99, 0x28, 0x99, 0x28, 0xF9, 0x1D, 0xF9, 0x1D, 0x20, 0x13, 0x20, 0x13,
-        0x21, 0x08, 0x21, 0x08, 0x15, 0xFD, 0x15, 0xFD, 0x0D, 0xF2, 0x0D, 0xF2, 0x20, 0xE7, 0x20, 0xE7, 0x62, 0xDC,
-        0x62, 0xDC, 0xE8, 0xD1, 0xE8, 0xD1, 0xC7, 0xC7, 0xC7, 0xC7, 0x10, 0xBE, 0x10, 0xBE, 0xD8, 0xB4, 0xD8, 0xB4,
-        0x2F, 0xAC, 0x2F, 0xAC, 0x26, 0xA4, 0x26, 0xA4, 0xCD, 0x9C, 0xCD, 0x9C, 0x30, 0x96, 0x30, 0x96, 0x5F, 0x90,
-        0x5F, 0x90, 0x62, 0x8B, 0x62, 0x8B, 0x44, 0x87, 0x44, 0x87, 0x0C, 0x84, 0x0C, 0x84, 0xC1, 0x81, 0xC1, 0x81,
-        0x67, 0x80, 0x67, 0x80, 0x01, 0x80, 0x01, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x11, 0x82, 0x11, 0x82, 0x83, 0x84,
-        0x83, 0x84, 0xE1, 0x87, 0xE1, 0x87, 0x24, 0x8C, 0x24, 0x8C, 0x46, 0x91, 0x46, 0x91, 0x39, 0x97, 0x39, 0x97,
-        0xF5, 0x9D, 0xF5, 0x9D, 0x6D, 0xA5, 0x6D, 0xA5, 0x91, 0xAD, 0x91, 0xAD, 0x53, 0xB6, 0x53, 0xB6, 0xA1, 0xBF,
-        0xA1, 0xBF, 0x6A, 0xC9, 0x6A, 0xC9, 0x9C, 0xD3, 0x9C, 0xD3, 0x22, 0xDE, 0x22, 0xDE, 0xEA, 0xE8, 0xEA, 0xE8,
-        0xDD, 0xF3, 0xDD, 0xF3, 0xE6, 0xFE, 0xE6, 0xFE, 0xF2, 0x09, 0xF2, 0x09, 0xEB, 0x14, 0xEB, 0x14, 0xBD, 0x1F,
-        0xBD, 0x1F, 0x52, 0x2A, 0x52, 0x2A, 0x96, 0x34, 0x96, 0x34, 0x75, 0x3E, 0x75, 0x3E, 0xDD, 0x47, 0xDD, 0x47,
-        0xBD, 0x50, 0xBD, 0x50, 0x02, 0x59, 0x02, 0x59, 0x9D, 0x60, 0x9D, 0x60, 0x7F, 0x67, 0x7F, 0x67, 0x9C, 0x6D,
-        0x9C, 0x6D, 0xE7, 0x72, 0xE7, 0x72, 0x57, 0x77, 0x57, 0x77, 0xE4, 0x7A, 0xE4, 0x7A, 0x86, 0x7D, 0x86, 0x7D,
-        0x37, 0x7F, 0x37, 0x7F, 0xF6, 0x7F, 0xF6, 0x7F, 0xC0, 0x7F, 0xC0, 0x7F, 0x97, 0x7E, 0x97, 0x7E, 0x7C, 0x7C,
-        0x7C, 0x7C, 0x73, 0x79, 0x73, 0x79, 0x82, 0x75, 0x82, 0x75, 0xB1, 0x70, 0xB1, 0x70, 0x09, 0x6B, 0x09, 0x6B,
-        0x94, 0x64, 0x94, 0x64, 0x5F, 0x5D, 0x5F, 0x5D, 0x78, 0x55, 0x78, 0x55, 0xED, 0x4C, 0xED, 0x4C, 0xD1, 0x43,
-        0xD1, 0x43, 0x32, 0x3A, 0x32, 0x3A, 0x24, 0x30, 0x24, 0x30, 0xBA, 0x25, 0xBA, 0x25, 0x08, 0x1B, 0x08, 0x1B,
-        0x23, 0x10, 0x23, 0x10, 0x1E, 0x05, 0x1E, 0x05, 0x11, 0xFA, 0x11, 0xFA, 0x0F, 0xEF, 0x0F, 0xEF, 0x2C, 0xE4,
-        0x2C, 0xE4, 0x7F, 0xD9, 0x7F, 0xD9, 0x1B, 0xCF, 0x1B, 0xCF, 0x15, 0xC5, 0x15, 0xC5, 0x7F, 0xBB, 0x7F, 0xBB,
-        0x6C, 0xB2, 0x6C, 0xB2, 0xED, 0xA9, 0xED, 0xA9, 0x13, 0xA2, 0x13, 0xA2, 0xEC, 0x9A, 0xEC, 0x9A, 0x85, 0x94,
-        0x85, 0x94, 0xED, 0x8E, 0xED, 0x8E, 0x2C, 0x8A, 0x2C, 0x8A, 0x4C, 0x86, 0x4C, 0x86, 0x54, 0x83, 0x54, 0x83,
-        0x4B, 0x81, 0x4B, 0x81, 0x34, 0x80, 0x34, 0x80, 0x10, 0x80, 0x10, 0x80, 0xE1, 0x80, 0xE1, 0x80, 0xA4, 0x82,
-        0xA4, 0x82, 0x57, 0x85, 0x57, 0x85, 0xF4, 0x88, 0xF4, 0x88, 0x75, 0x8D, 0x75, 0x8D, 0xD0, 0x92, 0xD0, 0x92,
-        0xFC, 0x98, 0xFC, 0x98, 0xED, 0x9F, 0xED, 0x9F, 0x94, 0xA7, 0x94, 0xA7, 0xE5, 0xAF, 0xE5, 0xAF, 0xD0, 0xB8,
-        0xD0, 0xB8, 0x41, 0xC2, 0x41, 0xC2, 0x29, 0xCC, 0x29, 0xCC, 0x73, 0xD6, 0x73, 0xD6, 0x0D, 0xE1, 0x0D, 0xE1,
-        0xE2, 0xEB, 0xE2, 0xEB, 0xDE, 0xF6, 0xDE, 0xF6, 0xEA, 0x01, 0xEA, 0x01, 0xF3, 0x0C, 0xF3, 0x0C, 0xE4, 0x17,
-        0xE4, 0x17, 0xA6, 0x22, 0xA6, 0x22, 0x27, 0x2D, 0x27, 0x2D, 0x52, 0x37, 0x52, 0x37, 0x13, 0x41, 0x13, 0x41,
-        0x57, 0x4A, 0x57, 0x4A, 0x0E, 0x53, 0x0E, 0x53, 0x26, 0x5B, 0x26, 0x5B, 0x90, 0x62, 0x90, 0x62, 0x3E, 0x69,
-        0x3E, 0x69, 0x23, 0x6F, 0x23, 0x6F, 0x33, 0x74, 0x33, 0x74, 0x66, 0x78, 0x66, 0x78, 0xB3, 0x7B, 0xB3, 0x7B,
-        0x14, 0x7E, 0x14, 0x7E, 0x83, 0x7F, 0x83, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x88, 0x7F, 0x88, 0x7F, 0x1C, 0x7E,
-        0x1C, 0x7E, 0xBF, 0x7B, 0xBF, 0x7B, 0x77, 0x78, 0x77, 0x78, 0x48, 0x74, 0x48, 0x74, 0x3B, 0x6F, 0x3B, 0x6F,
-        0x5A, 0x69, 0x5A, 0x69, 0xAF, 0x62, 0xAF, 0x62, 0x49, 0x5B, 0x49, 0x5B, 0x33, 0x53, 0x33, 0x53, 0x80, 0x4A,
-        0x80, 0x4A, 0x3D, 0x41, 0x3D, 0x41, 0x7E, 0x37, 0x7E, 0x37, 0x55, 0x2D, 0x55, 0x2D, 0xD6, 0x22, 0xD6, 0x22,
-        0x14, 0x18, 0x14, 0x18, 0x24, 0x0D, 0x24, 0x0D, 0x1B, 0x02, 0x1B, 0x02, 0x0E, 0xF7, 0x0E, 0xF7, 0x13, 0xEC,
-        0x13, 0xEC, 0x3D, 0xE1, 0x3D, 0xE1, 0xA2, 0xD6, 0xA2, 0xD6, 0x55, 0xCC, 0x55, 0xCC, 0x6C, 0xC2, 0x6C, 0xC2,
-        0xF8, 0xB8, 0xF8, 0xB8, 0x0C, 0xB0, 0x0C, 0xB0, 0xB8, 0xA7, 0xB8, 0xA7, 0x0D, 0xA0, 0x0D, 0xA0, 0x19, 0x99,
-        0x19, 0x99, 0xEA, 0x92, 0xEA, 0x92, 0x8B, 0x8D, 0x8B, 0x8D, 0x07, 0x89, 0x07, 0x89, 0x65, 0x85, 0x65, 0x85,
-        0xAE, 0x82, 0xAE, 0x82, 0xE6, 0x80, 0xE6, 0x80, 0x11, 0x80, 0x11, 0x80, 0x30, 0x80, 0x30, 0x80, 0x44, 0x81,
-        0x44, 0x81, 0x49, 0x83, 0x49, 0x83, 0x3D, 0x86, 0x3D, 0x86, 0x18, 0x8A, 0x18, 0x8A, 0xD6, 0x8E, 0xD6, 0x8E,
-        0x6B, 0x94, 0x6B, 0x94, 0xCD, 0x9A, 0xCD, 0x9A, 0xF2, 0xA1, 0xF2, 0xA1, 0xC9, 0xA9, 0xC9, 0xA9, 0x45, 0xB2,
-        0x45, 0xB2, 0x55, 0xBB, 0x55, 0xBB, 0xE9, 0xC4, 0xE9, 0xC4, 0xEE, 0xCE, 0xEE, 0xCE, 0x50, 0xD9, 0x50, 0xD9,
-        0xFC, 0xE3, 0xFC, 0xE3, 0xDE, 0xEE, 0xDE, 0xEE, 0xE0, 0xF9, 0xE0, 0xF9, 0xEE, 0x04, 0xEE, 0x04, 0xF2, 0x0F,
-        0xF2, 0x0F, 0xD9, 0x1A, 0xD9, 0x1A, 0x8B, 0x25, 0x8B, 0x25, 0xF6, 0x2F, 0xF6, 0x2F, 0x06, 0x3A, 0x06, 0x3A,
-        0xA7, 0x43, 0xA7, 0x43, 0xC6, 0x4C, 0xC6, 0x4C, 0x54, 0x55, 0x54, 0x55, 0x3E, 0x5D, 0x3E, 0x5D, 0x76, 0x64,
-        0x76, 0x64, 0xEE, 0x6A, 0xEE, 0x6A, 0x9A, 0x70, 0x9A, 0x70, 0x6F, 0x75, 0x6F, 0x75, 0x63, 0x79, 0x63, 0x79,
-        0x71, 0x7C, 0x71, 0x7C, 0x90, 0x7E, 0x90, 0x7E, 0xBE, 0x7F, 0xBE, 0x7F, 0xF7, 0x7F, 0xF7, 0x7F, 0x3C, 0x7F,
-        0x3C, 0x7F, 0x8F, 0x7D, 0x8F, 0x7D, 0xF1, 0x7A, 0xF1, 0x7A, 0x69, 0x77, 0x69, 0x77, 0xFD, 0x72, 0xFD, 0x72,
-        0xB5, 0x6D, 0xB5, 0x6D, 0x9C, 0x67, 0x9C, 0x67, 0xBD, 0x60, 0xBD, 0x60, 0x25, 0x59, 0x25, 0x59, 0xE3, 0x50,
-        0xE3, 0x50, 0x06, 0x48, 0x06, 0x48, 0xA0, 0x3E, 0xA0, 0x3E, 0xC3, 0x34, 0xC3, 0x34, 0x80, 0x2A, 0x80, 0x2A,
-        0xEC, 0x1F, 0xEC, 0x1F, 0x1C, 0x15, 0x1C, 0x15, 0x23, 0x0A, 0x23, 0x0A, 0x18, 0xFF, 0x18, 0xFF, 0x0D, 0xF4,
-        0x0D, 0xF4, 0x19, 0xE9, 0x19, 0xE9, 0x51, 0xDE, 0x51, 0xDE, 0xCA, 0xD3, 0xCA, 0xD3, 0x97, 0xC9, 0x97, 0xC9,
-        0xCB, 0xBF, 0xCB, 0xBF, 0x7B, 0xB6, 0x7B, 0xB6, 0xB6, 0xAD, 0xB6, 0xAD, 0x8F, 0xA5, 0x8F, 0xA5, 0x15, 0x9E,
-        0x15, 0x9E, 0x55, 0x97, 0x55, 0x97, 0x5E, 0x91, 0x5E, 0x91, 0x39, 0x8C, 0x39, 0x8C, 0xF2, 0x87, 0xF2, 0x87,
-        0x90, 0x84, 0x90, 0x84, 0x1A, 0x82, 0x1A, 0x82, 0x94, 0x80, 0x94, 0x80, 0x01, 0x80, 0x01, 0x80, 0x64, 0x80,
-        0x64, 0x80, 0xB9, 0x81, 0xB9, 0x81, 0x00, 0x84, 0x00, 0x84, 0x33, 0x87, 0x33, 0x87, 0x4E, 0x8B, 0x4E, 0x8B,
-        0x46, 0x90, 0x46, 0x90, 0x15, 0x96, 0x15, 0x96, 0xAD, 0x9C, 0xAD, 0x9C, 0x04, 0xA4, 0x04, 0xA4, 0x09, 0xAC,
-        0x09, 0xAC, 0xB0, 0xB4, 0xB0, 0xB4, 0xE7, 0xBD, 0xE7, 0xBD, 0x9A, 0xC7, 0x9A, 0xC7, 0xBA, 0xD1, 0xBA, 0xD1,
-        0x33, 0xDC, 0x33, 0xDC, 0xF0, 0xE6, 0xF0, 0xE6, 0xDC, 0xF1, 0xDC, 0xF1, 0xE4, 0xFC, 0xE4, 0xFC, 0xF1, 0x07,
-        0xF1, 0x07, 0xEF, 0x12, 0xEF, 0x12, 0xC9, 0x1D, 0xC9, 0x1D, 0x6A, 0x28, 0x6A, 0x28, 0xBF, 0x32, 0xBF, 0x32,
-        0xB2, 0x3C, 0xB2, 0x3C, 0x31, 0x46, 0x31, 0x46, 0x2B, 0x4F, 0x2B, 0x4F, 0x8D, 0x57, 0x8D, 0x57, 0x48, 0x5F,
-        0x48, 0x5F, 0x4D, 0x66, 0x4D, 0x66, 0x8E, 0x6C, 0x8E, 0x6C, 0x01, 0x72, 0x01, 0x72, 0x9A, 0x76, 0x9A, 0x76,
-        0x50, 0x7A, 0x50, 0x7A, 0x1C, 0x7D, 0x1C, 0x7D, 0xFA, 0x7E, 0xFA, 0x7E, 0xE5, 0x7F, 0xE5, 0x7F, 0xDD, 0x7F,
-        0xDD, 0x7F, 0xDF, 0x7E, 0xDF, 0x7E, 0xF0, 0x7C, 0xF0, 0x7C, 0x12, 0x7A, 0x12, 0x7A, 0x4B, 0x76, 0x4B, 0x76,
-        0xA1, 0x71, 0xA1, 0x71, 0x20, 0x6C, 0x20, 0x6C, 0xCF, 0x65, 0xCF, 0x65, 0xBC, 0x5E, 0xBC, 0x5E, 0xF4, 0x56,
-        0xF4, 0x56, 0x87, 0x4E, 0x87, 0x4E, 0x83, 0x45, 0x83, 0x45, 0xFA, 0x3B, 0xFA, 0x3B, 0xFF, 0x31, 0xFF, 0x31,
-        0xA5, 0x27, 0xA5, 0x27, 0xFE, 0x1C, 0xFE, 0x1C, 0x21, 0x12, 0x21, 0x12, 0x21, 0x07, 0x21, 0x07, 0x14, 0xFC,
-        0x14, 0xFC, 0x0D, 0xF1, 0x0D, 0xF1, 0x23, 0xE6, 0x23, 0xE6, 0x6B, 0xDB, 0x6B, 0xDB, 0xF8, 0xD0, 0xF8, 0xD0,
-        0xE0, 0xC6, 0xE0, 0xC6, 0x34, 0xBD, 0x34, 0xBD, 0x08, 0xB4, 0x08, 0xB4, 0x6D, 0xAB, 0x6D, 0xAB, 0x73, 0xA3,
-        0x73, 0xA3, 0x2B, 0x9C, 0x2B, 0x9C, 0xA1, 0x95, 0xA1, 0x95, 0xE1, 0x8F, 0xE1, 0x8F, 0xF8, 0x8A, 0xF8, 0x8A,
-        0xEF, 0x86, 0xEF, 0x86, 0xCC, 0x83, 0xCC, 0x83, 0x98, 0x81, 0x98, 0x81, 0x54, 0x80, 0x54, 0x80, 0x04, 0x80,
-        0x04, 0x80, 0xA8, 0x80, 0xA8, 0x80, 0x40, 0x82, 0x40, 0x82, 0xC8, 0x84, 0xC8, 0x84, 0x3B, 0x88, 0x3B, 0x88,
-        0x93, 0x8C, 0x93, 0x8C, 0xC7, 0x91, 0xC7, 0x91, 0xCE, 0x97, 0xCE, 0x97, 0x9C, 0x9E, 0x9C, 0x9E, 0x23, 0xA6,
-        0x23, 0xA6, 0x56, 0xAE, 0x56, 0xAE, 0x25, 0xB7, 0x25, 0xB7, 0x80, 0xC0, 0x80, 0xC0, 0x53, 0xCA, 0x53, 0xCA,
-        0x8E, 0xD4, 0x8E, 0xD4, 0x1B, 0xDF, 0x1B, 0xDF, 0xE6, 0xE9, 0xE6, 0xE9, 0xDD, 0xF4, 0xDD, 0xF4, 0xE8, 0xFF,
-        0xE8, 0xFF, 0xF2, 0x0A, 0xF2, 0x0A, 0xE9, 0x15, 0xE9, 0x15, 0xB6, 0x20, 0xB6, 0x20, 0x44, 0x2B, 0x44, 0x2B,
-        0x80, 0x35, 0x80, 0x35, 0x55, 0x3F, 0x55, 0x3F, 0xB2, 0x48, 0xB2, 0x48, 0x84, 0x51, 0x84, 0x51, 0xBA, 0x59,
-        0xBA, 0x59, 0x45, 0x61, 0x45, 0x61, 0x16, 0x68, 0x16, 0x68, 0x20, 0x6E, 0x20, 0x6E, 0x58, 0x73, 0x58, 0x73,
-        0xB4, 0x77, 0xB4, 0x77, 0x2B, 0x7B, 0x2B, 0x7B, 0xB7, 0x7D, 0xB7, 0x7D, 0x52, 0x7F, 0x52, 0x7F, 0xFB, 0x7F,
-        0xFB, 0x7F, 0xAF, 0x7F, 0xAF, 0x7F, 0x70, 0x7E, 0x70, 0x7E, 0x3F, 0x7C, 0x3F, 0x7C, 0x21, 0x79, 0x21, 0x79,
-        0x1B, 0x75, 0x1B, 0x75, 0x37, 0x70, 0x37, 0x70, 0x7A, 0x6A, 0x7A, 0x6A, 0xF4, 0x63, 0xF4, 0x63, 0xAE, 0x5C,
-        0xAE, 0x5C, 0xB8, 0x54, 0xB8, 0x54, 0x20, 0x4C, 0x20, 0x4C, 0xF6, 0x42, 0xF6, 0x42, 0x4C, 0x39, 0x4C, 0x39,
-        0x35, 0x2F, 0x35, 0x2F, 0xC4, 0x24, 0xC4, 0x24, 0x0D, 0x1A, 0x0D, 0x1A, 0x23, 0x0F, 0x23, 0x0F, 0x1E, 0x04,
-        0x1E, 0x04, 0x10, 0xF9, 0x10, 0xF9, 0x10, 0xEE, 0x10, 0xEE, 0x32, 0xE3, 0x32, 0xE3, 0x8A, 0xD8, 0x8A, 0xD8,
-        0x2E, 0xCE, 0x2E, 0xCE, 0x31, 0xC4, 0x31, 0xC4, 0xA6, 0xBA, 0xA6, 0xBA, 0xA0, 0xB1, 0xA0, 0xB1, 0x2F, 0xA9,
-        0x2F, 0xA9, 0x65, 0xA1, 0x65, 0xA1, 0x4F, 0x9A, 0x4F, 0x9A, 0xFB, 0x93, 0xFB, 0x93, 0x75, 0x8E, 0x75, 0x8E,
-        0xC8, 0x89, 0xC8, 0x89, 0xFD, 0x85, 0xFD, 0x85, 0x1B, 0x83, 0x1B, 0x83, 0x27, 0x81, 0x27, 0x81, 0x26, 0x80,
-        0x26, 0x80, 0x18, 0x80, 0x18, 0x80, 0x00, 0x81, 0x00, 0x81, 0xD9, 0x82, 0xD9, 0x82, 0xA2, 0x85, 0xA2, 0x85,
-        0x54, 0x89, 0x54, 0x89, 0xE9, 0x8D, 0xE9, 0x8D, 0x57, 0x93, 0x57, 0x93, 0x96, 0x99, 0x96, 0x99, 0x97, 0xA0,
-        0x97, 0xA0, 0x4F, 0xA8, 0x4F, 0xA8, 0xAF, 0xB0, 0xAF, 0xB0, 0xA6, 0xB9, 0xA6, 0xB9, 0x23, 0xC3, 0x23, 0xC3,
-        0x14, 0xCD, 0x14, 0xCD, 0x67, 0xD7, 0x67, 0xD7, 0x07, 0xE2, 0x07, 0xE2, 0xE0, 0xEC, 0xE0, 0xEC, 0xDE, 0xF7,
-        0xDE, 0xF7, 0xEB, 0x02, 0xEB, 0x02, 0xF3, 0x0D, 0xF3, 0x0D, 0xE1, 0x18, 0xE1, 0x18, 0x9E, 0x23, 0x9E, 0x23,
-        0x18, 0x2E, 0x18, 0x2E, 0x39, 0x38, 0x39, 0x38, 0xF0, 0x41, 0xF0, 0x41, 0x29, 0x4B, 0x29, 0x4B, 0xD1, 0x53,
-        0xD1, 0x53, 0xDA, 0x5B, 0xDA, 0x5B, 0x33, 0x63, 0x33, 0x63, 0xD0, 0x69, 0xD0, 0x69, 0xA1, 0x6F, 0xA1, 0x6F,
-        0x9F, 0x74, 0x9F, 0x74, 0xBC, 0x78, 0xBC, 0x78, 0xF5, 0x7B, 0xF5, 0x7B, 0x3F, 0x7E, 0x3F, 0x7E, 0x99, 0x7F,
-        0x99, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x71, 0x7F, 0x71, 0x7F, 0xEF, 0x7D, 0xEF, 0x7D, 0x7D, 0x7B, 0x7D, 0x7B,
-        0x1E, 0x78, 0x1E, 0x78, 0xDB, 0x73, 0xDB, 0x73, 0xBB, 0x6E, 0xBB, 0x6E, 0xC7, 0x68, 0xC7, 0x68, 0x0B, 0x62,
-        0x0B, 0x62, 0x93, 0x5A, 0x93, 0x5A, 0x6F, 0x52, 0x6F, 0x52, 0xAE, 0x49, 0xAE, 0x49, 0x5F, 0x40, 0x5F, 0x40,
-        0x96, 0x36, 0x96, 0x36, 0x64, 0x2C, 0x64, 0x2C, 0xDE, 0x21, 0xDE, 0x21, 0x17, 0x17, 0x17, 0x17, 0x23, 0x0C,
-        0x23, 0x0C, 0x1A, 0x01, 0x1A, 0x01, 0x0E, 0xF6, 0x0E, 0xF6, 0x14, 0xEB, 0x14, 0xEB, 0x43, 0xE0, 0x43, 0xE0,
-        0xAE, 0xD5, 0xAE, 0xD5, 0x6A, 0xCB, 0x6A, 0xCB, 0x8B, 0xC1, 0x8B, 0xC1, 0x22, 0xB8, 0x22, 0xB8, 0x43, 0xAF,
-        0x43, 0xAF, 0xFE, 0xA6, 0xFE, 0xA6, 0x63, 0x9F, 0x63, 0x9F, 0x81, 0x98, 0x81, 0x98, 0x64, 0x92, 0x64, 0x92,
-        0x19, 0x8D, 0x19, 0x8D, 0xA9, 0x88, 0xA9, 0x88, 0x1D, 0x85, 0x1D, 0x85, 0x7A, 0x82, 0x7A, 0x82, 0xC9, 0x80,
-        0xC9, 0x80, 0x0A, 0x80, 0x0A, 0x80, 0x40, 0x80, 0x40, 0x80, 0x68, 0x81, 0x68, 0x81, 0x84, 0x83, 0x84, 0x83,
-        0x8D, 0x86, 0x8D, 0x86, 0x7E, 0x8A, 0x7E, 0x8A, 0x4F, 0x8F, 0x4F, 0x8F, 0xF7, 0x94, 0xF7, 0x94, 0x6C, 0x9B,
-        0x6C, 0x9B, 0xA1, 0xA2, 0xA1, 0xA2, 0x88, 0xAA, 0x88, 0xAA, 0x12, 0xB3, 0x12, 0xB3, 0x2F, 0xBC, 0x2F, 0xBC,
-        0xCE, 0xC5, 0xCE, 0xC5, 0xDC, 0xCF, 0xDC, 0xCF, 0x46, 0xDA, 0x46, 0xDA, 0xF8, 0xE4, 0xF8, 0xE4, 0xDD, 0xEF,
-        0xDD, 0xEF, 0xE1, 0xFA, 0xE1, 0xFA, 0xEE, 0x05, 0xEE, 0x05, 0xF2, 0x10, 0xF2, 0x10, 0xD4, 0x1B, 0xD4, 0x1B,
-        0x81, 0x26, 0x81, 0x26, 0xE4, 0x30, 0xE4, 0x30, 0xEB, 0x3A, 0xEB, 0x3A, 0x81, 0x44, 0x81, 0x44, 0x94, 0x4D,
-        0x94, 0x4D, 0x13, 0x56, 0x13, 0x56, 0xED, 0x5D, 0xED, 0x5D, 0x14, 0x65, 0x14, 0x65, 0x7B, 0x6B, 0x7B, 0x6B,
-        0x13, 0x71, 0x13, 0x71, 0xD5, 0x75, 0xD5, 0x75, 0xB4, 0x79, 0xB4, 0x79, 0xAC, 0x7C, 0xAC, 0x7C, 0xB5, 0x7E,
-        0xB5, 0x7E, 0xCD, 0x7F, 0xCD, 0x7F, 0xF1, 0x7F, 0xF1, 0x7F, 0x1F, 0x7F, 0x1F, 0x7F, 0x5C, 0x7D, 0x5C, 0x7D,
-        0xA9, 0x7A, 0xA9, 0x7A, 0x0C, 0x77, 0x0C, 0x77, 0x8B, 0x72, 0x8B, 0x72, 0x30, 0x6D, 0x30, 0x6D, 0x04, 0x67,
-        0x04, 0x67, 0x14, 0x60, 0x14, 0x60, 0x6B, 0x58, 0x6B, 0x58, 0x1B, 0x50, 0x1B, 0x50, 0x31, 0x47, 0x31, 0x47,
-        0xBF, 0x3D, 0xBF, 0x3D, 0xD7, 0x33, 0xD7, 0x33, 0x8D, 0x29, 0x8D, 0x29, 0xF3, 0x1E, 0xF3, 0x1E, 0x1E, 0x14,
-        0x1E, 0x14, 0x22, 0x09, 0x22, 0x09, 0x16, 0xFE, 0x16, 0xFE, 0x0D, 0xF3, 0x0D, 0xF3, 0x1D, 0xE8, 0x1D, 0xE8,
-        0x5A, 0xDD, 0x5A, 0xDD, 0xD8, 0xD2, 0xD8, 0xD2, 0xAE, 0xC8, 0xAE, 0xC8, 0xED, 0xBE, 0xED, 0xBE, 0xA9, 0xB5,
-        0xA9, 0xB5, 0xF1, 0xAC, 0xF1, 0xAC, 0xDA, 0xA4, 0xDA, 0xA4, 0x70, 0x9D, 0x70, 0x9D, 0xC2, 0x96, 0xC2, 0x96,
-        0xDD, 0x90, 0xDD, 0x90, 0xCD, 0x8B, 0xCD, 0x8B, 0x9A, 0x87, 0x9A, 0x87, 0x4D, 0x84, 0x4D, 0x84, 0xEC, 0x81,
-        0xEC, 0x81, 0x7D, 0x80, 0x7D, 0x80, 0x00, 0x80, 0x00, 0x80, 0x78, 0x80, 0x78, 0x80, 0xE4, 0x81, 0xE4, 0x81,
-        0x40, 0x84, 0x40, 0x84, 0x89, 0x87, 0x89, 0x87, 0xB8, 0x8B, 0xB8, 0x8B, 0xC5, 0x90, 0xC5, 0x90, 0xA6, 0x96,
-        0xA6, 0x96, 0x51, 0x9D, 0x51, 0x9D, 0xB7, 0xA4, 0xB7, 0xA4, 0xCD, 0xAC, 0xCD, 0xAC, 0x81, 0xB5, 0x81, 0xB5,
-        0xC3, 0xBE, 0xC3, 0xBE, 0x82, 0xC8, 0x82, 0xC8, 0xAB, 0xD2, 0xAB, 0xD2, 0x2B, 0xDD, 0x2B, 0xDD, 0xEC, 0xE7,
-        0xEC, 0xE7, 0xDD, 0xF2, 0xDD, 0xF2, 0xE5, 0xFD, 0xE5, 0xFD, 0xF1, 0x08, 0xF1, 0x08, 0xED, 0x13, 0xED, 0x13,
-        0xC3, 0x1E, 0xC3, 0x1E, 0x5E, 0x29, 0x5E, 0x29, 0xAB, 0x33, 0xAB, 0x33, 0x94, 0x3D, 0x94, 0x3D, 0x08, 0x47,
-        0x08, 0x47, 0xF4, 0x4F, 0xF4, 0x4F, 0x48, 0x58, 0x48, 0x58, 0xF3, 0x5F, 0xF3, 0x5F, 0xE7, 0x66, 0xE7, 0x66,
-        0x16, 0x6D, 0x16, 0x6D, 0x75, 0x72, 0x75, 0x72, 0xF9, 0x76, 0xF9, 0x76, 0x9B, 0x7A, 0x9B, 0x7A, 0x52, 0x7D,
-        0x52, 0x7D, 0x1A, 0x7F, 0x1A, 0x7F, 0xEF, 0x7F, 0xEF, 0x7F, 0xCF, 0x7F, 0xCF, 0x7F, 0xBC, 0x7E, 0xBC, 0x7E,
-        0xB7, 0x7C, 0xB7, 0x7C, 0xC3, 0x79, 0xC3, 0x79, 0xE7, 0x75, 0xE7, 0x75, 0x2A, 0x71, 0x2A, 0x71, 0x95, 0x6B,
-        0x95, 0x6B, 0x33, 0x65, 0x33, 0x65, 0x0E, 0x5E, 0x0E, 0x5E, 0x37, 0x56, 0x37, 0x56, 0xBB, 0x4D, 0xBB, 0x4D,
-        0xAA, 0x44, 0xAA, 0x44, 0x16, 0x3B, 0x16, 0x3B, 0x12, 0x31, 0x12, 0x31, 0xB0, 0x26, 0xB0, 0x26, 0x03, 0x1C,
-        0x03, 0x1C, 0x22, 0x11, 0x22, 0x11, 0x20, 0x06, 0x20, 0x06, 0x12, 0xFB, 0x12, 0xFB, 0x0E, 0xF0, 0x0E, 0xF0,
-        0x28, 0xE5, 0x28, 0xE5, 0x75, 0xDA, 0x75, 0xDA, 0x0A, 0xD0, 0x0A, 0xD0, 0xFA, 0xC5, 0xFA, 0xC5, 0x59, 0xBC,
-        0x59, 0xBC, 0x3A, 0xB3, 0x3A, 0xB3, 0xAD, 0xAA, 0xAD, 0xAA, 0xC2, 0xA2, 0xC2, 0xA2, 0x8A, 0x9B, 0x8A, 0x9B,
-        0x12, 0x95, 0x12, 0x95, 0x66, 0x8F, 0x66, 0x8F, 0x91, 0x8A, 0x91, 0x8A, 0x9D, 0x86, 0x9D, 0x86, 0x8F, 0x83,
-        0x8F, 0x83, 0x71, 0x81, 0x71, 0x81, 0x42, 0x80, 0x42, 0x80, 0x09, 0x80, 0x09, 0x80, 0xC3, 0x80, 0xC3, 0x80,
-        0x71, 0x82, 0x71, 0x82, 0x0E, 0x85, 0x0E, 0x85, 0x97, 0x88, 0x97, 0x88, 0x03, 0x8D, 0x03, 0x8D, 0x4B, 0x92,
-        0x4B, 0x92, 0x64, 0x98, 0x64, 0x98, 0x43, 0x9F, 0x43, 0x9F, 0xDB, 0xA6, 0xDB, 0xA6, 0x1D, 0xAF, 0x1D, 0xAF,
-        0xFA, 0xB7, 0xFA, 0xB7, 0x60, 0xC1, 0x60, 0xC1, 0x3E, 0xCB, 0x3E, 0xCB, 0x80, 0xD5, 0x80, 0xD5, 0x14, 0xE0,
-        0x14, 0xE0, 0xE4, 0xEA, 0xE4, 0xEA, 0xDD, 0xF5, 0xDD, 0xF5, 0xE9, 0x00, 0xE9, 0x00, 0xF3, 0x0B, 0xF3, 0x0B,
-        0xE7, 0x16, 0xE7, 0x16, 0xAE, 0x21, 0xAE, 0x21, 0x36, 0x2C, 0x36, 0x2C, 0x69, 0x36, 0x69, 0x36, 0x35, 0x40,
-        0x35, 0x40, 0x85, 0x49, 0x85, 0x49, 0x4A, 0x52, 0x4A, 0x52, 0x71, 0x5A, 0x71, 0x5A, 0xEB, 0x61, 0xEB, 0x61,
-        0xAA, 0x68, 0xAA, 0x68, 0xA2, 0x6E, 0xA2, 0x6E, 0xC6, 0x73, 0xC6, 0x73, 0x0E, 0x78, 0x0E, 0x78, 0x70, 0x7B,
-        0x70, 0x7B, 0xE7, 0x7D, 0xE7, 0x7D, 0x6C, 0x7F, 0x6C, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F,
-        0x47, 0x7E, 0x47, 0x7E, 0x00, 0x7C, 0x00, 0x7C, 0xCD, 0x78, 0xCD, 0x78, 0xB2, 0x74, 0xB2, 0x74, 0xBA, 0x6F,
-        0xBA, 0x6F, 0xEB, 0x69, 0xEB, 0x69, 0x53, 0x63, 0x53, 0x63, 0xFC, 0x5B, 0xFC, 0x5B, 0xF6, 0x53, 0xF6, 0x53,
-        0x50, 0x4B, 0x50, 0x4B, 0x1A, 0x42, 0x1A, 0x42, 0x66, 0x38, 0x66, 0x38, 0x46, 0x2E, 0x46, 0x2E, 0xCD, 0x23,
-        0xCD, 0x23, 0x10, 0x19, 0x10, 0x19, 0x24, 0x0E, 0x24, 0x0E, 0x1C, 0x03, 0x1C, 0x03, 0x10, 0xF8, 0x10, 0xF8,
-        0x11, 0xED, 0x11, 0xED, 0x37, 0xE2, 0x37, 0xE2, 0x95, 0xD7, 0x95, 0xD7, 0x41, 0xCD, 0x41, 0xCD, 0x4E, 0xC3,
-        0x4E, 0xC3, 0xCE, 0xB9, 0xCE, 0xB9, 0xD5, 0xB0, 0xD5, 0xB0, 0x73, 0xA8, 0x73, 0xA8, 0xB8, 0xA0, 0xB8, 0xA0,
-        0xB3, 0x99, 0xB3, 0x99, 0x71, 0x93, 0x71, 0x93, 0xFF, 0x8D, 0xFF, 0x8D, 0x67, 0x89, 0x67, 0x89, 0xB0, 0x85,
-        0xB0, 0x85, 0xE4, 0x82, 0xE4, 0x82, 0x05, 0x81, 0x05, 0x81, 0x1B, 0x80, 0x1B, 0x80, 0x23, 0x80, 0x23, 0x80,
-        0x21, 0x81, 0x21, 0x81, 0x10, 0x83, 0x10, 0x83, 0xEE, 0x85, 0xEE, 0x85, 0xB5, 0x89, 0xB5, 0x89, 0x5E, 0x8E,
-        0x5E, 0x8E, 0xE0, 0x93, 0xE0, 0x93, 0x31, 0x9A, 0x31, 0x9A, 0x44, 0xA1, 0x44, 0xA1, 0x0B, 0xA9, 0x0B, 0xA9,
-        0x79, 0xB1, 0x79, 0xB1, 0x7D, 0xBA, 0x7D, 0xBA, 0x06, 0xC4, 0x06, 0xC4, 0x01, 0xCE, 0x01, 0xCE, 0x5B, 0xD8,
-        0x5B, 0xD8, 0x01, 0xE3, 0x01, 0xE3, 0xDF, 0xED, 0xDF, 0xED, 0xE0, 0xF8, 0xE0, 0xF8, 0xED, 0x03, 0xED, 0x03,
-        0xF3, 0x0E, 0xF3, 0x0E, 0xDD, 0x19, 0xDD, 0x19, 0x95, 0x24, 0x95, 0x24, 0x07, 0x2F, 0x07, 0x2F, 0x20, 0x39,
-        0x20, 0x39, 0xCC, 0x42, 0xCC, 0x42, 0xF8, 0x4B, 0xF8, 0x4B, 0x93, 0x54, 0x93, 0x54, 0x8D, 0x5C, 0x8D, 0x5C,
-        0xD5, 0x63, 0xD5, 0x63, 0x60, 0x6A, 0x60, 0x6A, 0x1F, 0x70, 0x1F, 0x70, 0x08, 0x75, 0x08, 0x75, 0x11, 0x79,
-        0x11, 0x79, 0x34, 0x7C, 0x34, 0x7C, 0x68, 0x7E, 0x68, 0x7E, 0xAD, 0x7F, 0xAD, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F,
-        0x58, 0x7F, 0x58, 0x7F, 0xC0, 0x7D, 0xC0, 0x7D, 0x38, 0x7B, 0x38, 0x7B, 0xC5, 0x77, 0xC5, 0x77, 0x6D, 0x73,
-        0x6D, 0x73, 0x39, 0x6E, 0x39, 0x6E, 0x32, 0x68, 0x32, 0x68, 0x65, 0x61, 0x65, 0x61, 0xDD, 0x59, 0xDD, 0x59,
-        0xAA, 0x51, 0xAA, 0x51, 0xDB, 0x48, 0xDB, 0x48, 0x80, 0x3F, 0x80, 0x3F, 0xAD, 0x35, 0xAD, 0x35, 0x72, 0x2B,
-        0x72, 0x2B, 0xE5, 0x20, 0xE5, 0x20, 0x19, 0x16, 0x19, 0x16, 0x23, 0x0B, 0x23, 0x0B, 0x18, 0x00, 0x18, 0x00,
-        0x0D, 0xF5, 0x0D, 0xF5, 0x17, 0xEA, 0x17, 0xEA, 0x4A, 0xDF, 0x4A, 0xDF, 0xBC, 0xD4, 0xBC, 0xD4, 0x80, 0xCA,
-        0x80, 0xCA, 0xAA, 0xC0, 0xAA, 0xC0, 0x4E, 0xB7, 0x4E, 0xB7, 0x7C, 0xAE, 0x7C, 0xAE, 0x47, 0xA6, 0x47, 0xA6,
-        0xBC, 0x9E, 0xBC, 0x9E, 0xEB, 0x97, 0xEB, 0x97, 0xE0, 0x91, 0xE0, 0x91, 0xA8, 0x8C, 0xA8, 0x8C, 0x4C, 0x88,
-        0x4C, 0x88, 0xD5, 0x84, 0xD5, 0x84, 0x49, 0x82, 0x49, 0x82, 0xAE, 0x80, 0xAE, 0x80, 0x05, 0x80, 0x05, 0x80,
-        0x51, 0x80, 0x51, 0x80, 0x90, 0x81, 0x90, 0x81, 0xC1, 0x83, 0xC1, 0x83, 0xDF, 0x86, 0xDF, 0x86, 0xE5, 0x8A,
-        0xE5, 0x8A, 0xCA, 0x8F, 0xCA, 0x8F, 0x85, 0x95, 0x85, 0x95, 0x0C, 0x9C, 0x0C, 0x9C, 0x52, 0xA3, 0x52, 0xA3,
-        0x48, 0xAB, 0x48, 0xAB, 0xE1, 0xB3, 0xE1, 0xB3, 0x0A, 0xBD, 0x0A, 0xBD, 0xB4, 0xC6, 0xB4, 0xC6, 0xCB, 0xD0,
-        0xCB, 0xD0, 0x3C, 0xDB, 0x3C, 0xDB, 0xF4, 0xE5, 0xF4, 0xE5, 0xDD, 0xF0, 0xDD, 0xF0, 0xE3, 0xFB, 0xE3, 0xFB,
-        0xEF, 0x06, 0xEF, 0x06, 0xF0, 0x11, 0xF0, 0x11, 0xCF, 0x1C, 0xCF, 0x1C, 0x76, 0x27, 0x76, 0x27, 0xD2, 0x31,
-        0xD2, 0x31, 0xCF, 0x3B, 0xCF, 0x3B, 0x5A, 0x45, 0x5A, 0x45, 0x60, 0x4E, 0x60, 0x4E, 0xD1, 0x56, 0xD1, 0x56,
-        0x9B, 0x5E, 0x9B, 0x5E, 0xB2, 0x65, 0xB2, 0x65, 0x05, 0x6C, 0x05, 0x6C, 0x8B, 0x71, 0x8B, 0x71, 0x38, 0x76,
-        0x38, 0x76, 0x03, 0x7A, 0x03, 0x7A, 0xE5, 0x7C, 0xE5, 0x7C, 0xD9, 0x7E, 0xD9, 0x7E, 0xDA, 0x7F, 0xDA, 0x7F,
-        0xE7, 0x7F, 0xE7, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x27, 0x7D, 0x27, 0x7D, 0x5E, 0x7A, 0x5E, 0x7A, 0xAC, 0x76,
-        0xAC, 0x76, 0x17, 0x72, 0x17, 0x72, 0xA9, 0x6C, 0xA9, 0x6C, 0x6A, 0x66, 0x6A, 0x66, 0x69, 0x5F, 0x69, 0x5F,
-        0xB1, 0x57, 0xB1, 0x57, 0x51, 0x4F, 0x51, 0x4F, 0x5A, 0x46, 0x5A, 0x46, 0xDD, 0x3C, 0xDD, 0x3C, 0xEC, 0x32,
-        0xEC, 0x32, 0x99, 0x28, 0x99, 0x28, 0xF9, 0x1D, 0xF9, 0x1D, 0x20, 0x13, 0x20, 0x13, 0x21, 0x08, 0x21, 0x08,
-        0x15, 0xFD, 0x15, 0xFD, 0x0D, 0xF2, 0x0D, 0xF2, 0x20, 0xE7, 0x20, 0xE7, 0x62, 0xDC, 0x62, 0xDC, 0xE8, 0xD1,
-        0xE8, 0xD1, 0xC7, 0xC7, 0xC7, 0xC7, 0x10, 0xBE, 0x10, 0xBE, 0xD8, 0xB4, 0xD8, 0xB4, 0x2F, 0xAC, 0x2F, 0xAC,
-        0x26, 0xA4, 0x26, 0xA4, 0xCD, 0x9C, 0xCD, 0x9C, 0x30, 0x96, 0x30, 0x96, 0x5F, 0x90, 0x5F, 0x90, 0x62, 0x8B,
-        0x62, 0x8B, 0x44, 0x87, 0x44, 0x87, 0x0C, 0x84, 0x0C, 0x84, 0xC1, 0x81, 0xC1, 0x81, 0x67, 0x80, 0x67, 0x80,
-        0x01, 0x80, 0x01, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x11, 0x82, 0x11, 0x82, 0x83, 0x84, 0x83, 0x84, 0xE1, 0x87,
-        0xE1, 0x87, 0x24, 0x8C, 0x24, 0x8C, 0x46, 0x91, 0x46, 0x91, 0x39, 0x97, 0x39, 0x97, 0xF5, 0x9D, 0xF5, 0x9D,
-        0x6D, 0xA5, 0x6D, 0xA5, 0x91, 0xAD, 0x91, 0xAD, 0x53, 0xB6, 0x53, 0xB6, 0xA1, 0xBF, 0xA1, 0xBF, 0x6A, 0xC9,
-        0x6A, 0xC9, 0x9C, 0xD3, 0x9C, 0xD3, 0x22, 0xDE, 0x22, 0xDE, 0xEA, 0xE8, 0xEA, 0xE8, 0xDD, 0xF3, 0xDD, 0xF3,
-        0xE6, 0xFE, 0xE6, 0xFE, 0xF2, 0x09, 0xF2, 0x09, 0xEB, 0x14, 0xEB, 0x14, 0xBD, 0x1F, 0xBD, 0x1F, 0x52, 0x2A,
-        0x52, 0x2A, 0x96, 0x34, 0x96, 0x34, 0x75, 0x3E, 0x75, 0x3E, 0xDD, 0x47, 0xDD, 0x47, 0xBD, 0x50, 0xBD, 0x50,
-        0x02, 0x59, 0x02, 0x59, 0x9D, 0x60, 0x9D, 0x60, 0x7F, 0x67, 0x7F, 0x67, 0x9C, 0x6D, 0x9C, 0x6D, 0xE7, 0x72,
-        0xE7, 0x72, 0x57, 0x77, 0x57, 0x77, 0xE4, 0x7A, 0xE4, 0x7A, 0x86, 0x7D, 0x86, 0x7D, 0x37, 0x7F, 0x37, 0x7F,
-        0xF6, 0x7F, 0xF6, 0x7F, 0xC0, 0x7F, 0xC0, 0x7F, 0x97, 0x7E, 0x97, 0x7E, 0x7C, 0x7C, 0x7C, 0x7C, 0x73, 0x79,
-        0x73, 0x79, 0x82, 0x75, 0x82, 0x75, 0xB1, 0x70, 0xB1, 0x70, 0x09, 0x6B, 0x09, 0x6B, 0x94, 0x64, 0x94, 0x64,
-        0x5F, 0x5D, 0x5F, 0x5D, 0x78, 0x55, 0x78, 0x55, 0xED, 0x4C, 0xED, 0x4C, 0xD1, 0x43, 0xD1, 0x43, 0x32, 0x3A,
-        0x32, 0x3A, 0x24, 0x30, 0x24, 0x30, 0xBA, 0x25, 0xBA, 0x25, 0x08, 0x1B, 0x08, 0x1B, 0x23, 0x10, 0x23, 0x10,
-        0x1E, 0x05, 0x1E, 0x05, 0x11, 0xFA, 0x11, 0xFA, 0x0F, 0xEF, 0x0F, 0xEF, 0x2C, 0xE4, 0x2C, 0xE4, 0x7F, 0xD9,
-        0x7F, 0xD9, 0x1B, 0xCF, 0x1B, 0xCF, 0x15, 0xC5, 0x15, 0xC5, 0x7F, 0xBB, 0x7F, 0xBB, 0x6C, 0xB2, 0x6C, 0xB2,
-        0xED, 0xA9, 0xED, 0xA9, 0x13, 0xA2, 0x13, 0xA2, 0xEC, 0x9A, 0xEC, 0x9A, 0x85, 0x94, 0x85, 0x94, 0xED, 0x8E,
-        0xED, 0x8E, 0x2C, 0x8A, 0x2C, 0x8A, 0x4C, 0x86, 0x4C, 0x86, 0x54, 0x83, 0x54, 0x83, 0x4B, 0x81, 0x4B, 0x81,
-        0x34, 0x80, 0x34, 0x80, 0x10, 0x80, 0x10, 0x80, 0xE1, 0x80, 0xE1, 0x80, 0xA4, 0x82, 0xA4, 0x82, 0x57, 0x85,
-        0x57, 0x85, 0xF4, 0x88, 0xF4, 0x88, 0x75, 0x8D, 0x75, 0x8D, 0xD0, 0x92, 0xD0, 0x92, 0xFC, 0x98, 0xFC, 0x98,
-        0xED, 0x9F, 0xED, 0x9F, 0x94, 0xA7, 0x94, 0xA7, 0xE5, 0xAF, 0xE5, 0xAF, 0xD0, 0xB8, 0xD0, 0xB8, 0x41, 0xC2,
-        0x41, 0xC2, 0x29, 0xCC, 0x29, 0xCC, 0x73, 0xD6, 0x73, 0xD6, 0x0D, 0xE1, 0x0D, 0xE1, 0xE2, 0xEB, 0xE2, 0xEB,
-        0xDE, 0xF6, 0xDE, 0xF6, 0xEA, 0x01, 0xEA, 0x01, 0xF3, 0x0C, 0xF3, 0x0C, 0xE4, 0x17, 0xE4, 0x17, 0xA6, 0x22,
-        0xA6, 0x22, 0x27, 0x2D, 0x27, 0x2D, 0x52, 0x37, 0x52, 0x37, 0x13, 0x41, 0x13, 0x41, 0x57, 0x4A, 0x57, 0x4A,
-        0x0E, 0x53, 0x0E, 0x53, 0x26, 0x5B, 0x26, 0x5B, 0x90, 0x62, 0x90, 0x62, 0x3E, 0x69, 0x3E, 0x69, 0x23, 0x6F,
-        0x23, 0x6F, 0x33, 0x74, 0x33, 0x74, 0x66, 0x78, 0x66, 0x78, 0xB3, 0x7B, 0xB3, 0x7B, 0x14, 0x7E, 0x14, 0x7E,
-        0x83, 0x7F, 0x83, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x88, 0x7F, 0x88, 0x7F, 0x1C, 0x7E, 0x1C, 0x7E, 0xBF, 0x7B,
-        0xBF, 0x7B, 0x77, 0x78, 0x77, 0x78, 0x48, 0x74, 0x48, 0x74, 0x3B, 0x6F, 0x3B, 0x6F, 0x5A, 0x69, 0x5A, 0x69,
-        0xAF, 0x62, 0xAF, 0x62, 0x49, 0x5B, 0x49, 0x5B, 0x33, 0x53, 0x33, 0x53, 0x80, 0x4A, 0x80, 0x4A, 0x3D, 0x41,
-        0x3D, 0x41, 0x7E, 0x37, 0x7E, 0x37, 0x55, 0x2D, 0x55, 0x2D, 0xD6, 0x22, 0xD6, 0x22, 0x14, 0x18, 0x14, 0x18,
-        0x24, 0x0D, 0x24, 0x0D, 0x1B, 0x02, 0x1B, 0x02, 0x0E, 0xF7, 0x0E, 0xF7, 0x13, 0xEC, 0x13, 0xEC, 0x3D, 0xE1,
-        0x3D, 0xE1, 0xA2, 0xD6, 0xA2, 0xD6, 0x55, 0xCC, 0x55, 0xCC, 0x6C, 0xC2, 0x6C, 0xC2, 0xF8, 0xB8, 0xF8, 0xB8,
-        0x0C, 0xB0, 0x0C, 0xB0, 0xB8, 0xA7, 0xB8, 0xA7, 0x0D, 0xA0, 0x0D, 0xA0, 0x19, 0x99, 0x19, 0x99, 0xEA, 0x92,
-        0xEA, 0x92, 0x8B, 0x8D, 0x8B, 0x8D, 0x07, 0x89, 0x07, 0x89, 0x65, 0x85, 0x65, 0x85, 0xAE, 0x82, 0xAE, 0x82,
-        0xE6, 0x80, 0xE6, 0x80, 0x11, 0x80, 0x11, 0x80, 0x30, 0x80, 0x30, 0x80, 0x44, 0x81, 0x44, 0x81, 0x49, 0x83,
-        0x49, 0x83, 0x3D, 0x86, 0x3D, 0x86, 0x18, 0x8A, 0x18, 0x8A, 0xD6, 0x8E, 0xD6, 0x8E, 0x6B, 0x94, 0x6B, 0x94,
-        0xCD, 0x9A, 0xCD, 0x9A, 0xF2, 0xA1, 0xF2, 0xA1, 0xC9, 0xA9, 0xC9, 0xA9, 0x45, 0xB2, 0x45, 0xB2, 0x55, 0xBB,
-        0x55, 0xBB, 0xE9, 0xC4, 0xE9, 0xC4, 0xEE, 0xCE, 0xEE, 0xCE, 0x50, 0xD9, 0x50, 0xD9, 0xFC, 0xE3, 0xFC, 0xE3,
-        0xDE, 0xEE, 0xDE, 0xEE, 0xE0, 0xF9, 0xE0, 0xF9, 0xEE, 0x04, 0xEE, 0x04, 0xF2, 0x0F, 0xF2, 0x0F, 0xD9, 0x1A,
-        0xD9, 0x1A, 0x8B, 0x25, 0x8B, 0x25, 0xF6, 0x2F, 0xF6, 0x2F, 0x06, 0x3A, 0x06, 0x3A, 0xA7, 0x43, 0xA7, 0x43,
-        0xC6, 0x4C, 0xC6, 0x4C, 0x54, 0x55, 0x54, 0x55, 0x3E, 0x5D, 0x3E, 0x5D, 0x76, 0x64, 0x76, 0x64, 0xEE, 0x6A,
-        0xEE, 0x6A, 0x9A, 0x70, 0x9A, 0x70, 0x6F, 0x75, 0x6F, 0x75, 0x63, 0x79, 0x63, 0x79, 0x71, 0x7C, 0x71, 0x7C,
-        0x90, 0x7E, 0x90, 0x7E, 0xBE, 0x7F, 0xBE, 0x7F, 0xF7, 0x7F, 0xF7, 0x7F, 0x3C, 0x7F, 0x3C, 0x7F, 0x8F, 0x7D,
-        0x8F, 0x7D, 0xF1, 0x7A, 0xF1, 0x7A, 0x69, 0x77, 0x69, 0x77, 0xFD, 0x72, 0xFD, 0x72, 0xB5, 0x6D, 0xB5, 0x6D,
-        0x9C, 0x67, 0x9C, 0x67, 0xBD, 0x60, 0xBD, 0x60, 0x25, 0x59, 0x25, 0x59, 0xE3, 0x50, 0xE3, 0x50, 0x06, 0x48,
-        0x06, 0x48, 0xA0, 0x3E, 0xA0, 0x3E, 0xC3, 0x34, 0xC3, 0x34, 0x80, 0x2A, 0x80, 0x2A, 0xEC, 0x1F, 0xEC, 0x1F,
-        0x1C, 0x15, 0x1C, 0x15, 0x23, 0x0A, 0x23, 0x0A, 0x18, 0xFF, 0x18, 0xFF, 0x0D, 0xF4, 0x0D, 0xF4, 0x19, 0xE9,
-        0x19, 0xE9, 0x51, 0xDE, 0x51, 0xDE, 0xCA, 0xD3, 0xCA, 0xD3, 0x97, 0xC9, 0x97, 0xC9, 0xCB, 0xBF, 0xCB, 0xBF,
-        0x7B, 0xB6, 0x7B, 0xB6, 0xB6, 0xAD, 0xB6, 0xAD, 0x8F, 0xA5, 0x8F, 0xA5, 0x15, 0x9E, 0x15, 0x9E, 0x55, 0x97,
-        0x55, 0x97, 0x5E, 0x91, 0x5E, 0x91, 0x39, 0x8C, 0x39, 0x8C, 0xF2, 0x87, 0xF2, 0x87, 0x90, 0x84, 0x90, 0x84,
-        0x1A, 0x82, 0x1A, 0x82, 0x94, 0x80, 0x94, 0x80, 0x01, 0x80, 0x01, 0x80, 0x64, 0x80, 0x64, 0x80, 0xB9, 0x81,
-        0xB9, 0x81, 0x00, 0x84, 0x00, 0x84, 0x33, 0x87, 0x33, 0x87, 0x4E, 0x8B, 0x4E, 0x8B, 0x46, 0x90, 0x46, 0x90,
-        0x15, 0x96, 0x15, 0x96, 0xAD, 0x9C, 0xAD, 0x9C, 0x04, 0xA4, 0x04, 0xA4, 0x09, 0xAC, 0x09, 0xAC, 0xB0, 0xB4,
-        0xB0, 0xB4, 0xE7, 0xBD, 0xE7, 0xBD, 0x9A, 0xC7, 0x9A, 0xC7, 0xBA, 0xD1, 0xBA, 0xD1, 0x33, 0xDC, 0x33, 0xDC,
-        0xF0, 0xE6, 0xF0, 0xE6, 0xDC, 0xF1, 0xDC, 0xF1, 0xE4, 0xFC, 0xE4, 0xFC, 0xF1, 0x07, 0xF1, 0x07, 0xEF, 0x12,
-        0xEF, 0x12, 0xC9, 0x1D, 0xC9, 0x1D, 0x6A, 0x28, 0x6A, 0x28, 0xBF, 0x32, 0xBF, 0x32, 0xB2, 0x3C, 0xB2, 0x3C,
-        0x31, 0x46, 0x31, 0x46, 0x2B, 0x4F, 0x2B, 0x4F, 0x8D, 0x57, 0x8D, 0x57, 0x48, 0x5F, 0x48, 0x5F, 0x4D, 0x66,
-        0x4D, 0x66, 0x8E, 0x6C, 0x8E, 0x6C, 0x01, 0x72, 0x01, 0x72, 0x9A, 0x76, 0x9A, 0x76, 0x50, 0x7A, 0x50, 0x7A,
-        0x1C, 0x7D, 0x1C, 0x7D, 0xFA, 0x7E, 0xFA, 0x7E, 0xE5, 0x7F, 0xE5, 0x7F, 0xDD, 0x7F, 0xDD, 0x7F, 0xDF, 0x7E,
-        0xDF, 0x7E, 0xF0, 0x7C, 0xF0, 0x7C, 0x12, 0x7A, 0x12, 0x7A, 0x4B, 0x76, 0x4B, 0x76, 0xA1, 0x71, 0xA1, 0x71,
-        0x20, 0x6C, 0x20, 0x6C, 0xCF, 0x65, 0xCF, 0x65, 0xBC, 0x5E, 0xBC, 0x5E, 0xF4, 0x56, 0xF4, 0x56, 0x87, 0x4E,
-        0x87, 0x4E, 0x83, 0x45, 0x83, 0x45, 0xFA, 0x3B, 0xFA, 0x3B, 0xFF, 0x31, 0xFF, 0x31, 0xA5, 0x27, 0xA5, 0x27,
-        0xFE, 0x1C, 0xFE, 0x1C, 0x21, 0x12, 0x21, 0x12, 0x21, 0x07, 0x21, 0x07, 0x14, 0xFC, 0x14, 0xFC, 0x0D, 0xF1,
-        0x0D, 0xF1, 0x23, 0xE6, 0x23, 0xE6, 0x6B, 0xDB, 0x6B, 0xDB, 0xF8, 0xD0, 0xF8, 0xD0, 0xE0, 0xC6, 0xE0, 0xC6,
-        0x34, 0xBD, 0x34, 0xBD, 0x08, 0xB4, 0x08, 0xB4, 0x6D, 0xAB, 0x6D, 0xAB, 0x73, 0xA3, 0x73, 0xA3, 0x2B, 0x9C,
-        0x2B, 0x9C, 0xA1, 0x95, 0xA1, 0x95, 0xE1, 0x8F, 0xE1, 0x8F, 0xF8, 0x8A, 0xF8, 0x8A, 0xEF, 0x86, 0xEF, 0x86,
-        0xCC, 0x83, 0xCC, 0x83, 0x98, 0x81, 0x98, 0x81, 0x54, 0x80, 0x54, 0x80, 0x04, 0x80, 0x04, 0x80, 0xA8, 0x80,
-        0xA8, 0x80, 0x40, 0x82, 0x40, 0x82, 0xC8, 0x84, 0xC8, 0x84, 0x3B, 0x88, 0x3B, 0x88, 0x93, 0x8C, 0x93, 0x8C,
-        0xC7, 0x91, 0xC7, 0x91, 0xCE, 0x97, 0xCE, 0x97, 0x9C, 0x9E, 0x9C, 0x9E, 0x23, 0xA6, 0x23, 0xA6, 0x56, 0xAE,
-        0x56, 0xAE, 0x25, 0xB7, 0x25, 0xB7, 0x80, 0xC0, 0x80, 0xC0, 0x53, 0xCA, 0x53, 0xCA, 0x8E, 0xD4, 0x8E, 0xD4,
-        0x1B, 0xDF, 0x1B, 0xDF, 0xE6, 0xE9, 0xE6, 0xE9, 0xDD, 0xF4, 0xDD, 0xF4, 0xE8, 0xFF, 0xE8, 0xFF, 0xF2, 0x0A,
-        0xF2, 0x0A, 0xE9, 0x15, 0xE9, 0x15, 0xB6, 0x20, 0xB6, 0x20, 0x44, 0x2B, 0x44, 0x2B, 0x80, 0x35, 0x80, 0x35,
-        0x55, 0x3F, 0x55, 0x3F, 0xB2, 0x48, 0xB2, 0x48, 0x84, 0x51, 0x84, 0x51, 0xBA, 0x59, 0xBA, 0x59, 0x45, 0x61,
-        0x45, 0x61, 0x16, 0x68, 0x16, 0x68, 0x20, 0x6E, 0x20, 0x6E, 0x58, 0x73, 0x58, 0x73, 0xB4, 0x77, 0xB4, 0x77,
-        0x2B, 0x7B, 0x2B, 0x7B, 0xB7, 0x7D, 0xB7, 0x7D, 0x52, 0x7F, 0x52, 0x7F, 0xFB, 0x7F, 0xFB, 0x7F, 0xAF, 0x7F,
-        0xAF, 0x7F, 0x70, 0x7E, 0x70, 0x7E, 0x3F, 0x7C, 0x3F, 0x7C, 0x21, 0x79, 0x21, 0x79, 0x1B, 0x75, 0x1B, 0x75,
-        0x37, 0x70, 0x37, 0x70, 0x7A, 0x6A, 0x7A, 0x6A, 0xF4, 0x63, 0xF4, 0x63, 0xAE, 0x5C, 0xAE, 0x5C, 0xB8, 0x54,
-        0xB8, 0x54, 0x20, 0x4C, 0x20, 0x4C, 0xF6, 0x42, 0xF6, 0x42, 0x4C, 0x39, 0x4C, 0x39, 0x35, 0x2F, 0x35, 0x2F,
-        0xC4, 0x24, 0xC4, 0x24, 0x0D, 0x1A, 0x0D, 0x1A, 0x23, 0x0F, 0x23, 0x0F, 0x1E, 0x04, 0x1E, 0x04, 0x10, 0xF9,
-        0x10, 0xF9, 0x10, 0xEE, 0x10, 0xEE, 0x32, 0xE3, 0x32, 0xE3, 0x8A, 0xD8, 0x8A, 0xD8, 0x2E, 0xCE, 0x2E, 0xCE,
-        0x31, 0xC4, 0x31, 0xC4, 0xA6, 0xBA, 0xA6, 0xBA, 0xA0, 0xB1, 0xA0, 0xB1, 0x2F, 0xA9, 0x2F, 0xA9, 0x65, 0xA1,
-        0x65, 0xA1, 0x4F, 0x9A, 0x4F, 0x9A, 0xFB, 0x93, 0xFB, 0x93, 0x75, 0x8E, 0x75, 0x8E, 0xC8, 0x89, 0xC8, 0x89,
-        0xFD, 0x85, 0xFD, 0x85, 0x1B, 0x83, 0x1B, 0x83, 0x27, 0x81, 0x27, 0x81, 0x26, 0x80, 0x26, 0x80, 0x18, 0x80,
-        0x18, 0x80, 0x00, 0x81, 0x00, 0x81, 0xD9, 0x82, 0xD9, 0x82, 0xA2, 0x85, 0xA2, 0x85, 0x54, 0x89, 0x54, 0x89,
-        0xE9, 0x8D, 0xE9, 0x8D, 0x57, 0x93, 0x57, 0x93, 0x96, 0x99, 0x96, 0x99, 0x97, 0xA0, 0x97, 0xA0, 0x4F, 0xA8,
-        0x4F, 0xA8, 0xAF, 0xB0, 0xAF, 0xB0, 0xA6, 0xB9, 0xA6, 0xB9, 0x23, 0xC3, 0x23, 0xC3, 0x14, 0xCD, 0x14, 0xCD,
-        0x67, 0xD7, 0x67, 0xD7, 0x07, 0xE2, 0x07, 0xE2, 0xE0, 0xEC, 0xE0, 0xEC, 0xDE, 0xF7, 0xDE, 0xF7, 0xEB, 0x02,
-        0xEB, 0x02, 0xF3, 0x0D, 0xF3, 0x0D, 0xE1, 0x18, 0xE1, 0x18, 0x9E, 0x23, 0x9E, 0x23, 0x18, 0x2E, 0x18, 0x2E,
-        0x39, 0x38, 0x39, 0x38, 0xF0, 0x41, 0xF0, 0x41, 0x29, 0x4B, 0x29, 0x4B, 0xD1, 0x53, 0xD1, 0x53, 0xDA, 0x5B,
-        0xDA, 0x5B, 0x33, 0x63, 0x33, 0x63, 0xD0, 0x69, 0xD0, 0x69, 0xA1, 0x6F, 0xA1, 0x6F, 0x9F, 0x74, 0x9F, 0x74,
-        0xBC, 0x78, 0xBC, 0x78, 0xF5, 0x7B, 0xF5, 0x7B, 0x3F, 0x7E, 0x3F, 0x7E, 0x99, 0x7F, 0x99, 0x7F, 0xFF, 0x7F,
-        0xFF, 0x7F, 0x71, 0x7F, 0x71, 0x7F, 0xEF, 0x7D, 0xEF, 0x7D, 0x7D, 0x7B, 0x7D, 0x7B, 0x1E, 0x78, 0x1E, 0x78,
-        0xDB, 0x73, 0xDB, 0x73, 0xBB, 0x6E, 0xBB, 0x6E, 0xC7, 0x68, 0xC7, 0x68, 0x0B, 0x62, 0x0B, 0x62, 0x93, 0x5A,
-        0x93, 0x5A, 0x6F, 0x52, 0x6F, 0x52, 0xAE, 0x49, 0xAE, 0x49, 0x5F, 0x40, 0x5F, 0x40, 0x96, 0x36, 0x96, 0x36,
-        0x64, 0x2C, 0x64, 0x2C, 0xDE, 0x21, 0xDE, 0x21, 0x17, 0x17, 0x17, 0x17, 0x23, 0x0C, 0x23, 0x0C, 0x1A, 0x01,
-        0x1A, 0x01, 0x0E, 0xF6, 0x0E, 0xF6, 0x14, 0xEB, 0x14, 0xEB, 0x43, 0xE0, 0x43, 0xE0, 0xAE, 0xD5, 0xAE, 0xD5,
-        0x6A, 0xCB, 0x6A, 0xCB, 0x8B, 0xC1, 0x8B, 0xC1, 0x22, 0xB8, 0x22, 0xB8, 0x43, 0xAF, 0x43, 0xAF, 0xFE, 0xA6,
-        0xFE, 0xA6, 0x63, 0x9F, 0x63, 0x9F, 0x81, 0x98, 0x81, 0x98, 0x64, 0x92, 0x64, 0x92, 0x19, 0x8D, 0x19, 0x8D,
-        0xA9, 0x88, 0xA9, 0x88, 0x1D, 0x85, 0x1D, 0x85, 0x7A, 0x82, 0x7A, 0x82, 0xC9, 0x80, 0xC9, 0x80, 0x0A, 0x80,
-        0x0A, 0x80, 0x40, 0x80, 0x40, 0x80, 0x68, 0x81, 0x68, 0x81, 0x84, 0x83, 0x84, 0x83, 0x8D, 0x86, 0x8D, 0x86,
-        0x7E, 0x8A, 0x7E, 0x8A, 0x4F, 0x8F, 0x4F, 0x8F, 0xF7, 0x94, 0xF7, 0x94, 0x6C, 0x9B, 0x6C, 0x9B, 0xA1, 0xA2,
-        0xA1, 0xA2, 0x88, 0xAA, 0x88, 0xAA, 0x12, 0xB3, 0x12, 0xB3, 0x2F, 0xBC, 0x2F, 0xBC, 0xCE, 0xC5, 0xCE, 0xC5,
-        0xDC, 0xCF, 0xDC, 0xCF, 0x46, 0xDA, 0x46, 0xDA, 0xF8, 0xE4, 0xF8, 0xE4, 0xDD, 0xEF, 0xDD, 0xEF, 0xE1, 0xFA,
-        0xE1, 0xFA, 0xEE, 0x05, 0xEE, 0x05, 0xF2, 0x10, 0xF2, 0x10, 0xD4, 0x1B, 0xD4, 0x1B, 0x81, 0x26, 0x81, 0x26,
-        0xE4, 0x30, 0xE4, 0x30, 0xEB, 0x3A, 0xEB, 0x3A, 0x81, 0x44, 0x81, 0x44, 0x94, 0x4D, 0x94, 0x4D, 0x13, 0x56,
-        0x13, 0x56, 0xED, 0x5D, 0xED, 0x5D, 0x14, 0x65, 0x14, 0x65, 0x7B, 0x6B, 0x7B, 0x6B, 0x13, 0x71, 0x13, 0x71,
-        0xD5, 0x75, 0xD5, 0x75, 0xB4, 0x79, 0xB4, 0x79, 0xAC, 0x7C, 0xAC, 0x7C, 0xB5, 0x7E, 0xB5, 0x7E, 0xCD, 0x7F,
-        0xCD, 0x7F, 0xF1, 0x7F, 0xF1, 0x7F, 0x1F, 0x7F, 0x1F, 0x7F, 0x5C, 0x7D, 0x5C, 0x7D, 0xA9, 0x7A, 0xA9, 0x7A,
-        0x0C, 0x77, 0x0C, 0x77, 0x8B, 0x72, 0x8B, 0x72, 0x30, 0x6D, 0x30, 0x6D, 0x04, 0x67, 0x04, 0x67, 0x14, 0x60,
-        0x14, 0x60, 0x6B, 0x58, 0x6B, 0x58, 0x1B, 0x50, 0x1B, 0x50, 0x31, 0x47, 0x31, 0x47, 0xBF, 0x3D, 0xBF, 0x3D,
-        0xD7, 0x33, 0xD7, 0x33, 0x8D, 0x29, 0x8D, 0x29, 0xF3, 0x1E, 0xF3, 0x1E, 0x1E, 0x14, 0x1E, 0x14, 0x22, 0x09,
-        0x22, 0x09, 0x16, 0xFE, 0x16, 0xFE, 0x0D, 0xF3, 0x0D, 0xF3, 0x1D, 0xE8, 0x1D, 0xE8, 0x5A, 0xDD, 0x5A, 0xDD,
-        0xD8, 0xD2, 0xD8, 0xD2, 0xAE, 0xC8, 0xAE, 0xC8, 0xED, 0xBE, 0xED, 0xBE, 0xA9, 0xB5, 0xA9, 0xB5, 0xF1, 0xAC,
-        0xF1, 0xAC, 0xDA, 0xA4, 0xDA, 0xA4, 0x70, 0x9D, 0x70, 0x9D, 0xC2, 0x96, 0xC2, 0x96, 0xDD, 0x90, 0xDD, 0x90,
-        0xCD, 0x8B, 0xCD, 0x8B, 0x9A, 0x87, 0x9A, 0x87, 0x4D, 0x84, 0x4D, 0x84, 0xEC, 0x81, 0xEC, 0x81, 0x7D, 0x80,
-        0x7D, 0x80, 0x00, 0x80, 0x00, 0x80, 0x78, 0x80, 0x78, 0x80, 0xE4, 0x81, 0xE4, 0x81, 0x40, 0x84, 0x40, 0x84,
-        0x89, 0x87, 0x89, 0x87, 0xB8, 0x8B, 0xB8, 0x8B, 0xC5, 0x90, 0xC5, 0x90, 0xA6, 0x96, 0xA6, 0x96, 0x51, 0x9D,
-        0x51, 0x9D, 0xB7, 0xA4, 0xB7, 0xA4, 0xCD, 0xAC, 0xCD, 0xAC, 0x81, 0xB5, 0x81, 0xB5, 0xC3, 0xBE, 0xC3, 0xBE,
-        0x82, 0xC8, 0x82, 0xC8, 0xAB, 0xD2, 0xAB, 0xD2, 0x2B, 0xDD, 0x2B, 0xDD, 0xEC, 0xE7, 0xEC, 0xE7, 0xDD, 0xF2,
-        0xDD, 0xF2, 0xE5, 0xFD, 0xE5, 0xFD, 0xF1, 0x08, 0xF1, 0x08, 0xED, 0x13, 0xED, 0x13, 0xC3, 0x1E, 0xC3, 0x1E,
-        0x5E, 0x29, 0x5E, 0x29, 0xAB, 0x33, 0xAB, 0x33, 0x94, 0x3D, 0x94, 0x3D, 0x08, 0x47, 0x08, 0x47, 0xF4, 0x4F,
-        0xF4, 0x4F, 0x48, 0x58, 0x48, 0x58, 0xF3, 0x5F, 0xF3, 0x5F, 0xE7, 0x66, 0xE7, 0x66, 0x16, 0x6D, 0x16, 0x6D,
-        0x75, 0x72, 0x75, 0x72, 0xF9, 0x76, 0xF9, 0x76, 0x9B, 0x7A, 0x9B, 0x7A, 0x52, 0x7D, 0x52, 0x7D, 0x1A, 0x7F,
-        0x1A, 0x7F, 0xEF, 0x7F, 0xEF, 0x7F, 0xCF, 0x7F, 0xCF, 0x7F, 0xBC, 0x7E, 0xBC, 0x7E, 0xB7, 0x7C, 0xB7, 0x7C,
-        0xC3, 0x79, 0xC3, 0x79, 0xE7, 0x75, 0xE7, 0x75, 0x2A, 0x71, 0x2A, 0x71, 0x95, 0x6B, 0x95, 0x6B, 0x33, 0x65,
-        0x33, 0x65, 0x0E, 0x5E, 0x0E, 0x5E, 0x37, 0x56, 0x37, 0x56, 0xBB, 0x4D, 0xBB, 0x4D, 0xAA, 0x44, 0xAA, 0x44,
-        0x16, 0x3B, 0x16, 0x3B, 0x12, 0x31, 0x12, 0x31, 0xB0, 0x26, 0xB0, 0x26, 0x03, 0x1C, 0x03, 0x1C, 0x22, 0x11,
-        0x22, 0x11, 0x20, 0x06, 0x20, 0x06, 0x12, 0xFB, 0x12, 0xFB, 0x0E, 0xF0, 0x0E, 0xF0, 0x28, 0xE5, 0x28, 0xE5,
-        0x75, 0xDA, 0x75, 0xDA, 0x0A, 0xD0, 0x0A, 0xD0, 0xFA, 0xC5, 0xFA, 0xC5, 0x59, 0xBC, 0x59, 0xBC, 0x3A, 0xB3,
-        0x3A, 0xB3, 0xAD, 0xAA, 0xAD, 0xAA, 0xC2, 0xA2, 0xC2, 0xA2, 0x8A, 0x9B, 0x8A, 0x9B, 0x12, 0x95, 0x12, 0x95,
-        0x66, 0x8F, 0x66, 0x8F, 0x91, 0x8A, 0x91, 0x8A, 0x9D, 0x86, 0x9D, 0x86, 0x8F, 0x83, 0x8F, 0x83, 0x71, 0x81,
-        0x71, 0x81, 0x42, 0x80, 0x42, 0x80, 0x09, 0x80, 0x09, 0x80, 0xC3, 0x80, 0xC3, 0x80, 0x71, 0x82, 0x71, 0x82,
-        0x0E, 0x85, 0x0E, 0x85, 0x97, 0x88, 0x97, 0x88, 0x03, 0x8D, 0x03, 0x8D, 0x4B, 0x92, 0x4B, 0x92, 0x64, 0x98,
-        0x64, 0x98, 0x43, 0x9F, 0x43, 0x9F, 0xDB, 0xA6, 0xDB, 0xA6, 0x1D, 0xAF, 0x1D, 0xAF, 0xFA, 0xB7, 0xFA, 0xB7,
-        0x60, 0xC1, 0x60, 0xC1, 0x3E, 0xCB, 0x3E, 0xCB, 0x80, 0xD5, 0x80, 0xD5, 0x14, 0xE0, 0x14, 0xE0, 0xE4, 0xEA,
-        0xE4, 0xEA, 0xDD, 0xF5, 0xDD, 0xF5, 0xE9, 0x00, 0xE9, 0x00, 0xF3, 0x0B, 0xF3, 0x0B, 0xE7, 0x16, 0xE7, 0x16,
-        0xAE, 0x21, 0xAE, 0x21, 0x36, 0x2C, 0x36, 0x2C, 0x69, 0x36, 0x69, 0x36, 0x35, 0x40, 0x35, 0x40, 0x85, 0x49,
-        0x85, 0x49, 0x4A, 0x52, 0x4A, 0x52, 0x71, 0x5A, 0x71, 0x5A, 0xEB, 0x61, 0xEB, 0x61, 0xAA, 0x68, 0xAA, 0x68,
-        0xA2, 0x6E, 0xA2, 0x6E, 0xC6, 0x73, 0xC6, 0x73, 0x0E, 0x78, 0x0E, 0x78, 0x70, 0x7B, 0x70, 0x7B, 0xE7, 0x7D,
-        0xE7, 0x7D, 0x6C, 0x7F, 0x6C, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x47, 0x7E, 0x47, 0x7E,
-        0x00, 0x7C, 0x00, 0x7C, 0xCD, 0x78, 0xCD, 0x78, 0xB2, 0x74, 0xB2, 0x74, 0xBA, 0x6F, 0xBA, 0x6F, 0xEB, 0x69,
-        0xEB, 0x69, 0x53, 0x63, 0x53, 0x63, 0xFC, 0x5B, 0xFC, 0x5B, 0xF6, 0x53, 0xF6, 0x53, 0x50, 0x4B, 0x50, 0x4B,
-        0x1A, 0x42, 0x1A, 0x42, 0x66, 0x38, 0x66, 0x38, 0x46, 0x2E, 0x46, 0x2E, 0xCD, 0x23, 0xCD, 0x23, 0x10, 0x19,
-        0x10, 0x19, 0x24, 0x0E, 0x24, 0x0E, 0x1C, 0x03, 0x1C, 0x03, 0x10, 0xF8, 0x10, 0xF8, 0x11, 0xED, 0x11, 0xED,
-        0x37, 0xE2, 0x37, 0xE2, 0x95, 0xD7, 0x95, 0xD7, 0x41, 0xCD, 0x41, 0xCD, 0x4E, 0xC3, 0x4E, 0xC3, 0xCE, 0xB9,
-        0xCE, 0xB9, 0xD5, 0xB0, 0xD5, 0xB0, 0x73, 0xA8, 0x73, 0xA8, 0xB8, 0xA0, 0xB8, 0xA0, 0xB3, 0x99, 0xB3, 0x99,
-        0x71, 0x93, 0x71, 0x93, 0xFF, 0x8D, 0xFF, 0x8D, 0x67, 0x89, 0x67, 0x89, 0xB0, 0x85, 0xB0, 0x85, 0xE4, 0x82,
-        0xE4, 0x82, 0x05, 0x81, 0x05, 0x81, 0x1B, 0x80, 0x1B, 0x80, 0x23, 0x80, 0x23, 0x80, 0x21, 0x81, 0x21, 0x81,
-        0x10, 0x83, 0x10, 0x83, 0xEE, 0x85, 0xEE, 0x85, 0xB5, 0x89, 0xB5, 0x89, 0x5E, 0x8E, 0x5E, 0x8E, 0xE0, 0x93,
-        0xE0, 0x93, 0x31, 0x9A, 0x31, 0x9A, 0x44, 0xA1, 0x44, 0xA1, 0x0B, 0xA9, 0x0B, 0xA9, 0x79, 0xB1, 0x79, 0xB1,
-        0x7D, 0xBA, 0x7D, 0xBA, 0x06, 0xC4, 0x06, 0xC4, 0x01, 0xCE, 0x01, 0xCE, 0x5B, 0xD8, 0x5B, 0xD8, 0x01, 0xE3,
-        0x01, 0xE3, 0xDF, 0xED, 0xDF, 0xED, 0xE0, 0xF8, 0xE0, 0xF8, 0xED, 0x03, 0xED, 0x03, 0xF3, 0x0E, 0xF3, 0x0E,
-        0xDD, 0x19, 0xDD, 0x19, 0x95, 0x24, 0x95, 0x24, 0x07, 0x2F, 0x07, 0x2F, 0x20, 0x39, 0x20, 0x39, 0xCC, 0x42,
-        0xCC, 0x42, 0xF8, 0x4B, 0xF8, 0x4B, 0x93, 0x54, 0x93, 0x54, 0x8D, 0x5C, 0x8D, 0x5C, 0xD5, 0x63, 0xD5, 0x63,
-        0x60, 0x6A, 0x60, 0x6A, 0x1F, 0x70, 0x1F, 0x70, 0x08, 0x75, 0x08, 0x75, 0x11, 0x79, 0x11, 0x79, 0x34, 0x7C,
-        0x34, 0x7C, 0x68, 0x7E, 0x68, 0x7E, 0xAD, 0x7F, 0xAD, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0x58, 0x7F, 0x58, 0x7F,
-        0xC0, 0x7D, 0xC0, 0x7D, 0x38, 0x7B, 0x38, 0x7B, 0xC5, 0x77, 0xC5, 0x77, 0x6D, 0x73, 0x6D, 0x73, 0x39, 0x6E,
-        0x39, 0x6E, 0x32, 0x68, 0x32, 0x68, 0x65, 0x61, 0x65, 0x61, 0xDD, 0x59, 0xDD, 0x59, 0xAA, 0x51, 0xAA, 0x51,
-        0xDB, 0x48, 0xDB, 0x48, 0x80, 0x3F, 0x80, 0x3F, 0xAD, 0x35, 0xAD, 0x35, 0x72, 0x2B, 0x72, 0x2B, 0xE5, 0x20,
-        0xE5, 0x20, 0x19, 0x16, 0x19, 0x16, 0x23, 0x0B, 0x23, 0x0B, 0x18, 0x00, 0x18, 0x00, 0x0D, 0xF5, 0x0D, 0xF5,
-        0x17, 0xEA, 0x17, 0xEA, 0x4A, 0xDF, 0x4A, 0xDF, 0xBC, 0xD4, 0xBC, 0xD4, 0x80, 0xCA, 0x80, 0xCA, 0xAA, 0xC0,
-        0xAA, 0xC0, 0x4E, 0xB7, 0x4E, 0xB7, 0x7C, 0xAE, 0x7C, 0xAE, 0x47, 0xA6, 0x47, 0xA6, 0xBC, 0x9E, 0xBC, 0x9E,
-        0xEB, 0x97, 0xEB, 0x97, 0xE0, 0x91, 0xE0, 0x91, 0xA8, 0x8C, 0xA8, 0x8C, 0x4C, 0x88, 0x4C, 0x88, 0xD5, 0x84,
-        0xD5, 0x84, 0x49, 0x82, 0x49, 0x82, 0xAE, 0x80, 0xAE, 0x80, 0x05, 0x80, 0x05, 0x80, 0x51, 0x80, 0x51, 0x80,
-        0x90, 0x81, 0x90, 0x81, 0xC1, 0x83, 0xC1, 0x83, 0xDF, 0x86, 0xDF, 0x86, 0xE5, 0x8A, 0xE5, 0x8A, 0xCA, 0x8F,
-        0xCA, 0x8F, 0x85, 0x95, 0x85, 0x95, 0x0C, 0x9C, 0x0C, 0x9C, 0x52, 0xA3, 0x52, 0xA3, 0x48, 0xAB, 0x48, 0xAB,
-        0xE1, 0xB3, 0xE1, 0xB3, 0x0A, 0xBD, 0x0A, 0xBD, 0xB4, 0xC6, 0xB4, 0xC6, 0xCB, 0xD0, 0xCB, 0xD0, 0x3C, 0xDB,
-        0x3C, 0xDB, 0xF4, 0xE5, 0xF4, 0xE5, 0xDD, 0xF0, 0xDD, 0xF0, 0xE3, 0xFB, 0xE3, 0xFB, 0xEF, 0x06, 0xEF, 0x06,
-        0xF0, 0x11, 0xF0, 0x11, 0xCF, 0x1C, 0xCF, 0x1C, 0x76, 0x27, 0x76, 0x27, 0xD2, 0x31, 0xD2, 0x31, 0xCF, 0x3B,
-        0xCF, 0x3B, 0x5A, 0x45, 0x5A, 0x45, 0x60, 0x4E, 0x60, 0x4E, 0xD1, 0x56, 0xD1, 0x56, 0x9B, 0x5E, 0x9B, 0x5E,
-        0xB2, 0x65, 0xB2, 0x65, 0x05, 0x6C, 0x05, 0x6C, 0x8B, 0x71, 0x8B, 0x71, 0x38, 0x76, 0x38, 0x76, 0x03, 0x7A,
-        0x03, 0x7A, 0xE5, 0x7C, 0xE5, 0x7C, 0xD9, 0x7E, 0xD9, 0x7E, 0xDA, 0x7F, 0xDA, 0x7F, 0xE7, 0x7F, 0xE7, 0x7F,
-        0x00, 0x7F, 0x00, 0x7F, 0x27, 0x7D, 0x27, 0x7D, 0x5E, 0x7A, 0x5E, 0x7A, 0xAC, 0x76, 0xAC, 0x76, 0x17, 0x72,
-        0x17, 0x72, 0xA9, 0x6C, 0xA9, 0x6C, 0x6A, 0x66, 0x6A, 0x66, 0x69, 0x5F, 0x69, 0x5F, 0xB1, 0x57, 0xB1, 0x57,
-        0x51, 0x4F, 0x51, 0x4F, 0x5A, 0x46, 0x5A, 0x46, 0xDD, 0x3C, 0xDD, 0x3C, 0xEC, 0x32, 0xEC, 0x32, 0x99, 0x28,
-        0x99, 0x28, 0xF9, 0x1D, 0xF9, 0x1D, 0x20, 0x13, 0x20, 0x13, 0x21, 0x08, 0x21, 0x08, 0x15, 0xFD, 0x15, 0xFD,
-        0x0D, 0xF2, 0x0D, 0xF2, 0x20, 0xE7, 0x20, 0xE7, 0x62, 0xDC, 0x62, 0xDC, 0xE8, 0xD1, 0xE8, 0xD1, 0xC7, 0xC7,
-        0xC7, 0xC7, 0x10, 0xBE, 0x10, 0xBE, 0xD8, 0xB4, 0xD8, 0xB4, 0x2F, 0xAC, 0x2F, 0xAC, 0x26, 0xA4, 0x26, 0xA4,
-        0xCD, 0x9C, 0xCD, 0x9C, 0x30, 0x96, 0x30, 0x96, 0x5F, 0x90, 0x5F, 0x90, 0x62, 0x8B, 0x62, 0x8B, 0x44, 0x87,
-        0x44, 0x87, 0x0C, 0x84, 0x0C, 0x84, 0xC1, 0x81, 0xC1, 0x81, 0x67, 0x80, 0x67, 0x80, 0x01, 0x80, 0x01, 0x80,
-        0x8F, 0x80, 0x8F, 0x80, 0x11, 0x82, 0x11, 0x82, 0x83, 0x84, 0x83, 0x84, 0xE1, 0x87, 0xE1, 0x87, 0x24, 0x8C,
-        0x24, 0x8C, 0x46, 0x91, 0x46, 0x91, 0x39, 0x97, 0x39, 0x97, 0xF5, 0x9D, 0xF5, 0x9D, 0x6D, 0xA5, 0x6D, 0xA5,
-        0x91, 0xAD, 0x91, 0xAD, 0x53, 0xB6, 0x53, 0xB6, 0xA1, 0xBF, 0xA1, 0xBF, 0x6A, 0xC9, 0x6A, 0xC9, 0x9C, 0xD3,
-        0x9C, 0xD3, 0x22, 0xDE, 0x22, 0xDE, 0xEA, 0xE8, 0xEA, 0xE8, 0xDD, 0xF3, 0xDD, 0xF3, 0xE6, 0xFE, 0xE6, 0xFE,
-        0xF2, 0x09, 0xF2, 0x09, 0xEB, 0x14, 0xEB, 0x14, 0xBD, 0x1F, 0xBD, 0x1F, 0x52, 0x2A, 0x52, 0x2A, 0x96, 0x34,
-        0x96, 0x34, 0x75, 0x3E, 0x75, 0x3E, 0xDD, 0x47, 0xDD, 0x47, 0xBD, 0x50, 0xBD, 0x50, 0x02, 0x59, 0x02, 0x59,
-        0x9D, 0x60, 0x9D, 0x60, 0x7F, 0x67, 0x7F, 0x67, 0x9C, 0x6D, 0x9C, 0x6D, 0xE7, 0x72, 0xE7, 0x72, 0x57, 0x77,
-        0x57, 0x77, 0xE4, 0x7A, 0xE4, 0x7A, 0x86, 0x7D, 0x86, 0x7D, 0x37, 0x7F, 0x37, 0x7F, 0xF6, 0x7F, 0xF6, 0x7F,
-        0xC0, 0x7F, 0xC0, 0x7F, 0x97, 0x7E, 0x97, 0x7E, 0x7C, 0x7C, 0x7C, 0x7C, 0x73, 0x79, 0x73, 0x79, 0x82, 0x75,
-        0x82, 0x75, 0xB1, 0x70, 0xB1, 0x70, 0x09, 0x6B, 0x09, 0x6B, 0x94, 0x64, 0x94, 0x64, 0x5F, 0x5D, 0x5F, 0x5D,
-        0x78, 0x55, 0x78, 0x55, 0xED, 0x4C, 0xED, 0x4C, 0xD1, 0x43, 0xD1, 0x43, 0x32, 0x3A, 0x32, 0x3A, 0x24, 0x30,
-        0x24, 0x30, 0xBA, 0x25, 0xBA, 0x25, 0x08, 0x1B, 0x08, 0x1B, 0x23, 0x10, 0x23, 0x10, 0x1E, 0x05, 0x1E, 0x05,
-        0x11, 0xFA, 0x11, 0xFA, 0x0F, 0xEF, 0x0F, 0xEF, 0x2C, 0xE4, 0x2C, 0xE4, 0x7F, 0xD9, 0x7F, 0xD9, 0x1B, 0xCF,
-        0x1B, 0xCF, 0x15, 0xC5, 0x15, 0xC5, 0x7F, 0xBB, 0x7F, 0xBB, 0x6C, 0xB2, 0x6C, 0xB2, 0xED, 0xA9, 0xED, 0xA9,
-        0x13, 0xA2, 0x13, 0xA2, 0xEC, 0x9A, 0xEC, 0x9A, 0x85, 0x94, 0x85, 0x94, 0xED, 0x8E, 0xED, 0x8E, 0x2C, 0x8A,
-        0x2C, 0x8A, 0x4C, 0x86, 0x4C, 0x86, 0x54, 0x83, 0x54, 0x83, 0x4B, 0x81, 0x4B, 0x81, 0x34, 0x80, 0x34, 0x80,
-        0x10, 0x80, 0x10, 0x80, 0xE1, 0x80, 0xE1, 0x80, 0xA4, 0x82, 0xA4, 0x82, 0x57, 0x85, 0x57, 0x85, 0xF4, 0x88,
-        0xF4, 0x88, 0x75, 0x8D, 0x75, 0x8D, 0xD0, 0x92, 0xD0, 0x92, 0xFC, 0x98, 0xFC, 0x98, 0xED, 0x9F, 0xED, 0x9F,
-        0x94, 0xA7, 0x94, 0xA7, 0xE5, 0xAF, 0xE5, 0xAF, 0xD0, 0xB8, 0xD0, 0xB8, 0x41, 0xC2, 0x41, 0xC2, 0x29, 0xCC,
-        0x29, 0xCC, 0x73, 0xD6, 0x73, 0xD6, 0x0D, 0xE1, 0x0D, 0xE1, 0xE2, 0xEB, 0xE2, 0xEB, 0xDE, 0xF6, 0xDE, 0xF6,
-        0xEA, 0x01, 0xEA, 0x01, 0xF3, 0x0C, 0xF3, 0x0C, 0xE4, 0x17, 0xE4, 0x17, 0xA6, 0x22, 0xA6, 0x22, 0x27, 0x2D,
-        0x27, 0x2D, 0x52, 0x37, 0x52, 0x37, 0x13, 0x41, 0x13, 0x41, 0x57, 0x4A, 0x57, 0x4A, 0x0E, 0x53, 0x0E, 0x53,
-        0x26, 0x5B, 0x26, 0x5B, 0x90, 0x62, 0x90, 0x62, 0x3E, 0x69, 0x3E, 0x69, 0x23, 0x6F, 0x23, 0x6F, 0x33, 0x74,
-        0x33, 0x74, 0x66, 0x78, 0x66, 0x78, 0xB3, 0x7B, 0xB3, 0x7B, 0x14, 0x7E, 0x14, 0x7E, 0x83, 0x7F, 0x83, 0x7F,
-        0xFF, 0x7F, 0xFF, 0x7F, 0x88, 0x7F, 0x88, 0x7F, 0x1C, 0x7E, 0x1C, 0x7E, 0xBF, 0x7B, 0xBF, 0x7B, 0x77, 0x78,
-        0x77, 0x78, 0x48, 0x74, 0x48, 0x74, 0x3B, 0x6F, 0x3B, 0x6F, 0x5A, 0x69, 0x5A, 0x69, 0xAF, 0x62, 0xAF, 0x62,
-        0x49, 0x5B, 0x49, 0x5B, 0x33, 0x53, 0x33, 0x53, 0x80, 0x4A, 0x80, 0x4A, 0x3D, 0x41, 0x3D, 0x41, 0x7E, 0x37,
-        0x7E, 0x37, 0x55, 0x2D, 0x55, 0x2D, 0xD6, 0x22, 0xD6, 0x22, 0x14, 0x18, 0x14, 0x18, 0x24, 0x0D, 0x24, 0x0D,
-        0x1B, 0x02, 0x1B, 0x02, 0x0E, 0xF7, 0x0E, 0xF7, 0x13, 0xEC, 0x13, 0xEC, 0x3D, 0xE1, 0x3D, 0xE1, 0xA2, 0xD6,
-        0xA2, 0xD6, 0x55, 0xCC, 0x55, 0xCC, 0x6C, 0xC2, 0x6C, 0xC2, 0xF8, 0xB8, 0xF8, 0xB8, 0x0C, 0xB0, 0x0C, 0xB0,
-        0xB8, 0xA7, 0xB8, 0xA7, 0x0D, 0xA0, 0x0D, 0xA0, 0x19, 0x99, 0x19, 0x99, 0xEA, 0x92, 0xEA, 0x92, 0x8B, 0x8D,
-        0x8B, 0x8D, 0x07, 0x89, 0x07, 0x89, 0x65, 0x85, 0x65, 0x85, 0xAE, 0x82, 0xAE, 0x82, 0xE6, 0x80, 0xE6, 0x80,
-        0x11, 0x80, 0x11, 0x80, 0x30, 0x80, 0x30, 0x80, 0x44, 0x81, 0x44, 0x81, 0x49, 0x83, 0x49, 0x83, 0x3D, 0x86,
-        0x3D, 0x86, 0x18, 0x8A, 0x18, 0x8A, 0xD6, 0x8E, 0xD6, 0x8E, 0x6B, 0x94, 0x6B, 0x94, 0xCD, 0x9A, 0xCD, 0x9A,
-        0xF2, 0xA1, 0xF2, 0xA1, 0xC9, 0xA9, 0xC9, 0xA9, 0x45, 0xB2, 0x45, 0xB2, 0x55, 0xBB, 0x55, 0xBB, 0xE9, 0xC4,
-        0xE9, 0xC4, 0xEE, 0xCE, 0xEE, 0xCE, 0x50, 0xD9, 0x50, 0xD9, 0xFC, 0xE3, 0xFC, 0xE3, 0xDE, 0xEE, 0xDE, 0xEE,
-        0xE0, 0xF9, 0xE0, 0xF9, 0xEE, 0x04, 0xEE, 0x04, 0xF2, 0x0F, 0xF2, 0x0F, 0xD9, 0x1A, 0xD9, 0x1A, 0x8B, 0x25,
-        0x8B, 0x25, 0xF6, 0x2F, 0xF6, 0x2F, 0x06, 0x3A, 0x06, 0x3A, 0xA7, 0x43, 0xA7, 0x43, 0xC6, 0x4C, 0xC6, 0x4C,
-        0x54, 0x55, 0x54, 0x55, 0x3E, 0x5D, 0x3E, 0x5D, 0x76, 0x64, 0x76, 0x64, 0xEE, 0x6A, 0xEE, 0x6A, 0x9A, 0x70,
-        0x9A, 0x70, 0x6F, 0x75, 0x6F, 0x75, 0x63, 0x79, 0x63, 0x79, 0x71, 0x7C, 0x71, 0x7C, 0x90, 0x7E, 0x90, 0x7E,
-        0xBE, 0x7F, 0xBE, 0x7F, 0xF7, 0x7F, 0xF7, 0x7F, 0x3C, 0x7F, 0x3C, 0x7F, 0x8F, 0x7D, 0x8F, 0x7D, 0xF1, 0x7A,
-        0xF1, 0x7A, 0x69, 0x77, 0x69, 0x77, 0xFD, 0x72, 0xFD, 0x72, 0xB5, 0x6D, 0xB5, 0x6D, 0x9C, 0x67, 0x9C, 0x67,
-        0xBD, 0x60, 0xBD, 0x60, 0x25, 0x59, 0x25, 0x59, 0xE3, 0x50, 0xE3, 0x50, 0x06, 0x48, 0x06, 0x48, 0xA0, 0x3E,
-        0xA0, 0x3E, 0xC3, 0x34, 0xC3, 0x34, 0x80, 0x2A, 0x80, 0x2A, 0xEC, 0x1F, 0xEC, 0x1F, 0x1C, 0x15, 0x1C, 0x15,
-        0x23, 0x0A, 0x23, 0x0A, 0x18, 0xFF, 0x18, 0xFF, 0x0D, 0xF4, 0x0D, 0xF4, 0x19, 0xE9, 0x19, 0xE9, 0x51, 0xDE,
-        0x51, 0xDE, 0xCA, 0xD3, 0xCA, 0xD3, 0x97, 0xC9, 0x97, 0xC9, 0xCB, 0xBF, 0xCB, 0xBF, 0x7B, 0xB6, 0x7B, 0xB6,
-        0xB6, 0xAD, 0xB6, 0xAD, 0x8F, 0xA5, 0x8F, 0xA5, 0x15, 0x9E, 0x15, 0x9E, 0x55, 0x97, 0x55, 0x97, 0x5E, 0x91,
-        0x5E, 0x91, 0x39, 0x8C, 0x39, 0x8C, 0xF2, 0x87, 0xF2, 0x87, 0x90, 0x84, 0x90, 0x84, 0x1A, 0x82, 0x1A, 0x82,
-        0x94, 0x80, 0x94, 0x80, 0x01, 0x80, 0x01, 0x80, 0x64, 0x80, 0x64, 0x80, 0xB9, 0x81, 0xB9, 0x81, 0x00, 0x84,
-        0x00, 0x84, 0x33, 0x87, 0x33, 0x87, 0x4E, 0x8B, 0x4E, 0x8B, 0x46, 0x90, 0x46, 0x90, 0x15, 0x96, 0x15, 0x96,
-        0xAD, 0x9C, 0xAD, 0x9C, 0x04, 0xA4, 0x04, 0xA4, 0x09, 0xAC, 0x09, 0xAC, 0xB0, 0xB4, 0xB0, 0xB4, 0xE7, 0xBD,
-        0xE7, 0xBD, 0x9A, 0xC7, 0x9A, 0xC7, 0xBA, 0xD1, 0xBA, 0xD1, 0x33, 0xDC, 0x33, 0xDC, 0xF0, 0xE6, 0xF0, 0xE6,
-        0xDC, 0xF1, 0xDC, 0xF1, 0xE4, 0xFC, 0xE4, 0xFC, 0xF1, 0x07, 0xF1, 0x07, 0xEF, 0x12, 0xEF, 0x12, 0xC9, 0x1D,
-        0xC9, 0x1D, 0x6A, 0x28, 0x6A, 0x28, 0xBF, 0x32, 0xBF, 0x32, 0xB2, 0x3C, 0xB2, 0x3C, 0x31, 0x46, 0x31, 0x46,
-        0x2B, 0x4F, 0x2B, 0x4F, 0x8D, 0x57, 0x8D, 0x57, 0x48, 0x5F, 0x48, 0x5F, 0x4D, 0x66, 0x4D, 0x66, 0x8E, 0x6C,
-        0x8E, 0x6C, 0x01, 0x72, 0x01, 0x72, 0x9A, 0x76, 0x9A, 0x76, 0x50, 0x7A, 0x50, 0x7A, 0x1C, 0x7D, 0x1C, 0x7D,
-        0xFA, 0x7E, 0xFA, 0x7E, 0xE5, 0x7F, 0xE5, 0x7F, 0xDD, 0x7F, 0xDD, 0x7F, 0xDF, 0x7E, 0xDF, 0x7E, 0xF0, 0x7C,
-        0xF0, 0x7C, 0x12, 0x7A, 0x12, 0x7A, 0x4B, 0x76, 0x4B, 0x76, 0xA1, 0x71, 0xA1, 0x71, 0x20, 0x6C, 0x20, 0x6C,
-        0xCF, 0x65, 0xCF, 0x65, 0xBC, 0x5E, 0xBC, 0x5E, 0xF4, 0x56, 0xF4, 0x56, 0x87, 0x4E, 0x87, 0x4E, 0x83, 0x45,
-        0x83, 0x45, 0xFA, 0x3B, 0xFA, 0x3B, 0xFF, 0x31, 0xFF, 0x31, 0xA5, 0x27, 0xA5, 0x27, 0xFE, 0x1C, 0xFE, 0x1C,
-        0x21, 0x12, 0x21, 0x12, 0x21, 0x07, 0x21, 0x07, 0x14, 0xFC, 0x14, 0xFC, 0x0D, 0xF1, 0x0D, 0xF1, 0x23, 0xE6,
-        0x23, 0xE6, 0x6B, 0xDB, 0x6B, 0xDB, 0xF8, 0xD0, 0xF8, 0xD0, 0xE0, 0xC6, 0xE0, 0xC6, 0x34, 0xBD, 0x34, 0xBD,
-        0x08, 0xB4, 0x08, 0xB4, 0x6D, 0xAB, 0x6D, 0xAB, 0x73, 0xA3, 0x73, 0xA3, 0x2B, 0x9C, 0x2B, 0x9C, 0xA1, 0x95,
-        0xA1, 0x95, 0xE1, 0x8F, 0xE1, 0x8F, 0xF8, 0x8A, 0xF8, 0x8A, 0xEF, 0x86, 0xEF, 0x86, 0xCC, 0x83, 0xCC, 0x83,
-        0x98, 0x81, 0x98, 0x81, 0x54, 0x80, 0x54, 0x80, 0x04, 0x80, 0x04, 0x80, 0xA8, 0x80, 0xA8, 0x80, 0x40, 0x82,
-        0x40, 0x82, 0xC8, 0x84, 0xC8, 0x84, 0x3B, 0x88, 0x3B, 0x88, 0x93, 0x8C, 0x93, 0x8C, 0xC7, 0x91, 0xC7, 0x91,
-        0xCE, 0x97, 0xCE, 0x97, 0x9C, 0x9E, 0x9C, 0x9E, 0x23, 0xA6, 0x23, 0xA6, 0x56, 0xAE, 0x56, 0xAE, 0x25, 0xB7,
-        0x25, 0xB7, 0x80, 0xC0, 0x80, 0xC0, 0x53, 0xCA, 0x53, 0xCA, 0x8E, 0xD4, 0x8E, 0xD4, 0x1B, 0xDF, 0x1B, 0xDF,
-        0xE6, 0xE9, 0xE6, 0xE9, 0xDD, 0xF4, 0xDD, 0xF4, 0xE8, 0xFF, 0xE8, 0xFF, 0xF2, 0x0A, 0xF2, 0x0A, 0xE9, 0x15,
-        0xE9, 0x15, 0xB6, 0x20, 0xB6, 0x20, 0x44, 0x2B, 0x44, 0x2B, 0x80, 0x35, 0x80, 0x35, 0x55, 0x3F, 0x55, 0x3F,
-        0xB2, 0x48, 0xB2, 0x48, 0x84, 0x51, 0x84, 0x51, 0xBA, 0x59, 0xBA, 0x59, 0x45, 0x61, 0x45, 0x61, 0x16, 0x68,
-        0x16, 0x68, 0x20, 0x6E, 0x20, 0x6E, 0x58, 0x73, 0x58, 0x73, 0xB4, 0x77, 0xB4, 0x77, 0x2B, 0x7B, 0x2B, 0x7B,
-        0xB7, 0x7D, 0xB7, 0x7D, 0x52, 0x7F, 0x52, 0x7F, 0xFB, 0x7F, 0xFB, 0x7F, 0xAF, 0x7F, 0xAF, 0x7F, 0x70, 0x7E,
-        0x70, 0x7E, 0x3F, 0x7C, 0x3F, 0x7C, 0x21, 0x79, 0x21, 0x79, 0x1B, 0x75, 0x1B, 0x75, 0x37, 0x70, 0x37, 0x70,
-        0x7A, 0x6A, 0x7A, 0x6A, 0xF4, 0x63, 0xF4, 0x63, 0xAE, 0x5C, 0xAE, 0x5C, 0xB8, 0x54, 0xB8, 0x54, 0x20, 0x4C,
-        0x20, 0x4C, 0xF6, 0x42, 0xF6, 0x42, 0x4C, 0x39, 0x4C, 0x39, 0x35, 0x2F, 0x35, 0x2F, 0xC4, 0x24, 0xC4, 0x24,
-        0x0D, 0x1A, 0x0D, 0x1A, 0x23, 0x0F, 0x23, 0x0F, 0x1E, 0x04, 0x1E, 0x04, 0x10, 0xF9, 0x10, 0xF9, 0x10, 0xEE,
-        0x10, 0xEE, 0x32, 0xE3, 0x32, 0xE3, 0x8A, 0xD8, 0x8A, 0xD8, 0x2E, 0xCE, 0x2E, 0xCE, 0x31, 0xC4, 0x31, 0xC4,
-        0xA6, 0xBA, 0xA6, 0xBA, 0xA0, 0xB1, 0xA0, 0xB1, 0x2F, 0xA9, 0x2F, 0xA9, 0x65, 0xA1, 0x65, 0xA1, 0x4F, 0x9A,
-        0x4F, 0x9A, 0xFB, 0x93, 0xFB, 0x93, 0x75, 0x8E, 0x75, 0x8E, 0xC8, 0x89, 0xC8, 0x89, 0xFD, 0x85, 0xFD, 0x85,
-        0x1B, 0x83, 0x1B, 0x83, 0x27, 0x81, 0x27, 0x81, 0x26, 0x80, 0x26, 0x80, 0x18, 0x80, 0x18, 0x80, 0x00, 0x81,
-        0x00, 0x81, 0xD9, 0x82, 0xD9, 0x82, 0xA2, 0x85, 0xA2, 0x85, 0x54, 0x89, 0x54, 0x89, 0xE9, 0x8D, 0xE9, 0x8D,
-        0x57, 0x93, 0x57, 0x93, 0x96, 0x99, 0x96, 0x99, 0x97, 0xA0, 0x97, 0xA0, 0x4F, 0xA8, 0x4F, 0xA8, 0xAF, 0xB0,
-        0xAF, 0xB0, 0xA6, 0xB9, 0xA6, 0xB9, 0x23, 0xC3, 0x23, 0xC3, 0x14, 0xCD, 0x14, 0xCD, 0x67, 0xD7, 0x67, 0xD7,
-        0x07, 0xE2, 0x07, 0xE2, 0xE0, 0xEC, 0xE0, 0xEC, 0xDE, 0xF7, 0xDE, 0xF7, 0xEB, 0x02, 0xEB, 0x02, 0xF3, 0x0D,
-        0xF3, 0x0D, 0xE1, 0x18, 0xE1, 0x18, 0x9E, 0x23, 0x9E, 0x23, 0x18, 0x2E, 0x18, 0x2E, 0x39, 0x38, 0x39, 0x38,
-        0xF0, 0x41, 0xF0, 0x41, 0x29, 0x4B, 0x29, 0x4B, 0xD1, 0x53, 0xD1, 0x53, 0xDA, 0x5B, 0xDA, 0x5B, 0x33, 0x63,
-        0x33, 0x63, 0xD0, 0x69, 0xD0, 0x69, 0xA1, 0x6F, 0xA1, 0x6F, 0x9F, 0x74, 0x9F, 0x74, 0xBC, 0x78, 0xBC, 0x78,
-        0xF5, 0x7B, 0xF5, 0x7B, 0x3F, 0x7E, 0x3F, 0x7E, 0x99, 0x7F, 0x99, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x71, 0x7F,
-        0x71, 0x7F, 0xEF, 0x7D, 0xEF, 0x7D, 0x7D, 0x7B, 0x7D, 0x7B, 0x1E, 0x78, 0x1E, 0x78, 0xDB, 0x73, 0xDB, 0x73,
-        0xBB, 0x6E, 0xBB, 0x6E, 0xC7, 0x68, 0xC7, 0x68, 0x0B, 0x62, 0x0B, 0x62, 0x93, 0x5A, 0x93, 0x5A, 0x6F, 0x52,
-        0x6F, 0x52, 0xAE, 0x49, 0xAE, 0x49, 0x5F, 0x40, 0x5F, 0x40, 0x96, 0x36, 0x96, 0x36, 0x64, 0x2C, 0x64, 0x2C,
-        0xDE, 0x21, 0xDE, 0x21, 0x17, 0x17, 0x17, 0x17, 0x23, 0x0C, 0x23, 0x0C, 0x1A, 0x01, 0x1A, 0x01, 0x0E, 0xF6,
-        0x0E, 0xF6, 0x14, 0xEB, 0x14, 0xEB, 0x43, 0xE0, 0x43, 0xE0, 0xAE, 0xD5, 0xAE, 0xD5, 0x6A, 0xCB, 0x6A, 0xCB,
-        0x8B, 0xC1, 0x8B, 0xC1, 0x22, 0xB8, 0x22, 0xB8, 0x43, 0xAF, 0x43, 0xAF, 0xFE, 0xA6, 0xFE, 0xA6, 0x63, 0x9F,
-        0x63, 0x9F, 0x81, 0x98, 0x81, 0x98, 0x64, 0x92, 0x64, 0x92, 0x19, 0x8D, 0x19, 0x8D, 0xA9, 0x88, 0xA9, 0x88,
-        0x1D, 0x85, 0x1D, 0x85, 0x7A, 0x82, 0x7A, 0x82, 0xC9, 0x80, 0xC9, 0x80, 0x0A, 0x80, 0x0A, 0x80, 0x40, 0x80,
-        0x40, 0x80, 0x68, 0x81, 0x68, 0x81, 0x84, 0x83, 0x84, 0x83, 0x8D, 0x86, 0x8D, 0x86, 0x7E, 0x8A, 0x7E, 0x8A,
-        0x4F, 0x8F, 0x4F, 0x8F, 0xF7, 0x94, 0xF7, 0x94, 0x6C, 0x9B, 0x6C, 0x9B, 0xA1, 0xA2, 0xA1, 0xA2, 0x88, 0xAA,
-        0x88, 0xAA, 0x12, 0xB3, 0x12, 0xB3, 0x2F, 0xBC, 0x2F, 0xBC, 0xCE, 0xC5, 0xCE, 0xC5, 0xDC, 0xCF, 0xDC, 0xCF,
-        0x46, 0xDA, 0x46, 0xDA, 0xF8, 0xE4, 0xF8, 0xE4, 0xDD, 0xEF, 0xDD, 0xEF, 0xE1, 0xFA, 0xE1, 0xFA, 0xEE, 0x05,
-        0xEE, 0x05, 0xF2, 0x10, 0xF2, 0x10, 0xD4, 0x1B, 0xD4, 0x1B, 0x81, 0x26, 0x81, 0x26, 0xE4, 0x30, 0xE4, 0x30,
-        0xEB, 0x3A, 0xEB, 0x3A, 0x81, 0x44, 0x81, 0x44, 0x94, 0x4D, 0x94, 0x4D, 0x13, 0x56, 0x13, 0x56, 0xED, 0x5D,
-        0xED, 0x5D, 0x14, 0x65, 0x14, 0x65, 0x7B, 0x6B, 0x7B, 0x6B, 0x13, 0x71, 0x13, 0x71, 0xD5, 0x75, 0xD5, 0x75,
-        0xB4, 0x79, 0xB4, 0x79, 0xAC, 0x7C, 0xAC, 0x7C, 0xB5, 0x7E, 0xB5, 0x7E, 0xCD, 0x7F, 0xCD, 0x7F, 0xF1, 0x7F,
-        0xF1, 0x7F, 0x1F, 0x7F, 0x1F, 0x7F, 0x5C, 0x7D, 0x5C, 0x7D, 0xA9, 0x7A, 0xA9, 0x7A, 0x0C, 0x77, 0x0C, 0x77,
-        0x8B, 0x72, 0x8B, 0x72, 0x30, 0x6D, 0x30, 0x6D, 0x04, 0x67, 0x04, 0x67, 0x14, 0x60, 0x14, 0x60, 0x6B, 0x58,
-        0x6B, 0x58, 0x1B, 0x50, 0x1B, 0x50, 0x31, 0x47, 0x31, 0x47, 0xBF, 0x3D, 0xBF, 0x3D, 0xD7, 0x33, 0xD7, 0x33,
-        0x8D, 0x29, 0x8D, 0x29, 0xF3, 0x1E, 0xF3, 0x1E, 0x1E, 0x14, 0x1E, 0x14, 0x22, 0x09, 0x22, 0x09, 0x16, 0xFE,
-        0x16, 0xFE, 0x0D, 0xF3, 0x0D, 0xF3, 0x1D, 0xE8, 0x1D, 0xE8, 0x5A, 0xDD, 0x5A, 0xDD, 0xD8, 0xD2, 0xD8, 0xD2,
-        0xAE, 0xC8, 0xAE, 0xC8, 0xED, 0xBE, 0xED, 0xBE, 0xA9, 0xB5, 0xA9, 0xB5, 0xF1, 0xAC, 0xF1, 0xAC, 0xDA, 0xA4,
-        0xDA, 0xA4, 0x70, 0x9D, 0x70, 0x9D, 0xC2, 0x96, 0xC2, 0x96, 0xDD, 0x90, 0xDD, 0x90, 0xCD, 0x8B, 0xCD, 0x8B,
-        0x9A, 0x87, 0x9A, 0x87, 0x4D, 0x84, 0x4D, 0x84, 0xEC, 0x81, 0xEC, 0x81, 0x7D, 0x80, 0x7D, 0x80, 0x00, 0x80,
-        0x00, 0x80, 0x78, 0x80, 0x78, 0x80, 0xE4, 0x81, 0xE4, 0x81, 0x40, 0x84, 0x40, 0x84, 0x89, 0x87, 0x89, 0x87,
-        0xB8, 0x8B, 0xB8, 0x8B, 0xC5, 0x90, 0xC5, 0x90, 0xA6, 0x96, 0xA6, 0x96, 0x51, 0x9D, 0x51, 0x9D, 0xB7, 0xA4,
-        0xB7, 0xA4, 0xCD, 0xAC, 0xCD, 0xAC, 0x81, 0xB5, 0x81, 0xB5, 0xC3, 0xBE, 0xC3, 0xBE, 0x82, 0xC8, 0x82, 0xC8,
-        0xAB, 0xD2, 0xAB, 0xD2, 0x2B, 0xDD, 0x2B, 0xDD, 0xEC, 0xE7, 0xEC, 0xE7, 0xDD, 0xF2, 0xDD, 0xF2, 0xE5, 0xFD,
-        0xE5, 0xFD, 0xF1, 0x08, 0xF1, 0x08, 0xED, 0x13, 0xED, 0x13, 0xC3, 0x1E, 0xC3, 0x1E, 0x5E, 0x29, 0x5E, 0x29,
-        0xAB, 0x33, 0xAB, 0x33, 0x94, 0x3D, 0x94, 0x3D, 0x08, 0x47, 0x08, 0x47, 0xF4, 0x4F, 0xF4, 0x4F, 0x48, 0x58,
-        0x48, 0x58, 0xF3, 0x5F, 0xF3, 0x5F, 0xE7, 0x66, 0xE7, 0x66, 0x16, 0x6D, 0x16, 0x6D, 0x75, 0x72, 0x75, 0x72,
-        0xF9, 0x76, 0xF9, 0x76, 0x9B, 0x7A, 0x9B, 0x7A, 0x52, 0x7D, 0x52, 0x7D, 0x1A, 0x7F, 0x1A, 0x7F, 0xEF, 0x7F,
-        0xEF, 0x7F, 0xCF, 0x7F, 0xCF, 0x7F, 0xBC, 0x7E, 0xBC, 0x7E, 0xB7, 0x7C, 0xB7, 0x7C, 0xC3, 0x79, 0xC3, 0x79,
-        0xE7, 0x75, 0xE7, 0x75, 0x2A, 0x71, 0x2A, 0x71, 0x95, 0x6B, 0x95, 0x6B, 0x33, 0x65, 0x33, 0x65, 0x0E, 0x5E,
-        0x0E, 0x5E, 0x37, 0x56, 0x37, 0x56, 0xBB, 0x4D, 0xBB, 0x4D, 0xAA, 0x44, 0xAA, 0x44, 0x16, 0x3B, 0x16, 0x3B,
-        0x12, 0x31, 0x12, 0x31, 0xB0, 0x26, 0xB0, 0x26, 0x03, 0x1C, 0x03, 0x1C, 0x22, 0x11, 0x22, 0x11, 0x20, 0x06,
-        0x20, 0x06, 0x12, 0xFB, 0x12, 0xFB, 0x0E, 0xF0, 0x0E, 0xF0, 0x28, 0xE5, 0x28, 0xE5, 0x75, 0xDA, 0x75, 0xDA,
-        0x0A, 0xD0, 0x0A, 0xD0, 0xFA, 0xC5, 0xFA, 0xC5, 0x59, 0xBC, 0x59, 0xBC, 0x3A, 0xB3, 0x3A, 0xB3, 0xAD, 0xAA,
-        0xAD, 0xAA, 0xC2, 0xA2, 0xC2, 0xA2, 0x8A, 0x9B, 0x8A, 0x9B, 0x12, 0x95, 0x12, 0x95, 0x66, 0x8F, 0x66, 0x8F,
-        0x91, 0x8A, 0x91, 0x8A, 0x9D, 0x86, 0x9D, 0x86, 0x8F, 0x83, 0x8F, 0x83, 0x71, 0x81, 0x71, 0x81, 0x42, 0x80,
-        0x42, 0x80, 0x09, 0x80, 0x09, 0x80, 0xC3, 0x80, 0xC3, 0x80, 0x71, 0x82, 0x71, 0x82, 0x0E, 0x85, 0x0E, 0x85,
-        0x97, 0x88, 0x97, 0x88, 0x03, 0x8D, 0x03, 0x8D, 0x4B, 0x92, 0x4B, 0x92, 0x64, 0x98, 0x64, 0x98, 0x43, 0x9F,
-        0x43, 0x9F, 0xDB, 0xA6, 0xDB, 0xA6, 0x1D, 0xAF, 0x1D, 0xAF, 0xFA, 0xB7, 0xFA, 0xB7, 0x60, 0xC1, 0x60, 0xC1,
-        0x3E, 0xCB, 0x3E, 0xCB, 0x80, 0xD5, 0x80, 0xD5, 0x14, 0xE0, 0x14, 0xE0, 0xE4, 0xEA, 0xE4, 0xEA, 0xDD, 0xF5,
-        0xDD, 0xF5, 0xE9, 0x00, 0xE9, 0x00, 0xF3, 0x0B, 0xF3, 0x0B, 0xE7, 0x16, 0xE7, 0x16, 0xAE, 0x21, 0xAE, 0x21,
-        0x36, 0x2C, 0x36, 0x2C, 0x69, 0x36, 0x69, 0x36, 0x35, 0x40, 0x35, 0x40, 0x85, 0x49, 0x85, 0x49, 0x4A, 0x52,
-        0x4A, 0x52, 0x71, 0x5A, 0x71, 0x5A, 0xEB, 0x61, 0xEB, 0x61, 0xAA, 0x68, 0xAA, 0x68, 0xA2, 0x6E, 0xA2, 0x6E,
-        0xC6, 0x73, 0xC6, 0x73, 0x0E, 0x78, 0x0E, 0x78, 0x70, 0x7B, 0x70, 0x7B, 0xE7, 0x7D, 0xE7, 0x7D, 0x6C, 0x7F,
-        0x6C, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x47, 0x7E, 0x47, 0x7E, 0x00, 0x7C, 0x00, 0x7C,
-        0xCD, 0x78, 0xCD, 0x78, 0xB2, 0x74, 0xB2, 0x74, 0xBA, 0x6F, 0xBA, 0x6F, 0xEB, 0x69, 0xEB, 0x69, 0x53, 0x63,
-        0x53, 0x63, 0xFC, 0x5B, 0xFC, 0x5B, 0xF6, 0x53, 0xF6, 0x53, 0x50, 0x4B, 0x50, 0x4B, 0x1A, 0x42, 0x1A, 0x42,
-        0x66, 0x38, 0x66, 0x38, 0x46, 0x2E, 0x46, 0x2E, 0xCD, 0x23, 0xCD, 0x23, 0x10, 0x19, 0x10, 0x19, 0x24, 0x0E,
-        0x24, 0x0E, 0x1C, 0x03, 0x1C, 0x03, 0x10, 0xF8, 0x10, 0xF8, 0x11, 0xED, 0x11, 0xED, 0x37, 0xE2, 0x37, 0xE2,
-        0x95, 0xD7, 0x95, 0xD7, 0x41, 0xCD, 0x41, 0xCD, 0x4E, 0xC3, 0x4E, 0xC3, 0xCE, 0xB9, 0xCE, 0xB9, 0xD5, 0xB0,
-        0xD5, 0xB0, 0x73, 0xA8, 0x73, 0xA8, 0xB8, 0xA0, 0xB8, 0xA0, 0xB3, 0x99, 0xB3, 0x99, 0x71, 0x93, 0x71, 0x93,
-        0xFF, 0x8D, 0xFF, 0x8D, 0x67, 0x89, 0x67, 0x89, 0xB0, 0x85, 0xB0, 0x85, 0xE4, 0x82, 0xE4, 0x82, 0x05, 0x81,
-        0x05, 0x81, 0x1B, 0x80, 0x1B, 0x80, 0x23, 0x80, 0x23, 0x80, 0x21, 0x81, 0x21, 0x81, 0x10, 0x83, 0x10, 0x83,
-        0xEE, 0x85, 0xEE, 0x85, 0xB5, 0x89, 0xB5, 0x89, 0x5E, 0x8E, 0x5E, 0x8E, 0xE0, 0x93, 0xE0, 0x93, 0x31, 0x9A,
-        0x31, 0x9A, 0x44, 0xA1, 0x44, 0xA1, 0x0B, 0xA9, 0x0B, 0xA9, 0x79, 0xB1, 0x79, 0xB1, 0x7D, 0xBA, 0x7D, 0xBA,
-        0x06, 0xC4, 0x06, 0xC4, 0x01, 0xCE, 0x01, 0xCE, 0x5B, 0xD8, 0x5B, 0xD8, 0x01, 0xE3, 0x01, 0xE3, 0xDF, 0xED,
-        0xDF, 0xED, 0xE0, 0xF8, 0xE0, 0xF8, 0xED, 0x03, 0xED, 0x03, 0xF3, 0x0E, 0xF3, 0x0E, 0xDD, 0x19, 0xDD, 0x19,
-        0x95, 0x24, 0x95, 0x24, 0x07, 0x2F, 0x07, 0x2F, 0x20, 0x39, 0x20, 0x39, 0xCC, 0x42, 0xCC, 0x42, 0xF8, 0x4B,
-        0xF8, 0x4B, 0x93, 0x54, 0x93, 0x54, 0x8D, 0x5C, 0x8D, 0x5C, 0xD5, 0x63, 0xD5, 0x63, 0x60, 0x6A, 0x60, 0x6A,
-        0x1F, 0x70, 0x1F, 0x70, 0x08, 0x75, 0x08, 0x75, 0x11, 0x79, 0x11, 0x79, 0x34, 0x7C, 0x34, 0x7C, 0x68, 0x7E,
-        0x68, 0x7E, 0xAD, 0x7F, 0xAD, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0x58, 0x7F, 0x58, 0x7F, 0xC0, 0x7D, 0xC0, 0x7D,
-        0x38, 0x7B, 0x38, 0x7B, 0xC5, 0x77, 0xC5, 0x77, 0x6D, 0x73, 0x6D, 0x73, 0x39, 0x6E, 0x39, 0x6E, 0x32, 0x68,
-        0x32, 0x68, 0x65, 0x61, 0x65, 0x61, 0xDD, 0x59, 0xDD, 0x59, 0xAA, 0x51, 0xAA, 0x51, 0xDB, 0x48, 0xDB, 0x48,
-        0x80, 0x3F, 0x80, 0x3F, 0xAD, 0x35, 0xAD, 0x35, 0x72, 0x2B, 0x72, 0x2B, 0xE5, 0x20, 0xE5, 0x20, 0x19, 0x16,
-        0x19, 0x16, 0x23, 0x0B, 0x23, 0x0B, 0x18, 0x00, 0x18, 0x00, 0x0D, 0xF5, 0x0D, 0xF5, 0x17, 0xEA, 0x17, 0xEA,
-        0x4A, 0xDF, 0x4A, 0xDF, 0xBC, 0xD4, 0xBC, 0xD4, 0x80, 0xCA, 0x80, 0xCA, 0xAA, 0xC0, 0xAA, 0xC0, 0x4E, 0xB7,
-        0x4E, 0xB7, 0x7C, 0xAE, 0x7C, 0xAE, 0x47, 0xA6, 0x47, 0xA6, 0xBC, 0x9E, 0xBC, 0x9E, 0xEB, 0x97, 0xEB, 0x97,
-        0xE0, 0x91, 0xE0, 0x91, 0xA8, 0x8C, 0xA8, 0x8C, 0x4C, 0x88, 0x4C, 0x88, 0xD5, 0x84, 0xD5, 0x84, 0x49, 0x82,
-        0x49, 0x82, 0xAE, 0x80, 0xAE, 0x80, 0x05, 0x80, 0x05, 0x80, 0x51, 0x80, 0x51, 0x80, 0x90, 0x81, 0x90, 0x81,
-        0xC1, 0x83, 0xC1, 0x83, 0xDF, 0x86, 0xDF, 0x86, 0xE5, 0x8A, 0xE5, 0x8A, 0xCA, 0x8F, 0xCA, 0x8F, 0x85, 0x95,
-        0x85, 0x95, 0x0C, 0x9C, 0x0C, 0x9C, 0x52, 0xA3, 0x52, 0xA3, 0x48, 0xAB, 0x48, 0xAB, 0xE1, 0xB3, 0xE1, 0xB3,
-        0x0A, 0xBD, 0x0A, 0xBD, 0xB4, 0xC6, 0xB4, 0xC6, 0xCB, 0xD0, 0xCB, 0xD0, 0x3C, 0xDB, 0x3C, 0xDB, 0xF4, 0xE5,
-        0xF4, 0xE5, 0xDD, 0xF0, 0xDD, 0xF0, 0xE3, 0xFB, 0xE3, 0xFB, 0xEF, 0x06, 0xEF, 0x06, 0xF0, 0x11, 0xF0, 0x11,
-        0xCF, 0x1C, 0xCF, 0x1C, 0x76, 0x27, 0x76, 0x27, 0xD2, 0x31, 0xD2, 0x31, 0xCF, 0x3B, 0xCF, 0x3B, 0x5A, 0x45,
-        0x5A, 0x45, 0x60, 0x4E, 0x60, 0x4E, 0xD1, 0x56, 0xD1, 0x56, 0x9B, 0x5E, 0x9B, 0x5E, 0xB2, 0x65, 0xB2, 0x65,
-        0x05, 0x6C, 0x05, 0x6C, 0x8B, 0x71, 0x8B, 0x71, 0x38, 0x76, 0x38, 0x76, 0x03, 0x7A, 0x03, 0x7A, 0xE5, 0x7C,
-        0xE5, 0x7C, 0xD9, 0x7E, 0xD9, 0x7E, 0xDA, 0x7F, 0xDA, 0x7F, 0xE7, 0x7F, 0xE7, 0x7F, 0x00, 0x7F, 0x00, 0x7F,
-        0x27, 0x7D, 0x27, 0x7D, 0x5E, 0x7A, 0x5E, 0x7A, 0xAC, 0x76, 0xAC, 0x76, 0x17, 0x72, 0x17, 0x72, 0xA9, 0x6C,
-        0xA9, 0x6C, 0x6A, 0x66, 0x6A, 0x66, 0x69, 0x5F, 0x69, 0x5F, 0xB1, 0x57, 0xB1, 0x57, 0x51, 0x4F, 0x51, 0x4F,
-        0x5A, 0x46, 0x5A, 0x46, 0xDD, 0x3C, 0xDD, 0x3C, 0xEC, 0x32, 0xEC, 0x32, 0x99, 0x28, 0x99, 0x28, 0xF9, 0x1D,
-        0xF9, 0x1D, 0x20, 0x13, 0x20, 0x13, 0x21, 0x08, 0x21, 0x08, 0x15, 0xFD, 0x15, 0xFD, 0x0D, 0xF2, 0x0D, 0xF2,
-        0x20, 0xE7, 0x20, 0xE7, 0x62, 0xDC, 0x62, 0xDC, 0xE8, 0xD1, 0xE8, 0xD1, 0xC7, 0xC7, 0xC7, 0xC7, 0x10, 0xBE,
-        0x10, 0xBE, 0xD8, 0xB4, 0xD8, 0xB4, 0x2F, 0xAC, 0x2F, 0xAC, 0x26, 0xA4, 0x26, 0xA4, 0xCD, 0x9C, 0xCD, 0x9C,
-        0x30, 0x96, 0x30, 0x96, 0x5F, 0x90, 0x5F, 0x90, 0x62, 0x8B, 0x62, 0x8B, 0x44, 0x87, 0x44, 0x87, 0x0C, 0x84,
-        0x0C, 0x84, 0xC1, 0x81, 0xC1, 0x81, 0x67, 0x80, 0x67, 0x80, 0x01, 0x80, 0x01, 0x80, 0x8F, 0x80, 0x8F, 0x80,
-        0x11, 0x82, 0x11, 0x82, 0x83, 0x84, 0x83, 0x84, 0xE1, 0x87, 0xE1, 0x87, 0x24, 0x8C, 0x24, 0x8C, 0x46, 0x91,
-        0x46, 0x91, 0x39, 0x97, 0x39, 0x97, 0xF5, 0x9D, 0xF5, 0x9D, 0x6D, 0xA5, 0x6D, 0xA5, 0x91, 0xAD, 0x91, 0xAD,
-        0x53, 0xB6, 0x53, 0xB6, 0xA1, 0xBF, 0xA1, 0xBF, 0x6A, 0xC9, 0x6A, 0xC9, 0x9C, 0xD3, 0x9C, 0xD3, 0x22, 0xDE,
-        0x22, 0xDE, 0xEA, 0xE8, 0xEA, 0xE8, 0xDD, 0xF3, 0xDD, 0xF3, 0xE6, 0xFE, 0xE6, 0xFE, 0xF2, 0x09, 0xF2, 0x09,
-        0xEB, 0x14, 0xEB, 0x14, 0xBD, 0x1F, 0xBD, 0x1F, 0x52, 0x2A, 0x52, 0x2A, 0x96, 0x34, 0x96, 0x34, 0x75, 0x3E,
-        0x75, 0x3E, 0xDD, 0x47, 0xDD, 0x47, 0xBD, 0x50, 0xBD, 0x50, 0x02, 0x59, 0x02, 0x59, 0x9D, 0x60, 0x9D, 0x60,
-        0x7F, 0x67, 0x7F, 0x67, 0x9C, 0x6D, 0x9C, 0x6D, 0xE7, 0x72, 0xE7, 0x72, 0x57, 0x77, 0x57, 0x77, 0xE4, 0x7A,
-        0xE4, 0x7A, 0x86, 0x7D, 0x86, 0x7D, 0x37, 0x7F, 0x37, 0x7F, 0xF6, 0x7F, 0xF6, 0x7F, 0xC0, 0x7F, 0xC0, 0x7F,
-        0x97, 0x7E, 0x97, 0x7E, 0x7C, 0x7C, 0x7C, 0x7C, 0x73, 0x79, 0x73, 0x79, 0x82, 0x75, 0x82, 0x75, 0xB1, 0x70,
-        0xB1, 0x70, 0x09, 0x6B, 0x09, 0x6B, 0x94, 0x64, 0x94, 0x64, 0x5F, 0x5D, 0x5F, 0x5D, 0x78, 0x55, 0x78, 0x55,
-        0xED, 0x4C, 0xED, 0x4C, 0xD1, 0x43, 0xD1, 0x43, 0x32, 0x3A, 0x32, 0x3A, 0x24, 0x30, 0x24, 0x30, 0xBA, 0x25,
-        0xBA, 0x25, 0x08, 0x1B, 0x08, 0x1B, 0x23, 0x10, 0x23, 0x10, 0x1E, 0x05, 0x1E, 0x05, 0x11, 0xFA, 0x11, 0xFA,
-        0x0F, 0xEF, 0x0F, 0xEF, 0x2C, 0xE4, 0x2C, 0xE4, 0x7F, 0xD9, 0x7F, 0xD9, 0x1B, 0xCF, 0x1B, 0xCF, 0x15, 0xC5,
-        0x15, 0xC5, 0x7F, 0xBB, 0x7F, 0xBB, 0x6C, 0xB2, 0x6C, 0xB2, 0xED, 0xA9, 0xED, 0xA9, 0x13, 0xA2, 0x13, 0xA2,
-        0xEC, 0x9A, 0xEC, 0x9A, 0x85, 0x94, 0x85, 0x94, 0xED, 0x8E, 0xED, 0x8E, 0x2C, 0x8A, 0x2C, 0x8A, 0x4C, 0x86,
-        0x4C, 0x86, 0x54, 0x83, 0x54, 0x83, 0x4B, 0x81, 0x4B, 0x81, 0x34, 0x80, 0x34, 0x80, 0x10, 0x80, 0x10, 0x80,
-        0xE1, 0x80, 0xE1, 0x80, 0xA4, 0x82, 0xA4, 0x82, 0x57, 0x85, 0x57, 0x85, 0xF4, 0x88, 0xF4, 0x88, 0x75, 0x8D,
-        0x75, 0x8D, 0xD0, 0x92, 0xD0, 0x92, 0xFC, 0x98, 0xFC, 0x98, 0xED, 0x9F, 0xED, 0x9F, 0x94, 0xA7, 0x94, 0xA7,
-        0xE5, 0xAF, 0xE5, 0xAF, 0xD0, 0xB8, 0xD0, 0xB8, 0x41, 0xC2, 0x41, 0xC2, 0x29, 0xCC, 0x29, 0xCC, 0x73, 0xD6,
-        0x73, 0xD6, 0x0D, 0xE1, 0x0D, 0xE1, 0xE2, 0xEB, 0xE2, 0xEB, 0xDE, 0xF6, 0xDE, 0xF6, 0xEA, 0x01, 0xEA, 0x01,
-        0xF3, 0x0C, 0xF3, 0x0C, 0xE4, 0x17, 0xE4, 0x17, 0xA6, 0x22, 0xA6, 0x22, 0x27, 0x2D, 0x27, 0x2D, 0x52, 0x37,
-        0x52, 0x37, 0x13, 0x41, 0x13, 0x41, 0x57, 0x4A, 0x57, 0x4A, 0x0E, 0x53, 0x0E, 0x53, 0x26, 0x5B, 0x26, 0x5B,
-        0x90, 0x62, 0x90, 0x62, 0x3E, 0x69, 0x3E, 0x69, 0x23, 0x6F, 0x23, 0x6F, 0x33, 0x74, 0x33, 0x74, 0x66, 0x78,
-        0x66, 0x78, 0xB3, 0x7B, 0xB3, 0x7B, 0x14, 0x7E, 0x14, 0x7E, 0x83, 0x7F, 0x83, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F,
-        0x88, 0x7F, 0x88, 0x7F, 0x1C, 0x7E, 0x1C, 0x7E, 0xBF, 0x7B, 0xBF, 0x7B, 0x77, 0x78, 0x77, 0x78, 0x48, 0x74,
-        0x48, 0x74, 0x3B, 0x6F, 0x3B, 0x6F, 0x5A, 0x69, 0x5A, 0x69, 0xAF, 0x62, 0xAF, 0x62, 0x49, 0x5B, 0x49, 0x5B,
-        0x33, 0x53, 0x33, 0x53, 0x80, 0x4A, 0x80, 0x4A, 0x3D, 0x41, 0x3D, 0x41, 0x7E, 0x37, 0x7E, 0x37, 0x55, 0x2D,
-        0x55, 0x2D, 0xD6, 0x22, 0xD6, 0x22, 0x14, 0x18, 0x14, 0x18, 0x24, 0x0D, 0x24, 0x0D, 0x1B, 0x02, 0x1B, 0x02,
-        0x0E, 0xF7, 0x0E, 0xF7, 0x13, 0xEC, 0x13, 0xEC, 0x3D, 0xE1, 0x3D, 0xE1, 0xA2, 0xD6, 0xA2, 0xD6, 0x55, 0xCC,
-        0x55, 0xCC, 0x6C, 0xC2, 0x6C, 0xC2, 0xF8, 0xB8, 0xF8, 0xB8, 0x0C, 0xB0, 0x0C, 0xB0, 0xB8, 0xA7, 0xB8, 0xA7,
-        0x0D, 0xA0, 0x0D, 0xA0, 0x19, 0x99, 0x19, 0x99, 0xEA, 0x92, 0xEA, 0x92, 0x8B, 0x8D, 0x8B, 0x8D, 0x07, 0x89,
-        0x07, 0x89, 0x65, 0x85, 0x65, 0x85, 0xAE, 0x82, 0xAE, 0x82, 0xE6, 0x80, 0xE6, 0x80, 0x11, 0x80, 0x11, 0x80,
-        0x30, 0x80, 0x30, 0x80, 0x44, 0x81, 0x44, 0x81, 0x49, 0x83, 0x49, 0x83, 0x3D, 0x86, 0x3D, 0x86, 0x18, 0x8A,
-        0x18, 0x8A, 0xD6, 0x8E, 0xD6, 0x8E, 0x6B, 0x94, 0x6B, 0x94, 0xCD, 0x9A, 0xCD, 0x9A, 0xF2, 0xA1, 0xF2, 0xA1,
-        0xC9, 0xA9, 0xC9, 0xA9, 0x45, 0xB2, 0x45, 0xB2, 0x55, 0xBB, 0x55, 0xBB, 0xE9, 0xC4, 0xE9, 0xC4, 0xEE, 0xCE,
-        0xEE, 0xCE, 0x50, 0xD9, 0x50, 0xD9, 0xFC, 0xE3, 0xFC, 0xE3, 0xDE, 0xEE, 0xDE, 0xEE, 0xE0, 0xF9, 0xE0, 0xF9,
-        0xEE, 0x04, 0xEE, 0x04, 0xF2, 0x0F, 0xF2, 0x0F, 0xD9, 0x1A, 0xD9, 0x1A, 0x8B, 0x25, 0x8B, 0x25, 0xF6, 0x2F,
-        0xF6, 0x2F, 0x06, 0x3A, 0x06, 0x3A, 0xA7, 0x43, 0xA7, 0x43, 0xC6, 0x4C, 0xC6, 0x4C, 0x54, 0x55, 0x54, 0x55,
-        0x3E, 0x5D, 0x3E, 0x5D, 0x76, 0x64, 0x76, 0x64, 0xEE, 0x6A, 0xEE, 0x6A, 0x9A, 0x70, 0x9A, 0x70, 0x6F, 0x75,
-        0x6F, 0x75, 0x63, 0x79, 0x63, 0x79, 0x71, 0x7C, 0x71, 0x7C, 0x90, 0x7E, 0x90, 0x7E, 0xBE, 0x7F, 0xBE, 0x7F,
-        0xF7, 0x7F, 0xF7, 0x7F, 0x3C, 0x7F, 0x3C, 0x7F, 0x8F, 0x7D, 0x8F, 0x7D, 0xF1, 0x7A, 0xF1, 0x7A, 0x69, 0x77,
-        0x69, 0x77, 0xFD, 0x72, 0xFD, 0x72, 0xB5, 0x6D, 0xB5, 0x6D, 0x9C, 0x67, 0x9C, 0x67, 0xBD, 0x60, 0xBD, 0x60,
-        0x25, 0x59, 0x25, 0x59, 0xE3, 0x50, 0xE3, 0x50, 0x06, 0x48, 0x06, 0x48, 0xA0, 0x3E, 0xA0, 0x3E, 0xC3, 0x34,
-        0xC3, 0x34, 0x80, 0x2A, 0x80, 0x2A, 0xEC, 0x1F, 0xEC, 0x1F, 0x1C, 0x15, 0x1C, 0x15, 0x23, 0x0A, 0x23, 0x0A,
-        0x18, 0xFF, 0x18, 0xFF, 0x0D, 0xF4, 0x0D, 0xF4, 0x19, 0xE9, 0x19, 0xE9, 0x51, 0xDE, 0x51, 0xDE, 0xCA, 0xD3,
-        0xCA, 0xD3, 0x97, 0xC9, 0x97, 0xC9, 0xCB, 0xBF, 0xCB, 0xBF, 0x7B, 0xB6, 0x7B, 0xB6, 0xB6, 0xAD, 0xB6, 0xAD,
-        0x8F, 0xA5, 0x8F, 0xA5, 0x15, 0x9E, 0x15, 0x9E, 0x55, 0x97, 0x55, 0x97, 0x5E, 0x91, 0x5E, 0x91, 0x39, 0x8C,
-        0x39, 0x8C, 0xF2, 0x87, 0xF2, 0x87, 0x90, 0x84, 0x90, 0x84, 0x1A, 0x82, 0x1A, 0x82, 0x94, 0x80, 0x94, 0x80,
-        0x01, 0x80, 0x01, 0x80, 0x64, 0x80, 0x64, 0x80, 0xB9, 0x81, 0xB9, 0x81, 0x00, 0x84, 0x00, 0x84, 0x33, 0x87,
-        0x33, 0x87, 0x4E, 0x8B, 0x4E, 0x8B, 0x46, 0x90, 0x46, 0x90, 0x15, 0x96, 0x15, 0x96, 0xAD, 0x9C, 0xAD, 0x9C,
-        0x04, 0xA4, 0x04, 0xA4, 0x09, 0xAC, 0x09, 0xAC, 0xB0, 0xB4, 0xB0, 0xB4, 0xE7, 0xBD, 0xE7, 0xBD, 0x9A, 0xC7,
-        0x9A, 0xC7, 0xBA, 0xD1, 0xBA, 0xD1, 0x33, 0xDC, 0x33, 0xDC, 0xF0, 0xE6, 0xF0, 0xE6, 0xDC, 0xF1, 0xDC, 0xF1,
-        0xE4, 0xFC, 0xE4, 0xFC, 0xF1, 0x07, 0xF1, 0x07, 0xEF, 0x12, 0xEF, 0x12, 0xC9, 0x1D, 0xC9, 0x1D, 0x6A, 0x28,
-        0x6A, 0x28, 0xBF, 0x32, 0xBF, 0x32, 0xB2, 0x3C, 0xB2, 0x3C, 0x31, 0x46, 0x31, 0x46, 0x2B, 0x4F, 0x2B, 0x4F,
-        0x8D, 0x57, 0x8D, 0x57, 0x48, 0x5F, 0x48, 0x5F, 0x4D, 0x66, 0x4D, 0x66, 0x8E, 0x6C, 0x8E, 0x6C, 0x01, 0x72,
-        0x01, 0x72, 0x9A, 0x76, 0x9A, 0x76, 0x50, 0x7A, 0x50, 0x7A, 0x1C, 0x7D, 0x1C, 0x7D, 0xFA, 0x7E, 0xFA, 0x7E,
-        0xE5, 0x7F, 0xE5, 0x7F, 0xDD, 0x7F, 0xDD, 0x7F, 0xDF, 0x7E, 0xDF, 0x7E, 0xF0, 0x7C, 0xF0, 0x7C, 0x12, 0x7A,
-        0x12, 0x7A, 0x4B, 0x76, 0x4B, 0x76, 0xA1, 0x71, 0xA1, 0x71, 0x20, 0x6C, 0x20, 0x6C, 0xCF, 0x65, 0xCF, 0x65,
-        0xBC, 0x5E, 0xBC, 0x5E, 0xF4, 0x56, 0xF4, 0x56, 0x87, 0x4E, 0x87, 0x4E, 0x83, 0x45, 0x83, 0x45, 0xFA, 0x3B,
-        0xFA, 0x3B, 0xFF, 0x31, 0xFF, 0x31, 0xA5, 0x27, 0xA5, 0x27, 0xFE, 0x1C, 0xFE, 0x1C, 0x21, 0x12, 0x21, 0x12,
-        0x21, 0x07, 0x21, 0x07, 0x14, 0xFC, 0x14, 0xFC, 0x0D, 0xF1, 0x0D, 0xF1, 0x23, 0xE6, 0x23, 0xE6, 0x6B, 0xDB,
-        0x6B, 0xDB, 0xF8, 0xD0, 0xF8, 0xD0, 0xE0, 0xC6, 0xE0, 0xC6, 0x34, 0xBD, 0x34, 0xBD, 0x08, 0xB4, 0x08, 0xB4,
-        0x6D, 0xAB, 0x6D, 0xAB, 0x73, 0xA3, 0x73, 0xA3, 0x2B, 0x9C, 0x2B, 0x9C, 0xA1, 0x95, 0xA1, 0x95, 0xE1, 0x8F,
-        0xE1, 0x8F, 0xF8, 0x8A, 0xF8, 0x8A, 0xEF, 0x86, 0xEF, 0x86, 0xCC, 0x83, 0xCC, 0x83, 0x98, 0x81, 0x98, 0x81,
-        0x54, 0x80, 0x54, 0x80, 0x04, 0x80, 0x04, 0x80, 0xA8, 0x80, 0xA8, 0x80, 0x40, 0x82, 0x40, 0x82, 0xC8, 0x84,
-        0xC8, 0x84, 0x3B, 0x88, 0x3B, 0x88, 0x93, 0x8C, 0x93, 0x8C, 0xC7, 0x91, 0xC7, 0x91, 0xCE, 0x97, 0xCE, 0x97,
-        0x9C, 0x9E, 0x9C, 0x9E, 0x23, 0xA6, 0x23, 0xA6, 0x56, 0xAE, 0x56, 0xAE, 0x25, 0xB7, 0x25, 0xB7, 0x80, 0xC0,
-        0x80, 0xC0, 0x53, 0xCA, 0x53, 0xCA, 0x8E, 0xD4, 0x8E, 0xD4, 0x1B, 0xDF, 0x1B, 0xDF, 0xE6, 0xE9, 0xE6, 0xE9,
-        0xDD, 0xF4, 0xDD, 0xF4, 0xE8, 0xFF, 0xE8, 0xFF, 0xF2, 0x0A, 0xF2, 0x0A, 0xE9, 0x15, 0xE9, 0x15, 0xB6, 0x20,
-        0xB6, 0x20, 0x44, 0x2B, 0x44, 0x2B, 0x80, 0x35, 0x80, 0x35, 0x55, 0x3F, 0x55, 0x3F, 0xB2, 0x48, 0xB2, 0x48,
-        0x84, 0x51, 0x84, 0x51, 0xBA, 0x59, 0xBA, 0x59, 0x45, 0x61, 0x45, 0x61, 0x16, 0x68, 0x16, 0x68, 0x20, 0x6E,
-        0x20, 0x6E, 0x58, 0x73, 0x58, 0x73, 0xB4, 0x77, 0xB4, 0x77, 0x2B, 0x7B, 0x2B, 0x7B, 0xB7, 0x7D, 0xB7, 0x7D,
-        0x52, 0x7F, 0x52, 0x7F, 0xFB, 0x7F, 0xFB, 0x7F, 0xAF, 0x7F, 0xAF, 0x7F, 0x70, 0x7E, 0x70, 0x7E, 0x3F, 0x7C,
-        0x3F, 0x7C, 0x21, 0x79, 0x21, 0x79, 0x1B, 0x75, 0x1B, 0x75, 0x37, 0x70, 0x37, 0x70, 0x7A, 0x6A, 0x7A, 0x6A,
-        0xF4, 0x63, 0xF4, 0x63, 0xAE, 0x5C, 0xAE, 0x5C, 0xB8, 0x54, 0xB8, 0x54, 0x20, 0x4C, 0x20, 0x4C, 0xF6, 0x42,
-        0xF6, 0x42, 0x4C, 0x39, 0x4C, 0x39, 0x35, 0x2F, 0x35, 0x2F, 0xC4, 0x24, 0xC4, 0x24, 0x0D, 0x1A, 0x0D, 0x1A,
-        0x23, 0x0F, 0x23, 0x0F, 0x1E, 0x04, 0x1E, 0x04, 0x10, 0xF9, 0x10, 0xF9, 0x10, 0xEE, 0x10, 0xEE, 0x32, 0xE3,
-        0x32, 0xE3, 0x8A, 0xD8, 0x8A, 0xD8, 0x2E, 0xCE, 0x2E, 0xCE, 0x31, 0xC4, 0x31, 0xC4, 0xA6, 0xBA, 0xA6, 0xBA,
-        0xA0, 0xB1, 0xA0, 0xB1, 0x2F, 0xA9, 0x2F, 0xA9, 0x65, 0xA1, 0x65, 0xA1, 0x4F, 0x9A, 0x4F, 0x9A, 0xFB, 0x93,
-        0xFB, 0x93, 0x75, 0x8E, 0x75, 0x8E, 0xC8, 0x89, 0xC8, 0x89, 0xFD, 0x85, 0xFD, 0x85, 0x1B, 0x83, 0x1B, 0x83,
-        0x27, 0x81, 0x27, 0x81, 0x26, 0x80, 0x26, 0x80, 0x18, 0x80, 0x18, 0x80, 0x00, 0x81, 0x00, 0x81, 0xD9, 0x82,
-        0xD9, 0x82, 0xA2, 0x85, 0xA2, 0x85, 0x54, 0x89, 0x54, 0x89, 0xE9, 0x8D, 0xE9, 0x8D, 0x57, 0x93, 0x57, 0x93,
-        0x96, 0x99, 0x96, 0x99, 0x97, 0xA0, 0x97, 0xA0, 0x4F, 0xA8, 0x4F, 0xA8, 0xAF, 0xB0, 0xAF, 0xB0, 0xA6, 0xB9,
-        0xA6, 0xB9, 0x23, 0xC3, 0x23, 0xC3, 0x14, 0xCD, 0x14, 0xCD, 0x67, 0xD7, 0x67, 0xD7, 0x07, 0xE2, 0x07, 0xE2,
-        0xE0, 0xEC, 0xE0, 0xEC, 0xDE, 0xF7, 0xDE, 0xF7, 0xEB, 0x02, 0xEB, 0x02, 0xF3, 0x0D, 0xF3, 0x0D, 0xE1, 0x18,
-        0xE1, 0x18, 0x9E, 0x23, 0x9E, 0x23, 0x18, 0x2E, 0x18, 0x2E, 0x39, 0x38, 0x39, 0x38, 0xF0, 0x41, 0xF0, 0x41,
-        0x29, 0x4B, 0x29, 0x4B, 0xD1, 0x53, 0xD1, 0x53, 0xDA, 0x5B, 0xDA, 0x5B, 0x33, 0x63, 0x33, 0x63, 0xD0, 0x69,
-        0xD0, 0x69, 0xA1, 0x6F, 0xA1, 0x6F, 0x9F, 0x74, 0x9F, 0x74, 0xBC, 0x78, 0xBC, 0x78, 0xF5, 0x7B, 0xF5, 0x7B,
-        0x3F, 0x7E, 0x3F, 0x7E, 0x99, 0x7F, 0x99, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x71, 0x7F, 0x71, 0x7F, 0xEF, 0x7D,
-        0xEF, 0x7D, 0x7D, 0x7B, 0x7D, 0x7B, 0x1E, 0x78, 0x1E, 0x78, 0xDB, 0x73, 0xDB, 0x73, 0xBB, 0x6E, 0xBB, 0x6E,
-        0xC7, 0x68, 0xC7, 0x68, 0x0B, 0x62, 0x0B, 0x62, 0x93, 0x5A, 0x93, 0x5A, 0x6F, 0x52, 0x6F, 0x52, 0xAE, 0x49,
-        0xAE, 0x49, 0x5F, 0x40, 0x5F, 0x40, 0x96, 0x36, 0x96, 0x36, 0x64, 0x2C, 0x64, 0x2C, 0xDE, 0x21, 0xDE, 0x21,
-        0x17, 0x17, 0x17, 0x17, 0x23, 0x0C, 0x23, 0x0C, 0x1A, 0x01, 0x1A, 0x01, 0x0E, 0xF6, 0x0E, 0xF6, 0x14, 0xEB,
-        0x14, 0xEB, 0x43, 0xE0, 0x43, 0xE0, 0xAE, 0xD5, 0xAE, 0xD5, 0x6A, 0xCB, 0x6A, 0xCB, 0x8B, 0xC1, 0x8B, 0xC1,
-        0x22, 0xB8, 0x22, 0xB8, 0x43, 0xAF, 0x43, 0xAF, 0xFE, 0xA6, 0xFE, 0xA6, 0x63, 0x9F, 0x63, 0x9F, 0x81, 0x98,
-        0x81, 0x98, 0x64, 0x92, 0x64, 0x92, 0x19, 0x8D, 0x19, 0x8D, 0xA9, 0x88, 0xA9, 0x88, 0x1D, 0x85, 0x1D, 0x85,
-        0x7A, 0x82, 0x7A, 0x82, 0xC9, 0x80, 0xC9, 0x80, 0x0A, 0x80, 0x0A, 0x80, 0x40, 0x80, 0x40, 0x80, 0x68, 0x81,
-        0x68, 0x81, 0x84, 0x83, 0x84, 0x83, 0x8D, 0x86, 0x8D, 0x86, 0x7E, 0x8A, 0x7E, 0x8A, 0x4F, 0x8F, 0x4F, 0x8F,
-        0xF7, 0x94, 0xF7, 0x94, 0x6C, 0x9B, 0x6C, 0x9B, 0xA1, 0xA2, 0xA1, 0xA2, 0x88, 0xAA, 0x88, 0xAA, 0x12, 0xB3,
-        0x12, 0xB3, 0x2F, 0xBC, 0x2F, 0xBC, 0xCE, 0xC5, 0xCE, 0xC5, 0xDC, 0xCF, 0xDC, 0xCF, 0x46, 0xDA, 0x46, 0xDA,
-        0xF8, 0xE4, 0xF8, 0xE4, 0xDD, 0xEF, 0xDD, 0xEF, 0xE1, 0xFA, 0xE1, 0xFA, 0xEE, 0x05, 0xEE, 0x05, 0xF2, 0x10,
-        0xF2, 0x10, 0xD4, 0x1B, 0xD4, 0x1B, 0x81, 0x26, 0x81, 0x26, 0xE4, 0x30, 0xE4, 0x30, 0xEB, 0x3A, 0xEB, 0x3A,
-        0x81, 0x44, 0x81, 0x44, 0x94, 0x4D, 0x94, 0x4D, 0x13, 0x56, 0x13, 0x56, 0xED, 0x5D, 0xED, 0x5D, 0x14, 0x65,
-        0x14, 0x65, 0x7B, 0x6B, 0x7B, 0x6B, 0x13, 0x71, 0x13, 0x71, 0xD5, 0x75, 0xD5, 0x75, 0xB4, 0x79, 0xB4, 0x79,
-        0xAC, 0x7C, 0xAC, 0x7C, 0xB5, 0x7E, 0xB5, 0x7E, 0xCD, 0x7F, 0xCD, 0x7F, 0xF1, 0x7F, 0xF1, 0x7F, 0x1F, 0x7F,
-        0x1F, 0x7F, 0x5C, 0x7D, 0x5C, 0x7D, 0xA9, 0x7A, 0xA9, 0x7A, 0x0C, 0x77, 0x0C, 0x77, 0x8B, 0x72, 0x8B, 0x72,
-        0x30, 0x6D, 0x30, 0x6D, 0x04, 0x67, 0x04, 0x67, 0x14, 0x60, 0x14, 0x60, 0x6B, 0x58, 0x6B, 0x58, 0x1B, 0x50,
-        0x1B, 0x50, 0x31, 0x47, 0x31, 0x47, 0xBF, 0x3D, 0xBF, 0x3D, 0xD7, 0x33, 0xD7, 0x33, 0x8D, 0x29, 0x8D, 0x29,
-        0xF3, 0x1E, 0xF3, 0x1E, 0x1E, 0x14, 0x1E, 0x14, 0x22, 0x09, 0x22, 0x09, 0x16, 0xFE, 0x16, 0xFE, 0x0D, 0xF3,
-        0x0D, 0xF3, 0x1D, 0xE8, 0x1D, 0xE8, 0x5A, 0xDD, 0x5A, 0xDD, 0xD8, 0xD2, 0xD8, 0xD2, 0xAE, 0xC8, 0xAE, 0xC8,
-        0xED, 0xBE, 0xED, 0xBE, 0xA9, 0xB5, 0xA9, 0xB5, 0xF1, 0xAC, 0xF1, 0xAC, 0xDA, 0xA4, 0xDA, 0xA4, 0x70, 0x9D,
-        0x70, 0x9D, 0xC2, 0x96, 0xC2, 0x96, 0xDD, 0x90, 0xDD, 0x90, 0xCD, 0x8B, 0xCD, 0x8B, 0x9A, 0x87, 0x9A, 0x87,
-        0x4D, 0x84, 0x4D, 0x84, 0xEC, 0x81, 0xEC, 0x81, 0x7D, 0x80, 0x7D, 0x80, 0x00, 0x80, 0x00, 0x80, 0x78, 0x80,
-        0x78, 0x80, 0xE4, 0x81, 0xE4, 0x81, 0x40, 0x84, 0x40, 0x84, 0x89, 0x87, 0x89, 0x87, 0xB8, 0x8B, 0xB8, 0x8B,
-        0xC5, 0x90, 0xC5, 0x90, 0xA6, 0x96, 0xA6, 0x96, 0x51, 0x9D, 0x51, 0x9D, 0xB7, 0xA4, 0xB7, 0xA4, 0xCD, 0xAC,
-        0xCD, 0xAC, 0x81, 0xB5, 0x81, 0xB5, 0xC3, 0xBE, 0xC3, 0xBE, 0x82, 0xC8, 0x82, 0xC8, 0xAB, 0xD2, 0xAB, 0xD2,
-        0x2B, 0xDD, 0x2B, 0xDD, 0xEC, 0xE7, 0xEC, 0xE7, 0xDD, 0xF2, 0xDD, 0xF2, 0xE5, 0xFD, 0xE5, 0xFD, 0xF1, 0x08,
-        0xF1, 0x08, 0xED, 0x13, 0xED, 0x13, 0xC3, 0x1E, 0xC3, 0x1E, 0x5E, 0x29, 0x5E, 0x29, 0xAB, 0x33, 0xAB, 0x33,
-        0x94, 0x3D, 0x94, 0x3D, 0x08, 0x47, 0x08, 0x47, 0xF4, 0x4F, 0xF4, 0x4F, 0x48, 0x58, 0x48, 0x58, 0xF3, 0x5F,
-        0xF3, 0x5F, 0xE7, 0x66, 0xE7, 0x66, 0x16, 0x6D, 0x16, 0x6D, 0x75, 0x72, 0x75, 0x72, 0xF9, 0x76, 0xF9, 0x76,
-        0x9B, 0x7A, 0x9B, 0x7A, 0x52, 0x7D, 0x52, 0x7D, 0x1A, 0x7F, 0x1A, 0x7F, 0xEF, 0x7F, 0xEF, 0x7F, 0xCF, 0x7F,
-        0xCF, 0x7F, 0xBC, 0x7E, 0xBC, 0x7E, 0xB7, 0x7C, 0xB7, 0x7C, 0xC3, 0x79, 0xC3, 0x79, 0xE7, 0x75, 0xE7, 0x75,
-        0x2A, 0x71, 0x2A, 0x71, 0x95, 0x6B, 0x95, 0x6B, 0x33, 0x65, 0x33, 0x65, 0x0E, 0x5E, 0x0E, 0x5E, 0x37, 0x56,
-        0x37, 0x56, 0xBB, 0x4D, 0xBB, 0x4D, 0xAA, 0x44, 0xAA, 0x44, 0x16, 0x3B, 0x16, 0x3B, 0x12, 0x31, 0x12, 0x31,
-        0xB0, 0x26, 0xB0, 0x26, 0x03, 0x1C, 0x03, 0x1C, 0x22, 0x11, 0x22, 0x11, 0x20, 0x06, 0x20, 0x06, 0x12, 0xFB,
-        0x12, 0xFB, 0x0E, 0xF0, 0x0E, 0xF0, 0x28, 0xE5, 0x28, 0xE5, 0x75, 0xDA, 0x75, 0xDA, 0x0A, 0xD0, 0x0A, 0xD0,
-        0xFA, 0xC5, 0xFA, 0xC5, 0x59, 0xBC, 0x59, 0xBC, 0x3A, 0xB3, 0x3A, 0xB3, 0xAD, 0xAA, 0xAD, 0xAA, 0xC2, 0xA2,
-        0xC2, 0xA2, 0x8A, 0x9B, 0x8A, 0x9B, 0x12, 0x95, 0x12, 0x95, 0x66, 0x8F, 0x66, 0x8F, 0x91, 0x8A, 0x91, 0x8A,
-        0x9D, 0x86, 0x9D, 0x86, 0x8F, 0x83, 0x8F, 0x83, 0x71, 0x81, 0x71, 0x81, 0x42, 0x80, 0x42, 0x80, 0x09, 0x80,
-        0x09, 0x80, 0xC3, 0x80, 0xC3, 0x80, 0x71, 0x82, 0x71, 0x82, 0x0E, 0x85, 0x0E, 0x85, 0x97, 0x88, 0x97, 0x88,
-        0x03, 0x8D, 0x03, 0x8D, 0x4B, 0x92, 0x4B, 0x92, 0x64, 0x98, 0x64, 0x98, 0x43, 0x9F, 0x43, 0x9F, 0xDB, 0xA6,
-        0xDB, 0xA6, 0x1D, 0xAF, 0x1D, 0xAF, 0xFA, 0xB7, 0xFA, 0xB7, 0x60, 0xC1, 0x60, 0xC1, 0x3E, 0xCB, 0x3E, 0xCB,
-        0x80, 0xD5, 0x80, 0xD5, 0x14, 0xE0, 0x14, 0xE0, 0xE4, 0xEA, 0xE4, 0xEA, 0xDD, 0xF5, 0xDD, 0xF5, 0xE9, 0x00,
-        0xE9, 0x00, 0xF3, 0x0B, 0xF3, 0x0B, 0xE7, 0x16, 0xE7, 0x16, 0xAE, 0x21, 0xAE, 0x21, 0x36, 0x2C, 0x36, 0x2C,
-        0x69, 0x36, 0x69, 0x36, 0x35, 0x40, 0x35, 0x40, 0x85, 0x49, 0x85, 0x49, 0x4A, 0x52, 0x4A, 0x52, 0x71, 0x5A,
-        0x71, 0x5A, 0xEB, 0x61, 0xEB, 0x61, 0xAA, 0x68, 0xAA, 0x68, 0xA2, 0x6E, 0xA2, 0x6E, 0xC6, 0x73, 0xC6, 0x73,
-        0x0E, 0x78, 0x0E, 0x78, 0x70, 0x7B, 0x70, 0x7B, 0xE7, 0x7D, 0xE7, 0x7D, 0x6C, 0x7F, 0x6C, 0x7F, 0xFE, 0x7F,
-        0xFE, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x47, 0x7E, 0x47, 0x7E, 0x00, 0x7C, 0x00, 0x7C, 0xCD, 0x78, 0xCD, 0x78,
-        0xB2, 0x74, 0xB2, 0x74, 0xBA, 0x6F, 0xBA, 0x6F, 0xEB, 0x69, 0xEB, 0x69, 0x53, 0x63, 0x53, 0x63, 0xFC, 0x5B,
-        0xFC, 0x5B, 0xF6, 0x53, 0xF6, 0x53, 0x50, 0x4B, 0x50, 0x4B, 0x1A, 0x42, 0x1A, 0x42, 0x66, 0x38, 0x66, 0x38,
-        0x46, 0x2E, 0x46, 0x2E, 0xCD, 0x23, 0xCD, 0x23, 0x10, 0x19, 0x10, 0x19, 0x24, 0x0E, 0x24, 0x0E, 0x1C, 0x03,
-        0x1C, 0x03, 0x10, 0xF8, 0x10, 0xF8, 0x11, 0xED, 0x11, 0xED, 0x37, 0xE2, 0x37, 0xE2, 0x95, 0xD7, 0x95, 0xD7,
-        0x41, 0xCD, 0x41, 0xCD, 0x4E, 0xC3, 0x4E, 0xC3, 0xCE, 0xB9, 0xCE, 0xB9, 0xD5, 0xB0, 0xD5, 0xB0, 0x73, 0xA8,
-        0x73, 0xA8, 0xB8, 0xA0, 0xB8, 0xA0, 0xB3, 0x99, 0xB3, 0x99, 0x71, 0x93, 0x71, 0x93, 0xFF, 0x8D, 0xFF, 0x8D,
-        0x67, 0x89, 0x67, 0x89, 0xB0, 0x85, 0xB0, 0x85, 0xE4, 0x82, 0xE4, 0x82, 0x05, 0x81, 0x05, 0x81, 0x1B, 0x80,
-        0x1B, 0x80, 0x23, 0x80, 0x23, 0x80, 0x21, 0x81, 0x21, 0x81, 0x10, 0x83, 0x10, 0x83, 0xEE, 0x85, 0xEE, 0x85,
-        0xB5, 0x89, 0xB5, 0x89, 0x5E, 0x8E, 0x5E, 0x8E, 0xE0, 0x93, 0xE0, 0x93, 0x31, 0x9A, 0x31, 0x9A, 0x44, 0xA1,
-        0x44, 0xA1, 0x0B, 0xA9, 0x0B, 0xA9, 0x79, 0xB1, 0x79, 0xB1, 0x7D, 0xBA, 0x7D, 0xBA, 0x06, 0xC4, 0x06, 0xC4,
-        0x01, 0xCE, 0x01, 0xCE, 0x5B, 0xD8, 0x5B, 0xD8, 0x01, 0xE3, 0x01, 0xE3, 0xDF, 0xED, 0xDF, 0xED, 0xE0, 0xF8,
-        0xE0, 0xF8, 0xED, 0x03, 0xED, 0x03, 0xF3, 0x0E, 0xF3, 0x0E, 0xDD, 0x19, 0xDD, 0x19, 0x95, 0x24, 0x95, 0x24,
-        0x07, 0x2F, 0x07, 0x2F, 0x20, 0x39, 0x20, 0x39, 0xCC, 0x42, 0xCC, 0x42, 0xF8, 0x4B, 0xF8, 0x4B, 0x93, 0x54,
-        0x93, 0x54, 0x8D, 0x5C, 0x8D, 0x5C, 0xD5, 0x63, 0xD5, 0x63, 0x60, 0x6A, 0x60, 0x6A, 0x1F, 0x70, 0x1F, 0x70,
-        0x08, 0x75, 0x08, 0x75, 0x11, 0x79, 0x11, 0x79, 0x34, 0x7C, 0x34, 0x7C, 0x68, 0x7E, 0x68, 0x7E, 0xAD, 0x7F,
-        0xAD, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0x58, 0x7F, 0x58, 0x7F, 0xC0, 0x7D, 0xC0, 0x7D, 0x38, 0x7B, 0x38, 0x7B,
-        0xC5, 0x77, 0xC5, 0x77, 0x6D, 0x73, 0x6D, 0x73, 0x39, 0x6E, 0x39, 0x6E, 0x32, 0x68, 0x32, 0x68, 0x65, 0x61,
-        0x65, 0x61, 0xDD, 0x59, 0xDD, 0x59, 0xAA, 0x51, 0xAA, 0x51, 0xDB, 0x48, 0xDB, 0x48, 0x80, 0x3F, 0x80, 0x3F,
-        0xAD, 0x35, 0xAD, 0x35, 0x72, 0x2B, 0x72, 0x2B, 0xE5, 0x20, 0xE5, 0x20, 0x19, 0x16, 0x19, 0x16, 0x23, 0x0B,
-        0x23, 0x0B, 0x18, 0x00, 0x18, 0x00, 0x0D, 0xF5, 0x0D, 0xF5, 0x17, 0xEA, 0x17, 0xEA, 0x4A, 0xDF, 0x4A, 0xDF,
-        0xBC, 0xD4, 0xBC, 0xD4, 0x80, 0xCA, 0x80, 0xCA, 0xAA, 0xC0, 0xAA, 0xC0, 0x4E, 0xB7, 0x4E, 0xB7, 0x7C, 0xAE,
-        0x7C, 0xAE, 0x47, 0xA6, 0x47, 0xA6, 0xBC, 0x9E, 0xBC, 0x9E, 0xEB, 0x97, 0xEB, 0x97, 0xE0, 0x91, 0xE0, 0x91,
-        0xA8, 0x8C, 0xA8, 0x8C, 0x4C, 0x88, 0x4C, 0x88, 0xD5, 0x84, 0xD5, 0x84, 0x49, 0x82, 0x49, 0x82, 0xAE, 0x80,
-        0xAE, 0x80, 0x05, 0x80, 0x05, 0x80, 0x51, 0x80, 0x51, 0x80, 0x90, 0x81, 0x90, 0x81, 0xC1, 0x83, 0xC1, 0x83,
-        0xDF, 0x86, 0xDF, 0x86, 0xE5, 0x8A, 0xE5, 0x8A, 0xCA, 0x8F, 0xCA, 0x8F, 0x85, 0x95, 0x85, 0x95, 0x0C, 0x9C,
-        0x0C, 0x9C, 0x52, 0xA3, 0x52, 0xA3, 0x48, 0xAB, 0x48, 0xAB, 0xE1, 0xB3, 0xE1, 0xB3, 0x0A, 0xBD, 0x0A, 0xBD,
-        0xB4, 0xC6, 0xB4, 0xC6, 0xCB, 0xD0, 0xCB, 0xD0, 0x3C, 0xDB, 0x3C, 0xDB, 0xF4, 0xE5, 0xF4, 0xE5, 0xDD, 0xF0,
-        0xDD, 0xF0, 0xE3, 0xFB, 0xE3, 0xFB, 0xEF, 0x06, 0xEF, 0x06, 0xF0, 0x11, 0xF0, 0x11, 0xCF, 0x1C, 0xCF, 0x1C,
-        0x76, 0x27, 0x76, 0x27, 0xD2, 0x31, 0xD2, 0x31, 0xCF, 0x3B, 0xCF, 0x3B, 0x5A, 0x45, 0x5A, 0x45, 0x60, 0x4E,
-        0x60, 0x4E, 0xD1, 0x56, 0xD1, 0x56, 0x9B, 0x5E, 0x9B, 0x5E, 0xB2, 0x65, 0xB2, 0x65, 0x05, 0x6C, 0x05, 0x6C,
-        0x8B, 0x71, 0x8B, 0x71, 0x38, 0x76, 0x38, 0x76, 0x03, 0x7A, 0x03, 0x7A, 0xE5, 0x7C, 0xE5, 0x7C, 0xD9, 0x7E,
-        0xD9, 0x7E, 0xDA, 0x7F, 0xDA, 0x7F, 0xE7, 0x7F, 0xE7, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x27, 0x7D, 0x27, 0x7D,
-        0x5E, 0x7A, 0x5E, 0x7A, 0xAC, 0x76, 0xAC, 0x76, 0x17, 0x72, 0x17, 0x72, 0xA9, 0x6C, 0xA9, 0x6C, 0x6A, 0x66,
-        0x6A, 0x66, 0x69, 0x5F, 0x69, 0x5F, 0xB1, 0x57, 0xB1, 0x57, 0x51, 0x4F, 0x51, 0x4F, 0x5A, 0x46, 0x5A, 0x46,
-        0xDD, 0x3C, 0xDD, 0x3C, 0xEC, 0x32, 0xEC, 0x32, 0x99, 0x28, 0x99, 0x28, 0xF9, 0x1D, 0xF9, 0x1D, 0x20, 0x13,
-        0x20, 0x13, 0x21, 0x08, 0x21, 0x08, 0x15, 0xFD, 0x15, 0xFD, 0x0D, 0xF2, 0x0D, 0xF2, 0x20, 0xE7, 0x20, 0xE7,
-        0x62, 0xDC, 0x62, 0xDC, 0xE8, 0xD1, 0xE8, 0xD1, 0xC7, 0xC7, 0xC7, 0xC7, 0x10, 0xBE, 0x10, 0xBE, 0xD8, 0xB4,
-        0xD8, 0xB4, 0x2F, 0xAC, 0x2F, 0xAC, 0x26, 0xA4, 0x26, 0xA4, 0xCD, 0x9C, 0xCD, 0x9C, 0x30, 0x96, 0x30, 0x96,
-        0x5F, 0x90, 0x5F, 0x90, 0x62, 0x8B, 0x62, 0x8B, 0x44, 0x87, 0x44, 0x87, 0x0C, 0x84, 0x0C, 0x84, 0xC1, 0x81,
-        0xC1, 0x81, 0x67, 0x80, 0x67, 0x80, 0x01, 0x80, 0x01, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x11, 0x82, 0x11, 0x82,
-        0x83, 0x84, 0x83, 0x84, 0xE1, 0x87, 0xE1, 0x87, 0x24, 0x8C, 0x24, 0x8C, 0x46, 0x91, 0x46, 0x91, 0x39, 0x97,
-        0x39, 0x97, 0xF5, 0x9D, 0xF5, 0x9D, 0x6D, 0xA5, 0x6D, 0xA5, 0x91, 0xAD, 0x91, 0xAD, 0x53, 0xB6, 0x53, 0xB6,
-        0xA1, 0xBF, 0xA1, 0xBF, 0x6A, 0xC9, 0x6A, 0xC9, 0x9C, 0xD3, 0x9C, 0xD3, 0x22, 0xDE, 0x22, 0xDE, 0xEA, 0xE8,
-        0xEA, 0xE8, 0xDD, 0xF3, 0xDD, 0xF3, 0xE6, 0xFE, 0xE6, 0xFE, 0xF2, 0x09, 0xF2, 0x09, 0xEB, 0x14, 0xEB, 0x14,
-        0xBD, 0x1F, 0xBD, 0x1F, 0x52, 0x2A, 0x52, 0x2A, 0x96, 0x34, 0x96, 0x34, 0x75, 0x3E, 0x75, 0x3E, 0xDD, 0x47,
-        0xDD, 0x47, 0xBD, 0x50, 0xBD, 0x50, 0x02, 0x59, 0x02, 0x59, 0x9D, 0x60, 0x9D, 0x60, 0x7F, 0x67, 0x7F, 0x67,
-        0x9C, 0x6D, 0x9C, 0x6D, 0xE7, 0x72, 0xE7, 0x72, 0x57, 0x77, 0x57, 0x77, 0xE4, 0x7A, 0xE4, 0x7A, 0x86, 0x7D,
-        0x86, 0x7D, 0x37, 0x7F, 0x37, 0x7F, 0xF6, 0x7F, 0xF6, 0x7F, 0xC0, 0x7F, 0xC0, 0x7F, 0x97, 0x7E, 0x97, 0x7E,
-        0x7C, 0x7C, 0x7C, 0x7C, 0x73, 0x79, 0x73, 0x79, 0x82, 0x75, 0x82, 0x75, 0xB1, 0x70, 0xB1, 0x70, 0x09, 0x6B,
-        0x09, 0x6B, 0x94, 0x64, 0x94, 0x64, 0x5F, 0x5D, 0x5F, 0x5D, 0x78, 0x55, 0x78, 0x55, 0xED, 0x4C, 0xED, 0x4C,
-        0xD1, 0x43, 0xD1, 0x43, 0x32, 0x3A, 0x32, 0x3A, 0x24, 0x30, 0x24, 0x30, 0xBA, 0x25, 0xBA, 0x25, 0x08, 0x1B,
-        0x08, 0x1B, 0x23, 0x10, 0x23, 0x10, 0x1E, 0x05, 0x1E, 0x05, 0x11, 0xFA, 0x11, 0xFA, 0x0F, 0xEF, 0x0F, 0xEF,
-        0x2C, 0xE4, 0x2C, 0xE4, 0x7F, 0xD9, 0x7F, 0xD9, 0x1B, 0xCF, 0x1B, 0xCF, 0x15, 0xC5, 0x15, 0xC5, 0x7F, 0xBB,
-        0x7F, 0xBB, 0x6C, 0xB2, 0x6C, 0xB2, 0xED, 0xA9, 0xED, 0xA9, 0x13, 0xA2, 0x13, 0xA2, 0xEC, 0x9A, 0xEC, 0x9A,
-        0x85, 0x94, 0x85, 0x94, 0xED, 0x8E, 0xED, 0x8E, 0x2C, 0x8A, 0x2C, 0x8A, 0x4C, 0x86, 0x4C, 0x86, 0x54, 0x83,
-        0x54, 0x83, 0x4B, 0x81, 0x4B, 0x81, 0x34, 0x80, 0x34, 0x80, 0x10, 0x80, 0x10, 0x80, 0xE1, 0x80, 0xE1, 0x80,
-        0xA4, 0x82, 0xA4, 0x82, 0x57, 0x85, 0x57, 0x85, 0xF4, 0x88, 0xF4, 0x88, 0x75, 0x8D, 0x75, 0x8D, 0xD0, 0x92,
-        0xD0, 0x92, 0xFC, 0x98, 0xFC, 0x98, 0xED, 0x9F, 0xED, 0x9F, 0x94, 0xA7, 0x94, 0xA7, 0xE5, 0xAF, 0xE5, 0xAF,
-        0xD0, 0xB8, 0xD0, 0xB8, 0x41, 0xC2, 0x41, 0xC2, 0x29, 0xCC, 0x29, 0xCC, 0x73, 0xD6, 0x73, 0xD6, 0x0D, 0xE1,
-        0x0D, 0xE1, 0xE2, 0xEB, 0xE2, 0xEB, 0xDE, 0xF6, 0xDE, 0xF6, 0xEA, 0x01, 0xEA, 0x01, 0xF3, 0x0C, 0xF3, 0x0C,
-        0xE4, 0x17, 0xE4, 0x17, 0xA6, 0x22, 0xA6, 0x22, 0x27, 0x2D, 0x27, 0x2D, 0x52, 0x37, 0x52, 0x37, 0x13, 0x41,
-        0x13, 0x41, 0x57, 0x4A, 0x57, 0x4A, 0x0E, 0x53, 0x0E, 0x53, 0x26, 0x5B, 0x26, 0x5B, 0x90, 0x62, 0x90, 0x62,
-        0x3E, 0x69, 0x3E, 0x69, 0x23, 0x6F, 0x23, 0x6F, 0x33, 0x74, 0x33, 0x74, 0x66, 0x78, 0x66, 0x78, 0xB3, 0x7B,
-        0xB3, 0x7B, 0x14, 0x7E, 0x14, 0x7E, 0x83, 0x7F, 0x83, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x88, 0x7F, 0x88, 0x7F,
-        0x1C, 0x7E, 0x1C, 0x7E, 0xBF, 0x7B, 0xBF, 0x7B, 0x77, 0x78, 0x77, 0x78, 0x48, 0x74, 0x48, 0x74, 0x3B, 0x6F,
-        0x3B, 0x6F, 0x5A, 0x69, 0x5A, 0x69, 0xAF, 0x62, 0xAF, 0x62, 0x49, 0x5B, 0x49, 0x5B, 0x33, 0x53, 0x33, 0x53,
-        0x80, 0x4A, 0x80, 0x4A, 0x3D, 0x41, 0x3D, 0x41, 0x7E, 0x37, 0x7E, 0x37, 0x55, 0x2D, 0x55, 0x2D, 0xD6, 0x22,
-        0xD6, 0x22, 0x14, 0x18, 0x14, 0x18, 0x24, 0x0D, 0x24, 0x0D, 0x1B, 0x02, 0x1B, 0x02, 0x0E, 0xF7, 0x0E, 0xF7,
-        0x13, 0xEC, 0x13, 0xEC, 0x3D, 0xE1, 0x3D, 0xE1, 0xA2, 0xD6, 0xA2, 0xD6, 0x55, 0xCC, 0x55, 0xCC, 0x6C, 0xC2,
-        0x6C, 0xC2, 0xF8, 0xB8, 0xF8, 0xB8, 0x0C, 0xB0, 0x0C, 0xB0, 0xB8, 0xA7, 0xB8, 0xA7, 0x0D, 0xA0, 0x0D, 0xA0,
-        0x19, 0x99, 0x19, 0x99, 0xEA, 0x92, 0xEA, 0x92, 0x8B, 0x8D, 0x8B, 0x8D, 0x07, 0x89, 0x07, 0x89, 0x65, 0x85,
-        0x65, 0x85, 0xAE, 0x82, 0xAE, 0x82, 0xE6, 0x80, 0xE6, 0x80, 0x11, 0x80, 0x11, 0x80, 0x30, 0x80, 0x30, 0x80,
-        0x44, 0x81, 0x44, 0x81, 0x49, 0x83, 0x49, 0x83, 0x3D, 0x86, 0x3D, 0x86, 0x18, 0x8A, 0x18, 0x8A, 0xD6, 0x8E,
-        0xD6, 0x8E, 0x6B, 0x94, 0x6B, 0x94, 0xCD, 0x9A, 0xCD, 0x9A, 0xF2, 0xA1, 0xF2, 0xA1, 0xC9, 0xA9, 0xC9, 0xA9,
-        0x45, 0xB2, 0x45, 0xB2, 0x55, 0xBB, 0x55, 0xBB, 0xE9, 0xC4, 0xE9, 0xC4, 0xEE, 0xCE, 0xEE, 0xCE, 0x50, 0xD9,
-        0x50, 0xD9, 0xFC, 0xE3, 0xFC, 0xE3, 0xDE, 0xEE, 0xDE, 0xEE, 0xE0, 0xF9, 0xE0, 0xF9, 0xEE, 0x04, 0xEE, 0x04,
-        0xF2, 0x0F, 0xF2, 0x0F, 0xD9, 0x1A, 0xD9, 0x1A, 0x8B, 0x25, 0x8B, 0x25, 0xF6, 0x2F, 0xF6, 0x2F, 0x06, 0x3A,
-        0x06, 0x3A, 0xA7, 0x43, 0xA7, 0x43, 0xC6, 0x4C, 0xC6, 0x4C, 0x54, 0x55, 0x54, 0x55, 0x3E, 0x5D, 0x3E, 0x5D,
-        0x76, 0x64, 0x76, 0x64, 0xEE, 0x6A, 0xEE, 0x6A, 0x9A, 0x70, 0x9A, 0x70, 0x6F, 0x75, 0x6F, 0x75, 0x63, 0x79,
-        0x63, 0x79, 0x71, 0x7C, 0x71, 0x7C, 0x90, 0x7E, 0x90, 0x7E, 0xBE, 0x7F, 0xBE, 0x7F, 0xF7, 0x7F, 0xF7, 0x7F,
-        0x3C, 0x7F, 0x3C, 0x7F, 0x8F, 0x7D, 0x8F, 0x7D, 0xF1, 0x7A, 0xF1, 0x7A, 0x69, 0x77, 0x69, 0x77, 0xFD, 0x72,
-        0xFD, 0x72, 0xB5, 0x6D, 0xB5, 0x6D, 0x9C, 0x67, 0x9C, 0x67, 0xBD, 0x60, 0xBD, 0x60, 0x25, 0x59, 0x25, 0x59,
-        0xE3, 0x50, 0xE3, 0x50, 0x06, 0x48, 0x06, 0x48, 0xA0, 0x3E, 0xA0, 0x3E, 0xC3, 0x34, 0xC3, 0x34, 0x80, 0x2A,
-        0x80, 0x2A, 0xEC, 0x1F, 0xEC, 0x1F, 0x1C, 0x15, 0x1C, 0x15, 0x23, 0x0A, 0x23, 0x0A, 0x18, 0xFF, 0x18, 0xFF,
-        0x0D, 0xF4, 0x0D, 0xF4, 0x19, 0xE9, 0x19, 0xE9, 0x51, 0xDE, 0x51, 0xDE, 0xCA, 0xD3, 0xCA, 0xD3, 0x97, 0xC9,
-        0x97, 0xC9, 0xCB, 0xBF, 0xCB, 0xBF, 0x7B, 0xB6, 0x7B, 0xB6, 0xB6, 0xAD, 0xB6, 0xAD, 0x8F, 0xA5, 0x8F, 0xA5,
-        0x15, 0x9E, 0x15, 0x9E, 0x55, 0x97, 0x55, 0x97, 0x5E, 0x91, 0x5E, 0x91, 0x39, 0x8C, 0x39, 0x8C, 0xF2, 0x87,
-        0xF2, 0x87, 0x90, 0x84, 0x90, 0x84, 0x1A, 0x82, 0x1A, 0x82, 0x94, 0x80, 0x94, 0x80, 0x01, 0x80, 0x01, 0x80,
-        0x64, 0x80, 0x64, 0x80, 0xB9, 0x81, 0xB9, 0x81, 0x00, 0x84, 0x00, 0x84, 0x33, 0x87, 0x33, 0x87, 0x4E, 0x8B,
-        0x4E, 0x8B, 0x46, 0x90, 0x46, 0x90, 0x15, 0x96, 0x15, 0x96, 0xAD, 0x9C, 0xAD, 0x9C, 0x04, 0xA4, 0x04, 0xA4,
-        0x09, 0xAC, 0x09, 0xAC, 0xB0, 0xB4, 0xB0, 0xB4, 0xE7, 0xBD, 0xE7, 0xBD, 0x9A, 0xC7, 0x9A, 0xC7, 0xBA, 0xD1,
-        0xBA, 0xD1, 0x33, 0xDC, 0x33, 0xDC, 0xF0, 0xE6, 0xF0, 0xE6, 0xDC, 0xF1, 0xDC, 0xF1, 0xE4, 0xFC, 0xE4, 0xFC,
-        0xF1, 0x07, 0xF1, 0x07, 0xEF, 0x12, 0xEF, 0x12, 0xC9, 0x1D, 0xC9, 0x1D, 0x6A, 0x28, 0x6A, 0x28, 0xBF, 0x32,
-        0xBF, 0x32, 0xB2, 0x3C, 0xB2, 0x3C, 0x31, 0x46, 0x31, 0x46, 0x2B, 0x4F, 0x2B, 0x4F, 0x8D, 0x57, 0x8D, 0x57,
-        0x48, 0x5F, 0x48, 0x5F, 0x4D, 0x66, 0x4D, 0x66, 0x8E, 0x6C, 0x8E, 0x6C, 0x01, 0x72, 0x01, 0x72, 0x9A, 0x76,
-        0x9A, 0x76, 0x50, 0x7A, 0x50, 0x7A, 0x1C, 0x7D, 0x1C, 0x7D, 0xFA, 0x7E, 0xFA, 0x7E, 0xE5, 0x7F, 0xE5, 0x7F,
-        0xDD, 0x7F, 0xDD, 0x7F, 0xDF, 0x7E, 0xDF, 0x7E, 0xF0, 0x7C, 0xF0, 0x7C, 0x12, 0x7A, 0x12, 0x7A, 0x4B, 0x76,
-        0x4B, 0x76, 0xA1, 0x71, 0xA1, 0x71, 0x20, 0x6C, 0x20, 0x6C, 0xCF, 0x65, 0xCF, 0x65, 0xBC, 0x5E, 0xBC, 0x5E,
-        0xF4, 0x56, 0xF4, 0x56, 0x87, 0x4E, 0x87, 0x4E, 0x83, 0x45, 0x83, 0x45, 0xFA, 0x3B, 0xFA, 0x3B, 0xFF, 0x31,
-        0xFF, 0x31, 0xA5, 0x27, 0xA5, 0x27, 0xFE, 0x1C, 0xFE, 0x1C, 0x21, 0x12, 0x21, 0x12, 0x21, 0x07, 0x21, 0x07,
-        0x14, 0xFC, 0x14, 0xFC, 0x0D, 0xF1, 0x0D, 0xF1, 0x23, 0xE6, 0x23, 0xE6, 0x6B, 0xDB, 0x6B, 0xDB, 0xF8, 0xD0,
-        0xF8, 0xD0, 0xE0, 0xC6, 0xE0, 0xC6, 0x34, 0xBD, 0x34, 0xBD, 0x08, 0xB4, 0x08, 0xB4, 0x6D, 0xAB, 0x6D, 0xAB,
-        0x73, 0xA3, 0x73, 0xA3, 0x2B, 0x9C, 0x2B, 0x9C, 0xA1, 0x95, 0xA1, 0x95, 0xE1, 0x8F, 0xE1, 0x8F, 0xF8, 0x8A,
-        0xF8, 0x8A, 0xEF, 0x86, 0xEF, 0x86, 0xCC, 0x83, 0xCC, 0x83, 0x98, 0x81, 0x98, 0x81, 0x54, 0x80, 0x54, 0x80,
-        0x04, 0x80, 0x04, 0x80, 0xA8, 0x80, 0xA8, 0x80, 0x40, 0x82, 0x40, 0x82, 0xC8, 0x84, 0xC8, 0x84, 0x3B, 0x88,
-        0x3B, 0x88, 0x93, 0x8C, 0x93, 0x8C, 0xC7, 0x91, 0xC7, 0x91, 0xCE, 0x97, 0xCE, 0x97, 0x9C, 0x9E, 0x9C, 0x9E,
-        0x23, 0xA6, 0x23, 0xA6, 0x56, 0xAE, 0x56, 0xAE, 0x25, 0xB7, 0x25, 0xB7, 0x80, 0xC0, 0x80, 0xC0, 0x53, 0xCA,
-        0x53, 0xCA, 0x8E, 0xD4, 0x8E, 0xD4, 0x1B, 0xDF, 0x1B, 0xDF, 0xE6, 0xE9, 0xE6, 0xE9, 0xDD, 0xF4, 0xDD, 0xF4,
-        0xE8, 0xFF, 0xE8, 0xFF, 0xF2, 0x0A, 0xF2, 0x0A, 0xE9, 0x15, 0xE9, 0x15, 0xB6, 0x20, 0xB6, 0x20, 0x44, 0x2B,
-        0x44, 0x2B, 0x80, 0x35, 0x80, 0x35, 0x55, 0x3F, 0x55, 0x3F, 0xB2, 0x48, 0xB2, 0x48, 0x84, 0x51, 0x84, 0x51,
-        0xBA, 0x59, 0xBA, 0x59, 0x45, 0x61, 0x45, 0x61, 0x16, 0x68, 0x16, 0x68, 0x20, 0x6E, 0x20, 0x6E, 0x58, 0x73,
-        0x58, 0x73, 0xB4, 0x77, 0xB4, 0x77, 0x2B, 0x7B, 0x2B, 0x7B, 0xB7, 0x7D, 0xB7, 0x7D, 0x52, 0x7F, 0x52, 0x7F,
-        0xFB, 0x7F, 0xFB, 0x7F, 0xAF, 0x7F, 0xAF, 0x7F, 0x70, 0x7E, 0x70, 0x7E, 0x3F, 0x7C, 0x3F, 0x7C, 0x21, 0x79,
-        0x21, 0x79, 0x1B, 0x75, 0x1B, 0x75, 0x37, 0x70, 0x37, 0x70, 0x7A, 0x6A, 0x7A, 0x6A, 0xF4, 0x63, 0xF4, 0x63,
-        0xAE, 0x5C, 0xAE, 0x5C, 0xB8, 0x54, 0xB8, 0x54, 0x20, 0x4C, 0x20, 0x4C, 0xF6, 0x42, 0xF6, 0x42, 0x4C, 0x39,
-        0x4C, 0x39, 0x35, 0x2F, 0x35, 0x2F, 0xC4, 0x24, 0xC4, 0x24, 0x0D, 0x1A, 0x0D, 0x1A, 0x23, 0x0F, 0x23, 0x0F,
-        0x1E, 0x04, 0x1E, 0x04, 0x10, 0xF9, 0x10, 0xF9, 0x10, 0xEE, 0x10, 0xEE, 0x32, 0xE3, 0x32, 0xE3, 0x8A, 0xD8,
-        0x8A, 0xD8, 0x2E, 0xCE, 0x2E, 0xCE, 0x31, 0xC4, 0x31, 0xC4, 0xA6, 0xBA, 0xA6, 0xBA, 0xA0, 0xB1, 0xA0, 0xB1,
-        0x2F, 0xA9, 0x2F, 0xA9, 0x65, 0xA1, 0x65, 0xA1, 0x4F, 0x9A, 0x4F, 0x9A, 0xFB, 0x93, 0xFB, 0x93, 0x75, 0x8E,
-        0x75, 0x8E, 0xC8, 0x89, 0xC8, 0x89, 0xFD, 0x85, 0xFD, 0x85, 0x1B, 0x83, 0x1B, 0x83, 0x27, 0x81, 0x27, 0x81,
-        0x26, 0x80, 0x26, 0x80, 0x18, 0x80, 0x18, 0x80, 0x00, 0x81, 0x00, 0x81, 0xD9, 0x82, 0xD9, 0x82, 0xA2, 0x85,
-        0xA2, 0x85, 0x54, 0x89, 0x54, 0x89, 0xE9, 0x8D, 0xE9, 0x8D, 0x57, 0x93, 0x57, 0x93, 0x96, 0x99, 0x96, 0x99,
-        0x97, 0xA0, 0x97, 0xA0, 0x4F, 0xA8, 0x4F, 0xA8, 0xAF, 0xB0, 0xAF, 0xB0, 0xA6, 0xB9, 0xA6, 0xB9, 0x23, 0xC3,
-        0x23, 0xC3, 0x14, 0xCD, 0x14, 0xCD, 0x67, 0xD7, 0x67, 0xD7, 0x07, 0xE2, 0x07, 0xE2, 0xE0, 0xEC, 0xE0, 0xEC,
-        0xDE, 0xF7, 0xDE, 0xF7, 0xEB, 0x02, 0xEB, 0x02, 0xF3, 0x0D, 0xF3, 0x0D, 0xE1, 0x18, 0xE1, 0x18, 0x9E, 0x23,
-        0x9E, 0x23, 0x18, 0x2E, 0x18, 0x2E, 0x39, 0x38, 0x39, 0x38, 0xF0, 0x41, 0xF0, 0x41, 0x29, 0x4B, 0x29, 0x4B,
-        0xD1, 0x53, 0xD1, 0x53, 0xDA, 0x5B, 0xDA, 0x5B, 0x33, 0x63, 0x33, 0x63, 0xD0, 0x69, 0xD0, 0x69, 0xA1, 0x6F,
-        0xA1, 0x6F, 0x9F, 0x74, 0x9F, 0x74, 0xBC, 0x78, 0xBC, 0x78, 0xF5, 0x7B, 0xF5, 0x7B, 0x3F, 0x7E, 0x3F, 0x7E,
-        0x99, 0x7F, 0x99, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x71, 0x7F, 0x71, 0x7F, 0xEF, 0x7D, 0xEF, 0x7D, 0x7D, 0x7B,
-        0x7D, 0x7B, 0x1E, 0x78, 0x1E, 0x78, 0xDB, 0x73, 0xDB, 0x73, 0xBB, 0x6E, 0xBB, 0x6E, 0xC7, 0x68, 0xC7, 0x68,
-        0x0B, 0x62, 0x0B, 0x62, 0x93, 0x5A, 0x93, 0x5A, 0x6F, 0x52, 0x6F, 0x52, 0xAE, 0x49, 0xAE, 0x49, 0x5F, 0x40,
-        0x5F, 0x40, 0x96, 0x36, 0x96, 0x36, 0x64, 0x2C, 0x64, 0x2C, 0xDE, 0x21, 0xDE, 0x21, 0x17, 0x17, 0x17, 0x17,
-        0x23, 0x0C, 0x23, 0x0C, 0x1A, 0x01, 0x1A, 0x01, 0x0E, 0xF6, 0x0E, 0xF6, 0x14, 0xEB, 0x14, 0xEB, 0x43, 0xE0,
-        0x43, 0xE0, 0xAE, 0xD5, 0xAE, 0xD5, 0x6A, 0xCB, 0x6A, 0xCB, 0x8B, 0xC1, 0x8B, 0xC1, 0x22, 0xB8, 0x22, 0xB8,
-        0x43, 0xAF, 0x43, 0xAF, 0xFE, 0xA6, 0xFE, 0xA6, 0x63, 0x9F, 0x63, 0x9F, 0x81, 0x98, 0x81, 0x98, 0x64, 0x92,
-        0x64, 0x92, 0x19, 0x8D, 0x19, 0x8D, 0xA9, 0x88, 0xA9, 0x88, 0x1D, 0x85, 0x1D, 0x85, 0x7A, 0x82, 0x7A, 0x82,
-        0xC9, 0x80, 0xC9, 0x80, 0x0A, 0x80, 0x0A, 0x80, 0x40, 0x80, 0x40, 0x80, 0x68, 0x81, 0x68, 0x81, 0x84, 0x83,
-        0x84, 0x83, 0x8D, 0x86, 0x8D, 0x86, 0x7E, 0x8A, 0x7E, 0x8A, 0x4F, 0x8F, 0x4F, 0x8F, 0xF7, 0x94, 0xF7, 0x94,
-        0x6C, 0x9B, 0x6C, 0x9B, 0xA1, 0xA2, 0xA1, 0xA2, 0x88, 0xAA, 0x88, 0xAA, 0x12, 0xB3, 0x12, 0xB3, 0x2F, 0xBC,
-        0x2F, 0xBC, 0xCE, 0xC5, 0xCE, 0xC5, 0xDC, 0xCF, 0xDC, 0xCF, 0x46, 0xDA, 0x46, 0xDA, 0xF8, 0xE4, 0xF8, 0xE4,
-        0xDD, 0xEF, 0xDD, 0xEF, 0xE1, 0xFA, 0xE1, 0xFA, 0xEE, 0x05, 0xEE, 0x05, 0xF2, 0x10, 0xF2, 0x10, 0xD4, 0x1B,
-        0xD4, 0x1B, 0x81, 0x26, 0x81, 0x26, 0xE4, 0x30, 0xE4, 0x30, 0xEB, 0x3A, 0xEB, 0x3A, 0x81, 0x44, 0x81, 0x44,
-        0x94, 0x4D, 0x94, 0x4D, 0x13, 0x56, 0x13, 0x56, 0xED, 0x5D, 0xED, 0x5D, 0x14, 0x65, 0x14, 0x65, 0x7B, 0x6B,
-        0x7B, 0x6B, 0x13, 0x71, 0x13, 0x71, 0xD5, 0x75, 0xD5, 0x75, 0xB4, 0x79, 0xB4, 0x79, 0xAC, 0x7C, 0xAC, 0x7C,
-        0xB5, 0x7E, 0xB5, 0x7E, 0xCD, 0x7F, 0xCD, 0x7F, 0xF1, 0x7F, 0xF1, 0x7F, 0x1F, 0x7F, 0x1F, 0x7F, 0x5C, 0x7D,
-        0x5C, 0x7D, 0xA9, 0x7A, 0xA9, 0x7A, 0x0C, 0x77, 0x0C, 0x77, 0x8B, 0x72, 0x8B, 0x72, 0x30, 0x6D, 0x30, 0x6D,
-        0x04, 0x67, 0x04, 0x67, 0x14, 0x60, 0x14, 0x60, 0x6B, 0x58, 0x6B, 0x58, 0x1B, 0x50, 0x1B, 0x50, 0x31, 0x47,
-        0x31, 0x47, 0xBF, 0x3D, 0xBF, 0x3D, 0xD7, 0x33, 0xD7, 0x33, 0x8D, 0x29, 0x8D, 0x29, 0xF3, 0x1E, 0xF3, 0x1E,
-        0x1E, 0x14, 0x1E, 0x14, 0x22, 0x09, 0x22, 0x09, 0x16, 0xFE, 0x16, 0xFE, 0x0D, 0xF3, 0x0D, 0xF3, 0x1D, 0xE8,
-        0x1D, 0xE8, 0x5A, 0xDD, 0x5A, 0xDD, 0xD8, 0xD2, 0xD8, 0xD2, 0xAE, 0xC8, 0xAE, 0xC8, 0xED, 0xBE, 0xED, 0xBE,
-        0xA9, 0xB5, 0xA9, 0xB5, 0xF1, 0xAC, 0xF1, 0xAC, 0xDA, 0xA4, 0xDA, 0xA4, 0x70, 0x9D, 0x70, 0x9D, 0xC2, 0x96,
-        0xC2, 0x96, 0xDD, 0x90, 0xDD, 0x90, 0xCD, 0x8B, 0xCD, 0x8B, 0x9A, 0x87, 0x9A, 0x87, 0x4D, 0x84, 0x4D, 0x84,
-        0xEC, 0x81, 0xEC, 0x81, 0x7D, 0x80, 0x7D, 0x80, 0x00, 0x80, 0x00, 0x80, 0x78, 0x80, 0x78, 0x80, 0xE4, 0x81,
-        0xE4, 0x81, 0x40, 0x84, 0x40, 0x84, 0x89, 0x87, 0x89, 0x87, 0xB8, 0x8B, 0xB8, 0x8B, 0xC5, 0x90, 0xC5, 0x90,
-        0xA6, 0x96, 0xA6, 0x96, 0x51, 0x9D, 0x51, 0x9D, 0xB7, 0xA4, 0xB7, 0xA4, 0xCD, 0xAC, 0xCD, 0xAC, 0x81, 0xB5,
-        0x81, 0xB5, 0xC3, 0xBE, 0xC3, 0xBE, 0x82, 0xC8, 0x82, 0xC8, 0xAB, 0xD2, 0xAB, 0xD2, 0x2B, 0xDD, 0x2B, 0xDD,
-        0xEC, 0xE7, 0xEC, 0xE7, 0xDD, 0xF2, 0xDD, 0xF2, 0xE5, 0xFD, 0xE5, 0xFD, 0xF1, 0x08, 0xF1, 0x08, 0xED, 0x13,
-        0xED, 0x13, 0xC3, 0x1E, 0xC3, 0x1E, 0x5E, 0x29, 0x5E, 0x29, 0xAB, 0x33, 0xAB, 0x33, 0x94, 0x3D, 0x94, 0x3D,
-        0x08, 0x47, 0x08, 0x47, 0xF4, 0x4F, 0xF4, 0x4F, 0x48, 0x58, 0x48, 0x58, 0xF3, 0x5F, 0xF3, 0x5F, 0xE7, 0x66,
-        0xE7, 0x66, 0x16, 0x6D, 0x16, 0x6D, 0x75, 0x72, 0x75, 0x72, 0xF9, 0x76, 0xF9, 0x76, 0x9B, 0x7A, 0x9B, 0x7A,
-        0x52, 0x7D, 0x52, 0x7D, 0x1A, 0x7F, 0x1A, 0x7F, 0xEF, 0x7F, 0xEF, 0x7F, 0xCF, 0x7F, 0xCF, 0x7F, 0xBC, 0x7E,
-        0xBC, 0x7E, 0xB7, 0x7C, 0xB7, 0x7C, 0xC3, 0x79, 0xC3, 0x79, 0xE7, 0x75, 0xE7, 0x75, 0x2A, 0x71, 0x2A, 0x71,
-        0x95, 0x6B, 0x95, 0x6B, 0x33, 0x65, 0x33, 0x65, 0x0E, 0x5E, 0x0E, 0x5E, 0x37, 0x56, 0x37, 0x56, 0xBB, 0x4D,
-        0xBB, 0x4D, 0xAA, 0x44, 0xAA, 0x44, 0x16, 0x3B, 0x16, 0x3B, 0x12, 0x31, 0x12, 0x31, 0xB0, 0x26, 0xB0, 0x26,
-        0x03, 0x1C, 0x03, 0x1C, 0x22, 0x11, 0x22, 0x11, 0x20, 0x06, 0x20, 0x06, 0x12, 0xFB, 0x12, 0xFB, 0x0E, 0xF0,
-        0x0E, 0xF0, 0x28, 0xE5, 0x28, 0xE5, 0x75, 0xDA, 0x75, 0xDA, 0x0A, 0xD0, 0x0A, 0xD0, 0xFA, 0xC5, 0xFA, 0xC5,
-        0x59, 0xBC, 0x59, 0xBC, 0x3A, 0xB3, 0x3A, 0xB3, 0xAD, 0xAA, 0xAD, 0xAA, 0xC2, 0xA2, 0xC2, 0xA2, 0x8A, 0x9B,
-        0x8A, 0x9B, 0x12, 0x95, 0x12, 0x95, 0x66, 0x8F, 0x66, 0x8F, 0x91, 0x8A, 0x91, 0x8A, 0x9D, 0x86, 0x9D, 0x86,
-        0x8F, 0x83, 0x8F, 0x83, 0x71, 0x81, 0x71, 0x81, 0x42, 0x80, 0x42, 0x80, 0x09, 0x80, 0x09, 0x80, 0xC3, 0x80,
-        0xC3, 0x80, 0x71, 0x82, 0x71, 0x82, 0x0E, 0x85, 0x0E, 0x85, 0x97, 0x88, 0x97, 0x88, 0x03, 0x8D, 0x03, 0x8D,
-        0x4B, 0x92, 0x4B, 0x92, 0x64, 0x98, 0x64, 0x98, 0x43, 0x9F, 0x43, 0x9F, 0xDB, 0xA6, 0xDB, 0xA6, 0x1D, 0xAF,
-        0x1D, 0xAF, 0xFA, 0xB7, 0xFA, 0xB7, 0x60, 0xC1, 0x60, 0xC1, 0x3E, 0xCB, 0x3E, 0xCB, 0x80, 0xD5, 0x80, 0xD5,
-        0x14, 0xE0, 0x14, 0xE0, 0xE4, 0xEA, 0xE4, 0xEA, 0xDD, 0xF5, 0xDD, 0xF5, 0xE9, 0x00, 0xE9, 0x00, 0xF3, 0x0B,
-        0xF3, 0x0B, 0xE7, 0x16, 0xE7, 0x16, 0xAE, 0x21, 0xAE, 0x21, 0x36, 0x2C, 0x36, 0x2C, 0x69, 0x36, 0x69, 0x36,
-        0x35, 0x40, 0x35, 0x40, 0x85, 0x49, 0x85, 0x49, 0x4A, 0x52, 0x4A, 0x52, 0x71, 0x5A, 0x71, 0x5A, 0xEB, 0x61,
-        0xEB, 0x61, 0xAA, 0x68, 0xAA, 0x68, 0xA2, 0x6E, 0xA2, 0x6E, 0xC6, 0x73, 0xC6, 0x73, 0x0E, 0x78, 0x0E, 0x78,
-        0x70, 0x7B, 0x70, 0x7B, 0xE7, 0x7D, 0xE7, 0x7D, 0x6C, 0x7F, 0x6C, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0x9C, 0x7F,
-        0x9C, 0x7F, 0x47, 0x7E, 0x47, 0x7E, 0x00, 0x7C, 0x00, 0x7C, 0xCD, 0x78, 0xCD, 0x78, 0xB2, 0x74, 0xB2, 0x74,
-        0xBA, 0x6F, 0xBA, 0x6F, 0xEB, 0x69, 0xEB, 0x69, 0x53, 0x63, 0x53, 0x63, 0xFC, 0x5B, 0xFC, 0x5B, 0xF6, 0x53,
-        0xF6, 0x53, 0x50, 0x4B, 0x50, 0x4B, 0x1A, 0x42, 0x1A, 0x42, 0x66, 0x38, 0x66, 0x38, 0x46, 0x2E, 0x46, 0x2E,
-        0xCD, 0x23, 0xCD, 0x23, 0x10, 0x19, 0x10, 0x19, 0x24, 0x0E, 0x24, 0x0E, 0x1C, 0x03, 0x1C, 0x03, 0x10, 0xF8,
-        0x10, 0xF8, 0x11, 0xED, 0x11, 0xED, 0x37, 0xE2, 0x37, 0xE2, 0x95, 0xD7, 0x95, 0xD7, 0x41, 0xCD, 0x41, 0xCD,
-        0x4E, 0xC3, 0x4E, 0xC3, 0xCE, 0xB9, 0xCE, 0xB9, 0xD5, 0xB0, 0xD5, 0xB0, 0x73, 0xA8, 0x73, 0xA8, 0xB8, 0xA0,
-        0xB8, 0xA0, 0xB3, 0x99, 0xB3, 0x99, 0x71, 0x93, 0x71, 0x93, 0xFF, 0x8D, 0xFF, 0x8D, 0x67, 0x89, 0x67, 0x89,
-        0xB0, 0x85, 0xB0, 0x85, 0xE4, 0x82, 0xE4, 0x82, 0x05, 0x81, 0x05, 0x81, 0x1B, 0x80, 0x1B, 0x80, 0x23, 0x80,
-        0x23, 0x80, 0x21, 0x81, 0x21, 0x81, 0x10, 0x83, 0x10, 0x83, 0xEE, 0x85, 0xEE, 0x85, 0xB5, 0x89, 0xB5, 0x89,
-        0x5E, 0x8E, 0x5E, 0x8E, 0xE0, 0x93, 0xE0, 0x93, 0x31, 0x9A, 0x31, 0x9A, 0x44, 0xA1, 0x44, 0xA1, 0x0B, 0xA9,
-        0x0B, 0xA9, 0x79, 0xB1, 0x79, 0xB1, 0x7D, 0xBA, 0x7D, 0xBA, 0x06, 0xC4, 0x06, 0xC4, 0x01, 0xCE, 0x01, 0xCE,
-        0x5B, 0xD8, 0x5B, 0xD8, 0x01, 0xE3, 0x01, 0xE3, 0xDF, 0xED, 0xDF, 0xED, 0xE0, 0xF8, 0xE0, 0xF8, 0xED, 0x03,
-        0xED, 0x03, 0xF3, 0x0E, 0xF3, 0x0E, 0xDD, 0x19, 0xDD, 0x19, 0x95, 0x24, 0x95, 0x24, 0x07, 0x2F, 0x07, 0x2F,
-        0x20, 0x39, 0x20, 0x39, 0xCC, 0x42, 0xCC, 0x42, 0xF8, 0x4B, 0xF8, 0x4B, 0x93, 0x54, 0x93, 0x54, 0x8D, 0x5C,
-        0x8D, 0x5C, 0xD5, 0x63, 0xD5, 0x63, 0x60, 0x6A, 0x60, 0x6A, 0x1F, 0x70, 0x1F, 0x70, 0x08, 0x75, 0x08, 0x75,
-        0x11, 0x79, 0x11, 0x79, 0x34, 0x7C, 0x34, 0x7C, 0x68, 0x7E, 0x68, 0x7E, 0xAD, 0x7F, 0xAD, 0x7F, 0xFC, 0x7F,
-        0xFC, 0x7F, 0x58, 0x7F, 0x58, 0x7F, 0xC0, 0x7D, 0xC0, 0x7D, 0x38, 0x7B, 0x38, 0x7B, 0xC5, 0x77, 0xC5, 0x77,
-        0x6D, 0x73, 0x6D, 0x73, 0x39, 0x6E, 0x39, 0x6E, 0x32, 0x68, 0x32, 0x68, 0x65, 0x61, 0x65, 0x61, 0xDD, 0x59,
-        0xDD, 0x59, 0xAA, 0x51, 0xAA, 0x51, 0xDB, 0x48, 0xDB, 0x48, 0x80, 0x3F, 0x80, 0x3F, 0xAD, 0x35, 0xAD, 0x35,
-        0x72, 0x2B, 0x72, 0x2B, 0xE5, 0x20, 0xE5, 0x20, 0x19, 0x16, 0x19, 0x16, 0x23, 0x0B, 0x23, 0x0B, 0x18, 0x00,
-        0x18, 0x00, 0x0D, 0xF5, 0x0D, 0xF5, 0x17, 0xEA, 0x17, 0xEA, 0x4A, 0xDF, 0x4A, 0xDF, 0xBC, 0xD4, 0xBC, 0xD4,
-        0x80, 0xCA, 0x80, 0xCA, 0xAA, 0xC0, 0xAA, 0xC0, 0x4E, 0xB7, 0x4E, 0xB7, 0x7C, 0xAE, 0x7C, 0xAE, 0x47, 0xA6,
-        0x47, 0xA6, 0xBC, 0x9E, 0xBC, 0x9E, 0xEB, 0x97, 0xEB, 0x97, 0xE0, 0x91, 0xE0, 0x91, 0xA8, 0x8C, 0xA8, 0x8C,
-        0x4C, 0x88, 0x4C, 0x88, 0xD5, 0x84, 0xD5, 0x84, 0x49, 0x82, 0x49, 0x82, 0xAE, 0x80, 0xAE, 0x80, 0x05, 0x80,
-        0x05, 0x80, 0x51, 0x80, 0x51, 0x80, 0x90, 0x81, 0x90, 0x81, 0xC1, 0x83, 0xC1, 0x83, 0xDF, 0x86, 0xDF, 0x86,
-        0xE5, 0x8A, 0xE5, 0x8A, 0xCA, 0x8F, 0xCA, 0x8F, 0x85, 0x95, 0x85, 0x95, 0x0C, 0x9C, 0x0C, 0x9C, 0x52, 0xA3,
-        0x52, 0xA3, 0x48, 0xAB, 0x48, 0xAB, 0xE1, 0xB3, 0xE1, 0xB3, 0x0A, 0xBD, 0x0A, 0xBD, 0xB4, 0xC6, 0xB4, 0xC6,
-        0xCB, 0xD0, 0xCB, 0xD0, 0x3C, 0xDB, 0x3C, 0xDB, 0xF4, 0xE5, 0xF4, 0xE5, 0xDD, 0xF0, 0xDD, 0xF0, 0xE3, 0xFB,
-        0xE3, 0xFB, 0xEF, 0x06, 0xEF, 0x06, 0xF0, 0x11, 0xF0, 0x11, 0xCF, 0x1C, 0xCF, 0x1C, 0x76, 0x27, 0x76, 0x27,
-        0xD2, 0x31, 0xD2, 0x31, 0xCF, 0x3B, 0xCF, 0x3B, 0x5A, 0x45, 0x5A, 0x45, 0x60, 0x4E, 0x60, 0x4E, 0xD1, 0x56,
-        0xD1, 0x56, 0x9B, 0x5E, 0x9B, 0x5E, 0xB2, 0x65, 0xB2, 0x65, 0x05, 0x6C, 0x05, 0x6C, 0x8B, 0x71, 0x8B, 0x71,
-        0x38, 0x76, 0x38, 0x76, 0x03, 0x7A, 0x03, 0x7A, 0xE5, 0x7C, 0xE5, 0x7C, 0xD9, 0x7E, 0xD9, 0x7E, 0xDA, 0x7F,
-        0xDA, 0x7F, 0xE7, 0x7F, 0xE7, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x27, 0x7D, 0x27, 0x7D, 0x5E, 0x7A, 0x5E, 0x7A,
-        0xAC, 0x76, 0xAC, 0x76, 0x17, 0x72, 0x17, 0x72, 0xA9, 0x6C, 0xA9, 0x6C, 0x6A, 0x66, 0x6A, 0x66, 0x69, 0x5F,
-        0x69, 0x5F, 0xB1, 0x57, 0xB1, 0x57, 0x51, 0x4F, 0x51, 0x4F, 0x5A, 0x46, 0x5A, 0x46, 0xDD, 0x3C, 0xDD, 0x3C,
-        0xEC, 0x32, 0xEC, 0x32, 0x99, 0x28, 0x99, 0x28, 0xF9, 0x1D, 0xF9, 0x1D, 0x20, 0x13, 0x20, 0x13, 0x21, 0x08,
-        0x21, 0x08, 0x15, 0xFD, 0x15, 0xFD, 0x0D, 0xF2, 0x0D, 0xF2, 0x20, 0xE7, 0x20, 0xE7, 0x62, 0xDC, 0x62, 0xDC,
-        0xE8, 0xD1, 0xE8, 0xD1, 0xC7, 0xC7, 0xC7, 0xC7, 0x10, 0xBE, 0x10, 0xBE, 0xD8, 0xB4, 0xD8, 0xB4, 0x2F, 0xAC,
-        0x2F, 0xAC, 0x26, 0xA4, 0x26, 0xA4, 0xCD, 0x9C, 0xCD, 0x9C, 0x30, 0x96, 0x30, 0x96, 0x5F, 0x90, 0x5F, 0x90,
-        0x62, 0x8B, 0x62, 0x8B, 0x44, 0x87, 0x44, 0x87, 0x0C, 0x84, 0x0C, 0x84, 0xC1, 0x81, 0xC1, 0x81, 0x67, 0x80,
-        0x67, 0x80, 0x01, 0x80, 0x01, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x11, 0x82, 0x11, 0x82, 0x83, 0x84, 0x83, 0x84,
-        0xE1, 0x87, 0xE1, 0x87, 0x24, 0x8C, 0x24, 0x8C, 0x46, 0x91, 0x46, 0x91, 0x39, 0x97, 0x39, 0x97, 0xF5, 0x9D,
-        0xF5, 0x9D, 0x6D, 0xA5, 0x6D, 0xA5, 0x91, 0xAD, 0x91, 0xAD, 0x53, 0xB6, 0x53, 0xB6, 0xA1, 0xBF, 0xA1, 0xBF,
-        0x6A, 0xC9, 0x6A, 0xC9, 0x9C, 0xD3, 0x9C, 0xD3, 0x22, 0xDE, 0x22, 0xDE, 0xEA, 0xE8, 0xEA, 0xE8, 0xDD, 0xF3,
-        0xDD, 0xF3, 0xE6, 0xFE, 0xE6, 0xFE, 0xF2, 0x09, 0xF2, 0x09, 0xEB, 0x14, 0xEB, 0x14, 0xBD, 0x1F, 0xBD, 0x1F,
-        0x52, 0x2A, 0x52, 0x2A, 0x96, 0x34, 0x96, 0x34, 0x75, 0x3E, 0x75, 0x3E, 0xDD, 0x47, 0xDD, 0x47, 0xBD, 0x50,
-        0xBD, 0x50, 0x02, 0x59, 0x02, 0x59, 0x9D, 0x60, 0x9D, 0x60, 0x7F, 0x67, 0x7F, 0x67, 0x9C, 0x6D, 0x9C, 0x6D,
-        0xE7, 0x72, 0xE7, 0x72, 0x57, 0x77, 0x57, 0x77, 0xE4, 0x7A, 0xE4, 0x7A, 0x86, 0x7D, 0x86, 0x7D, 0x37, 0x7F,
-        0x37, 0x7F, 0xF6, 0x7F, 0xF6, 0x7F, 0xC0, 0x7F, 0xC0, 0x7F, 0x97, 0x7E, 0x97, 0x7E, 0x7C, 0x7C, 0x7C, 0x7C,
-        0x73, 0x79, 0x73, 0x79, 0x82, 0x75, 0x82, 0x75, 0xB1, 0x70, 0xB1, 0x70, 0x09, 0x6B, 0x09, 0x6B, 0x94, 0x64,
-        0x94, 0x64, 0x5F, 0x5D, 0x5F, 0x5D, 0x78, 0x55, 0x78, 0x55, 0xED, 0x4C, 0xED, 0x4C, 0xD1, 0x43, 0xD1, 0x43,
-        0x32, 0x3A, 0x32, 0x3A, 0x24, 0x30, 0x24, 0x30, 0xBA, 0x25, 0xBA, 0x25, 0x08, 0x1B, 0x08, 0x1B, 0x23, 0x10,
-        0x23, 0x10, 0x1E, 0x05, 0x1E, 0x05, 0x11, 0xFA, 0x11, 0xFA, 0x0F, 0xEF, 0x0F, 0xEF, 0x2C, 0xE4, 0x2C, 0xE4,
-        0x7F, 0xD9, 0x7F, 0xD9, 0x1B, 0xCF, 0x1B, 0xCF, 0x15, 0xC5, 0x15, 0xC5, 0x7F, 0xBB, 0x7F, 0xBB, 0x6C, 0xB2,
-        0x6C, 0xB2, 0xED, 0xA9, 0xED, 0xA9, 0x13, 0xA2, 0x13, 0xA2, 0xEC, 0x9A, 0xEC, 0x9A, 0x85, 0x94, 0x85, 0x94,
-        0xED, 0x8E, 0xED, 0x8E, 0x2C, 0x8A, 0x2C, 0x8A, 0x4C, 0x86, 0x4C, 0x86, 0x54, 0x83, 0x54, 0x83, 0x4B, 0x81,
-        0x4B, 0x81, 0x34, 0x80, 0x34, 0x80, 0x10, 0x80, 0x10, 0x80, 0xE1, 0x80, 0xE1, 0x80, 0xA4, 0x82, 0xA4, 0x82,
-        0x57, 0x85, 0x57, 0x85, 0xF4, 0x88, 0xF4, 0x88, 0x75, 0x8D, 0x75, 0x8D, 0xD0, 0x92, 0xD0, 0x92, 0xFC, 0x98,
-        0xFC, 0x98, 0xED, 0x9F, 0xED, 0x9F, 0x94, 0xA7, 0x94, 0xA7, 0xE5, 0xAF, 0xE5, 0xAF, 0xD0, 0xB8, 0xD0, 0xB8,
-        0x41, 0xC2, 0x41, 0xC2, 0x29, 0xCC, 0x29, 0xCC, 0x73, 0xD6, 0x73, 0xD6, 0x0D, 0xE1, 0x0D, 0xE1, 0xE2, 0xEB,
-        0xE2, 0xEB, 0xDE, 0xF6, 0xDE, 0xF6, 0xEA, 0x01, 0xEA, 0x01, 0xF3, 0x0C, 0xF3, 0x0C, 0xE4, 0x17, 0xE4, 0x17,
-        0xA6, 0x22, 0xA6, 0x22, 0x27, 0x2D, 0x27, 0x2D, 0x52, 0x37, 0x52, 0x37, 0x13, 0x41, 0x13, 0x41, 0x57, 0x4A,
-        0x57, 0x4A, 0x0E, 0x53, 0x0E, 0x53, 0x26, 0x5B, 0x26, 0x5B, 0x90, 0x62, 0x90, 0x62, 0x3E, 0x69, 0x3E, 0x69,
-        0x23, 0x6F, 0x23, 0x6F, 0x33, 0x74, 0x33, 0x74, 0x66, 0x78, 0x66, 0x78, 0xB3, 0x7B, 0xB3, 0x7B, 0x14, 0x7E,
-        0x14, 0x7E, 0x83, 0x7F, 0x83, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x88, 0x7F, 0x88, 0x7F, 0x1C, 0x7E, 0x1C, 0x7E,
-        0xBF, 0x7B, 0xBF, 0x7B, 0x77, 0x78, 0x77, 0x78, 0x48, 0x74, 0x48, 0x74, 0x3B, 0x6F, 0x3B, 0x6F, 0x5A, 0x69,
-        0x5A, 0x69, 0xAF, 0x62, 0xAF, 0x62, 0x49, 0x5B, 0x49, 0x5B, 0x33, 0x53, 0x33, 0x53, 0x80, 0x4A, 0x80, 0x4A,
-        0x3D, 0x41, 0x3D, 0x41, 0x7E, 0x37, 0x7E, 0x37, 0x55, 0x2D, 0x55, 0x2D, 0xD6, 0x22, 0xD6, 0x22, 0x14, 0x18,
-        0x14, 0x18, 0x24, 0x0D, 0x24, 0x0D, 0x1B, 0x02, 0x1B, 0x02, 0x0E, 0xF7, 0x0E, 0xF7, 0x13, 0xEC, 0x13, 0xEC,
-        0x3D, 0xE1, 0x3D, 0xE1, 0xA2, 0xD6, 0xA2, 0xD6, 0x55, 0xCC, 0x55, 0xCC, 0x6C, 0xC2, 0x6C, 0xC2, 0xF8, 0xB8,
-        0xF8, 0xB8, 0x0C, 0xB0, 0x0C, 0xB0, 0xB8, 0xA7, 0xB8, 0xA7, 0x0D, 0xA0, 0x0D, 0xA0, 0x19, 0x99, 0x19, 0x99,
-        0xEA, 0x92, 0xEA, 0x92, 0x8B, 0x8D, 0x8B, 0x8D, 0x07, 0x89, 0x07, 0x89, 0x65, 0x85, 0x65, 0x85, 0xAE, 0x82,
-        0xAE, 0x82, 0xE6, 0x80, 0xE6, 0x80, 0x11, 0x80, 0x11, 0x80, 0x30, 0x80, 0x30, 0x80, 0x44, 0x81, 0x44, 0x81,
-        0x49, 0x83, 0x49, 0x83, 0x3D, 0x86, 0x3D, 0x86, 0x18, 0x8A, 0x18, 0x8A, 0xD6, 0x8E, 0xD6, 0x8E, 0x6B, 0x94,
-        0x6B, 0x94, 0xCD, 0x9A, 0xCD, 0x9A, 0xF2, 0xA1, 0xF2, 0xA1, 0xC9, 0xA9, 0xC9, 0xA9, 0x45, 0xB2, 0x45, 0xB2,
-        0x55, 0xBB, 0x55, 0xBB, 0xE9, 0xC4, 0xE9, 0xC4, 0xEE, 0xCE, 0xEE, 0xCE, 0x50, 0xD9, 0x50, 0xD9, 0xFC, 0xE3,
-        0xFC, 0xE3, 0xDE, 0xEE, 0xDE, 0xEE, 0xE0, 0xF9, 0xE0, 0xF9, 0xEE, 0x04, 0xEE, 0x04, 0xF2, 0x0F, 0xF2, 0x0F,
-        0xD9, 0x1A, 0xD9, 0x1A, 0x8B, 0x25, 0x8B, 0x25, 0xF6, 0x2F, 0xF6, 0x2F, 0x06, 0x3A, 0x06, 0x3A, 0xA7, 0x43,
-        0xA7, 0x43, 0xC6, 0x4C, 0xC6, 0x4C, 0x54, 0x55, 0x54, 0x55, 0x3E, 0x5D, 0x3E, 0x5D, 0x76, 0x64, 0x76, 0x64,
-        0xEE, 0x6A, 0xEE, 0x6A, 0x9A, 0x70, 0x9A, 0x70, 0x6F, 0x75, 0x6F, 0x75, 0x63, 0x79, 0x63, 0x79, 0x71, 0x7C,
-        0x71, 0x7C, 0x90, 0x7E, 0x90, 0x7E, 0xBE, 0x7F, 0xBE, 0x7F, 0xF7, 0x7F, 0xF7, 0x7F, 0x3C, 0x7F, 0x3C, 0x7F,
-        0x8F, 0x7D, 0x8F, 0x7D, 0xF1, 0x7A, 0xF1, 0x7A, 0x69, 0x77, 0x69, 0x77, 0xFD, 0x72, 0xFD, 0x72, 0xB5, 0x6D,
-        0xB5, 0x6D, 0x9C, 0x67, 0x9C, 0x67, 0xBD, 0x60, 0xBD, 0x60, 0x25, 0x59, 0x25, 0x59, 0xE3, 0x50, 0xE3, 0x50,
-        0x06, 0x48, 0x06, 0x48, 0xA0, 0x3E, 0xA0, 0x3E, 0xC3, 0x34, 0xC3, 0x34, 0x80, 0x2A, 0x80, 0x2A, 0xEC, 0x1F,
-        0xEC, 0x1F, 0x1C, 0x15, 0x1C, 0x15, 0x23, 0x0A, 0x23, 0x0A, 0x18, 0xFF, 0x18, 0xFF, 0x0D, 0xF4, 0x0D, 0xF4,
-        0x19, 0xE9, 0x19, 0xE9, 0x51, 0xDE, 0x51, 0xDE, 0xCA, 0xD3, 0xCA, 0xD3, 0x97, 0xC9, 0x97, 0xC9, 0xCB, 0xBF,
-        0xCB, 0xBF, 0x7B, 0xB6, 0x7B, 0xB6, 0xB6, 0xAD, 0xB6, 0xAD, 0x8F, 0xA5, 0x8F, 0xA5, 0x15, 0x9E, 0x15, 0x9E,
-        0x55, 0x97, 0x55, 0x97, 0x5E, 0x91, 0x5E, 0x91, 0x39, 0x8C, 0x39, 0x8C, 0xF2, 0x87, 0xF2, 0x87, 0x90, 0x84,
-        0x90, 0x84, 0x1A, 0x82, 0x1A, 0x82, 0x94, 0x80, 0x94, 0x80, 0x01, 0x80, 0x01, 0x80, 0x64, 0x80, 0x64, 0x80,
-        0xB9, 0x81, 0xB9, 0x81, 0x00, 0x84, 0x00, 0x84, 0x33, 0x87, 0x33, 0x87, 0x4E, 0x8B, 0x4E, 0x8B, 0x46, 0x90,
-        0x46, 0x90, 0x15, 0x96, 0x15, 0x96, 0xAD, 0x9C, 0xAD, 0x9C, 0x04, 0xA4, 0x04, 0xA4, 0x09, 0xAC, 0x09, 0xAC,
-        0xB0, 0xB4, 0xB0, 0xB4, 0xE7, 0xBD, 0xE7, 0xBD, 0x9A, 0xC7, 0x9A, 0xC7, 0xBA, 0xD1, 0xBA, 0xD1, 0x33, 0xDC,
-        0x33, 0xDC, 0xF0, 0xE6, 0xF0, 0xE6, 0xDC, 0xF1, 0xDC, 0xF1, 0xE4, 0xFC, 0xE4, 0xFC, 0xF1, 0x07, 0xF1, 0x07,
-        0xEF, 0x12, 0xEF, 0x12, 0xC9, 0x1D, 0xC9, 0x1D, 0x6A, 0x28, 0x6A, 0x28, 0xBF, 0x32, 0xBF, 0x32, 0xB2, 0x3C,
-        0xB2, 0x3C, 0x31, 0x46, 0x31, 0x46, 0x2B, 0x4F, 0x2B, 0x4F, 0x8D, 0x57, 0x8D, 0x57, 0x48, 0x5F, 0x48, 0x5F,
-        0x4D, 0x66, 0x4D, 0x66, 0x8E, 0x6C, 0x8E, 0x6C, 0x01, 0x72, 0x01, 0x72, 0x9A, 0x76, 0x9A, 0x76, 0x50, 0x7A,
-        0x50, 0x7A, 0x1C, 0x7D, 0x1C, 0x7D, 0xFA, 0x7E, 0xFA, 0x7E, 0xE5, 0x7F, 0xE5, 0x7F, 0xDD, 0x7F, 0xDD, 0x7F,
-        0xDF, 0x7E, 0xDF, 0x7E, 0xF0, 0x7C, 0xF0, 0x7C, 0x12, 0x7A, 0x12, 0x7A, 0x4B, 0x76, 0x4B, 0x76, 0xA1, 0x71,
-        0xA1, 0x71, 0x20, 0x6C, 0x20, 0x6C, 0xCF, 0x65, 0xCF, 0x65, 0xBC, 0x5E, 0xBC, 0x5E, 0xF4, 0x56, 0xF4, 0x56,
-        0x87, 0x4E, 0x87, 0x4E, 0x83, 0x45, 0x83, 0x45, 0xFA, 0x3B, 0xFA, 0x3B, 0xFF, 0x31, 0xFF, 0x31, 0xA5, 0x27,
-        0xA5, 0x27, 0xFE, 0x1C, 0xFE, 0x1C, 0x21, 0x12, 0x21, 0x12, 0x21, 0x07, 0x21, 0x07, 0x14, 0xFC, 0x14, 0xFC,
-        0x0D, 0xF1, 0x0D, 0xF1, 0x23, 0xE6, 0x23, 0xE6, 0x6B, 0xDB, 0x6B, 0xDB, 0xF8, 0xD0, 0xF8, 0xD0, 0xE0, 0xC6,
-        0xE0, 0xC6, 0x34, 0xBD, 0x34, 0xBD, 0x08, 0xB4, 0x08, 0xB4, 0x6D, 0xAB, 0x6D, 0xAB, 0x73, 0xA3, 0x73, 0xA3,
-        0x2B, 0x9C, 0x2B, 0x9C, 0xA1, 0x95, 0xA1, 0x95, 0xE1, 0x8F, 0xE1, 0x8F, 0xF8, 0x8A, 0xF8, 0x8A, 0xEF, 0x86,
-        0xEF, 0x86, 0xCC, 0x83, 0xCC, 0x83, 0x98, 0x81, 0x98, 0x81, 0x54, 0x80, 0x54, 0x80, 0x04, 0x80, 0x04, 0x80,
-        0xA8, 0x80, 0xA8, 0x80, 0x40, 0x82, 0x40, 0x82, 0xC8, 0x84, 0xC8, 0x84, 0x3B, 0x88, 0x3B, 0x88, 0x93, 0x8C,
-        0x93, 0x8C, 0xC7, 0x91, 0xC7, 0x91, 0xCE, 0x97, 0xCE, 0x97, 0x9C, 0x9E, 0x9C, 0x9E, 0x23, 0xA6, 0x23, 0xA6,
-        0x56, 0xAE, 0x56, 0xAE, 0x25, 0xB7, 0x25, 0xB7, 0x80, 0xC0, 0x80, 0xC0, 0x53, 0xCA, 0x53, 0xCA, 0x8E, 0xD4,
-        0x8E, 0xD4, 0x1B, 0xDF, 0x1B, 0xDF, 0xE6, 0xE9, 0xE6, 0xE9, 0xDD, 0xF4, 0xDD, 0xF4, 0xE8, 0xFF, 0xE8, 0xFF,
-        0xF2, 0x0A, 0xF2, 0x0A, 0xE9, 0x15, 0xE9, 0x15, 0xB6, 0x20, 0xB6, 0x20, 0x44, 0x2B, 0x44, 0x2B, 0x80, 0x35,
-        0x80, 0x35, 0x55, 0x3F, 0x55, 0x3F, 0xB2, 0x48, 0xB2, 0x48, 0x84, 0x51, 0x84, 0x51, 0xBA, 0x59, 0xBA, 0x59,
-        0x45, 0x61, 0x45, 0x61, 0x16, 0x68, 0x16, 0x68, 0x20, 0x6E, 0x20, 0x6E, 0x58, 0x73, 0x58, 0x73, 0xB4, 0x77,
-        0xB4, 0x77, 0x2B, 0x7B, 0x2B, 0x7B, 0xB7, 0x7D, 0xB7, 0x7D, 0x52, 0x7F, 0x52, 0x7F, 0xFB, 0x7F, 0xFB, 0x7F,
-        0xAF, 0x7F, 0xAF, 0x7F, 0x70, 0x7E, 0x70, 0x7E, 0x3F, 0x7C, 0x3F, 0x7C, 0x21, 0x79, 0x21, 0x79, 0x1B, 0x75,
-        0x1B, 0x75, 0x37, 0x70, 0x37, 0x70, 0x7A, 0x6A, 0x7A, 0x6A, 0xF4, 0x63, 0xF4, 0x63, 0xAE, 0x5C, 0xAE, 0x5C,
-        0xB8, 0x54, 0xB8, 0x54, 0x20, 0x4C, 0x20, 0x4C, 0xF6, 0x42, 0xF6, 0x42, 0x4C, 0x39, 0x4C, 0x39, 0x35, 0x2F,
-        0x35, 0x2F, 0xC4, 0x24, 0xC4, 0x24, 0x0D, 0x1A, 0x0D, 0x1A, 0x23, 0x0F, 0x23, 0x0F, 0x1E, 0x04, 0x1E, 0x04,
-        0x10, 0xF9, 0x10, 0xF9, 0x10, 0xEE, 0x10, 0xEE, 0x32, 0xE3, 0x32, 0xE3, 0x8A, 0xD8, 0x8A, 0xD8, 0x2E, 0xCE,
-        0x2E, 0xCE, 0x31, 0xC4, 0x31, 0xC4, 0xA6, 0xBA, 0xA6, 0xBA, 0xA0, 0xB1, 0xA0, 0xB1, 0x2F, 0xA9, 0x2F, 0xA9,
-        0x65, 0xA1, 0x65, 0xA1, 0x4F, 0x9A, 0x4F, 0x9A, 0xFB, 0x93, 0xFB, 0x93, 0x75, 0x8E, 0x75, 0x8E, 0xC8, 0x89,
-        0xC8, 0x89, 0xFD, 0x85, 0xFD, 0x85, 0x1B, 0x83, 0x1B, 0x83, 0x27, 0x81, 0x27, 0x81, 0x26, 0x80, 0x26, 0x80,
-        0x18, 0x80, 0x18, 0x80, 0x00, 0x81, 0x00, 0x81, 0xD9, 0x82, 0xD9, 0x82, 0xA2, 0x85, 0xA2, 0x85, 0x54, 0x89,
-        0x54, 0x89, 0xE9, 0x8D, 0xE9, 0x8D, 0x57, 0x93, 0x57, 0x93, 0x96, 0x99, 0x96, 0x99, 0x97, 0xA0, 0x97, 0xA0,
-        0x4F, 0xA8, 0x4F, 0xA8, 0xAF, 0xB0, 0xAF, 0xB0, 0xA6, 0xB9, 0xA6, 0xB9, 0x23, 0xC3, 0x23, 0xC3, 0x14, 0xCD,
-        0x14, 0xCD, 0x67, 0xD7, 0x67, 0xD7, 0x07, 0xE2, 0x07, 0xE2, 0xE0, 0xEC, 0xE0, 0xEC, 0xDE, 0xF7, 0xDE, 0xF7,
-        0xEB, 0x02, 0xEB, 0x02, 0xF3, 0x0D, 0xF3, 0x0D, 0xE1, 0x18, 0xE1, 0x18, 0x9E, 0x23, 0x9E, 0x23, 0x18, 0x2E,
-        0x18, 0x2E, 0x39, 0x38, 0x39, 0x38, 0xF0, 0x41, 0xF0, 0x41, 0x29, 0x4B, 0x29, 0x4B, 0xD1, 0x53, 0xD1, 0x53,
-        0xDA, 0x5B, 0xDA, 0x5B, 0x33, 0x63, 0x33, 0x63, 0xD0, 0x69, 0xD0, 0x69, 0xA1, 0x6F, 0xA1, 0x6F, 0x9F, 0x74,
-        0x9F, 0x74, 0xBC, 0x78, 0xBC, 0x78, 0xF5, 0x7B, 0xF5, 0x7B, 0x3F, 0x7E, 0x3F, 0x7E, 0x99, 0x7F, 0x99, 0x7F,
-        0xFF, 0x7F, 0xFF, 0x7F, 0x71, 0x7F, 0x71, 0x7F, 0xEF, 0x7D, 0xEF, 0x7D, 0x7D, 0x7B, 0x7D, 0x7B, 0x1E, 0x78,
-        0x1E, 0x78, 0xDB, 0x73, 0xDB, 0x73, 0xBB, 0x6E, 0xBB, 0x6E, 0xC7, 0x68, 0xC7, 0x68, 0x0B, 0x62, 0x0B, 0x62,
-        0x93, 0x5A, 0x93, 0x5A, 0x6F, 0x52, 0x6F, 0x52, 0xAE, 0x49, 0xAE, 0x49, 0x5F, 0x40, 0x5F, 0x40, 0x96, 0x36,
-        0x96, 0x36, 0x64, 0x2C, 0x64, 0x2C, 0xDE, 0x21, 0xDE, 0x21, 0x17, 0x17, 0x17, 0x17, 0x23, 0x0C, 0x23, 0x0C,
-        0x1A, 0x01, 0x1A, 0x01, 0x0E, 0xF6, 0x0E, 0xF6, 0x14, 0xEB, 0x14, 0xEB, 0x43, 0xE0, 0x43, 0xE0, 0xAE, 0xD5,
-        0xAE, 0xD5, 0x6A, 0xCB, 0x6A, 0xCB, 0x8B, 0xC1, 0x8B, 0xC1, 0x22, 0xB8, 0x22, 0xB8, 0x43, 0xAF, 0x43, 0xAF,
-        0xFE, 0xA6, 0xFE, 0xA6, 0x63, 0x9F, 0x63, 0x9F, 0x81, 0x98, 0x81, 0x98, 0x64, 0x92, 0x64, 0x92, 0x19, 0x8D,
-        0x19, 0x8D, 0xA9, 0x88, 0xA9, 0x88, 0x1D, 0x85, 0x1D, 0x85, 0x7A, 0x82, 0x7A, 0x82, 0xC9, 0x80, 0xC9, 0x80,
-        0x0A, 0x80, 0x0A, 0x80, 0x40, 0x80, 0x40, 0x80, 0x68, 0x81, 0x68, 0x81, 0x84, 0x83, 0x84, 0x83, 0x8D, 0x86,
-        0x8D, 0x86, 0x7E, 0x8A, 0x7E, 0x8A, 0x4F, 0x8F, 0x4F, 0x8F, 0xF7, 0x94, 0xF7, 0x94, 0x6C, 0x9B, 0x6C, 0x9B,
-        0xA1, 0xA2, 0xA1, 0xA2, 0x88, 0xAA, 0x88, 0xAA, 0x12, 0xB3, 0x12, 0xB3, 0x2F, 0xBC, 0x2F, 0xBC, 0xCE, 0xC5,
-        0xCE, 0xC5, 0xDC, 0xCF, 0xDC, 0xCF, 0x46, 0xDA, 0x46, 0xDA, 0xF8, 0xE4, 0xF8, 0xE4, 0xDD, 0xEF, 0xDD, 0xEF,
-        0xE1, 0xFA, 0xE1, 0xFA, 0xEE, 0x05, 0xEE, 0x05, 0xF2, 0x10, 0xF2, 0x10, 0xD4, 0x1B, 0xD4, 0x1B, 0x81, 0x26,
-        0x81, 0x26, 0xE4, 0x30, 0xE4, 0x30, 0xEB, 0x3A, 0xEB, 0x3A, 0x81, 0x44, 0x81, 0x44, 0x94, 0x4D, 0x94, 0x4D,
-        0x13, 0x56, 0x13, 0x56, 0xED, 0x5D, 0xED, 0x5D, 0x14, 0x65, 0x14, 0x65, 0x7B, 0x6B, 0x7B, 0x6B, 0x13, 0x71,
-        0x13, 0x71, 0xD5, 0x75, 0xD5, 0x75, 0xB4, 0x79, 0xB4, 0x79, 0xAC, 0x7C, 0xAC, 0x7C, 0xB5, 0x7E, 0xB5, 0x7E,
-        0xCD, 0x7F, 0xCD, 0x7F, 0xF1, 0x7F, 0xF1, 0x7F, 0x1F, 0x7F, 0x1F, 0x7F, 0x5C, 0x7D, 0x5C, 0x7D, 0xA9, 0x7A,
-        0xA9, 0x7A, 0x0C, 0x77, 0x0C, 0x77, 0x8B, 0x72, 0x8B, 0x72, 0x30, 0x6D, 0x30, 0x6D, 0x04, 0x67, 0x04, 0x67,
-        0x14, 0x60, 0x14, 0x60, 0x6B, 0x58, 0x6B, 0x58, 0x1B, 0x50, 0x1B, 0x50, 0x31, 0x47, 0x31, 0x47, 0xBF, 0x3D,
-        0xBF, 0x3D, 0xD7, 0x33, 0xD7, 0x33, 0x8D, 0x29, 0x8D, 0x29, 0xF3, 0x1E, 0xF3, 0x1E, 0x1E, 0x14, 0x1E, 0x14,
-        0x22, 0x09, 0x22, 0x09, 0x16, 0xFE, 0x16, 0xFE, 0x0D, 0xF3, 0x0D, 0xF3, 0x1D, 0xE8, 0x1D, 0xE8, 0x5A, 0xDD,
-        0x5A, 0xDD, 0xD8, 0xD2, 0xD8, 0xD2, 0xAE, 0xC8, 0xAE, 0xC8, 0xED, 0xBE, 0xED, 0xBE, 0xA9, 0xB5, 0xA9, 0xB5,
-        0xF1, 0xAC, 0xF1, 0xAC, 0xDA, 0xA4, 0xDA, 0xA4, 0x70, 0x9D, 0x70, 0x9D, 0xC2, 0x96, 0xC2, 0x96, 0xDD, 0x90,
-        0xDD, 0x90, 0xCD, 0x8B, 0xCD, 0x8B, 0x9A, 0x87, 0x9A, 0x87, 0x4D, 0x84, 0x4D, 0x84, 0xEC, 0x81, 0xEC, 0x81,
-        0x7D, 0x80, 0x7D, 0x80, 0x00, 0x80, 0x00, 0x80, 0x78, 0x80, 0x78, 0x80, 0xE4, 0x81, 0xE4, 0x81, 0x40, 0x84,
-        0x40, 0x84, 0x89, 0x87, 0x89, 0x87, 0xB8, 0x8B, 0xB8, 0x8B, 0xC5, 0x90, 0xC5, 0x90, 0xA6, 0x96, 0xA6, 0x96,
-        0x51, 0x9D, 0x51, 0x9D, 0xB7, 0xA4, 0xB7, 0xA4, 0xCD, 0xAC, 0xCD, 0xAC, 0x81, 0xB5, 0x81, 0xB5, 0xC3, 0xBE,
-        0xC3, 0xBE, 0x82, 0xC8, 0x82, 0xC8, 0xAB, 0xD2, 0xAB, 0xD2, 0x2B, 0xDD, 0x2B, 0xDD, 0xEC, 0xE7, 0xEC, 0xE7,
-        0xDD, 0xF2, 0xDD, 0xF2, 0xE5, 0xFD, 0xE5, 0xFD, 0xF1, 0x08, 0xF1, 0x08, 0xED, 0x13, 0xED, 0x13, 0xC3, 0x1E,
-        0xC3, 0x1E, 0x5E, 0x29, 0x5E, 0x29, 0xAB, 0x33, 0xAB, 0x33, 0x94, 0x3D, 0x94, 0x3D, 0x08, 0x47, 0x08, 0x47,
-        0xF4, 0x4F, 0xF4, 0x4F, 0x48, 0x58, 0x48, 0x58, 0xF3, 0x5F, 0xF3, 0x5F, 0xE7, 0x66, 0xE7, 0x66, 0x16, 0x6D,
-        0x16, 0x6D, 0x75, 0x72, 0x75, 0x72, 0xF9, 0x76, 0xF9, 0x76, 0x9B, 0x7A, 0x9B, 0x7A, 0x52, 0x7D, 0x52, 0x7D,
-        0x1A, 0x7F, 0x1A, 0x7F, 0xEF, 0x7F, 0xEF, 0x7F, 0xCF, 0x7F, 0xCF, 0x7F, 0xBC, 0x7E, 0xBC, 0x7E, 0xB7, 0x7C,
-        0xB7, 0x7C, 0xC3, 0x79, 0xC3, 0x79, 0xE7, 0x75, 0xE7, 0x75, 0x2A, 0x71, 0x2A, 0x71, 0x95, 0x6B, 0x95, 0x6B,
-        0x33, 0x65, 0x33, 0x65, 0x0E, 0x5E, 0x0E, 0x5E, 0x37, 0x56, 0x37, 0x56, 0xBB, 0x4D, 0xBB, 0x4D, 0xAA, 0x44,
-        0xAA, 0x44, 0x16, 0x3B, 0x16, 0x3B, 0x12, 0x31, 0x12, 0x31, 0xB0, 0x26, 0xB0, 0x26, 0x03, 0x1C, 0x03, 0x1C,
-        0x22, 0x11, 0x22, 0x11, 0x20, 0x06, 0x20, 0x06, 0x12, 0xFB, 0x12, 0xFB, 0x0E, 0xF0, 0x0E, 0xF0, 0x28, 0xE5,
-        0x28, 0xE5, 0x75, 0xDA, 0x75, 0xDA, 0x0A, 0xD0, 0x0A, 0xD0, 0xFA, 0xC5, 0xFA, 0xC5, 0x59, 0xBC, 0x59, 0xBC,
-        0x3A, 0xB3, 0x3A, 0xB3, 0xAD, 0xAA, 0xAD, 0xAA, 0xC2, 0xA2, 0xC2, 0xA2, 0x8A, 0x9B, 0x8A, 0x9B, 0x12, 0x95,
-        0x12, 0x95, 0x66, 0x8F, 0x66, 0x8F, 0x91, 0x8A, 0x91, 0x8A, 0x9D, 0x86, 0x9D, 0x86, 0x8F, 0x83, 0x8F, 0x83,
-        0x71, 0x81, 0x71, 0x81, 0x42, 0x80, 0x42, 0x80, 0x09, 0x80, 0x09, 0x80, 0xC3, 0x80, 0xC3, 0x80, 0x71, 0x82,
-        0x71, 0x82, 0x0E, 0x85, 0x0E, 0x85, 0x97, 0x88, 0x97, 0x88, 0x03, 0x8D, 0x03, 0x8D, 0x4B, 0x92, 0x4B, 0x92,
-        0x64, 0x98, 0x64, 0x98, 0x43, 0x9F, 0x43, 0x9F, 0xDB, 0xA6, 0xDB, 0xA6, 0x1D, 0xAF, 0x1D, 0xAF, 0xFA, 0xB7,
-        0xFA, 0xB7, 0x60, 0xC1, 0x60, 0xC1, 0x3E, 0xCB, 0x3E, 0xCB, 0x80, 0xD5, 0x80, 0xD5, 0x14, 0xE0, 0x14, 0xE0,
-        0xE4, 0xEA, 0xE4, 0xEA, 0xDD, 0xF5, 0xDD, 0xF5, 0xE9, 0x00, 0xE9, 0x00, 0xF3, 0x0B, 0xF3, 0x0B, 0xE7, 0x16,
-        0xE7, 0x16, 0xAE, 0x21, 0xAE, 0x21, 0x36, 0x2C, 0x36, 0x2C, 0x69, 0x36, 0x69, 0x36, 0x35, 0x40, 0x35, 0x40,
-        0x85, 0x49, 0x85, 0x49, 0x4A, 0x52, 0x4A, 0x52, 0x71, 0x5A, 0x71, 0x5A, 0xEB, 0x61, 0xEB, 0x61, 0xAA, 0x68,
-        0xAA, 0x68, 0xA2, 0x6E, 0xA2, 0x6E, 0xC6, 0x73, 0xC6, 0x73, 0x0E, 0x78, 0x0E, 0x78, 0x70, 0x7B, 0x70, 0x7B,
-        0xE7, 0x7D, 0xE7, 0x7D, 0x6C, 0x7F, 0x6C, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x47, 0x7E,
-        0x47, 0x7E, 0x00, 0x7C, 0x00, 0x7C, 0xCD, 0x78, 0xCD, 0x78, 0xB2, 0x74, 0xB2, 0x74, 0xBA, 0x6F, 0xBA, 0x6F,
-        0xEB, 0x69, 0xEB, 0x69, 0x53, 0x63, 0x53, 0x63, 0xFC, 0x5B, 0xFC, 0x5B, 0xF6, 0x53, 0xF6, 0x53, 0x50, 0x4B,
-        0x50, 0x4B, 0x1A, 0x42, 0x1A, 0x42, 0x66, 0x38, 0x66, 0x38, 0x46, 0x2E, 0x46, 0x2E, 0xCD, 0x23, 0xCD, 0x23,
-        0x10, 0x19, 0x10, 0x19, 0x24, 0x0E, 0x24, 0x0E, 0x1C, 0x03, 0x1C, 0x03, 0x10, 0xF8, 0x10, 0xF8, 0x11, 0xED,
-        0x11, 0xED, 0x37, 0xE2, 0x37, 0xE2, 0x95, 0xD7, 0x95, 0xD7, 0x41, 0xCD, 0x41, 0xCD, 0x4E, 0xC3, 0x4E, 0xC3,
-        0xCE, 0xB9, 0xCE, 0xB9, 0xD5, 0xB0, 0xD5, 0xB0, 0x73, 0xA8, 0x73, 0xA8, 0xB8, 0xA0, 0xB8, 0xA0, 0xB3, 0x99,
-        0xB3, 0x99, 0x71, 0x93, 0x71, 0x93, 0xFF, 0x8D, 0xFF, 0x8D, 0x67, 0x89, 0x67, 0x89, 0xB0, 0x85, 0xB0, 0x85,
-        0xE4, 0x82, 0xE4, 0x82, 0x05, 0x81, 0x05, 0x81, 0x1B, 0x80, 0x1B, 0x80, 0x23, 0x80, 0x23, 0x80, 0x21, 0x81,
-        0x21, 0x81, 0x10, 0x83, 0x10, 0x83, 0xEE, 0x85, 0xEE, 0x85, 0xB5, 0x89, 0xB5, 0x89, 0x5E, 0x8E, 0x5E, 0x8E,
-        0xE0, 0x93, 0xE0, 0x93, 0x31, 0x9A, 0x31, 0x9A, 0x44, 0xA1, 0x44, 0xA1, 0x0B, 0xA9, 0x0B, 0xA9, 0x79, 0xB1,
-        0x79, 0xB1, 0x7D, 0xBA, 0x7D, 0xBA, 0x06, 0xC4, 0x06, 0xC4, 0x01, 0xCE, 0x01, 0xCE, 0x5B, 0xD8, 0x5B, 0xD8,
-        0x01, 0xE3, 0x01, 0xE3, 0xDF, 0xED, 0xDF, 0xED, 0xE0, 0xF8, 0xE0, 0xF8, 0xED, 0x03, 0xED, 0x03, 0xF3, 0x0E,
-        0xF3, 0x0E, 0xDD, 0x19, 0xDD, 0x19, 0x95, 0x24, 0x95, 0x24, 0x07, 0x2F, 0x07, 0x2F, 0x20, 0x39, 0x20, 0x39,
-        0xCC, 0x42, 0xCC, 0x42, 0xF8, 0x4B, 0xF8, 0x4B, 0x93, 0x54, 0x93, 0x54, 0x8D, 0x5C, 0x8D, 0x5C, 0xD5, 0x63,
-        0xD5, 0x63, 0x60, 0x6A, 0x60, 0x6A, 0x1F, 0x70, 0x1F, 0x70, 0x08, 0x75, 0x08, 0x75, 0x11, 0x79, 0x11, 0x79,
-        0x34, 0x7C, 0x34, 0x7C, 0x68, 0x7E, 0x68, 0x7E, 0xAD, 0x7F, 0xAD, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0x58, 0x7F,
-        0x58, 0x7F, 0xC0, 0x7D, 0xC0, 0x7D, 0x38, 0x7B, 0x38, 0x7B, 0xC5, 0x77, 0xC5, 0x77, 0x6D, 0x73, 0x6D, 0x73,
-        0x39, 0x6E, 0x39, 0x6E, 0x32, 0x68, 0x32, 0x68, 0x65, 0x61, 0x65, 0x61, 0xDD, 0x59, 0xDD, 0x59, 0xAA, 0x51,
-        0xAA, 0x51, 0xDB, 0x48, 0xDB, 0x48, 0x80, 0x3F, 0x80, 0x3F, 0xAD, 0x35, 0xAD, 0x35, 0x72, 0x2B, 0x72, 0x2B,
-        0xE5, 0x20, 0xE5, 0x20, 0x19, 0x16, 0x19, 0x16, 0x23, 0x0B, 0x23, 0x0B, 0x18, 0x00, 0x18, 0x00, 0x0D, 0xF5,
-        0x0D, 0xF5, 0x17, 0xEA, 0x17, 0xEA, 0x4A, 0xDF, 0x4A, 0xDF, 0xBC, 0xD4, 0xBC, 0xD4, 0x80, 0xCA, 0x80, 0xCA,
-        0xAA, 0xC0, 0xAA, 0xC0, 0x4E, 0xB7, 0x4E, 0xB7, 0x7C, 0xAE, 0x7C, 0xAE, 0x47, 0xA6, 0x47, 0xA6, 0xBC, 0x9E,
-        0xBC, 0x9E, 0xEB, 0x97, 0xEB, 0x97, 0xE0, 0x91, 0xE0, 0x91, 0xA8, 0x8C, 0xA8, 0x8C, 0x4C, 0x88, 0x4C, 0x88,
-        0xD5, 0x84, 0xD5, 0x84, 0x49, 0x82, 0x49, 0x82, 0xAE, 0x80, 0xAE, 0x80, 0x05, 0x80, 0x05, 0x80, 0x51, 0x80,
-        0x51, 0x80, 0x90, 0x81, 0x90, 0x81, 0xC1, 0x83, 0xC1, 0x83, 0xDF, 0x86, 0xDF, 0x86, 0xE5, 0x8A, 0xE5, 0x8A,
-        0xCA, 0x8F, 0xCA, 0x8F, 0x85, 0x95, 0x85, 0x95, 0x0C, 0x9C, 0x0C, 0x9C, 0x52, 0xA3, 0x52, 0xA3, 0x48, 0xAB,
-        0x48, 0xAB, 0xE1, 0xB3, 0xE1, 0xB3, 0x0A, 0xBD, 0x0A, 0xBD, 0xB4, 0xC6, 0xB4, 0xC6, 0xCB, 0xD0, 0xCB, 0xD0,
-        0x3C, 0xDB, 0x3C, 0xDB, 0xF4, 0xE5, 0xF4, 0xE5, 0xDD, 0xF0, 0xDD, 0xF0, 0xE3, 0xFB, 0xE3, 0xFB, 0xEF, 0x06,
-        0xEF, 0x06, 0xF0, 0x11, 0xF0, 0x11, 0xCF, 0x1C, 0xCF, 0x1C, 0x76, 0x27, 0x76, 0x27, 0xD2, 0x31, 0xD2, 0x31,
-        0xCF, 0x3B, 0xCF, 0x3B, 0x5A, 0x45, 0x5A, 0x45, 0x60, 0x4E, 0x60, 0x4E, 0xD1, 0x56, 0xD1, 0x56, 0x9B, 0x5E,
-        0x9B, 0x5E, 0xB2, 0x65, 0xB2, 0x65, 0x05, 0x6C, 0x05, 0x6C, 0x8B, 0x71, 0x8B, 0x71, 0x38, 0x76, 0x38, 0x76,
-        0x03, 0x7A, 0x03, 0x7A, 0xE5, 0x7C, 0xE5, 0x7C, 0xD9, 0x7E, 0xD9, 0x7E, 0xDA, 0x7F, 0xDA, 0x7F, 0xE7, 0x7F,
-        0xE7, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x27, 0x7D, 0x27, 0x7D, 0x5E, 0x7A, 0x5E, 0x7A, 0xAC, 0x76, 0xAC, 0x76,
-        0x17, 0x72, 0x17, 0x72, 0xA9, 0x6C, 0xA9, 0x6C, 0x6A, 0x66, 0x6A, 0x66, 0x69, 0x5F, 0x69, 0x5F, 0xB1, 0x57,
-        0xB1, 0x57, 0x51, 0x4F, 0x51, 0x4F, 0x5A, 0x46, 0x5A, 0x46, 0xDD, 0x3C, 0xDD, 0x3C, 0xEC, 0x32, 0xEC, 0x32,
-        0x99, 0x28, 0x99, 0x28, 0xF9, 0x1D, 0xF9, 0x1D, 0x20, 0x13, 0x20, 0x13, 0x21, 0x08, 0x21, 0x08, 0x15, 0xFD,
-        0x15, 0xFD, 0x0D, 0xF2, 0x0D, 0xF2, 0x20, 0xE7, 0x20, 0xE7, 0x62, 0xDC, 0x62, 0xDC, 0xE8, 0xD1, 0xE8, 0xD1,
-        0xC7, 0xC7, 0xC7, 0xC7, 0x10, 0xBE, 0x10, 0xBE, 0xD8, 0xB4, 0xD8, 0xB4, 0x2F, 0xAC, 0x2F, 0xAC, 0x26, 0xA4,
-        0x26, 0xA4, 0xCD, 0x9C, 0xCD, 0x9C, 0x30, 0x96, 0x30, 0x96, 0x5F, 0x90, 0x5F, 0x90, 0x62, 0x8B, 0x62, 0x8B,
-        0x44, 0x87, 0x44, 0x87, 0x0C, 0x84, 0x0C, 0x84, 0xC1, 0x81, 0xC1, 0x81, 0x67, 0x80, 0x67, 0x80, 0x01, 0x80,
-        0x01, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x11, 0x82, 0x11, 0x82, 0x83, 0x84, 0x83, 0x84, 0xE1, 0x87, 0xE1, 0x87,
-        0x24, 0x8C, 0x24, 0x8C, 0x46, 0x91, 0x46, 0x91, 0x39, 0x97, 0x39, 0x97, 0xF5, 0x9D, 0xF5, 0x9D, 0x6D, 0xA5,
-        0x6D, 0xA5, 0x91, 0xAD, 0x91, 0xAD, 0x53, 0xB6, 0x53, 0xB6, 0xA1, 0xBF, 0xA1, 0xBF, 0x6A, 0xC9, 0x6A, 0xC9,
-        0x9C, 0xD3, 0x9C, 0xD3, 0x22, 0xDE, 0x22, 0xDE, 0xEA, 0xE8, 0xEA, 0xE8, 0xDD, 0xF3, 0xDD, 0xF3, 0xE6, 0xFE,
-        0xE6, 0xFE, 0xF2, 0x09, 0xF2, 0x09, 0xEB, 0x14, 0xEB, 0x14, 0xBD, 0x1F, 0xBD, 0x1F, 0x52, 0x2A, 0x52, 0x2A,
-        0x96, 0x34, 0x96, 0x34, 0x75, 0x3E, 0x75, 0x3E, 0xDD, 0x47, 0xDD, 0x47, 0xBD, 0x50, 0xBD, 0x50, 0x02, 0x59,
-        0x02, 0x59, 0x9D, 0x60, 0x9D, 0x60, 0x7F, 0x67, 0x7F, 0x67, 0x9C, 0x6D, 0x9C, 0x6D, 0xE7, 0x72, 0xE7, 0x72,
-        0x57, 0x77, 0x57, 0x77, 0xE4, 0x7A, 0xE4, 0x7A, 0x86, 0x7D, 0x86, 0x7D, 0x37, 0x7F, 0x37, 0x7F, 0xF6, 0x7F,
-        0xF6, 0x7F, 0xC0, 0x7F, 0xC0, 0x7F, 0x97, 0x7E, 0x97, 0x7E, 0x7C, 0x7C, 0x7C, 0x7C, 0x73, 0x79, 0x73, 0x79,
-        0x82, 0x75, 0x82, 0x75, 0xB1, 0x70, 0xB1, 0x70, 0x09, 0x6B, 0x09, 0x6B, 0x94, 0x64, 0x94, 0x64, 0x5F, 0x5D,
-        0x5F, 0x5D, 0x78, 0x55, 0x78, 0x55, 0xED, 0x4C, 0xED, 0x4C, 0xD1, 0x43, 0xD1, 0x43, 0x32, 0x3A, 0x32, 0x3A,
-        0x24, 0x30, 0x24, 0x30, 0xBA, 0x25, 0xBA, 0x25, 0x08, 0x1B, 0x08, 0x1B, 0x23, 0x10, 0x23, 0x10, 0x1E, 0x05,
-        0x1E, 0x05, 0x11, 0xFA, 0x11, 0xFA, 0x0F, 0xEF, 0x0F, 0xEF, 0x2C, 0xE4, 0x2C, 0xE4, 0x7F, 0xD9, 0x7F, 0xD9,
-        0x1B, 0xCF, 0x1B, 0xCF, 0x15, 0xC5, 0x15, 0xC5, 0x7F, 0xBB, 0x7F, 0xBB, 0x6C, 0xB2, 0x6C, 0xB2, 0xED, 0xA9,
-        0xED, 0xA9, 0x13, 0xA2, 0x13, 0xA2, 0xEC, 0x9A, 0xEC, 0x9A, 0x85, 0x94, 0x85, 0x94, 0xED, 0x8E, 0xED, 0x8E,
-        0x2C, 0x8A, 0x2C, 0x8A, 0x4C, 0x86, 0x4C, 0x86, 0x54, 0x83, 0x54, 0x83, 0x4B, 0x81, 0x4B, 0x81, 0x34, 0x80,
-        0x34, 0x80, 0x10, 0x80, 0x10, 0x80, 0xE1, 0x80, 0xE1, 0x80, 0xA4, 0x82, 0xA4, 0x82, 0x57, 0x85, 0x57, 0x85,
-        0xF4, 0x88, 0xF4, 0x88, 0x75, 0x8D, 0x75, 0x8D, 0xD0, 0x92, 0xD0, 0x92, 0xFC, 0x98, 0xFC, 0x98, 0xED, 0x9F,
-        0xED, 0x9F, 0x94, 0xA7, 0x94, 0xA7, 0xE5, 0xAF, 0xE5, 0xAF, 0xD0, 0xB8, 0xD0, 0xB8, 0x41, 0xC2, 0x41, 0xC2,
-        0x29, 0xCC, 0x29, 0xCC, 0x73, 0xD6, 0x73, 0xD6, 0x0D, 0xE1, 0x0D, 0xE1, 0xE2, 0xEB, 0xE2, 0xEB, 0xDE, 0xF6,
-        0xDE, 0xF6, 0xEA, 0x01, 0xEA, 0x01, 0xF3, 0x0C, 0xF3, 0x0C, 0xE4, 0x17, 0xE4, 0x17, 0xA6, 0x22, 0xA6, 0x22,
-        0x27, 0x2D, 0x27, 0x2D, 0x52, 0x37, 0x52, 0x37, 0x13, 0x41, 0x13, 0x41, 0x57, 0x4A, 0x57, 0x4A, 0x0E, 0x53,
-        0x0E, 0x53, 0x26, 0x5B, 0x26, 0x5B, 0x90, 0x62, 0x90, 0x62, 0x3E, 0x69, 0x3E, 0x69, 0x23, 0x6F, 0x23, 0x6F,
-        0x33, 0x74, 0x33, 0x74, 0x66, 0x78, 0x66, 0x78, 0xB3, 0x7B, 0xB3, 0x7B, 0x14, 0x7E, 0x14, 0x7E, 0x83, 0x7F,
-        0x83, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x88, 0x7F, 0x88, 0x7F, 0x1C, 0x7E, 0x1C, 0x7E, 0xBF, 0x7B, 0xBF, 0x7B,
-        0x77, 0x78, 0x77, 0x78, 0x48, 0x74, 0x48, 0x74, 0x3B, 0x6F, 0x3B, 0x6F, 0x5A, 0x69, 0x5A, 0x69, 0xAF, 0x62,
-        0xAF, 0x62, 0x49, 0x5B, 0x49, 0x5B, 0x33, 0x53, 0x33, 0x53, 0x80, 0x4A, 0x80, 0x4A, 0x3D, 0x41, 0x3D, 0x41,
-        0x7E, 0x37, 0x7E, 0x37, 0x55, 0x2D, 0x55, 0x2D, 0xD6, 0x22, 0xD6, 0x22, 0x14, 0x18, 0x14, 0x18, 0x24, 0x0D,
-        0x24, 0x0D, 0x1B, 0x02, 0x1B, 0x02, 0x0E, 0xF7, 0x0E, 0xF7, 0x13, 0xEC, 0x13, 0xEC, 0x3D, 0xE1, 0x3D, 0xE1,
-        0xA2, 0xD6, 0xA2, 0xD6, 0x55, 0xCC, 0x55, 0xCC, 0x6C, 0xC2, 0x6C, 0xC2, 0xF8, 0xB8, 0xF8, 0xB8, 0x0C, 0xB0,
-        0x0C, 0xB0, 0xB8, 0xA7, 0xB8, 0xA7, 0x0D, 0xA0, 0x0D, 0xA0, 0x19, 0x99, 0x19, 0x99, 0xEA, 0x92, 0xEA, 0x92,
-        0x8B, 0x8D, 0x8B, 0x8D, 0x07, 0x89, 0x07, 0x89, 0x65, 0x85, 0x65, 0x85, 0xAE, 0x82, 0xAE, 0x82, 0xE6, 0x80,
-        0xE6, 0x80, 0x11, 0x80, 0x11, 0x80, 0x30, 0x80, 0x30, 0x80, 0x44, 0x81, 0x44, 0x81, 0x49, 0x83, 0x49, 0x83,
-        0x3D, 0x86, 0x3D, 0x86, 0x18, 0x8A, 0x18, 0x8A, 0xD6, 0x8E, 0xD6, 0x8E, 0x6B, 0x94, 0x6B, 0x94, 0xCD, 0x9A,
-        0xCD, 0x9A, 0xF2, 0xA1, 0xF2, 0xA1, 0xC9, 0xA9, 0xC9, 0xA9, 0x45, 0xB2, 0x45, 0xB2, 0x55, 0xBB, 0x55, 0xBB,
-        0xE9, 0xC4, 0xE9, 0xC4, 0xEE, 0xCE, 0xEE, 0xCE, 0x50, 0xD9, 0x50, 0xD9, 0xFC, 0xE3, 0xFC, 0xE3, 0xDE, 0xEE,
-        0xDE, 0xEE, 0xE0, 0xF9, 0xE0, 0xF9, 0xEE, 0x04, 0xEE, 0x04, 0xF2, 0x0F, 0xF2, 0x0F, 0xD9, 0x1A, 0xD9, 0x1A,
-        0x8B, 0x25, 0x8B, 0x25, 0xF6, 0x2F, 0xF6, 0x2F, 0x06, 0x3A, 0x06, 0x3A, 0xA7, 0x43, 0xA7, 0x43, 0xC6, 0x4C,
-        0xC6, 0x4C, 0x54, 0x55, 0x54, 0x55, 0x3E, 0x5D, 0x3E, 0x5D, 0x76, 0x64, 0x76, 0x64, 0xEE, 0x6A, 0xEE, 0x6A,
-        0x9A, 0x70, 0x9A, 0x70, 0x6F, 0x75, 0x6F, 0x75, 0x63, 0x79, 0x63, 0x79, 0x71, 0x7C, 0x71, 0x7C, 0x90, 0x7E,
-        0x90, 0x7E, 0xBE, 0x7F, 0xBE, 0x7F, 0xF7, 0x7F, 0xF7, 0x7F, 0x3C, 0x7F, 0x3C, 0x7F, 0x8F, 0x7D, 0x8F, 0x7D,
-        0xF1, 0x7A, 0xF1, 0x7A, 0x69, 0x77, 0x69, 0x77, 0xFD, 0x72, 0xFD, 0x72, 0xB5, 0x6D, 0xB5, 0x6D, 0x9C, 0x67,
-        0x9C, 0x67, 0xBD, 0x60, 0xBD, 0x60, 0x25, 0x59, 0x25, 0x59, 0xE3, 0x50, 0xE3, 0x50, 0x06, 0x48, 0x06, 0x48,
-        0xA0, 0x3E, 0xA0, 0x3E, 0xC3, 0x34, 0xC3, 0x34, 0x80, 0x2A, 0x80, 0x2A, 0xEC, 0x1F, 0xEC, 0x1F, 0x1C, 0x15,
-        0x1C, 0x15, 0x23, 0x0A, 0x23, 0x0A, 0x18, 0xFF, 0x18, 0xFF, 0x0D, 0xF4, 0x0D, 0xF4, 0x19, 0xE9, 0x19, 0xE9,
-        0x51, 0xDE, 0x51, 0xDE, 0xCA, 0xD3, 0xCA, 0xD3, 0x97, 0xC9, 0x97, 0xC9, 0xCB, 0xBF, 0xCB, 0xBF, 0x7B, 0xB6,
-        0x7B, 0xB6, 0xB6, 0xAD, 0xB6, 0xAD, 0x8F, 0xA5, 0x8F, 0xA5, 0x15, 0x9E, 0x15, 0x9E, 0x55, 0x97, 0x55, 0x97,
-        0x5E, 0x91, 0x5E, 0x91, 0x39, 0x8C, 0x39, 0x8C, 0xF2, 0x87, 0xF2, 0x87, 0x90, 0x84, 0x90, 0x84, 0x1A, 0x82,
-        0x1A, 0x82, 0x94, 0x80, 0x94, 0x80, 0x01, 0x80, 0x01, 0x80, 0x64, 0x80, 0x64, 0x80, 0xB9, 0x81, 0xB9, 0x81,
-        0x00, 0x84, 0x00, 0x84, 0x33, 0x87, 0x33, 0x87, 0x4E, 0x8B, 0x4E, 0x8B, 0x46, 0x90, 0x46, 0x90, 0x15, 0x96,
-        0x15, 0x96, 0xAD, 0x9C, 0xAD, 0x9C, 0x04, 0xA4, 0x04, 0xA4, 0x09, 0xAC, 0x09, 0xAC, 0xB0, 0xB4, 0xB0, 0xB4,
-        0xE7, 0xBD, 0xE7, 0xBD, 0x9A, 0xC7, 0x9A, 0xC7, 0xBA, 0xD1, 0xBA, 0xD1, 0x33, 0xDC, 0x33, 0xDC, 0xF0, 0xE6,
-        0xF0, 0xE6, 0xDC, 0xF1, 0xDC, 0xF1, 0xE4, 0xFC, 0xE4, 0xFC, 0xF1, 0x07, 0xF1, 0x07, 0xEF, 0x12, 0xEF, 0x12,
-        0xC9, 0x1D, 0xC9, 0x1D, 0x6A, 0x28, 0x6A, 0x28, 0xBF, 0x32, 0xBF, 0x32, 0xB2, 0x3C, 0xB2, 0x3C, 0x31, 0x46,
-        0x31, 0x46, 0x2B, 0x4F, 0x2B, 0x4F, 0x8D, 0x57, 0x8D, 0x57, 0x48, 0x5F, 0x48, 0x5F, 0x4D, 0x66, 0x4D, 0x66,
-        0x8E, 0x6C, 0x8E, 0x6C, 0x01, 0x72, 0x01, 0x72, 0x9A, 0x76, 0x9A, 0x76, 0x50, 0x7A, 0x50, 0x7A, 0x1C, 0x7D,
-        0x1C, 0x7D, 0xFA, 0x7E, 0xFA, 0x7E, 0xE5, 0x7F, 0xE5, 0x7F, 0xDD, 0x7F, 0xDD, 0x7F, 0xDF, 0x7E, 0xDF, 0x7E,
-        0xF0, 0x7C, 0xF0, 0x7C, 0x12, 0x7A, 0x12, 0x7A, 0x4B, 0x76, 0x4B, 0x76, 0xA1, 0x71, 0xA1, 0x71, 0x20, 0x6C,
-        0x20, 0x6C, 0xCF, 0x65, 0xCF, 0x65, 0xBC, 0x5E, 0xBC, 0x5E, 0xF4, 0x56, 0xF4, 0x56, 0x87, 0x4E, 0x87, 0x4E,
-        0x83, 0x45, 0x83, 0x45, 0xFA, 0x3B, 0xFA, 0x3B, 0xFF, 0x31, 0xFF, 0x31, 0xA5, 0x27, 0xA5, 0x27, 0xFE, 0x1C,
-        0xFE, 0x1C, 0x21, 0x12, 0x21, 0x12, 0x21, 0x07, 0x21, 0x07, 0x14, 0xFC, 0x14, 0xFC, 0x0D, 0xF1, 0x0D, 0xF1,
-        0x23, 0xE6, 0x23, 0xE6, 0x6B, 0xDB, 0x6B, 0xDB, 0xF8, 0xD0, 0xF8, 0xD0, 0xE0, 0xC6, 0xE0, 0xC6, 0x34, 0xBD,
-        0x34, 0xBD, 0x08, 0xB4, 0x08, 0xB4, 0x6D, 0xAB, 0x6D, 0xAB, 0x73, 0xA3, 0x73, 0xA3, 0x2B, 0x9C, 0x2B, 0x9C,
-        0xA1, 0x95, 0xA1, 0x95, 0xE1, 0x8F, 0xE1, 0x8F, 0xF8, 0x8A, 0xF8, 0x8A, 0xEF, 0x86, 0xEF, 0x86, 0xCC, 0x83,
-        0xCC, 0x83, 0x98, 0x81, 0x98, 0x81, 0x54, 0x80, 0x54, 0x80, 0x04, 0x80, 0x04, 0x80, 0xA8, 0x80, 0xA8, 0x80,
-        0x40, 0x82, 0x40, 0x82, 0xC8, 0x84, 0xC8, 0x84, 0x3B, 0x88, 0x3B, 0x88, 0x93, 0x8C, 0x93, 0x8C, 0xC7, 0x91,
-        0xC7, 0x91, 0xCE, 0x97, 0xCE, 0x97, 0x9C, 0x9E, 0x9C, 0x9E, 0x23, 0xA6, 0x23, 0xA6, 0x56, 0xAE, 0x56, 0xAE,
-        0x25, 0xB7, 0x25, 0xB7, 0x80, 0xC0, 0x80, 0xC0, 0x53, 0xCA, 0x53, 0xCA, 0x8E, 0xD4, 0x8E, 0xD4, 0x1B, 0xDF,
-        0x1B, 0xDF, 0xE6, 0xE9, 0xE6, 0xE9, 0xDD, 0xF4, 0xDD, 0xF4, 0xE8, 0xFF, 0xE8, 0xFF, 0xF2, 0x0A, 0xF2, 0x0A,
-        0xE9, 0x15, 0xE9, 0x15, 0xB6, 0x20, 0xB6, 0x20, 0x44, 0x2B, 0x44, 0x2B, 0x80, 0x35, 0x80, 0x35, 0x55, 0x3F,
-        0x55, 0x3F, 0xB2, 0x48, 0xB2, 0x48, 0x84, 0x51, 0x84, 0x51, 0xBA, 0x59, 0xBA, 0x59, 0x45, 0x61, 0x45, 0x61,
-        0x16, 0x68, 0x16, 0x68, 0x20, 0x6E, 0x20, 0x6E, 0x58, 0x73, 0x58, 0x73, 0xB4, 0x77, 0xB4, 0x77, 0x2B, 0x7B,
-        0x2B, 0x7B, 0xB7, 0x7D, 0xB7, 0x7D, 0x52, 0x7F, 0x52, 0x7F, 0xFB, 0x7F, 0xFB, 0x7F, 0xAF, 0x7F, 0xAF, 0x7F,
-        0x70, 0x7E, 0x70, 0x7E, 0x3F, 0x7C, 0x3F, 0x7C, 0x21, 0x79, 0x21, 0x79, 0x1B, 0x75, 0x1B, 0x75, 0x37, 0x70,
-        0x37, 0x70, 0x7A, 0x6A, 0x7A, 0x6A, 0xF4, 0x63, 0xF4, 0x63, 0xAE, 0x5C, 0xAE, 0x5C, 0xB8, 0x54, 0xB8, 0x54,
-        0x20, 0x4C, 0x20, 0x4C, 0xF6, 0x42, 0xF6, 0x42, 0x4C, 0x39, 0x4C, 0x39, 0x35, 0x2F, 0x35, 0x2F, 0xC4, 0x24,
-        0xC4, 0x24, 0x0D, 0x1A, 0x0D, 0x1A, 0x23, 0x0F, 0x23, 0x0F, 0x1E, 0x04, 0x1E, 0x04, 0x10, 0xF9, 0x10, 0xF9,
-        0x10, 0xEE, 0x10, 0xEE, 0x32, 0xE3, 0x32, 0xE3, 0x8A, 0xD8, 0x8A, 0xD8, 0x2E, 0xCE, 0x2E, 0xCE, 0x31, 0xC4,
-        0x31, 0xC4, 0xA6, 0xBA, 0xA6, 0xBA, 0xA0, 0xB1, 0xA0, 0xB1, 0x2F, 0xA9, 0x2F, 0xA9, 0x65, 0xA1, 0x65, 0xA1,
-        0x4F, 0x9A, 0x4F, 0x9A, 0xFB, 0x93, 0xFB, 0x93, 0x75, 0x8E, 0x75, 0x8E, 0xC8, 0x89, 0xC8, 0x89, 0xFD, 0x85,
-        0xFD, 0x85, 0x1B, 0x83, 0x1B, 0x83, 0x27, 0x81, 0x27, 0x81, 0x26, 0x80, 0x26, 0x80, 0x18, 0x80, 0x18, 0x80,
-        0x00, 0x81, 0x00, 0x81, 0xD9, 0x82, 0xD9, 0x82, 0xA2, 0x85, 0xA2, 0x85, 0x54, 0x89, 0x54, 0x89, 0xE9, 0x8D,
-        0xE9, 0x8D, 0x57, 0x93, 0x57, 0x93, 0x96, 0x99, 0x96, 0x99, 0x97, 0xA0, 0x97, 0xA0, 0x4F, 0xA8, 0x4F, 0xA8,
-        0xAF, 0xB0, 0xAF, 0xB0, 0xA6, 0xB9, 0xA6, 0xB9, 0x23, 0xC3, 0x23, 0xC3, 0x14, 0xCD, 0x14, 0xCD, 0x67, 0xD7,
-        0x67, 0xD7, 0x07, 0xE2, 0x07, 0xE2, 0xE0, 0xEC, 0xE0, 0xEC, 0xDE, 0xF7, 0xDE, 0xF7, 0xEB, 0x02, 0xEB, 0x02,
-        0xF3, 0x0D, 0xF3, 0x0D, 0xE1, 0x18, 0xE1, 0x18, 0x9E, 0x23, 0x9E, 0x23, 0x18, 0x2E, 0x18, 0x2E, 0x39, 0x38,
-        0x39, 0x38, 0xF0, 0x41, 0xF0, 0x41, 0x29, 0x4B, 0x29, 0x4B, 0xD1, 0x53, 0xD1, 0x53, 0xDA, 0x5B, 0xDA, 0x5B,
-        0x33, 0x63, 0x33, 0x63, 0xD0, 0x69, 0xD0, 0x69, 0xA1, 0x6F, 0xA1, 0x6F, 0x9F, 0x74, 0x9F, 0x74, 0xBC, 0x78,
-        0xBC, 0x78, 0xF5, 0x7B, 0xF5, 0x7B, 0x3F, 0x7E, 0x3F, 0x7E, 0x99, 0x7F, 0x99, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F,
-        0x71, 0x7F, 0x71, 0x7F, 0xEF, 0x7D, 0xEF, 0x7D, 0x7D, 0x7B, 0x7D, 0x7B, 0x1E, 0x78, 0x1E, 0x78, 0xDB, 0x73,
-        0xDB, 0x73, 0xBB, 0x6E, 0xBB, 0x6E, 0xC7, 0x68, 0xC7, 0x68, 0x0B, 0x62, 0x0B, 0x62, 0x93, 0x5A, 0x93, 0x5A,
-        0x6F, 0x52, 0x6F, 0x52, 0xAE, 0x49, 0xAE, 0x49, 0x5F, 0x40, 0x5F, 0x40, 0x96, 0x36, 0x96, 0x36, 0x64, 0x2C,
-        0x64, 0x2C, 0xDE, 0x21, 0xDE, 0x21, 0x17, 0x17, 0x17, 0x17, 0x23, 0x0C, 0x23, 0x0C, 0x1A, 0x01, 0x1A, 0x01,
-        0x0E, 0xF6, 0x0E, 0xF6, 0x14, 0xEB, 0x14, 0xEB, 0x43, 0xE0, 0x43, 0xE0, 0xAE, 0xD5, 0xAE, 0xD5, 0x6A, 0xCB,
-        0x6A, 0xCB, 0x8B, 0xC1, 0x8B, 0xC1, 0x22, 0xB8, 0x22, 0xB8, 0x43, 0xAF, 0x43, 0xAF, 0xFE, 0xA6, 0xFE, 0xA6,
-        0x63, 0x9F, 0x63, 0x9F, 0x81, 0x98, 0x81, 0x98, 0x64, 0x92, 0x64, 0x92, 0x19, 0x8D, 0x19, 0x8D, 0xA9, 0x88,
-        0xA9, 0x88, 0x1D, 0x85, 0x1D, 0x85, 0x7A, 0x82, 0x7A, 0x82, 0xC9, 0x80, 0xC9, 0x80, 0x0A, 0x80, 0x0A, 0x80,
-        0x40, 0x80, 0x40, 0x80, 0x68, 0x81, 0x68, 0x81, 0x84, 0x83, 0x84, 0x83, 0x8D, 0x86, 0x8D, 0x86, 0x7E, 0x8A,
-        0x7E, 0x8A, 0x4F, 0x8F, 0x4F, 0x8F, 0xF7, 0x94, 0xF7, 0x94, 0x6C, 0x9B, 0x6C, 0x9B, 0xA1, 0xA2, 0xA1, 0xA2,
-        0x88, 0xAA, 0x88, 0xAA, 0x12, 0xB3, 0x12, 0xB3, 0x2F, 0xBC, 0x2F, 0xBC, 0xCE, 0xC5, 0xCE, 0xC5, 0xDC, 0xCF,
-        0xDC, 0xCF, 0x46, 0xDA, 0x46, 0xDA, 0xF8, 0xE4, 0xF8, 0xE4, 0xDD, 0xEF, 0xDD, 0xEF, 0xE1, 0xFA, 0xE1, 0xFA,
-        0xEE, 0x05, 0xEE, 0x05, 0xF2, 0x10, 0xF2, 0x10, 0xD4, 0x1B, 0xD4, 0x1B, 0x81, 0x26, 0x81, 0x26, 0xE4, 0x30,
-        0xE4, 0x30, 0xEB, 0x3A, 0xEB, 0x3A, 0x81, 0x44, 0x81, 0x44, 0x94, 0x4D, 0x94, 0x4D, 0x13, 0x56, 0x13, 0x56,
-        0xED, 0x5D, 0xED, 0x5D, 0x14, 0x65, 0x14, 0x65, 0x7B, 0x6B, 0x7B, 0x6B, 0x13, 0x71, 0x13, 0x71, 0xD5, 0x75,
-        0xD5, 0x75, 0xB4, 0x79, 0xB4, 0x79, 0xAC, 0x7C, 0xAC, 0x7C, 0xB5, 0x7E, 0xB5, 0x7E, 0xCD, 0x7F, 0xCD, 0x7F,
-        0xF1, 0x7F, 0xF1, 0x7F, 0x1F, 0x7F, 0x1F, 0x7F, 0x5C, 0x7D, 0x5C, 0x7D, 0xA9, 0x7A, 0xA9, 0x7A, 0x0C, 0x77,
-        0x0C, 0x77, 0x8B, 0x72, 0x8B, 0x72, 0x30, 0x6D, 0x30, 0x6D, 0x04, 0x67, 0x04, 0x67, 0x14, 0x60, 0x14, 0x60,
-        0x6B, 0x58, 0x6B, 0x58, 0x1B, 0x50, 0x1B, 0x50, 0x31, 0x47, 0x31, 0x47, 0xBF, 0x3D, 0xBF, 0x3D, 0xD7, 0x33,
-        0xD7, 0x33, 0x8D, 0x29, 0x8D, 0x29, 0xF3, 0x1E, 0xF3, 0x1E, 0x1E, 0x14, 0x1E, 0x14, 0x22, 0x09, 0x22, 0x09,
-        0x16, 0xFE, 0x16, 0xFE, 0x0D, 0xF3, 0x0D, 0xF3, 0x1D, 0xE8, 0x1D, 0xE8, 0x5A, 0xDD, 0x5A, 0xDD, 0xD8, 0xD2,
-        0xD8, 0xD2, 0xAE, 0xC8, 0xAE, 0xC8, 0xED, 0xBE, 0xED, 0xBE, 0xA9, 0xB5, 0xA9, 0xB5, 0xF1, 0xAC, 0xF1, 0xAC,
-        0xDA, 0xA4, 0xDA, 0xA4, 0x70, 0x9D, 0x70, 0x9D, 0xC2, 0x96, 0xC2, 0x96, 0xDD, 0x90, 0xDD, 0x90, 0xCD, 0x8B,
-        0xCD, 0x8B, 0x9A, 0x87, 0x9A, 0x87, 0x4D, 0x84, 0x4D, 0x84, 0xEC, 0x81, 0xEC, 0x81, 0x7D, 0x80, 0x7D, 0x80,
-        0x00, 0x80, 0x00, 0x80, 0x78, 0x80, 0x78, 0x80, 0xE4, 0x81, 0xE4, 0x81, 0x40, 0x84, 0x40, 0x84, 0x89, 0x87,
-        0x89, 0x87, 0xB8, 0x8B, 0xB8, 0x8B, 0xC5, 0x90, 0xC5, 0x90, 0xA6, 0x96, 0xA6, 0x96, 0x51, 0x9D, 0x51, 0x9D,
-        0xB7, 0xA4, 0xB7, 0xA4, 0xCD, 0xAC, 0xCD, 0xAC, 0x81, 0xB5, 0x81, 0xB5, 0xC3, 0xBE, 0xC3, 0xBE, 0x82, 0xC8,
-        0x82, 0xC8, 0xAB, 0xD2, 0xAB, 0xD2, 0x2B, 0xDD, 0x2B, 0xDD, 0xEC, 0xE7, 0xEC, 0xE7, 0xDD, 0xF2, 0xDD, 0xF2,
-        0xE5, 0xFD, 0xE5, 0xFD, 0xF1, 0x08, 0xF1, 0x08, 0xED, 0x13, 0xED, 0x13, 0xC3, 0x1E, 0xC3, 0x1E, 0x5E, 0x29,
-        0x5E, 0x29, 0xAB, 0x33, 0xAB, 0x33, 0x94, 0x3D, 0x94, 0x3D, 0x08, 0x47, 0x08, 0x47, 0xF4, 0x4F, 0xF4, 0x4F,
-        0x48, 0x58, 0x48, 0x58, 0xF3, 0x5F, 0xF3, 0x5F, 0xE7, 0x66, 0xE7, 0x66, 0x16, 0x6D, 0x16, 0x6D, 0x75, 0x72,
-        0x75, 0x72, 0xF9, 0x76, 0xF9, 0x76, 0x9B, 0x7A, 0x9B, 0x7A, 0x52, 0x7D, 0x52, 0x7D, 0x1A, 0x7F, 0x1A, 0x7F,
-        0xEF, 0x7F, 0xEF, 0x7F, 0xCF, 0x7F, 0xCF, 0x7F, 0xBC, 0x7E, 0xBC, 0x7E, 0xB7, 0x7C, 0xB7, 0x7C, 0xC3, 0x79,
-        0xC3, 0x79, 0xE7, 0x75, 0xE7, 0x75, 0x2A, 0x71, 0x2A, 0x71, 0x95, 0x6B, 0x95, 0x6B, 0x33, 0x65, 0x33, 0x65,
-        0x0E, 0x5E, 0x0E, 0x5E, 0x37, 0x56, 0x37, 0x56, 0xBB, 0x4D, 0xBB, 0x4D, 0xAA, 0x44, 0xAA, 0x44, 0x16, 0x3B,
-        0x16, 0x3B, 0x12, 0x31, 0x12, 0x31, 0xB0, 0x26, 0xB0, 0x26, 0x03, 0x1C, 0x03, 0x1C, 0x22, 0x11, 0x22, 0x11,
-        0x20, 0x06, 0x20, 0x06, 0x12, 0xFB, 0x12, 0xFB, 0x0E, 0xF0, 0x0E, 0xF0, 0x28, 0xE5, 0x28, 0xE5, 0x75, 0xDA,
-        0x75, 0xDA, 0x0A, 0xD0, 0x0A, 0xD0, 0xFA, 0xC5, 0xFA, 0xC5, 0x59, 0xBC, 0x59, 0xBC, 0x3A, 0xB3, 0x3A, 0xB3,
-        0xAD, 0xAA, 0xAD, 0xAA, 0xC2, 0xA2, 0xC2, 0xA2, 0x8A, 0x9B, 0x8A, 0x9B, 0x12, 0x95, 0x12, 0x95, 0x66, 0x8F,
-        0x66, 0x8F, 0x91, 0x8A, 0x91, 0x8A, 0x9D, 0x86, 0x9D, 0x86, 0x8F, 0x83, 0x8F, 0x83, 0x71, 0x81, 0x71, 0x81,
-        0x42, 0x80, 0x42, 0x80, 0x09, 0x80, 0x09, 0x80, 0xC3, 0x80, 0xC3, 0x80, 0x71, 0x82, 0x71, 0x82, 0x0E, 0x85,
-        0x0E, 0x85, 0x97, 0x88, 0x97, 0x88, 0x03, 0x8D, 0x03, 0x8D, 0x4B, 0x92, 0x4B, 0x92, 0x64, 0x98, 0x64, 0x98,
-        0x43, 0x9F, 0x43, 0x9F, 0xDB, 0xA6, 0xDB, 0xA6, 0x1D, 0xAF, 0x1D, 0xAF, 0xFA, 0xB7, 0xFA, 0xB7, 0x60, 0xC1,
-        0x60, 0xC1, 0x3E, 0xCB, 0x3E, 0xCB, 0x80, 0xD5, 0x80, 0xD5, 0x14, 0xE0, 0x14, 0xE0, 0xE4, 0xEA, 0xE4, 0xEA,
-        0xDD, 0xF5, 0xDD, 0xF5, 0xE9, 0x00, 0xE9, 0x00, 0xF3, 0x0B, 0xF3, 0x0B, 0xE7, 0x16, 0xE7, 0x16, 0xAE, 0x21,
-        0xAE, 0x21, 0x36, 0x2C, 0x36, 0x2C, 0x69, 0x36, 0x69, 0x36, 0x35, 0x40, 0x35, 0x40, 0x85, 0x49, 0x85, 0x49,
-        0x4A, 0x52, 0x4A, 0x52, 0x71, 0x5A, 0x71, 0x5A, 0xEB, 0x61, 0xEB, 0x61, 0xAA, 0x68, 0xAA, 0x68, 0xA2, 0x6E,
-        0xA2, 0x6E, 0xC6, 0x73, 0xC6, 0x73, 0x0E, 0x78, 0x0E, 0x78, 0x70, 0x7B, 0x70, 0x7B, 0xE7, 0x7D, 0xE7, 0x7D,
-        0x6C, 0x7F, 0x6C, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x47, 0x7E, 0x47, 0x7E, 0x00, 0x7C,
-        0x00, 0x7C, 0xCD, 0x78, 0xCD, 0x78, 0xB2, 0x74, 0xB2, 0x74, 0xBA, 0x6F, 0xBA, 0x6F, 0xEB, 0x69, 0xEB, 0x69,
-        0x53, 0x63, 0x53, 0x63, 0xFC, 0x5B, 0xFC, 0x5B, 0xF6, 0x53, 0xF6, 0x53, 0x50, 0x4B, 0x50, 0x4B, 0x1A, 0x42,
-        0x1A, 0x42, 0x66, 0x38, 0x66, 0x38, 0x46, 0x2E, 0x46, 0x2E, 0xCD, 0x23, 0xCD, 0x23, 0x10, 0x19, 0x10, 0x19,
-        0x24, 0x0E, 0x24, 0x0E, 0x1C, 0x03, 0x1C, 0x03, 0x10, 0xF8, 0x10, 0xF8, 0x11, 0xED, 0x11, 0xED, 0x37, 0xE2,
-        0x37, 0xE2, 0x95, 0xD7, 0x95, 0xD7, 0x41, 0xCD, 0x41, 0xCD, 0x4E, 0xC3, 0x4E, 0xC3, 0xCE, 0xB9, 0xCE, 0xB9,
-        0xD5, 0xB0, 0xD5, 0xB0, 0x73, 0xA8, 0x73, 0xA8, 0xB8, 0xA0, 0xB8, 0xA0, 0xB3, 0x99, 0xB3, 0x99, 0x71, 0x93,
-        0x71, 0x93, 0xFF, 0x8D, 0xFF, 0x8D, 0x67, 0x89, 0x67, 0x89, 0xB0, 0x85, 0xB0, 0x85, 0xE4, 0x82, 0xE4, 0x82,
-        0x05, 0x81, 0x05, 0x81, 0x1B, 0x80, 0x1B, 0x80, 0x23, 0x80, 0x23, 0x80, 0x21, 0x81, 0x21, 0x81, 0x10, 0x83,
-        0x10, 0x83, 0xEE, 0x85, 0xEE, 0x85, 0xB5, 0x89, 0xB5, 0x89, 0x5E, 0x8E, 0x5E, 0x8E, 0xE0, 0x93, 0xE0, 0x93,
-        0x31, 0x9A, 0x31, 0x9A, 0x44, 0xA1, 0x44, 0xA1, 0x0B, 0xA9, 0x0B, 0xA9, 0x79, 0xB1, 0x79, 0xB1, 0x7D, 0xBA,
-        0x7D, 0xBA, 0x06, 0xC4, 0x06, 0xC4, 0x01, 0xCE, 0x01, 0xCE, 0x5B, 0xD8, 0x5B, 0xD8, 0x01, 0xE3, 0x01, 0xE3,
-        0xDF, 0xED, 0xDF, 0xED, 0xE0, 0xF8, 0xE0, 0xF8, 0xED, 0x03, 0xED, 0x03, 0xF3, 0x0E, 0xF3, 0x0E, 0xDD, 0x19,
-        0xDD, 0x19, 0x95, 0x24, 0x95, 0x24, 0x07, 0x2F, 0x07, 0x2F, 0x20, 0x39, 0x20, 0x39, 0xCC, 0x42, 0xCC, 0x42,
-        0xF8, 0x4B, 0xF8, 0x4B, 0x93, 0x54, 0x93, 0x54, 0x8D, 0x5C, 0x8D, 0x5C, 0xD5, 0x63, 0xD5, 0x63, 0x60, 0x6A,
-        0x60, 0x6A, 0x1F, 0x70, 0x1F, 0x70, 0x08, 0x75, 0x08, 0x75, 0x11, 0x79, 0x11, 0x79, 0x34, 0x7C, 0x34, 0x7C,
-        0x68, 0x7E, 0x68, 0x7E, 0xAD, 0x7F, 0xAD, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0x58, 0x7F, 0x58, 0x7F, 0xC0, 0x7D,
-        0xC0, 0x7D, 0x38, 0x7B, 0x38, 0x7B, 0xC5, 0x77, 0xC5, 0x77, 0x6D, 0x73, 0x6D, 0x73, 0x39, 0x6E, 0x39, 0x6E,
-        0x32, 0x68, 0x32, 0x68, 0x65, 0x61, 0x65, 0x61, 0xDD, 0x59, 0xDD, 0x59, 0xAA, 0x51, 0xAA, 0x51, 0xDB, 0x48,
-        0xDB, 0x48, 0x80, 0x3F, 0x80, 0x3F, 0xAD, 0x35, 0xAD, 0x35, 0x72, 0x2B, 0x72, 0x2B, 0xE5, 0x20, 0xE5, 0x20,
-        0x19, 0x16, 0x19, 0x16, 0x23, 0x0B, 0x23, 0x0B, 0x18, 0x00, 0x18, 0x00, 0x0D, 0xF5, 0x0D, 0xF5, 0x17, 0xEA,
-        0x17, 0xEA, 0x4A, 0xDF, 0x4A, 0xDF, 0xBC, 0xD4, 0xBC, 0xD4, 0x80, 0xCA, 0x80, 0xCA, 0xAA, 0xC0, 0xAA, 0xC0,
-        0x4E, 0xB7, 0x4E, 0xB7, 0x7C, 0xAE, 0x7C, 0xAE, 0x47, 0xA6, 0x47, 0xA6, 0xBC, 0x9E, 0xBC, 0x9E, 0xEB, 0x97,
-        0xEB, 0x97, 0xE0, 0x91, 0xE0, 0x91, 0xA8, 0x8C, 0xA8, 0x8C, 0x4C, 0x88, 0x4C, 0x88, 0xD5, 0x84, 0xD5, 0x84,
-        0x49, 0x82, 0x49, 0x82, 0xAE, 0x80, 0xAE, 0x80, 0x05, 0x80, 0x05, 0x80, 0x51, 0x80, 0x51, 0x80, 0x90, 0x81,
-        0x90, 0x81, 0xC1, 0x83, 0xC1, 0x83, 0xDF, 0x86, 0xDF, 0x86, 0xE5, 0x8A, 0xE5, 0x8A, 0xCA, 0x8F, 0xCA, 0x8F,
-        0x85, 0x95, 0x85, 0x95, 0x0C, 0x9C, 0x0C, 0x9C, 0x52, 0xA3, 0x52, 0xA3, 0x48, 0xAB, 0x48, 0xAB, 0xE1, 0xB3,
-        0xE1, 0xB3, 0x0A, 0xBD, 0x0A, 0xBD, 0xB4, 0xC6, 0xB4, 0xC6, 0xCB, 0xD0, 0xCB, 0xD0, 0x3C, 0xDB, 0x3C, 0xDB,
-        0xF4, 0xE5, 0xF4, 0xE5, 0xDD, 0xF0, 0xDD, 0xF0, 0xE3, 0xFB, 0xE3, 0xFB, 0xEF, 0x06, 0xEF, 0x06, 0xF0, 0x11,
-        0xF0, 0x11, 0xCF, 0x1C, 0xCF, 0x1C, 0x76, 0x27, 0x76, 0x27, 0xD2, 0x31, 0xD2, 0x31, 0xCF, 0x3B, 0xCF, 0x3B,
-        0x5A, 0x45, 0x5A, 0x45, 0x60, 0x4E, 0x60, 0x4E, 0xD1, 0x56, 0xD1, 0x56, 0x9B, 0x5E, 0x9B, 0x5E, 0xB2, 0x65,
-        0xB2, 0x65, 0x05, 0x6C, 0x05, 0x6C, 0x8B, 0x71, 0x8B, 0x71, 0x38, 0x76, 0x38, 0x76, 0x03, 0x7A, 0x03, 0x7A,
-        0xE5, 0x7C, 0xE5, 0x7C, 0xD9, 0x7E, 0xD9, 0x7E, 0xDA, 0x7F, 0xDA, 0x7F, 0xE7, 0x7F, 0xE7, 0x7F, 0x00, 0x7F,
-        0x00, 0x7F, 0x27, 0x7D, 0x27, 0x7D, 0x5E, 0x7A, 0x5E, 0x7A, 0xAC, 0x76, 0xAC, 0x76, 0x17, 0x72, 0x17, 0x72,
-        0xA9, 0x6C, 0xA9, 0x6C, 0x6A, 0x66, 0x6A, 0x66, 0x69, 0x5F, 0x69, 0x5F, 0xB1, 0x57, 0xB1, 0x57, 0x51, 0x4F,
-        0x51, 0x4F, 0x5A, 0x46, 0x5A, 0x46, 0xDD, 0x3C, 0xDD, 0x3C, 0xEC, 0x32, 0xEC, 0x32, 0x99, 0x28, 0x99, 0x28,
-        0xF9, 0x1D, 0xF9, 0x1D, 0x20, 0x13, 0x20, 0x13, 0x21, 0x08, 0x21, 0x08, 0x15, 0xFD, 0x15, 0xFD, 0x0D, 0xF2,
-        0x0D, 0xF2, 0x20, 0xE7, 0x20, 0xE7, 0x62, 0xDC, 0x62, 0xDC, 0xE8, 0xD1, 0xE8, 0xD1, 0xC7, 0xC7, 0xC7, 0xC7,
-        0x10, 0xBE, 0x10, 0xBE, 0xD8, 0xB4, 0xD8, 0xB4, 0x2F, 0xAC, 0x2F, 0xAC, 0x26, 0xA4, 0x26, 0xA4, 0xCD, 0x9C,
-        0xCD, 0x9C, 0x30, 0x96, 0x30, 0x96, 0x5F, 0x90, 0x5F, 0x90, 0x62, 0x8B, 0x62, 0x8B, 0x44, 0x87, 0x44, 0x87,
-        0x0C, 0x84, 0x0C, 0x84, 0xC1, 0x81, 0xC1, 0x81, 0x67, 0x80, 0x67, 0x80, 0x01, 0x80, 0x01, 0x80, 0x8F, 0x80,
-        0x8F, 0x80, 0x11, 0x82, 0x11, 0x82, 0x83, 0x84, 0x83, 0x84, 0xE1, 0x87, 0xE1, 0x87, 0x24, 0x8C, 0x24, 0x8C,
-        0x46, 0x91, 0x46, 0x91, 0x39, 0x97, 0x39, 0x97, 0xF5, 0x9D, 0xF5, 0x9D, 0x6D, 0xA5, 0x6D, 0xA5, 0x91, 0xAD,
-        0x91, 0xAD, 0x53, 0xB6, 0x53, 0xB6, 0xA1, 0xBF, 0xA1, 0xBF, 0x6A, 0xC9, 0x6A, 0xC9, 0x9C, 0xD3, 0x9C, 0xD3,
-        0x22, 0xDE, 0x22, 0xDE, 0xEA, 0xE8, 0xEA, 0xE8, 0xDD, 0xF3, 0xDD, 0xF3, 0xE6, 0xFE, 0xE6, 0xFE, 0xF2, 0x09,
-        0xF2, 0x09, 0xEB, 0x14, 0xEB, 0x14, 0xBD, 0x1F, 0xBD, 0x1F, 0x52, 0x2A, 0x52, 0x2A, 0x96, 0x34, 0x96, 0x34,
-        0x75, 0x3E, 0x75, 0x3E, 0xDD, 0x47, 0xDD, 0x47, 0xBD, 0x50, 0xBD, 0x50, 0x02, 0x59, 0x02, 0x59, 0x9D, 0x60,
-        0x9D, 0x60, 0x7F, 0x67, 0x7F, 0x67, 0x9C, 0x6D, 0x9C, 0x6D, 0xE7, 0x72, 0xE7, 0x72, 0x57, 0x77, 0x57, 0x77,
-        0xE4, 0x7A, 0xE4, 0x7A, 0x86, 0x7D, 0x86, 0x7D, 0x37, 0x7F, 0x37, 0x7F, 0xF6, 0x7F, 0xF6, 0x7F, 0xC0, 0x7F,
-        0xC0, 0x7F, 0x97, 0x7E, 0x97, 0x7E, 0x7C, 0x7C, 0x7C, 0x7C, 0x73, 0x79, 0x73, 0x79, 0x82, 0x75, 0x82, 0x75,
-        0xB1, 0x70, 0xB1, 0x70, 0x09, 0x6B, 0x09, 0x6B, 0x94, 0x64, 0x94, 0x64, 0x5F, 0x5D, 0x5F, 0x5D, 0x78, 0x55,
-        0x78, 0x55, 0xED, 0x4C, 0xED, 0x4C, 0xD1, 0x43, 0xD1, 0x43, 0x32, 0x3A, 0x32, 0x3A, 0x24, 0x30, 0x24, 0x30,
-        0xBA, 0x25, 0xBA, 0x25, 0x08, 0x1B, 0x08, 0x1B, 0x23, 0x10, 0x23, 0x10, 0x1E, 0x05, 0x1E, 0x05, 0x11, 0xFA,
-        0x11, 0xFA, 0x0F, 0xEF, 0x0F, 0xEF, 0x2C, 0xE4, 0x2C, 0xE4, 0x7F, 0xD9, 0x7F, 0xD9, 0x1B, 0xCF, 0x1B, 0xCF,
-        0x15, 0xC5, 0x15, 0xC5, 0x7F, 0xBB, 0x7F, 0xBB, 0x6C, 0xB2, 0x6C, 0xB2, 0xED, 0xA9, 0xED, 0xA9, 0x13, 0xA2,
-        0x13, 0xA2, 0xEC, 0x9A, 0xEC, 0x9A, 0x85, 0x94, 0x85, 0x94, 0xED, 0x8E, 0xED, 0x8E, 0x2C, 0x8A, 0x2C, 0x8A,
-        0x4C, 0x86, 0x4C, 0x86, 0x54, 0x83, 0x54, 0x83, 0x4B, 0x81, 0x4B, 0x81, 0x34, 0x80, 0x34, 0x80, 0x10, 0x80,
-        0x10, 0x80, 0xE1, 0x80, 0xE1, 0x80, 0xA4, 0x82, 0xA4, 0x82, 0x57, 0x85, 0x57, 0x85, 0xF4, 0x88, 0xF4, 0x88,
-        0x75, 0x8D, 0x75, 0x8D, 0xD0, 0x92, 0xD0, 0x92, 0xFC, 0x98, 0xFC, 0x98, 0xED, 0x9F, 0xED, 0x9F, 0x94, 0xA7,
-        0x94, 0xA7, 0xE5, 0xAF, 0xE5, 0xAF, 0xD0, 0xB8, 0xD0, 0xB8, 0x41, 0xC2, 0x41, 0xC2, 0x29, 0xCC, 0x29, 0xCC,
-        0x73, 0xD6, 0x73, 0xD6, 0x0D, 0xE1, 0x0D, 0xE1, 0xE2, 0xEB, 0xE2, 0xEB, 0xDE, 0xF6, 0xDE, 0xF6, 0xEA, 0x01,
-        0xEA, 0x01, 0xF3, 0x0C, 0xF3, 0x0C, 0xE4, 0x17, 0xE4, 0x17, 0xA6, 0x22, 0xA6, 0x22, 0x27, 0x2D, 0x27, 0x2D,
-        0x52, 0x37, 0x52, 0x37, 0x13, 0x41, 0x13, 0x41, 0x57, 0x4A, 0x57, 0x4A, 0x0E, 0x53, 0x0E, 0x53, 0x26, 0x5B,
-        0x26, 0x5B, 0x90, 0x62, 0x90, 0x62, 0x3E, 0x69, 0x3E, 0x69, 0x23, 0x6F, 0x23, 0x6F, 0x33, 0x74, 0x33, 0x74,
-        0x66, 0x78, 0x66, 0x78, 0xB3, 0x7B, 0xB3, 0x7B, 0x14, 0x7E, 0x14, 0x7E, 0x83, 0x7F, 0x83, 0x7F, 0xFF, 0x7F,
-        0xFF, 0x7F, 0x88, 0x7F, 0x88, 0x7F, 0x1C, 0x7E, 0x1C, 0x7E, 0xBF, 0x7B, 0xBF, 0x7B, 0x77, 0x78, 0x77, 0x78,
-        0x48, 0x74, 0x48, 0x74, 0x3B, 0x6F, 0x3B, 0x6F, 0x5A, 0x69, 0x5A, 0x69, 0xAF, 0x62, 0xAF, 0x62, 0x49, 0x5B,
-        0x49, 0x5B, 0x33, 0x53, 0x33, 0x53, 0x80, 0x4A, 0x80, 0x4A, 0x3D, 0x41, 0x3D, 0x41, 0x7E, 0x37, 0x7E, 0x37,
-        0x55, 0x2D, 0x55, 0x2D, 0xD6, 0x22, 0xD6, 0x22, 0x14, 0x18, 0x14, 0x18, 0x24, 0x0D, 0x24, 0x0D, 0x1B, 0x02,
-        0x1B, 0x02, 0x0E, 0xF7, 0x0E, 0xF7, 0x13, 0xEC, 0x13, 0xEC, 0x3D, 0xE1, 0x3D, 0xE1, 0xA2, 0xD6, 0xA2, 0xD6,
-        0x55, 0xCC, 0x55, 0xCC, 0x6C, 0xC2, 0x6C, 0xC2, 0xF8, 0xB8, 0xF8, 0xB8, 0x0C, 0xB0, 0x0C, 0xB0, 0xB8, 0xA7,
-        0xB8, 0xA7, 0x0D, 0xA0, 0x0D, 0xA0, 0x19, 0x99, 0x19, 0x99, 0xEA, 0x92, 0xEA, 0x92, 0x8B, 0x8D, 0x8B, 0x8D,
-        0x07, 0x89, 0x07, 0x89, 0x65, 0x85, 0x65, 0x85, 0xAE, 0x82, 0xAE, 0x82, 0xE6, 0x80, 0xE6, 0x80, 0x11, 0x80,
-        0x11, 0x80, 0x30, 0x80, 0x30, 0x80, 0x44, 0x81, 0x44, 0x81, 0x49, 0x83, 0x49, 0x83, 0x3D, 0x86, 0x3D, 0x86,
-        0x18, 0x8A, 0x18, 0x8A, 0xD6, 0x8E, 0xD6, 0x8E, 0x6B, 0x94, 0x6B, 0x94, 0xCD, 0x9A, 0xCD, 0x9A, 0xF2, 0xA1,
-        0xF2, 0xA1, 0xC9, 0xA9, 0xC9, 0xA9, 0x45, 0xB2, 0x45, 0xB2, 0x55, 0xBB, 0x55, 0xBB, 0xE9, 0xC4, 0xE9, 0xC4,
-        0xEE, 0xCE, 0xEE, 0xCE, 0x50, 0xD9, 0x50, 0xD9, 0xFC, 0xE3, 0xFC, 0xE3, 0xDE, 0xEE, 0xDE, 0xEE, 0xE0, 0xF9,
-        0xE0, 0xF9, 0xEE, 0x04, 0xEE, 0x04, 0xF2, 0x0F, 0xF2, 0x0F, 0xD9, 0x1A, 0xD9, 0x1A, 0x8B, 0x25, 0x8B, 0x25,
-        0xF6, 0x2F, 0xF6, 0x2F, 0x06, 0x3A, 0x06, 0x3A, 0xA7, 0x43, 0xA7, 0x43, 0xC6, 0x4C, 0xC6, 0x4C, 0x54, 0x55,
-        0x54, 0x55, 0x3E, 0x5D, 0x3E, 0x5D, 0x76, 0x64, 0x76, 0x64, 0xEE, 0x6A, 0xEE, 0x6A, 0x9A, 0x70, 0x9A, 0x70,
-        0x6F, 0x75, 0x6F, 0x75, 0x63, 0x79, 0x63, 0x79, 0x71, 0x7C, 0x71, 0x7C, 0x90, 0x7E, 0x90, 0x7E, 0xBE, 0x7F,
-        0xBE, 0x7F, 0xF7, 0x7F, 0xF7, 0x7F, 0x3C, 0x7F, 0x3C, 0x7F, 0x8F, 0x7D, 0x8F, 0x7D, 0xF1, 0x7A, 0xF1, 0x7A,
-        0x69, 0x77, 0x69, 0x77, 0xFD, 0x72, 0xFD, 0x72, 0xB5, 0x6D, 0xB5, 0x6D, 0x9C, 0x67, 0x9C, 0x67, 0xBD, 0x60,
-        0xBD, 0x60, 0x25, 0x59, 0x25, 0x59, 0xE3, 0x50, 0xE3, 0x50, 0x06, 0x48, 0x06, 0x48, 0xA0, 0x3E, 0xA0, 0x3E,
-        0xC3, 0x34, 0xC3, 0x34, 0x80, 0x2A, 0x80, 0x2A, 0xEC, 0x1F, 0xEC, 0x1F, 0x1C, 0x15, 0x1C, 0x15, 0x23, 0x0A,
-        0x23, 0x0A, 0x18, 0xFF, 0x18, 0xFF, 0x0D, 0xF4, 0x0D, 0xF4, 0x19, 0xE9, 0x19, 0xE9, 0x51, 0xDE, 0x51, 0xDE,
-        0xCA, 0xD3, 0xCA, 0xD3, 0x97, 0xC9, 0x97, 0xC9, 0xCB, 0xBF, 0xCB, 0xBF, 0x7B, 0xB6, 0x7B, 0xB6, 0xB6, 0xAD,
-        0xB6, 0xAD, 0x8F, 0xA5, 0x8F, 0xA5, 0x15, 0x9E, 0x15, 0x9E, 0x55, 0x97, 0x55, 0x97, 0x5E, 0x91, 0x5E, 0x91,
-        0x39, 0x8C, 0x39, 0x8C, 0xF2, 0x87, 0xF2, 0x87, 0x90, 0x84, 0x90, 0x84, 0x1A, 0x82, 0x1A, 0x82, 0x94, 0x80,
-        0x94, 0x80, 0x01, 0x80, 0x01, 0x80, 0x64, 0x80, 0x64, 0x80, 0xB9, 0x81, 0xB9, 0x81, 0x00, 0x84, 0x00, 0x84,
-        0x33, 0x87, 0x33, 0x87, 0x4E, 0x8B, 0x4E, 0x8B, 0x46, 0x90, 0x46, 0x90, 0x15, 0x96, 0x15, 0x96, 0xAD, 0x9C,
-        0xAD, 0x9C, 0x04, 0xA4, 0x04, 0xA4, 0x09, 0xAC, 0x09, 0xAC, 0xB0, 0xB4, 0xB0, 0xB4, 0xE7, 0xBD, 0xE7, 0xBD,
-        0x9A, 0xC7, 0x9A, 0xC7, 0xBA, 0xD1, 0xBA, 0xD1, 0x33, 0xDC, 0x33, 0xDC, 0xF0, 0xE6, 0xF0, 0xE6, 0xDC, 0xF1,
-        0xDC, 0xF1, 0xE4, 0xFC, 0xE4, 0xFC, 0xF1, 0x07, 0xF1, 0x07, 0xEF, 0x12, 0xEF, 0x12, 0xC9, 0x1D, 0xC9, 0x1D,
-        0x6A, 0x28, 0x6A, 0x28, 0xBF, 0x32, 0xBF, 0x32, 0xB2, 0x3C, 0xB2, 0x3C, 0x31, 0x46, 0x31, 0x46, 0x2B, 0x4F,
-        0x2B, 0x4F, 0x8D, 0x57, 0x8D, 0x57, 0x48, 0x5F, 0x48, 0x5F, 0x4D, 0x66, 0x4D, 0x66, 0x8E, 0x6C, 0x8E, 0x6C,
-        0x01, 0x72, 0x01, 0x72, 0x9A, 0x76, 0x9A, 0x76, 0x50, 0x7A, 0x50, 0x7A, 0x1C, 0x7D, 0x1C, 0x7D, 0xFA, 0x7E,
-        0xFA, 0x7E, 0xE5, 0x7F, 0xE5, 0x7F, 0xDD, 0x7F, 0xDD, 0x7F, 0xDF, 0x7E, 0xDF, 0x7E, 0xF0, 0x7C, 0xF0, 0x7C,
-        0x12, 0x7A, 0x12, 0x7A, 0x4B, 0x76, 0x4B, 0x76, 0xA1, 0x71, 0xA1, 0x71, 0x20, 0x6C, 0x20, 0x6C, 0xCF, 0x65,
-        0xCF, 0x65, 0xBC, 0x5E, 0xBC, 0x5E, 0xF4, 0x56, 0xF4, 0x56, 0x87, 0x4E, 0x87, 0x4E, 0x83, 0x45, 0x83, 0x45,
-        0xFA, 0x3B, 0xFA, 0x3B, 0xFF, 0x31, 0xFF, 0x31, 0xA5, 0x27, 0xA5, 0x27, 0xFE, 0x1C, 0xFE, 0x1C, 0x21, 0x12,
-        0x21, 0x12, 0x21, 0x07, 0x21, 0x07, 0x14, 0xFC, 0x14, 0xFC, 0x0D, 0xF1, 0x0D, 0xF1, 0x23, 0xE6, 0x23, 0xE6,
-        0x6B, 0xDB, 0x6B, 0xDB, 0xF8, 0xD0, 0xF8, 0xD0, 0xE0, 0xC6, 0xE0, 0xC6, 0x34, 0xBD, 0x34, 0xBD, 0x08, 0xB4,
-        0x08, 0xB4, 0x6D, 0xAB, 0x6D, 0xAB, 0x73, 0xA3, 0x73, 0xA3, 0x2B, 0x9C, 0x2B, 0x9C, 0xA1, 0x95, 0xA1, 0x95,
-        0xE1, 0x8F, 0xE1, 0x8F, 0xF8, 0x8A, 0xF8, 0x8A, 0xEF, 0x86, 0xEF, 0x86, 0xCC, 0x83, 0xCC, 0x83, 0x98, 0x81,
-        0x98, 0x81, 0x54, 0x80, 0x54, 0x80, 0x04, 0x80, 0x04, 0x80, 0xA8, 0x80, 0xA8, 0x80, 0x40, 0x82, 0x40, 0x82,
-        0xC8, 0x84, 0xC8, 0x84, 0x3B, 0x88, 0x3B, 0x88, 0x93, 0x8C, 0x93, 0x8C, 0xC7, 0x91, 0xC7, 0x91, 0xCE, 0x97,
-        0xCE, 0x97, 0x9C, 0x9E, 0x9C, 0x9E, 0x23, 0xA6, 0x23, 0xA6, 0x56, 0xAE, 0x56, 0xAE, 0x25, 0xB7, 0x25, 0xB7,
-        0x80, 0xC0, 0x80, 0xC0, 0x53, 0xCA, 0x53, 0xCA, 0x8E, 0xD4, 0x8E, 0xD4, 0x1B, 0xDF, 0x1B, 0xDF, 0xE6, 0xE9,
-        0xE6, 0xE9, 0xDD, 0xF4, 0xDD, 0xF4, 0xE8, 0xFF, 0xE8, 0xFF, 0xF2, 0x0A, 0xF2, 0x0A, 0xE9, 0x15, 0xE9, 0x15,
-        0xB6, 0x20, 0xB6, 0x20, 0x44, 0x2B, 0x44, 0x2B, 0x80, 0x35, 0x80, 0x35, 0x55, 0x3F, 0x55, 0x3F, 0xB2, 0x48,
-        0xB2, 0x48, 0x84, 0x51, 0x84, 0x51, 0xBA, 0x59, 0xBA, 0x59, 0x45, 0x61, 0x45, 0x61, 0x16, 0x68, 0x16, 0x68,
-        0x20, 0x6E, 0x20, 0x6E, 0x58, 0x73, 0x58, 0x73, 0xB4, 0x77, 0xB4, 0x77, 0x2B, 0x7B, 0x2B, 0x7B, 0xB7, 0x7D,
-        0xB7, 0x7D, 0x52, 0x7F, 0x52, 0x7F, 0xFB, 0x7F, 0xFB, 0x7F, 0xAF, 0x7F, 0xAF, 0x7F, 0x70, 0x7E, 0x70, 0x7E,
-        0x3F, 0x7C, 0x3F, 0x7C, 0x21, 0x79, 0x21, 0x79, 0x1B, 0x75, 0x1B, 0x75, 0x37, 0x70, 0x37, 0x70, 0x7A, 0x6A,
-        0x7A, 0x6A, 0xF4, 0x63, 0xF4, 0x63, 0xAE, 0x5C, 0xAE, 0x5C, 0xB8, 0x54, 0xB8, 0x54, 0x20, 0x4C, 0x20, 0x4C,
-        0xF6, 0x42, 0xF6, 0x42, 0x4C, 0x39, 0x4C, 0x39, 0x35, 0x2F, 0x35, 0x2F, 0xC4, 0x24, 0xC4, 0x24, 0x0D, 0x1A,
-        0x0D, 0x1A, 0x23, 0x0F, 0x23, 0x0F, 0x1E, 0x04, 0x1E, 0x04, 0x10, 0xF9, 0x10, 0xF9, 0x10, 0xEE, 0x10, 0xEE,
-        0x32, 0xE3, 0x32, 0xE3, 0x8A, 0xD8, 0x8A, 0xD8, 0x2E, 0xCE, 0x2E, 0xCE, 0x31, 0xC4, 0x31, 0xC4, 0xA6, 0xBA,
-        0xA6, 0xBA, 0xA0, 0xB1, 0xA0, 0xB1, 0x2F, 0xA9, 0x2F, 0xA9, 0x65, 0xA1, 0x65, 0xA1, 0x4F, 0x9A, 0x4F, 0x9A,
-        0xFB, 0x93, 0xFB, 0x93, 0x75, 0x8E, 0x75, 0x8E, 0xC8, 0x89, 0xC8, 0x89, 0xFD, 0x85, 0xFD, 0x85, 0x1B, 0x83,
-        0x1B, 0x83, 0x27, 0x81, 0x27, 0x81, 0x26, 0x80, 0x26, 0x80, 0x18, 0x80, 0x18, 0x80, 0x00, 0x81, 0x00, 0x81,
-        0xD9, 0x82, 0xD9, 0x82, 0xA2, 0x85, 0xA2, 0x85, 0x54, 0x89, 0x54, 0x89, 0xE9, 0x8D, 0xE9, 0x8D, 0x57, 0x93,
-        0x57, 0x93, 0x96, 0x99, 0x96, 0x99, 0x97, 0xA0, 0x97, 0xA0, 0x4F, 0xA8, 0x4F, 0xA8, 0xAF, 0xB0, 0xAF, 0xB0,
-        0xA6, 0xB9, 0xA6, 0xB9, 0x23, 0xC3, 0x23, 0xC3, 0x14, 0xCD, 0x14, 0xCD, 0x67, 0xD7, 0x67, 0xD7, 0x07, 0xE2,
-        0x07, 0xE2, 0xE0, 0xEC, 0xE0, 0xEC, 0xDE, 0xF7, 0xDE, 0xF7, 0xEB, 0x02, 0xEB, 0x02, 0xF3, 0x0D, 0xF3, 0x0D,
-        0xE1, 0x18, 0xE1, 0x18, 0x9E, 0x23, 0x9E, 0x23, 0x18, 0x2E, 0x18, 0x2E, 0x39, 0x38, 0x39, 0x38, 0xF0, 0x41,
-        0xF0, 0x41, 0x29, 0x4B, 0x29, 0x4B, 0xD1, 0x53, 0xD1, 0x53, 0xDA, 0x5B, 0xDA, 0x5B, 0x33, 0x63, 0x33, 0x63,
-        0xD0, 0x69, 0xD0, 0x69, 0xA1, 0x6F, 0xA1, 0x6F, 0x9F, 0x74, 0x9F, 0x74, 0xBC, 0x78, 0xBC, 0x78, 0xF5, 0x7B,
-        0xF5, 0x7B, 0x3F, 0x7E, 0x3F, 0x7E, 0x99, 0x7F, 0x99, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x71, 0x7F, 0x71, 0x7F,
-        0xEF, 0x7D, 0xEF, 0x7D, 0x7D, 0x7B, 0x7D, 0x7B, 0x1E, 0x78, 0x1E, 0x78, 0xDB, 0x73, 0xDB, 0x73, 0xBB, 0x6E,
-        0xBB, 0x6E, 0xC7, 0x68, 0xC7, 0x68, 0x0B, 0x62, 0x0B, 0x62, 0x93, 0x5A, 0x93, 0x5A, 0x6F, 0x52, 0x6F, 0x52,
-        0xAE, 0x49, 0xAE, 0x49, 0x5F, 0x40, 0x5F, 0x40, 0x96, 0x36, 0x96, 0x36, 0x64, 0x2C, 0x64, 0x2C, 0xDE, 0x21,
-        0xDE, 0x21, 0x17, 0x17, 0x17, 0x17, 0x23, 0x0C, 0x23, 0x0C, 0x1A, 0x01, 0x1A, 0x01, 0x0E, 0xF6, 0x0E, 0xF6,
-        0x14, 0xEB, 0x14, 0xEB, 0x43, 0xE0, 0x43, 0xE0, 0xAE, 0xD5, 0xAE, 0xD5, 0x6A, 0xCB, 0x6A, 0xCB, 0x8B, 0xC1,
-        0x8B, 0xC1, 0x22, 0xB8, 0x22, 0xB8, 0x43, 0xAF, 0x43, 0xAF, 0xFE, 0xA6, 0xFE, 0xA6, 0x63, 0x9F, 0x63, 0x9F,
-        0x81, 0x98, 0x81, 0x98, 0x64, 0x92, 0x64, 0x92, 0x19, 0x8D, 0x19, 0x8D, 0xA9, 0x88, 0xA9, 0x88, 0x1D, 0x85,
-        0x1D, 0x85, 0x7A, 0x82, 0x7A, 0x82, 0xC9, 0x80, 0xC9, 0x80, 0x0A, 0x80, 0x0A, 0x80, 0x40, 0x80, 0x40, 0x80,
-        0x68, 0x81, 0x68, 0x81, 0x84, 0x83, 0x84, 0x83, 0x8D, 0x86, 0x8D, 0x86, 0x7E, 0x8A, 0x7E, 0x8A, 0x4F, 0x8F,
-        0x4F, 0x8F, 0xF7, 0x94, 0xF7, 0x94, 0x6C, 0x9B, 0x6C, 0x9B, 0xA1, 0xA2, 0xA1, 0xA2, 0x88, 0xAA, 0x88, 0xAA,
-        0x12, 0xB3, 0x12, 0xB3, 0x2F, 0xBC, 0x2F, 0xBC, 0xCE, 0xC5, 0xCE, 0xC5, 0xDC, 0xCF, 0xDC, 0xCF, 0x46, 0xDA,
-        0x46, 0xDA, 0xF8, 0xE4, 0xF8, 0xE4, 0xDD, 0xEF, 0xDD, 0xEF, 0xE1, 0xFA, 0xE1, 0xFA, 0xEE, 0x05, 0xEE, 0x05,
-        0xF2, 0x10, 0xF2, 0x10, 0xD4, 0x1B, 0xD4, 0x1B, 0x81, 0x26, 0x81, 0x26, 0xE4, 0x30, 0xE4, 0x30, 0xEB, 0x3A,
-        0xEB, 0x3A, 0x81, 0x44, 0x81, 0x44, 0x94, 0x4D, 0x94, 0x4D, 0x13, 0x56, 0x13, 0x56, 0xED, 0x5D, 0xED, 0x5D,
-        0x14, 0x65, 0x14, 0x65, 0x7B, 0x6B, 0x7B, 0x6B, 0x13, 0x71, 0x13, 0x71, 0xD5, 0x75, 0xD5, 0x75, 0xB4, 0x79,
-        0xB4, 0x79, 0xAC, 0x7C, 0xAC, 0x7C, 0xB5, 0x7E, 0xB5, 0x7E, 0xCD, 0x7F, 0xCD, 0x7F, 0xF1, 0x7F, 0xF1, 0x7F,
-        0x1F, 0x7F, 0x1F, 0x7F, 0x5C, 0x7D, 0x5C, 0x7D, 0xA9, 0x7A, 0xA9, 0x7A, 0x0C, 0x77, 0x0C, 0x77, 0x8B, 0x72,
-        0x8B, 0x72, 0x30, 0x6D, 0x30, 0x6D, 0x04, 0x67, 0x04, 0x67, 0x14, 0x60, 0x14, 0x60, 0x6B, 0x58, 0x6B, 0x58,
-        0x1B, 0x50, 0x1B, 0x50, 0x31, 0x47, 0x31, 0x47, 0xBF, 0x3D, 0xBF, 0x3D, 0xD7, 0x33, 0xD7, 0x33, 0x8D, 0x29,
-        0x8D, 0x29, 0xF3, 0x1E, 0xF3, 0x1E, 0x1E, 0x14, 0x1E, 0x14, 0x22, 0x09, 0x22, 0x09, 0x16, 0xFE, 0x16, 0xFE,
-        0x0D, 0xF3, 0x0D, 0xF3, 0x1D, 0xE8, 0x1D, 0xE8, 0x5A, 0xDD, 0x5A, 0xDD, 0xD8, 0xD2, 0xD8, 0xD2, 0xAE, 0xC8,
-        0xAE, 0xC8, 0xED, 0xBE, 0xED, 0xBE, 0xA9, 0xB5, 0xA9, 0xB5, 0xF1, 0xAC, 0xF1, 0xAC, 0xDA, 0xA4, 0xDA, 0xA4,
-        0x70, 0x9D, 0x70, 0x9D, 0xC2, 0x96, 0xC2, 0x96, 0xDD, 0x90, 0xDD, 0x90, 0xCD, 0x8B, 0xCD, 0x8B, 0x9A, 0x87,
-        0x9A, 0x87, 0x4D, 0x84, 0x4D, 0x84, 0xEC, 0x81, 0xEC, 0x81, 0x7D, 0x80, 0x7D, 0x80, 0x00, 0x80, 0x00, 0x80,
-        0x78, 0x80, 0x78, 0x80, 0xE4, 0x81, 0xE4, 0x81, 0x40, 0x84, 0x40, 0x84, 0x89, 0x87, 0x89, 0x87, 0xB8, 0x8B,
-        0xB8, 0x8B, 0xC5, 0x90, 0xC5, 0x90, 0xA6, 0x96, 0xA6, 0x96, 0x51, 0x9D, 0x51, 0x9D, 0xB7, 0xA4, 0xB7, 0xA4,
-        0xCD, 0xAC, 0xCD, 0xAC, 0x81, 0xB5, 0x81, 0xB5, 0xC3, 0xBE, 0xC3, 0xBE, 0x82, 0xC8, 0x82, 0xC8, 0xAB, 0xD2,
-        0xAB, 0xD2, 0x2B, 0xDD, 0x2B, 0xDD, 0xEC, 0xE7, 0xEC, 0xE7, 0xDD, 0xF2, 0xDD, 0xF2, 0xE5, 0xFD, 0xE5, 0xFD,
-        0xF1, 0x08, 0xF1, 0x08, 0xED, 0x13, 0xED, 0x13, 0xC3, 0x1E, 0xC3, 0x1E, 0x5E, 0x29, 0x5E, 0x29, 0xAB, 0x33,
-        0xAB, 0x33, 0x94, 0x3D, 0x94, 0x3D, 0x08, 0x47, 0x08, 0x47, 0xF4, 0x4F, 0xF4, 0x4F, 0x48, 0x58, 0x48, 0x58,
-        0xF3, 0x5F, 0xF3, 0x5F, 0xE7, 0x66, 0xE7, 0x66, 0x16, 0x6D, 0x16, 0x6D, 0x75, 0x72, 0x75, 0x72, 0xF9, 0x76,
-        0xF9, 0x76, 0x9B, 0x7A, 0x9B, 0x7A, 0x52, 0x7D, 0x52, 0x7D, 0x1A, 0x7F, 0x1A, 0x7F, 0xEF, 0x7F, 0xEF, 0x7F,
-        0xCF, 0x7F, 0xCF, 0x7F, 0xBC, 0x7E, 0xBC, 0x7E, 0xB7, 0x7C, 0xB7, 0x7C, 0xC3, 0x79, 0xC3, 0x79, 0xE7, 0x75,
-        0xE7, 0x75, 0x2A, 0x71, 0x2A, 0x71, 0x95, 0x6B, 0x95, 0x6B, 0x33, 0x65, 0x33, 0x65, 0x0E, 0x5E, 0x0E, 0x5E,
-        0x37, 0x56, 0x37, 0x56, 0xBB, 0x4D, 0xBB, 0x4D, 0xAA, 0x44, 0xAA, 0x44, 0x16, 0x3B, 0x16, 0x3B, 0x12, 0x31,
-        0x12, 0x31, 0xB0, 0x26, 0xB0, 0x26, 0x03, 0x1C, 0x03, 0x1C, 0x22, 0x11, 0x22, 0x11, 0x20, 0x06, 0x20, 0x06,
-        0x12, 0xFB, 0x12, 0xFB, 0x0E, 0xF0, 0x0E, 0xF0, 0x28, 0xE5, 0x28, 0xE5, 0x75, 0xDA, 0x75, 0xDA, 0x0A, 0xD0,
-        0x0A, 0xD0, 0xFA, 0xC5, 0xFA, 0xC5, 0x59, 0xBC, 0x59, 0xBC, 0x3A, 0xB3, 0x3A, 0xB3, 0xAD, 0xAA, 0xAD, 0xAA,
-        0xC2, 0xA2, 0xC2, 0xA2, 0x8A, 0x9B, 0x8A, 0x9B, 0x12, 0x95, 0x12, 0x95, 0x66, 0x8F, 0x66, 0x8F, 0x91, 0x8A,
-        0x91, 0x8A, 0x9D, 0x86, 0x9D, 0x86, 0x8F, 0x83, 0x8F, 0x83, 0x71, 0x81, 0x71, 0x81, 0x42, 0x80, 0x42, 0x80,
-        0x09, 0x80, 0x09, 0x80, 0xC3, 0x80, 0xC3, 0x80, 0x71, 0x82, 0x71, 0x82, 0x0E, 0x85, 0x0E, 0x85, 0x97, 0x88,
-        0x97, 0x88, 0x03, 0x8D, 0x03, 0x8D, 0x4B, 0x92, 0x4B, 0x92, 0x64, 0x98, 0x64, 0x98, 0x43, 0x9F, 0x43, 0x9F,
-        0xDB, 0xA6, 0xDB, 0xA6, 0x1D, 0xAF, 0x1D, 0xAF, 0xFA, 0xB7, 0xFA, 0xB7, 0x60, 0xC1, 0x60, 0xC1, 0x3E, 0xCB,
-        0x3E, 0xCB, 0x80, 0xD5, 0x80, 0xD5, 0x14, 0xE0, 0x14, 0xE0, 0xE4, 0xEA, 0xE4, 0xEA, 0xDD, 0xF5, 0xDD, 0xF5,
-        0xE9, 0x00, 0xE9, 0x00, 0xF3, 0x0B, 0xF3, 0x0B, 0xE7, 0x16, 0xE7, 0x16, 0xAE, 0x21, 0xAE, 0x21, 0x36, 0x2C,
-        0x36, 0x2C, 0x69, 0x36, 0x69, 0x36, 0x35, 0x40, 0x35, 0x40, 0x85, 0x49, 0x85, 0x49, 0x4A, 0x52, 0x4A, 0x52,
-        0x71, 0x5A, 0x71, 0x5A, 0xEB, 0x61, 0xEB, 0x61, 0xAA, 0x68, 0xAA, 0x68, 0xA2, 0x6E, 0xA2, 0x6E, 0xC6, 0x73,
-        0xC6, 0x73, 0x0E, 0x78, 0x0E, 0x78, 0x70, 0x7B, 0x70, 0x7B, 0xE7, 0x7D, 0xE7, 0x7D, 0x6C, 0x7F, 0x6C, 0x7F,
-        0xFE, 0x7F, 0xFE, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x47, 0x7E, 0x47, 0x7E, 0x00, 0x7C, 0x00, 0x7C, 0xCD, 0x78,
-        0xCD, 0x78, 0xB2, 0x74, 0xB2, 0x74, 0xBA, 0x6F, 0xBA, 0x6F, 0xEB, 0x69, 0xEB, 0x69, 0x53, 0x63, 0x53, 0x63,
-        0xFC, 0x5B, 0xFC, 0x5B, 0xF6, 0x53, 0xF6, 0x53, 0x50, 0x4B, 0x50, 0x4B, 0x1A, 0x42, 0x1A, 0x42, 0x66, 0x38,
-        0x66, 0x38, 0x46, 0x2E, 0x46, 0x2E, 0xCD, 0x23, 0xCD, 0x23, 0x10, 0x19, 0x10, 0x19, 0x24, 0x0E, 0x24, 0x0E,
-        0x1C, 0x03, 0x1C, 0x03, 0x10, 0xF8, 0x10, 0xF8, 0x11, 0xED, 0x11, 0xED, 0x37, 0xE2, 0x37, 0xE2, 0x95, 0xD7,
-        0x95, 0xD7, 0x41, 0xCD, 0x41, 0xCD, 0x4E, 0xC3, 0x4E, 0xC3, 0xCE, 0xB9, 0xCE, 0xB9, 0xD5, 0xB0, 0xD5, 0xB0,
-        0x73, 0xA8, 0x73, 0xA8, 0xB8, 0xA0, 0xB8, 0xA0, 0xB3, 0x99, 0xB3, 0x99, 0x71, 0x93, 0x71, 0x93, 0xFF, 0x8D,
-        0xFF, 0x8D, 0x67, 0x89, 0x67, 0x89, 0xB0, 0x85, 0xB0, 0x85, 0xE4, 0x82, 0xE4, 0x82, 0x05, 0x81, 0x05, 0x81,
-        0x1B, 0x80, 0x1B, 0x80, 0x23, 0x80, 0x23, 0x80, 0x21, 0x81, 0x21, 0x81, 0x10, 0x83, 0x10, 0x83, 0xEE, 0x85,
-        0xEE, 0x85, 0xB5, 0x89, 0xB5, 0x89, 0x5E, 0x8E, 0x5E, 0x8E, 0xE0, 0x93, 0xE0, 0x93, 0x31, 0x9A, 0x31, 0x9A,
-        0x44, 0xA1, 0x44, 0xA1, 0x0B, 0xA9, 0x0B, 0xA9, 0x79, 0xB1, 0x79, 0xB1, 0x7D, 0xBA, 0x7D, 0xBA, 0x06, 0xC4,
-        0x06, 0xC4, 0x01, 0xCE, 0x01, 0xCE, 0x5B, 0xD8, 0x5B, 0xD8, 0x01, 0xE3, 0x01, 0xE3, 0xDF, 0xED, 0xDF, 0xED,
-        0xE0, 0xF8, 0xE0, 0xF8, 0xED, 0x03, 0xED, 0x03, 0xF3, 0x0E, 0xF3, 0x0E, 0xDD, 0x19, 0xDD, 0x19, 0x95, 0x24,
-        0x95, 0x24, 0x07, 0x2F, 0x07, 0x2F, 0x20, 0x39, 0x20, 0x39, 0xCC, 0x42, 0xCC, 0x42, 0xF8, 0x4B, 0xF8, 0x4B,
-        0x93, 0x54, 0x93, 0x54, 0x8D, 0x5C, 0x8D, 0x5C, 0xD5, 0x63, 0xD5, 0x63, 0x60, 0x6A, 0x60, 0x6A, 0x1F, 0x70,
-        0x1F, 0x70, 0x08, 0x75, 0x08, 0x75, 0x11, 0x79, 0x11, 0x79, 0x34, 0x7C, 0x34, 0x7C, 0x68, 0x7E, 0x68, 0x7E,
-        0xAD, 0x7F, 0xAD, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0x58, 0x7F, 0x58, 0x7F, 0xC0, 0x7D, 0xC0, 0x7D, 0x38, 0x7B,
-        0x38, 0x7B, 0xC5, 0x77, 0xC5, 0x77, 0x6D, 0x73, 0x6D, 0x73, 0x39, 0x6E, 0x39, 0x6E, 0x32, 0x68, 0x32, 0x68,
-        0x65, 0x61, 0x65, 0x61, 0xDD, 0x59, 0xDD, 0x59, 0xAA, 0x51, 0xAA, 0x51, 0xDB, 0x48, 0xDB, 0x48, 0x80, 0x3F,
-        0x80, 0x3F, 0xAD, 0x35, 0xAD, 0x35, 0x72, 0x2B, 0x72, 0x2B, 0xE5, 0x20, 0xE5, 0x20, 0x19, 0x16, 0x19, 0x16,
-        0x23, 0x0B, 0x23, 0x0B, 0x18, 0x00, 0x18, 0x00, 0x0D, 0xF5, 0x0D, 0xF5, 0x17, 0xEA, 0x17, 0xEA, 0x4A, 0xDF,
-        0x4A, 0xDF, 0xBC, 0xD4, 0xBC, 0xD4, 0x80, 0xCA, 0x80, 0xCA, 0xAA, 0xC0, 0xAA, 0xC0, 0x4E, 0xB7, 0x4E, 0xB7,
-        0x7C, 0xAE, 0x7C, 0xAE, 0x47, 0xA6, 0x47, 0xA6, 0xBC, 0x9E, 0xBC, 0x9E, 0xEB, 0x97, 0xEB, 0x97, 0xE0, 0x91,
-        0xE0, 0x91, 0xA8, 0x8C, 0xA8, 0x8C, 0x4C, 0x88, 0x4C, 0x88, 0xD5, 0x84, 0xD5, 0x84, 0x49, 0x82, 0x49, 0x82,
-        0xAE, 0x80, 0xAE, 0x80, 0x05, 0x80, 0x05, 0x80, 0x51, 0x80, 0x51, 0x80, 0x90, 0x81, 0x90, 0x81, 0xC1, 0x83,
-        0xC1, 0x83, 0xDF, 0x86, 0xDF, 0x86, 0xE5, 0x8A, 0xE5, 0x8A, 0xCA, 0x8F, 0xCA, 0x8F, 0x85, 0x95, 0x85, 0x95,
-        0x0C, 0x9C, 0x0C, 0x9C, 0x52, 0xA3, 0x52, 0xA3, 0x48, 0xAB, 0x48, 0xAB, 0xE1, 0xB3, 0xE1, 0xB3, 0x0A, 0xBD,
-        0x0A, 0xBD, 0xB4, 0xC6, 0xB4, 0xC6, 0xCB, 0xD0, 0xCB, 0xD0, 0x3C, 0xDB, 0x3C, 0xDB, 0xF4, 0xE5, 0xF4, 0xE5,
-        0xDD, 0xF0, 0xDD, 0xF0, 0xE3, 0xFB, 0xE3, 0xFB, 0xEF, 0x06, 0xEF, 0x06, 0xF0, 0x11, 0xF0, 0x11, 0xCF, 0x1C,
-        0xCF, 0x1C, 0x76, 0x27, 0x76, 0x27, 0xD2, 0x31, 0xD2, 0x31, 0xCF, 0x3B, 0xCF, 0x3B, 0x5A, 0x45, 0x5A, 0x45,
-        0x60, 0x4E, 0x60, 0x4E, 0xD1, 0x56, 0xD1, 0x56, 0x9B, 0x5E, 0x9B, 0x5E, 0xB2, 0x65, 0xB2, 0x65, 0x05, 0x6C,
-        0x05, 0x6C, 0x8B, 0x71, 0x8B, 0x71, 0x38, 0x76, 0x38, 0x76, 0x03, 0x7A, 0x03, 0x7A, 0xE5, 0x7C, 0xE5, 0x7C,
-        0xD9, 0x7E, 0xD9, 0x7E, 0xDA, 0x7F, 0xDA, 0x7F, 0xE7, 0x7F, 0xE7, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x27, 0x7D,
-        0x27, 0x7D, 0x5E, 0x7A, 0x5E, 0x7A, 0xAC, 0x76, 0xAC, 0x76, 0x17, 0x72, 0x17, 0x72, 0xA9, 0x6C, 0xA9, 0x6C,
-        0x6A, 0x66, 0x6A, 0x66, 0x69, 0x5F, 0x69, 0x5F, 0xB1, 0x57, 0xB1, 0x57, 0x51, 0x4F, 0x51, 0x4F, 0x5A, 0x46,
-        0x5A, 0x46, 0xDD, 0x3C, 0xDD, 0x3C, 0xEC, 0x32, 0xEC, 0x32, 0x99, 0x28, 0x99, 0x28, 0xF9, 0x1D, 0xF9, 0x1D,
-        0x20, 0x13, 0x20, 0x13, 0x21, 0x08, 0x21, 0x08, 0x15, 0xFD, 0x15, 0xFD, 0x0D, 0xF2, 0x0D, 0xF2, 0x20, 0xE7,
-        0x20, 0xE7, 0x62, 0xDC, 0x62, 0xDC, 0xE8, 0xD1, 0xE8, 0xD1, 0xC7, 0xC7, 0xC7, 0xC7, 0x10, 0xBE, 0x10, 0xBE,
-        0xD8, 0xB4, 0xD8, 0xB4, 0x2F, 0xAC, 0x2F, 0xAC, 0x26, 0xA4, 0x26, 0xA4, 0xCD, 0x9C, 0xCD, 0x9C, 0x30, 0x96,
-        0x30, 0x96, 0x5F, 0x90, 0x5F, 0x90, 0x62, 0x8B, 0x62, 0x8B, 0x44, 0x87, 0x44, 0x87, 0x0C, 0x84, 0x0C, 0x84,
-        0xC1, 0x81, 0xC1, 0x81, 0x67, 0x80, 0x67, 0x80, 0x01, 0x80, 0x01, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x11, 0x82,
-        0x11, 0x82, 0x83, 0x84, 0x83, 0x84, 0xE1, 0x87, 0xE1, 0x87, 0x24, 0x8C, 0x24, 0x8C, 0x46, 0x91, 0x46, 0x91,
-        0x39, 0x97, 0x39, 0x97, 0xF5, 0x9D, 0xF5, 0x9D, 0x6D, 0xA5, 0x6D, 0xA5, 0x91, 0xAD, 0x91, 0xAD, 0x53, 0xB6,
-        0x53, 0xB6, 0xA1, 0xBF, 0xA1, 0xBF, 0x6A, 0xC9, 0x6A, 0xC9, 0x9C, 0xD3, 0x9C, 0xD3, 0x22, 0xDE, 0x22, 0xDE,
-        0xEA, 0xE8, 0xEA, 0xE8, 0xDD, 0xF3, 0xDD, 0xF3, 0xE6, 0xFE, 0xE6, 0xFE, 0xF2, 0x09, 0xF2, 0x09, 0xEB, 0x14,
-        0xEB, 0x14, 0xBD, 0x1F, 0xBD, 0x1F, 0x52, 0x2A, 0x52, 0x2A, 0x96, 0x34, 0x96, 0x34, 0x75, 0x3E, 0x75, 0x3E,
-        0xDD, 0x47, 0xDD, 0x47, 0xBD, 0x50, 0xBD, 0x50, 0x02, 0x59, 0x02, 0x59, 0x9D, 0x60, 0x9D, 0x60, 0x7F, 0x67,
-        0x7F, 0x67, 0x9C, 0x6D, 0x9C, 0x6D, 0xE7, 0x72, 0xE7, 0x72, 0x57, 0x77, 0x57, 0x77, 0xE4, 0x7A, 0xE4, 0x7A,
-        0x86, 0x7D, 0x86, 0x7D, 0x37, 0x7F, 0x37, 0x7F, 0xF6, 0x7F, 0xF6, 0x7F, 0xC0, 0x7F, 0xC0, 0x7F, 0x97, 0x7E,
-        0x97, 0x7E, 0x7C, 0x7C, 0x7C, 0x7C, 0x73, 0x79, 0x73, 0x79, 0x82, 0x75, 0x82, 0x75, 0xB1, 0x70, 0xB1, 0x70,
-        0x09, 0x6B, 0x09, 0x6B, 0x94, 0x64, 0x94, 0x64, 0x5F, 0x5D, 0x5F, 0x5D, 0x78, 0x55, 0x78, 0x55, 0xED, 0x4C,
-        0xED, 0x4C, 0xD1, 0x43, 0xD1, 0x43, 0x32, 0x3A, 0x32, 0x3A, 0x24, 0x30, 0x24, 0x30, 0xBA, 0x25, 0xBA, 0x25,
-        0x08, 0x1B, 0x08, 0x1B, 0x23, 0x10, 0x23, 0x10, 0x1E, 0x05, 0x1E, 0x05, 0x11, 0xFA, 0x11, 0xFA, 0x0F, 0xEF,
-        0x0F, 0xEF, 0x2C, 0xE4, 0x2C, 0xE4, 0x7F, 0xD9, 0x7F, 0xD9, 0x1B, 0xCF, 0x1B, 0xCF, 0x15, 0xC5, 0x15, 0xC5,
-        0x7F, 0xBB, 0x7F, 0xBB, 0x6C, 0xB2, 0x6C, 0xB2, 0xED, 0xA9, 0xED, 0xA9, 0x13, 0xA2, 0x13, 0xA2, 0xEC, 0x9A,
-        0xEC, 0x9A, 0x85, 0x94, 0x85, 0x94, 0xED, 0x8E, 0xED, 0x8E, 0x2C, 0x8A, 0x2C, 0x8A, 0x4C, 0x86, 0x4C, 0x86,
-        0x54, 0x83, 0x54, 0x83, 0x4B, 0x81, 0x4B, 0x81, 0x34, 0x80, 0x34, 0x80, 0x10, 0x80, 0x10, 0x80, 0xE1, 0x80,
-        0xE1, 0x80, 0xA4, 0x82, 0xA4, 0x82, 0x57, 0x85, 0x57, 0x85, 0xF4, 0x88, 0xF4, 0x88, 0x75, 0x8D, 0x75, 0x8D,
-        0xD0, 0x92, 0xD0, 0x92, 0xFC, 0x98, 0xFC, 0x98, 0xED, 0x9F, 0xED, 0x9F, 0x94, 0xA7, 0x94, 0xA7, 0xE5, 0xAF,
-        0xE5, 0xAF, 0xD0, 0xB8, 0xD0, 0xB8, 0x41, 0xC2, 0x41, 0xC2, 0x29, 0xCC, 0x29, 0xCC, 0x73, 0xD6, 0x73, 0xD6,
-        0x0D, 0xE1, 0x0D, 0xE1, 0xE2, 0xEB, 0xE2, 0xEB, 0xDE, 0xF6, 0xDE, 0xF6, 0xEA, 0x01, 0xEA, 0x01, 0xF3, 0x0C,
-        0xF3, 0x0C, 0xE4, 0x17, 0xE4, 0x17, 0xA6, 0x22, 0xA6, 0x22, 0x27, 0x2D, 0x27, 0x2D, 0x52, 0x37, 0x52, 0x37,
-        0x13, 0x41, 0x13, 0x41, 0x57, 0x4A, 0x57, 0x4A, 0x0E, 0x53, 0x0E, 0x53, 0x26, 0x5B, 0x26, 0x5B, 0x90, 0x62,
-        0x90, 0x62, 0x3E, 0x69, 0x3E, 0x69, 0x23, 0x6F, 0x23, 0x6F, 0x33, 0x74, 0x33, 0x74, 0x66, 0x78, 0x66, 0x78,
-        0xB3, 0x7B, 0xB3, 0x7B, 0x14, 0x7E, 0x14, 0x7E, 0x83, 0x7F, 0x83, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x88, 0x7F,
-        0x88, 0x7F, 0x1C, 0x7E, 0x1C, 0x7E, 0xBF, 0x7B, 0xBF, 0x7B, 0x77, 0x78, 0x77, 0x78, 0x48, 0x74, 0x48, 0x74,
-        0x3B, 0x6F, 0x3B, 0x6F, 0x5A, 0x69, 0x5A, 0x69, 0xAF, 0x62, 0xAF, 0x62, 0x49, 0x5B, 0x49, 0x5B, 0x33, 0x53,
-        0x33, 0x53, 0x80, 0x4A, 0x80, 0x4A, 0x3D, 0x41, 0x3D, 0x41, 0x7E, 0x37, 0x7E, 0x37, 0x55, 0x2D, 0x55, 0x2D,
-        0xD6, 0x22, 0xD6, 0x22, 0x14, 0x18, 0x14, 0x18, 0x24, 0x0D, 0x24, 0x0D, 0x1B, 0x02, 0x1B, 0x02, 0x0E, 0xF7,
-        0x0E, 0xF7, 0x13, 0xEC, 0x13, 0xEC, 0x3D, 0xE1, 0x3D, 0xE1, 0xA2, 0xD6, 0xA2, 0xD6, 0x55, 0xCC, 0x55, 0xCC,
-        0x6C, 0xC2, 0x6C, 0xC2, 0xF8, 0xB8, 0xF8, 0xB8, 0x0C, 0xB0, 0x0C, 0xB0, 0xB8, 0xA7, 0xB8, 0xA7, 0x0D, 0xA0,
-        0x0D, 0xA0, 0x19, 0x99, 0x19, 0x99, 0xEA, 0x92, 0xEA, 0x92, 0x8B, 0x8D, 0x8B, 0x8D, 0x07, 0x89, 0x07, 0x89,
-        0x65, 0x85, 0x65, 0x85, 0xAE, 0x82, 0xAE, 0x82, 0xE6, 0x80, 0xE6, 0x80, 0x11, 0x80, 0x11, 0x80, 0x30, 0x80,
-        0x30, 0x80, 0x44, 0x81, 0x44, 0x81, 0x49, 0x83, 0x49, 0x83, 0x3D, 0x86, 0x3D, 0x86, 0x18, 0x8A, 0x18, 0x8A,
-        0xD6, 0x8E, 0xD6, 0x8E, 0x6B, 0x94, 0x6B, 0x94, 0xCD, 0x9A, 0xCD, 0x9A, 0xF2, 0xA1, 0xF2, 0xA1, 0xC9, 0xA9,
-        0xC9, 0xA9, 0x45, 0xB2, 0x45, 0xB2, 0x55, 0xBB, 0x55, 0xBB, 0xE9, 0xC4, 0xE9, 0xC4, 0xEE, 0xCE, 0xEE, 0xCE,
-        0x50, 0xD9, 0x50, 0xD9, 0xFC, 0xE3, 0xFC, 0xE3, 0xDE, 0xEE, 0xDE, 0xEE, 0xE0, 0xF9, 0xE0, 0xF9, 0xEE, 0x04,
-        0xEE, 0x04, 0xF2, 0x0F, 0xF2, 0x0F, 0xD9, 0x1A, 0xD9, 0x1A, 0x8B, 0x25, 0x8B, 0x25, 0xF6, 0x2F, 0xF6, 0x2F,
-        0x06, 0x3A, 0x06, 0x3A, 0xA7, 0x43, 0xA7, 0x43, 0xC6, 0x4C, 0xC6, 0x4C, 0x54, 0x55, 0x54, 0x55, 0x3E, 0x5D,
-        0x3E, 0x5D, 0x76, 0x64, 0x76, 0x64, 0xEE, 0x6A, 0xEE, 0x6A, 0x9A, 0x70, 0x9A, 0x70, 0x6F, 0x75, 0x6F, 0x75,
-        0x63, 0x79, 0x63, 0x79, 0x71, 0x7C, 0x71, 0x7C, 0x90, 0x7E, 0x90, 0x7E, 0xBE, 0x7F, 0xBE, 0x7F, 0xF7, 0x7F,
-        0xF7, 0x7F, 0x3C, 0x7F, 0x3C, 0x7F, 0x8F, 0x7D, 0x8F, 0x7D, 0xF1, 0x7A, 0xF1, 0x7A, 0x69, 0x77, 0x69, 0x77,
-        0xFD, 0x72, 0xFD, 0x72, 0xB5, 0x6D, 0xB5, 0x6D, 0x9C, 0x67, 0x9C, 0x67, 0xBD, 0x60, 0xBD, 0x60, 0x25, 0x59,
-        0x25, 0x59, 0xE3, 0x50, 0xE3, 0x50, 0x06, 0x48, 0x06, 0x48, 0xA0, 0x3E, 0xA0, 0x3E, 0xC3, 0x34, 0xC3, 0x34,
-        0x80, 0x2A, 0x80, 0x2A, 0xEC, 0x1F, 0xEC, 0x1F, 0x1C, 0x15, 0x1C, 0x15, 0x23, 0x0A, 0x23, 0x0A, 0x18, 0xFF,
-        0x18, 0xFF, 0x0D, 0xF4, 0x0D, 0xF4, 0x19, 0xE9, 0x19, 0xE9, 0x51, 0xDE, 0x51, 0xDE, 0xCA, 0xD3, 0xCA, 0xD3,
-        0x97, 0xC9, 0x97, 0xC9, 0xCB, 0xBF, 0xCB, 0xBF, 0x7B, 0xB6, 0x7B, 0xB6, 0xB6, 0xAD, 0xB6, 0xAD, 0x8F, 0xA5,
-        0x8F, 0xA5, 0x15, 0x9E, 0x15, 0x9E, 0x55, 0x97, 0x55, 0x97, 0x5E, 0x91, 0x5E, 0x91, 0x39, 0x8C, 0x39, 0x8C,
-        0xF2, 0x87, 0xF2, 0x87, 0x90, 0x84, 0x90, 0x84, 0x1A, 0x82, 0x1A, 0x82, 0x94, 0x80, 0x94, 0x80, 0x01, 0x80,
-        0x01, 0x80, 0x64, 0x80, 0x64, 0x80, 0xB9, 0x81, 0xB9, 0x81, 0x00, 0x84, 0x00, 0x84, 0x33, 0x87, 0x33, 0x87,
-        0x4E, 0x8B, 0x4E, 0x8B, 0x46, 0x90, 0x46, 0x90, 0x15, 0x96, 0x15, 0x96, 0xAD, 0x9C, 0xAD, 0x9C, 0x04, 0xA4,
-        0x04, 0xA4, 0x09, 0xAC, 0x09, 0xAC, 0xB0, 0xB4, 0xB0, 0xB4, 0xE7, 0xBD, 0xE7, 0xBD, 0x9A, 0xC7, 0x9A, 0xC7,
-        0xBA, 0xD1, 0xBA, 0xD1, 0x33, 0xDC, 0x33, 0xDC, 0xF0, 0xE6, 0xF0, 0xE6, 0xDC, 0xF1, 0xDC, 0xF1, 0xE4, 0xFC,
-        0xE4, 0xFC, 0xF1, 0x07, 0xF1, 0x07, 0xEF, 0x12, 0xEF, 0x12, 0xC9, 0x1D, 0xC9, 0x1D, 0x6A, 0x28, 0x6A, 0x28,
-        0xBF, 0x32, 0xBF, 0x32, 0xB2, 0x3C, 0xB2, 0x3C, 0x31, 0x46, 0x31, 0x46, 0x2B, 0x4F, 0x2B, 0x4F, 0x8D, 0x57,
-        0x8D, 0x57, 0x48, 0x5F, 0x48, 0x5F, 0x4D, 0x66, 0x4D, 0x66, 0x8E, 0x6C, 0x8E, 0x6C, 0x01, 0x72, 0x01, 0x72,
-        0x9A, 0x76, 0x9A, 0x76, 0x50, 0x7A, 0x50, 0x7A, 0x1C, 0x7D, 0x1C, 0x7D, 0xFA, 0x7E, 0xFA, 0x7E, 0xE5, 0x7F,
-        0xE5, 0x7F, 0xDD, 0x7F, 0xDD, 0x7F, 0xDF, 0x7E, 0xDF, 0x7E, 0xF0, 0x7C, 0xF0, 0x7C, 0x12, 0x7A, 0x12, 0x7A,
-        0x4B, 0x76, 0x4B, 0x76, 0xA1, 0x71, 0xA1, 0x71, 0x20, 0x6C, 0x20, 0x6C, 0xCF, 0x65, 0xCF, 0x65, 0xBC, 0x5E,
-        0xBC, 0x5E, 0xF4, 0x56, 0xF4, 0x56, 0x87, 0x4E, 0x87, 0x4E, 0x83, 0x45, 0x83, 0x45, 0xFA, 0x3B, 0xFA, 0x3B,
-        0xFF, 0x31, 0xFF, 0x31, 0xA5, 0x27, 0xA5, 0x27, 0xFE, 0x1C, 0xFE, 0x1C, 0x21, 0x12, 0x21, 0x12, 0x21, 0x07,
-        0x21, 0x07, 0x14, 0xFC, 0x14, 0xFC, 0x0D, 0xF1, 0x0D, 0xF1, 0x23, 0xE6, 0x23, 0xE6, 0x6B, 0xDB, 0x6B, 0xDB,
-        0xF8, 0xD0, 0xF8, 0xD0, 0xE0, 0xC6, 0xE0, 0xC6, 0x34, 0xBD, 0x34, 0xBD, 0x08, 0xB4, 0x08, 0xB4, 0x6D, 0xAB,
-        0x6D, 0xAB, 0x73, 0xA3, 0x73, 0xA3, 0x2B, 0x9C, 0x2B, 0x9C, 0xA1, 0x95, 0xA1, 0x95, 0xE1, 0x8F, 0xE1, 0x8F,
-        0xF8, 0x8A, 0xF8, 0x8A, 0xEF, 0x86, 0xEF, 0x86, 0xCC, 0x83, 0xCC, 0x83, 0x98, 0x81, 0x98, 0x81, 0x54, 0x80,
-        0x54, 0x80, 0x04, 0x80, 0x04, 0x80, 0xA8, 0x80, 0xA8, 0x80, 0x40, 0x82, 0x40, 0x82, 0xC8, 0x84, 0xC8, 0x84,
-        0x3B, 0x88, 0x3B, 0x88, 0x93, 0x8C, 0x93, 0x8C, 0xC7, 0x91, 0xC7, 0x91, 0xCE, 0x97, 0xCE, 0x97, 0x9C, 0x9E,
-        0x9C, 0x9E, 0x23, 0xA6, 0x23, 0xA6, 0x56, 0xAE, 0x56, 0xAE, 0x25, 0xB7, 0x25, 0xB7, 0x80, 0xC0, 0x80, 0xC0,
-        0x53, 0xCA, 0x53, 0xCA, 0x8E, 0xD4, 0x8E, 0xD4, 0x1B, 0xDF, 0x1B, 0xDF, 0xE6, 0xE9, 0xE6, 0xE9, 0xDD, 0xF4,
-        0xDD, 0xF4, 0xE8, 0xFF, 0xE8, 0xFF, 0xF2, 0x0A, 0xF2, 0x0A, 0xE9, 0x15, 0xE9, 0x15, 0xB6, 0x20, 0xB6, 0x20,
-        0x44, 0x2B, 0x44, 0x2B, 0x80, 0x35, 0x80, 0x35, 0x55, 0x3F, 0x55, 0x3F, 0xB2, 0x48, 0xB2, 0x48, 0x84, 0x51,
-        0x84, 0x51, 0xBA, 0x59, 0xBA, 0x59, 0x45, 0x61, 0x45, 0x61, 0x16, 0x68, 0x16, 0x68, 0x20, 0x6E, 0x20, 0x6E,
-        0x58, 0x73, 0x58, 0x73, 0xB4, 0x77, 0xB4, 0x77, 0x2B, 0x7B, 0x2B, 0x7B, 0xB7, 0x7D, 0xB7, 0x7D, 0x52, 0x7F,
-        0x52, 0x7F, 0xFB, 0x7F, 0xFB, 0x7F, 0xAF, 0x7F, 0xAF, 0x7F, 0x70, 0x7E, 0x70, 0x7E, 0x3F, 0x7C, 0x3F, 0x7C,
-        0x21, 0x79, 0x21, 0x79, 0x1B, 0x75, 0x1B, 0x75, 0x37, 0x70, 0x37, 0x70, 0x7A, 0x6A, 0x7A, 0x6A, 0xF4, 0x63,
-        0xF4, 0x63, 0xAE, 0x5C, 0xAE, 0x5C, 0xB8, 0x54, 0xB8, 0x54, 0x20, 0x4C, 0x20, 0x4C, 0xF6, 0x42, 0xF6, 0x42,
-        0x4C, 0x39, 0x4C, 0x39, 0x35, 0x2F, 0x35, 0x2F, 0xC4, 0x24, 0xC4, 0x24, 0x0D, 0x1A, 0x0D, 0x1A, 0x23, 0x0F,
-        0x23, 0x0F, 0x1E, 0x04, 0x1E, 0x04, 0x10, 0xF9, 0x10, 0xF9, 0x10, 0xEE, 0x10, 0xEE, 0x32, 0xE3, 0x32, 0xE3,
-        0x8A, 0xD8, 0x8A, 0xD8, 0x2E, 0xCE, 0x2E, 0xCE, 0x31, 0xC4, 0x31, 0xC4, 0xA6, 0xBA, 0xA6, 0xBA, 0xA0, 0xB1,
-        0xA0, 0xB1, 0x2F, 0xA9, 0x2F, 0xA9, 0x65, 0xA1, 0x65, 0xA1, 0x4F, 0x9A, 0x4F, 0x9A, 0xFB, 0x93, 0xFB, 0x93,
-        0x75, 0x8E, 0x75, 0x8E, 0xC8, 0x89, 0xC8, 0x89, 0xFD, 0x85, 0xFD, 0x85, 0x1B, 0x83, 0x1B, 0x83, 0x27, 0x81,
-        0x27, 0x81, 0x26, 0x80, 0x26, 0x80, 0x18, 0x80, 0x18, 0x80, 0x00, 0x81, 0x00, 0x81, 0xD9, 0x82, 0xD9, 0x82,
-        0xA2, 0x85, 0xA2, 0x85, 0x54, 0x89, 0x54, 0x89, 0xE9, 0x8D, 0xE9, 0x8D, 0x57, 0x93, 0x57, 0x93, 0x96, 0x99,
-        0x96, 0x99, 0x97, 0xA0, 0x97, 0xA0, 0x4F, 0xA8, 0x4F, 0xA8, 0xAF, 0xB0, 0xAF, 0xB0, 0xA6, 0xB9, 0xA6, 0xB9,
-        0x23, 0xC3, 0x23, 0xC3, 0x14, 0xCD, 0x14, 0xCD, 0x67, 0xD7, 0x67, 0xD7, 0x07, 0xE2, 0x07, 0xE2, 0xE0, 0xEC,
-        0xE0, 0xEC, 0xDE, 0xF7, 0xDE, 0xF7, 0xEB, 0x02, 0xEB, 0x02, 0xF3, 0x0D, 0xF3, 0x0D, 0xE1, 0x18, 0xE1, 0x18,
-        0x9E, 0x23, 0x9E, 0x23, 0x18, 0x2E, 0x18, 0x2E, 0x39, 0x38, 0x39, 0x38, 0xF0, 0x41, 0xF0, 0x41, 0x29, 0x4B,
-        0x29, 0x4B, 0xD1, 0x53, 0xD1, 0x53, 0xDA, 0x5B, 0xDA, 0x5B, 0x33, 0x63, 0x33, 0x63, 0xD0, 0x69, 0xD0, 0x69,
-        0xA1, 0x6F, 0xA1, 0x6F, 0x9F, 0x74, 0x9F, 0x74, 0xBC, 0x78, 0xBC, 0x78, 0xF5, 0x7B, 0xF5, 0x7B, 0x3F, 0x7E,
-        0x3F, 0x7E, 0x99, 0x7F, 0x99, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x71, 0x7F, 0x71, 0x7F, 0xEF, 0x7D, 0xEF, 0x7D,
-        0x7D, 0x7B, 0x7D, 0x7B, 0x1E, 0x78, 0x1E, 0x78, 0xDB, 0x73, 0xDB, 0x73, 0xBB, 0x6E, 0xBB, 0x6E, 0xC7, 0x68,
-        0xC7, 0x68, 0x0B, 0x62, 0x0B, 0x62, 0x93, 0x5A, 0x93, 0x5A, 0x6F, 0x52, 0x6F, 0x52, 0xAE, 0x49, 0xAE, 0x49,
-        0x5F, 0x40, 0x5F, 0x40, 0x96, 0x36, 0x96, 0x36, 0x64, 0x2C, 0x64, 0x2C, 0xDE, 0x21, 0xDE, 0x21, 0x17, 0x17,
-        0x17, 0x17, 0x23, 0x0C, 0x23, 0x0C, 0x1A, 0x01, 0x1A, 0x01, 0x0E, 0xF6, 0x0E, 0xF6, 0x14, 0xEB, 0x14, 0xEB,
-        0x43, 0xE0, 0x43, 0xE0, 0xAE, 0xD5, 0xAE, 0xD5, 0x6A, 0xCB, 0x6A, 0xCB, 0x8B, 0xC1, 0x8B, 0xC1, 0x22, 0xB8,
-        0x22, 0xB8, 0x43, 0xAF, 0x43, 0xAF, 0xFE, 0xA6, 0xFE, 0xA6, 0x63, 0x9F, 0x63, 0x9F, 0x81, 0x98, 0x81, 0x98,
-        0x64, 0x92, 0x64, 0x92, 0x19, 0x8D, 0x19, 0x8D, 0xA9, 0x88, 0xA9, 0x88, 0x1D, 0x85, 0x1D, 0x85, 0x7A, 0x82,
-        0x7A, 0x82, 0xC9, 0x80, 0xC9, 0x80, 0x0A, 0x80, 0x0A, 0x80, 0x40, 0x80, 0x40, 0x80, 0x68, 0x81, 0x68, 0x81,
-        0x84, 0x83, 0x84, 0x83, 0x8D, 0x86, 0x8D, 0x86, 0x7E, 0x8A, 0x7E, 0x8A, 0x4F, 0x8F, 0x4F, 0x8F, 0xF7, 0x94,
-        0xF7, 0x94, 0x6C, 0x9B, 0x6C, 0x9B, 0xA1, 0xA2, 0xA1, 0xA2, 0x88, 0xAA, 0x88, 0xAA, 0x12, 0xB3, 0x12, 0xB3,
-        0x2F, 0xBC, 0x2F, 0xBC, 0xCE, 0xC5, 0xCE, 0xC5, 0xDC, 0xCF, 0xDC, 0xCF, 0x46, 0xDA, 0x46, 0xDA, 0xF8, 0xE4,
-        0xF8, 0xE4, 0xDD, 0xEF, 0xDD, 0xEF, 0xE1, 0xFA, 0xE1, 0xFA, 0xEE, 0x05, 0xEE, 0x05, 0xF2, 0x10, 0xF2, 0x10,
-        0xD4, 0x1B, 0xD4, 0x1B, 0x81, 0x26, 0x81, 0x26, 0xE4, 0x30, 0xE4, 0x30, 0xEB, 0x3A, 0xEB, 0x3A, 0x81, 0x44,
-        0x81, 0x44, 0x94, 0x4D, 0x94, 0x4D, 0x13, 0x56, 0x13, 0x56, 0xED, 0x5D, 0xED, 0x5D, 0x14, 0x65, 0x14, 0x65,
-        0x7B, 0x6B, 0x7B, 0x6B, 0x13, 0x71, 0x13, 0x71, 0xD5, 0x75, 0xD5, 0x75, 0xB4, 0x79, 0xB4, 0x79, 0xAC, 0x7C,
-        0xAC, 0x7C, 0xB5, 0x7E, 0xB5, 0x7E, 0xCD, 0x7F, 0xCD, 0x7F, 0xF1, 0x7F, 0xF1, 0x7F, 0x1F, 0x7F, 0x1F, 0x7F,
-        0x5C, 0x7D, 0x5C, 0x7D, 0xA9, 0x7A, 0xA9, 0x7A, 0x0C, 0x77, 0x0C, 0x77, 0x8B, 0x72, 0x8B, 0x72, 0x30, 0x6D,
-        0x30, 0x6D, 0x04, 0x67, 0x04, 0x67, 0x14, 0x60, 0x14, 0x60, 0x6B, 0x58, 0x6B, 0x58, 0x1B, 0x50, 0x1B, 0x50,
-        0x31, 0x47, 0x31, 0x47, 0xBF, 0x3D, 0xBF, 0x3D, 0xD7, 0x33, 0xD7, 0x33, 0x8D, 0x29, 0x8D, 0x29, 0xF3, 0x1E,
-        0xF3, 0x1E, 0x1E, 0x14, 0x1E, 0x14, 0x22, 0x09, 0x22, 0x09, 0x16, 0xFE, 0x16, 0xFE, 0x0D, 0xF3, 0x0D, 0xF3,
-        0x1D, 0xE8, 0x1D, 0xE8, 0x5A, 0xDD, 0x5A, 0xDD, 0xD8, 0xD2, 0xD8, 0xD2, 0xAE, 0xC8, 0xAE, 0xC8, 0xED, 0xBE,
-        0xED, 0xBE, 0xA9, 0xB5, 0xA9, 0xB5, 0xF1, 0xAC, 0xF1, 0xAC, 0xDA, 0xA4, 0xDA, 0xA4, 0x70, 0x9D, 0x70, 0x9D,
-        0xC2, 0x96, 0xC2, 0x96, 0xDD, 0x90, 0xDD, 0x90, 0xCD, 0x8B, 0xCD, 0x8B, 0x9A, 0x87, 0x9A, 0x87, 0x4D, 0x84,
-        0x4D, 0x84, 0xEC, 0x81, 0xEC, 0x81, 0x7D, 0x80, 0x7D, 0x80, 0x00, 0x80, 0x00, 0x80, 0x78, 0x80, 0x78, 0x80,
-        0xE4, 0x81, 0xE4, 0x81, 0x40, 0x84, 0x40, 0x84, 0x89, 0x87, 0x89, 0x87, 0xB8, 0x8B, 0xB8, 0x8B, 0xC5, 0x90,
-        0xC5, 0x90, 0xA6, 0x96, 0xA6, 0x96, 0x51, 0x9D, 0x51, 0x9D, 0xB7, 0xA4, 0xB7, 0xA4, 0xCD, 0xAC, 0xCD, 0xAC,
-        0x81, 0xB5, 0x81, 0xB5, 0xC3, 0xBE, 0xC3, 0xBE, 0x82, 0xC8, 0x82, 0xC8, 0xAB, 0xD2, 0xAB, 0xD2, 0x2B, 0xDD,
-        0x2B, 0xDD, 0xEC, 0xE7, 0xEC, 0xE7, 0xDD, 0xF2, 0xDD, 0xF2, 0xE5, 0xFD, 0xE5, 0xFD, 0xF1, 0x08, 0xF1, 0x08,
-        0xED, 0x13, 0xED, 0x13, 0xC3, 0x1E, 0xC3, 0x1E, 0x5E, 0x29, 0x5E, 0x29, 0xAB, 0x33, 0xAB, 0x33, 0x94, 0x3D,
-        0x94, 0x3D, 0x08, 0x47, 0x08, 0x47, 0xF4, 0x4F, 0xF4, 0x4F, 0x48, 0x58, 0x48, 0x58, 0xF3, 0x5F, 0xF3, 0x5F,
-        0xE7, 0x66, 0xE7, 0x66, 0x16, 0x6D, 0x16, 0x6D, 0x75, 0x72, 0x75, 0x72, 0xF9, 0x76, 0xF9, 0x76, 0x9B, 0x7A,
-        0x9B, 0x7A, 0x52, 0x7D, 0x52, 0x7D, 0x1A, 0x7F, 0x1A, 0x7F, 0xEF, 0x7F, 0xEF, 0x7F, 0xCF, 0x7F, 0xCF, 0x7F,
-        0xBC, 0x7E, 0xBC, 0x7E, 0xB7, 0x7C, 0xB7, 0x7C, 0xC3, 0x79, 0xC3, 0x79, 0xE7, 0x75, 0xE7, 0x75, 0x2A, 0x71,
-        0x2A, 0x71, 0x95, 0x6B, 0x95, 0x6B, 0x33, 0x65, 0x33, 0x65, 0x0E, 0x5E, 0x0E, 0x5E, 0x37, 0x56, 0x37, 0x56,
-        0xBB, 0x4D, 0xBB, 0x4D, 0xAA, 0x44, 0xAA, 0x44, 0x16, 0x3B, 0x16, 0x3B, 0x12, 0x31, 0x12, 0x31, 0xB0, 0x26,
-        0xB0, 0x26, 0x03, 0x1C, 0x03, 0x1C, 0x22, 0x11, 0x22, 0x11, 0x20, 0x06, 0x20, 0x06, 0x12, 0xFB, 0x12, 0xFB,
-        0x0E, 0xF0, 0x0E, 0xF0, 0x28, 0xE5, 0x28, 0xE5, 0x75, 0xDA, 0x75, 0xDA, 0x0A, 0xD0, 0x0A, 0xD0, 0xFA, 0xC5,
-        0xFA, 0xC5, 0x59, 0xBC, 0x59, 0xBC, 0x3A, 0xB3, 0x3A, 0xB3, 0xAD, 0xAA, 0xAD, 0xAA, 0xC2, 0xA2, 0xC2, 0xA2,
-        0x8A, 0x9B, 0x8A, 0x9B, 0x12, 0x95, 0x12, 0x95, 0x66, 0x8F, 0x66, 0x8F, 0x91, 0x8A, 0x91, 0x8A, 0x9D, 0x86,
-        0x9D, 0x86, 0x8F, 0x83, 0x8F, 0x83, 0x71, 0x81, 0x71, 0x81, 0x42, 0x80, 0x42, 0x80, 0x09, 0x80, 0x09, 0x80,
-        0xC3, 0x80, 0xC3, 0x80, 0x71, 0x82, 0x71, 0x82, 0x0E, 0x85, 0x0E, 0x85, 0x97, 0x88, 0x97, 0x88, 0x03, 0x8D,
-        0x03, 0x8D, 0x4B, 0x92, 0x4B, 0x92, 0x64, 0x98, 0x64, 0x98, 0x43, 0x9F, 0x43, 0x9F, 0xDB, 0xA6, 0xDB, 0xA6,
-        0x1D, 0xAF, 0x1D, 0xAF, 0xFA, 0xB7, 0xFA, 0xB7, 0x60, 0xC1, 0x60, 0xC1, 0x3E, 0xCB, 0x3E, 0xCB, 0x80, 0xD5,
-        0x80, 0xD5, 0x14, 0xE0, 0x14, 0xE0, 0xE4, 0xEA, 0xE4, 0xEA, 0xDD, 0xF5, 0xDD, 0xF5, 0xE9, 0x00, 0xE9, 0x00,
-        0xF3, 0x0B, 0xF3, 0x0B, 0xE7, 0x16, 0xE7, 0x16, 0xAE, 0x21, 0xAE, 0x21, 0x36, 0x2C, 0x36, 0x2C, 0x69, 0x36,
-        0x69, 0x36, 0x35, 0x40, 0x35, 0x40, 0x85, 0x49, 0x85, 0x49, 0x4A, 0x52, 0x4A, 0x52, 0x71, 0x5A, 0x71, 0x5A,
-        0xEB, 0x61, 0xEB, 0x61, 0xAA, 0x68, 0xAA, 0x68, 0xA2, 0x6E, 0xA2, 0x6E, 0xC6, 0x73, 0xC6, 0x73, 0x0E, 0x78,
-        0x0E, 0x78, 0x70, 0x7B, 0x70, 0x7B, 0xE7, 0x7D, 0xE7, 0x7D, 0x6C, 0x7F, 0x6C, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F,
-        0x9C, 0x7F, 0x9C, 0x7F, 0x47, 0x7E, 0x47, 0x7E, 0x00, 0x7C, 0x00, 0x7C, 0xCD, 0x78, 0xCD, 0x78, 0xB2, 0x74,
-        0xB2, 0x74, 0xBA, 0x6F, 0xBA, 0x6F, 0xEB, 0x69, 0xEB, 0x69, 0x53, 0x63, 0x53, 0x63, 0xFC, 0x5B, 0xFC, 0x5B,
-        0xF6, 0x53, 0xF6, 0x53, 0x50, 0x4B, 0x50, 0x4B, 0x1A, 0x42, 0x1A, 0x42, 0x66, 0x38, 0x66, 0x38, 0x46, 0x2E,
-        0x46, 0x2E, 0xCD, 0x23, 0xCD, 0x23, 0x10, 0x19, 0x10, 0x19, 0x24, 0x0E, 0x24, 0x0E, 0x1C, 0x03, 0x1C, 0x03,
-        0x10, 0xF8, 0x10, 0xF8, 0x11, 0xED, 0x11, 0xED, 0x37, 0xE2, 0x37, 0xE2, 0x95, 0xD7, 0x95, 0xD7, 0x41, 0xCD,
-        0x41, 0xCD, 0x4E, 0xC3, 0x4E, 0xC3, 0xCE, 0xB9, 0xCE, 0xB9, 0xD5, 0xB0, 0xD5, 0xB0, 0x73, 0xA8, 0x73, 0xA8,
-        0xB8, 0xA0, 0xB8, 0xA0, 0xB3, 0x99, 0xB3, 0x99, 0x71, 0x93, 0x71, 0x93, 0xFF, 0x8D, 0xFF, 0x8D, 0x67, 0x89,
-        0x67, 0x89, 0xB0, 0x85, 0xB0, 0x85, 0xE4, 0x82, 0xE4, 0x82, 0x05, 0x81, 0x05, 0x81, 0x1B, 0x80, 0x1B, 0x80,
-        0x23, 0x80, 0x23, 0x80, 0x21, 0x81, 0x21, 0x81, 0x10, 0x83, 0x10, 0x83, 0xEE, 0x85, 0xEE, 0x85, 0xB5, 0x89,
-        0xB5, 0x89, 0x5E, 0x8E, 0x5E, 0x8E, 0xE0, 0x93, 0xE0, 0x93, 0x31, 0x9A, 0x31, 0x9A, 0x44, 0xA1, 0x44, 0xA1,
-        0x0B, 0xA9, 0x0B, 0xA9, 0x79, 0xB1, 0x79, 0xB1, 0x7D, 0xBA, 0x7D, 0xBA, 0x06, 0xC4, 0x06, 0xC4, 0x01, 0xCE,
-        0x01, 0xCE, 0x5B, 0xD8, 0x5B, 0xD8, 0x01, 0xE3, 0x01, 0xE3, 0xDF, 0xED, 0xDF, 0xED, 0xE0, 0xF8, 0xE0, 0xF8,
-        0xED, 0x03, 0xED, 0x03, 0xF3, 0x0E, 0xF3, 0x0E, 0xDD, 0x19, 0xDD, 0x19, 0x95, 0x24, 0x95, 0x24, 0x07, 0x2F,
-        0x07, 0x2F, 0x20, 0x39, 0x20, 0x39, 0xCC, 0x42, 0xCC, 0x42, 0xF8, 0x4B, 0xF8, 0x4B, 0x93, 0x54, 0x93, 0x54,
-        0x8D, 0x5C, 0x8D, 0x5C, 0xD5, 0x63, 0xD5, 0x63, 0x60, 0x6A, 0x60, 0x6A, 0x1F, 0x70, 0x1F, 0x70, 0x08, 0x75,
-        0x08, 0x75, 0x11, 0x79, 0x11, 0x79, 0x34, 0x7C, 0x34, 0x7C, 0x68, 0x7E, 0x68, 0x7E, 0xAD, 0x7F, 0xAD, 0x7F,
-        0xFC, 0x7F, 0xFC, 0x7F, 0x58, 0x7F, 0x58, 0x7F, 0xC0, 0x7D, 0xC0, 0x7D, 0x38, 0x7B, 0x38, 0x7B, 0xC5, 0x77,
-        0xC5, 0x77, 0x6D, 0x73, 0x6D, 0x73, 0x39, 0x6E, 0x39, 0x6E, 0x32, 0x68, 0x32, 0x68, 0x65, 0x61, 0x65, 0x61,
-        0xDD, 0x59, 0xDD, 0x59, 0xAA, 0x51, 0xAA, 0x51, 0xDB, 0x48, 0xDB, 0x48, 0x80, 0x3F, 0x80, 0x3F, 0xAD, 0x35,
-        0xAD, 0x35, 0x72, 0x2B, 0x72, 0x2B, 0xE5, 0x20, 0xE5, 0x20, 0x19, 0x16, 0x19, 0x16, 0x23, 0x0B, 0x23, 0x0B,
-        0x18, 0x00, 0x18, 0x00, 0x0D, 0xF5, 0x0D, 0xF5, 0x17, 0xEA, 0x17, 0xEA, 0x4A, 0xDF, 0x4A, 0xDF, 0xBC, 0xD4,
-        0xBC, 0xD4, 0x80, 0xCA, 0x80, 0xCA, 0xAA, 0xC0, 0xAA, 0xC0, 0x4E, 0xB7, 0x4E, 0xB7, 0x7C, 0xAE, 0x7C, 0xAE,
-        0x47, 0xA6, 0x47, 0xA6, 0xBC, 0x9E, 0xBC, 0x9E, 0xEB, 0x97, 0xEB, 0x97, 0xE0, 0x91, 0xE0, 0x91, 0xA8, 0x8C,
-        0xA8, 0x8C, 0x4C, 0x88, 0x4C, 0x88, 0xD5, 0x84, 0xD5, 0x84, 0x49, 0x82, 0x49, 0x82, 0xAE, 0x80, 0xAE, 0x80,
-        0x05, 0x80, 0x05, 0x80, 0x51, 0x80, 0x51, 0x80, 0x90, 0x81, 0x90, 0x81, 0xC1, 0x83, 0xC1, 0x83, 0xDF, 0x86,
-        0xDF, 0x86, 0xE5, 0x8A, 0xE5, 0x8A, 0xCA, 0x8F, 0xCA, 0x8F, 0x85, 0x95, 0x85, 0x95, 0x0C, 0x9C, 0x0C, 0x9C,
-        0x52, 0xA3, 0x52, 0xA3, 0x48, 0xAB, 0x48, 0xAB, 0xE1, 0xB3, 0xE1, 0xB3, 0x0A, 0xBD, 0x0A, 0xBD, 0xB4, 0xC6,
-        0xB4, 0xC6, 0xCB, 0xD0, 0xCB, 0xD0, 0x3C, 0xDB, 0x3C, 0xDB, 0xF4, 0xE5, 0xF4, 0xE5, 0xDD, 0xF0, 0xDD, 0xF0,
-        0xE3, 0xFB, 0xE3, 0xFB, 0xEF, 0x06, 0xEF, 0x06, 0xF0, 0x11, 0xF0, 0x11, 0xCF, 0x1C, 0xCF, 0x1C, 0x76, 0x27,
-        0x76, 0x27, 0xD2, 0x31, 0xD2, 0x31, 0xCF, 0x3B, 0xCF, 0x3B, 0x5A, 0x45, 0x5A, 0x45, 0x60, 0x4E, 0x60, 0x4E,
-        0xD1, 0x56, 0xD1, 0x56, 0x9B, 0x5E, 0x9B, 0x5E, 0xB2, 0x65, 0xB2, 0x65, 0x05, 0x6C, 0x05, 0x6C, 0x8B, 0x71,
-        0x8B, 0x71, 0x38, 0x76, 0x38, 0x76, 0x03, 0x7A, 0x03, 0x7A, 0xE5, 0x7C, 0xE5, 0x7C, 0xD9, 0x7E, 0xD9, 0x7E,
-        0xDA, 0x7F, 0xDA, 0x7F, 0xE7, 0x7F, 0xE7, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x27, 0x7D, 0x27, 0x7D, 0x5E, 0x7A,
-        0x5E, 0x7A, 0xAC, 0x76, 0xAC, 0x76, 0x17, 0x72, 0x17, 0x72, 0xA9, 0x6C, 0xA9, 0x6C, 0x6A, 0x66, 0x6A, 0x66,
-        0x69, 0x5F, 0x69, 0x5F, 0xB1, 0x57, 0xB1, 0x57, 0x51, 0x4F, 0x51, 0x4F, 0x5A, 0x46, 0x5A, 0x46, 0xDD, 0x3C,
-        0xDD, 0x3C, 0xEC, 0x32, 0xEC, 0x32, 0x99, 0x28, 0x99, 0x28, 0xF9, 0x1D, 0xF9, 0x1D, 0x20, 0x13, 0x20, 0x13,
-        0x21, 0x08, 0x21, 0x08, 0x15, 0xFD, 0x15, 0xFD, 0x0D, 0xF2, 0x0D, 0xF2, 0x20, 0xE7, 0x20, 0xE7, 0x62, 0xDC,
-        0x62, 0xDC, 0xE8, 0xD1, 0xE8, 0xD1, 0xC7, 0xC7, 0xC7, 0xC7, 0x10, 0xBE, 0x10, 0xBE, 0xD8, 0xB4, 0xD8, 0xB4,
-        0x2F, 0xAC, 0x2F, 0xAC, 0x26, 0xA4, 0x26, 0xA4, 0xCD, 0x9C, 0xCD, 0x9C, 0x30, 0x96, 0x30, 0x96, 0x5F, 0x90,
-        0x5F, 0x90, 0x62, 0x8B, 0x62, 0x8B, 0x44, 0x87, 0x44, 0x87, 0x0C, 0x84, 0x0C, 0x84, 0xC1, 0x81, 0xC1, 0x81,
-        0x67, 0x80, 0x67, 0x80, 0x01, 0x80, 0x01, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x11, 0x82, 0x11, 0x82, 0x83, 0x84,
-        0x83, 0x84, 0xE1, 0x87, 0xE1, 0x87, 0x24, 0x8C, 0x24, 0x8C, 0x46, 0x91, 0x46, 0x91, 0x39, 0x97, 0x39, 0x97,
-        0xF5, 0x9D, 0xF5, 0x9D, 0x6D, 0xA5, 0x6D, 0xA5, 0x91, 0xAD, 0x91, 0xAD, 0x53, 0xB6, 0x53, 0xB6, 0xA1, 0xBF,
-        0xA1, 0xBF, 0x6A, 0xC9, 0x6A, 0xC9, 0x9C, 0xD3, 0x9C, 0xD3, 0x22, 0xDE, 0x22, 0xDE, 0xEA, 0xE8, 0xEA, 0xE8,
-        0xDD, 0xF3, 0xDD, 0xF3, 0xE6, 0xFE, 0xE6, 0xFE, 0xF2, 0x09, 0xF2, 0x09, 0xEB, 0x14, 0xEB, 0x14, 0xBD, 0x1F,
-        0xBD, 0x1F, 0x52, 0x2A, 0x52, 0x2A, 0x96, 0x34, 0x96, 0x34, 0x75, 0x3E, 0x75, 0x3E, 0xDD, 0x47, 0xDD, 0x47,
-        0xBD, 0x50, 0xBD, 0x50, 0x02, 0x59, 0x02, 0x59, 0x9D, 0x60, 0x9D, 0x60, 0x7F, 0x67, 0x7F, 0x67, 0x9C, 0x6D,
-        0x9C, 0x6D, 0xE7, 0x72, 0xE7, 0x72, 0x57, 0x77, 0x57, 0x77, 0xE4, 0x7A, 0xE4, 0x7A, 0x86, 0x7D, 0x86, 0x7D,
-        0x37, 0x7F, 0x37, 0x7F, 0xF6, 0x7F, 0xF6, 0x7F, 0xC0, 0x7F, 0xC0, 0x7F, 0x97, 0x7E, 0x97, 0x7E, 0x7C, 0x7C,
-        0x7C, 0x7C, 0x73, 0x79, 0x73, 0x79, 0x82, 0x75, 0x82, 0x75, 0xB1, 0x70, 0xB1, 0x70, 0x09, 0x6B, 0x09, 0x6B,
-        0x94, 0x64, 0x94, 0x64, 0x5F, 0x5D, 0x5F, 0x5D, 0x78, 0x55, 0x78, 0x55, 0xED, 0x4C, 0xED, 0x4C, 0xD1, 0x43,
-        0xD1, 0x43, 0x32, 0x3A, 0x32, 0x3A, 0x24, 0x30, 0x24, 0x30, 0xBA, 0x25, 0xBA, 0x25, 0x08, 0x1B, 0x08, 0x1B,
-        0x23, 0x10, 0x23, 0x10, 0x1E, 0x05, 0x1E, 0x05, 0x11, 0xFA, 0x11, 0xFA, 0x0F, 0xEF, 0x0F, 0xEF, 0x2C, 0xE4,
-        0x2C, 0xE4, 0x7F, 0xD9, 0x7F, 0xD9, 0x1B, 0xCF, 0x1B, 0xCF, 0x15, 0xC5, 0x15, 0xC5, 0x7F, 0xBB, 0x7F, 0xBB,
-        0x6C, 0xB2, 0x6C, 0xB2, 0xED, 0xA9, 0xED, 0xA9, 0x13, 0xA2, 0x13, 0xA2, 0xEC, 0x9A, 0xEC, 0x9A, 0x85, 0x94,
-        0x85, 0x94, 0xED, 0x8E, 0xED, 0x8E, 0x2C, 0x8A, 0x2C, 0x8A, 0x4C, 0x86, 0x4C, 0x86, 0x54, 0x83, 0x54, 0x83,
-        0x4B, 0x81, 0x4B, 0x81, 0x34, 0x80, 0x34, 0x80, 0x10, 0x80, 0x10, 0x80, 0xE1, 0x80, 0xE1, 0x80, 0xA4, 0x82,
-        0xA4, 0x82, 0x57, 0x85, 0x57, 0x85, 0xF4, 0x88, 0xF4, 0x88, 0x75, 0x8D, 0x75, 0x8D, 0xD0, 0x92, 0xD0, 0x92,
-        0xFC, 0x98, 0xFC, 0x98, 0xED, 0x9F, 0xED, 0x9F, 0x94, 0xA7, 0x94, 0xA7, 0xE5, 0xAF, 0xE5, 0xAF, 0xD0, 0xB8,
-        0xD0, 0xB8, 0x41, 0xC2, 0x41, 0xC2, 0x29, 0xCC, 0x29, 0xCC, 0x73, 0xD6, 0x73, 0xD6, 0x0D, 0xE1, 0x0D, 0xE1,
-        0xE2, 0xEB, 0xE2, 0xEB, 0xDE, 0xF6, 0xDE, 0xF6, 0xEA, 0x01, 0xEA, 0x01, 0xF3, 0x0C, 0xF3, 0x0C, 0xE4, 0x17,
-        0xE4, 0x17, 0xA6, 0x22, 0xA6, 0x22, 0x27, 0x2D, 0x27, 0x2D, 0x52, 0x37, 0x52, 0x37, 0x13, 0x41, 0x13, 0x41,
-        0x57, 0x4A, 0x57, 0x4A, 0x0E, 0x53, 0x0E, 0x53, 0x26, 0x5B, 0x26, 0x5B, 0x90, 0x62, 0x90, 0x62, 0x3E, 0x69,
-        0x3E, 0x69, 0x23, 0x6F, 0x23, 0x6F, 0x33, 0x74, 0x33, 0x74, 0x66, 0x78, 0x66, 0x78, 0xB3, 0x7B, 0xB3, 0x7B,
-        0x14, 0x7E, 0x14, 0x7E, 0x83, 0x7F, 0x83, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x88, 0x7F, 0x88, 0x7F, 0x1C, 0x7E,
-        0x1C, 0x7E, 0xBF, 0x7B, 0xBF, 0x7B, 0x77, 0x78, 0x77, 0x78, 0x48, 0x74, 0x48, 0x74, 0x3B, 0x6F, 0x3B, 0x6F,
-        0x5A, 0x69, 0x5A, 0x69, 0xAF, 0x62, 0xAF, 0x62, 0x49, 0x5B, 0x49, 0x5B, 0x33, 0x53, 0x33, 0x53, 0x80, 0x4A,
-        0x80, 0x4A, 0x3D, 0x41, 0x3D, 0x41, 0x7E, 0x37, 0x7E, 0x37, 0x55, 0x2D, 0x55, 0x2D, 0xD6, 0x22, 0xD6, 0x22,
-        0x14, 0x18, 0x14, 0x18, 0x24, 0x0D, 0x24, 0x0D, 0x1B, 0x02, 0x1B, 0x02, 0x0E, 0xF7, 0x0E, 0xF7, 0x13, 0xEC,
-        0x13, 0xEC, 0x3D, 0xE1, 0x3D, 0xE1, 0xA2, 0xD6, 0xA2, 0xD6, 0x55, 0xCC, 0x55, 0xCC, 0x6C, 0xC2, 0x6C, 0xC2,
-        0xF8, 0xB8, 0xF8, 0xB8, 0x0C, 0xB0, 0x0C, 0xB0, 0xB8, 0xA7, 0xB8, 0xA7, 0x0D, 0xA0, 0x0D, 0xA0, 0x19, 0x99,
-        0x19, 0x99, 0xEA, 0x92, 0xEA, 0x92, 0x8B, 0x8D, 0x8B, 0x8D, 0x07, 0x89, 0x07, 0x89, 0x65, 0x85, 0x65, 0x85,
-        0xAE, 0x82, 0xAE, 0x82, 0xE6, 0x80, 0xE6, 0x80, 0x11, 0x80, 0x11, 0x80, 0x30, 0x80, 0x30, 0x80, 0x44, 0x81,
-        0x44, 0x81, 0x49, 0x83, 0x49, 0x83, 0x3D, 0x86, 0x3D, 0x86, 0x18, 0x8A, 0x18, 0x8A, 0xD6, 0x8E, 0xD6, 0x8E,
-        0x6B, 0x94, 0x6B, 0x94, 0xCD, 0x9A, 0xCD, 0x9A, 0xF2, 0xA1, 0xF2, 0xA1, 0xC9, 0xA9, 0xC9, 0xA9, 0x45, 0xB2,
-        0x45, 0xB2, 0x55, 0xBB, 0x55, 0xBB, 0xE9, 0xC4, 0xE9, 0xC4, 0xEE, 0xCE, 0xEE, 0xCE, 0x50, 0xD9, 0x50, 0xD9,
-        0xFC, 0xE3, 0xFC, 0xE3, 0xDE, 0xEE, 0xDE, 0xEE, 0xE0, 0xF9, 0xE0, 0xF9, 0xEE, 0x04, 0xEE, 0x04, 0xF2, 0x0F,
-        0xF2, 0x0F, 0xD9, 0x1A, 0xD9, 0x1A, 0x8B, 0x25, 0x8B, 0x25, 0xF6, 0x2F, 0xF6, 0x2F, 0x06, 0x3A, 0x06, 0x3A,
-        0xA7, 0x43, 0xA7, 0x43, 0xC6, 0x4C, 0xC6, 0x4C, 0x54, 0x55, 0x54, 0x55, 0x3E, 0x5D, 0x3E, 0x5D, 0x76, 0x64,
-        0x76, 0x64, 0xEE, 0x6A, 0xEE, 0x6A, 0x9A, 0x70, 0x9A, 0x70, 0x6F, 0x75, 0x6F, 0x75, 0x63, 0x79, 0x63, 0x79,
-        0x71, 0x7C, 0x71, 0x7C, 0x90, 0x7E, 0x90, 0x7E, 0xBE, 0x7F, 0xBE, 0x7F, 0xF7, 0x7F, 0xF7, 0x7F, 0x3C, 0x7F,
-        0x3C, 0x7F, 0x8F, 0x7D, 0x8F, 0x7D, 0xF1, 0x7A, 0xF1, 0x7A, 0x69, 0x77, 0x69, 0x77, 0xFD, 0x72, 0xFD, 0x72,
-        0xB5, 0x6D, 0xB5, 0x6D, 0x9C, 0x67, 0x9C, 0x67, 0xBD, 0x60, 0xBD, 0x60, 0x25, 0x59, 0x25, 0x59, 0xE3, 0x50,
-        0xE3, 0x50, 0x06, 0x48, 0x06, 0x48, 0xA0, 0x3E, 0xA0, 0x3E, 0xC3, 0x34, 0xC3, 0x34, 0x80, 0x2A, 0x80, 0x2A,
-        0xEC, 0x1F, 0xEC, 0x1F, 0x1C, 0x15, 0x1C, 0x15, 0x23, 0x0A, 0x23, 0x0A, 0x18, 0xFF, 0x18, 0xFF, 0x0D, 0xF4,
-        0x0D, 0xF4, 0x19, 0xE9, 0x19, 0xE9, 0x51, 0xDE, 0x51, 0xDE, 0xCA, 0xD3, 0xCA, 0xD3, 0x97, 0xC9, 0x97, 0xC9,
-        0xCB, 0xBF, 0xCB, 0xBF, 0x7B, 0xB6, 0x7B, 0xB6, 0xB6, 0xAD, 0xB6, 0xAD, 0x8F, 0xA5, 0x8F, 0xA5, 0x15, 0x9E,
-        0x15, 0x9E, 0x55, 0x97, 0x55, 0x97, 0x5E, 0x91, 0x5E, 0x91, 0x39, 0x8C, 0x39, 0x8C, 0xF2, 0x87, 0xF2, 0x87,
-        0x90, 0x84, 0x90, 0x84, 0x1A, 0x82, 0x1A, 0x82, 0x94, 0x80, 0x94, 0x80, 0x01, 0x80, 0x01, 0x80, 0x64, 0x80,
-        0x64, 0x80, 0xB9, 0x81, 0xB9, 0x81, 0x00, 0x84, 0x00, 0x84, 0x33, 0x87, 0x33, 0x87, 0x4E, 0x8B, 0x4E, 0x8B,
-        0x46, 0x90, 0x46, 0x90, 0x15, 0x96, 0x15, 0x96, 0xAD, 0x9C, 0xAD, 0x9C, 0x04, 0xA4, 0x04, 0xA4, 0x09, 0xAC,
-        0x09, 0xAC, 0xB0, 0xB4, 0xB0, 0xB4, 0xE7, 0xBD, 0xE7, 0xBD, 0x9A, 0xC7, 0x9A, 0xC7, 0xBA, 0xD1, 0xBA, 0xD1,
-        0x33, 0xDC, 0x33, 0xDC, 0xF0, 0xE6, 0xF0, 0xE6, 0xDC, 0xF1, 0xDC, 0xF1, 0xE4, 0xFC, 0xE4, 0xFC, 0xF1, 0x07,
-        0xF1, 0x07, 0xEF, 0x12, 0xEF, 0x12, 0xC9, 0x1D, 0xC9, 0x1D, 0x6A, 0x28, 0x6A, 0x28, 0xBF, 0x32, 0xBF, 0x32,
-        0xB2, 0x3C, 0xB2, 0x3C, 0x31, 0x46, 0x31, 0x46, 0x2B, 0x4F, 0x2B, 0x4F, 0x8D, 0x57, 0x8D, 0x57, 0x48, 0x5F,
-        0x48, 0x5F, 0x4D, 0x66, 0x4D, 0x66, 0x8E, 0x6C, 0x8E, 0x6C, 0x01, 0x72, 0x01, 0x72, 0x9A, 0x76, 0x9A, 0x76,
-        0x50, 0x7A, 0x50, 0x7A, 0x1C, 0x7D, 0x1C, 0x7D, 0xFA, 0x7E, 0xFA, 0x7E, 0xE5, 0x7F, 0xE5, 0x7F, 0xDD, 0x7F,
-        0xDD, 0x7F, 0xDF, 0x7E, 0xDF, 0x7E, 0xF0, 0x7C, 0xF0, 0x7C, 0x12, 0x7A, 0x12, 0x7A, 0x4B, 0x76, 0x4B, 0x76,
-        0xA1, 0x71, 0xA1, 0x71, 0x20, 0x6C, 0x20, 0x6C, 0xCF, 0x65, 0xCF, 0x65, 0xBC, 0x5E, 0xBC, 0x5E, 0xF4, 0x56,
-        0xF4, 0x56, 0x87, 0x4E, 0x87, 0x4E, 0x83, 0x45, 0x83, 0x45, 0xFA, 0x3B, 0xFA, 0x3B, 0xFF, 0x31, 0xFF, 0x31,
-        0xA5, 0x27, 0xA5, 0x27, 0xFE, 0x1C, 0xFE, 0x1C, 0x21, 0x12, 0x21, 0x12, 0x21, 0x07, 0x21, 0x07, 0x14, 0xFC,
-        0x14, 0xFC, 0x0D, 0xF1, 0x0D, 0xF1, 0x23, 0xE6, 0x23, 0xE6, 0x6B, 0xDB, 0x6B, 0xDB, 0xF8, 0xD0, 0xF8, 0xD0,
-        0xE0, 0xC6, 0xE0, 0xC6, 0x34, 0xBD, 0x34, 0xBD, 0x08, 0xB4, 0x08, 0xB4, 0x6D, 0xAB, 0x6D, 0xAB, 0x73, 0xA3,
-        0x73, 0xA3, 0x2B, 0x9C, 0x2B, 0x9C, 0xA1, 0x95, 0xA1, 0x95, 0xE1, 0x8F, 0xE1, 0x8F, 0xF8, 0x8A, 0xF8, 0x8A,
-        0xEF, 0x86, 0xEF, 0x86, 0xCC, 0x83, 0xCC, 0x83, 0x98, 0x81, 0x98, 0x81, 0x54, 0x80, 0x54, 0x80, 0x04, 0x80,
-        0x04, 0x80, 0xA8, 0x80, 0xA8, 0x80, 0x40, 0x82, 0x40, 0x82, 0xC8, 0x84, 0xC8, 0x84, 0x3B, 0x88, 0x3B, 0x88,
-        0x93, 0x8C, 0x93, 0x8C, 0xC7, 0x91, 0xC7, 0x91, 0xCE, 0x97, 0xCE, 0x97, 0x9C, 0x9E, 0x9C, 0x9E, 0x23, 0xA6,
-        0x23, 0xA6, 0x56, 0xAE, 0x56, 0xAE, 0x25, 0xB7, 0x25, 0xB7, 0x80, 0xC0, 0x80, 0xC0, 0x53, 0xCA, 0x53, 0xCA,
-        0x8E, 0xD4, 0x8E, 0xD4, 0x1B, 0xDF, 0x1B, 0xDF, 0xE6, 0xE9, 0xE6, 0xE9, 0xDD, 0xF4, 0xDD, 0xF4, 0xE8, 0xFF,
-        0xE8, 0xFF, 0xF2, 0x0A, 0xF2, 0x0A, 0xE9, 0x15, 0xE9, 0x15, 0xB6, 0x20, 0xB6, 0x20, 0x44, 0x2B, 0x44, 0x2B,
-        0x80, 0x35, 0x80, 0x35, 0x55, 0x3F, 0x55, 0x3F, 0xB2, 0x48, 0xB2, 0x48, 0x84, 0x51, 0x84, 0x51, 0xBA, 0x59,
-        0xBA, 0x59, 0x45, 0x61, 0x45, 0x61, 0x16, 0x68, 0x16, 0x68, 0x20, 0x6E, 0x20, 0x6E, 0x58, 0x73, 0x58, 0x73,
-        0xB4, 0x77, 0xB4, 0x77, 0x2B, 0x7B, 0x2B, 0x7B, 0xB7, 0x7D, 0xB7, 0x7D, 0x52, 0x7F, 0x52, 0x7F, 0xFB, 0x7F,
-        0xFB, 0x7F, 0xAF, 0x7F, 0xAF, 0x7F, 0x70, 0x7E, 0x70, 0x7E, 0x3F, 0x7C, 0x3F, 0x7C, 0x21, 0x79, 0x21, 0x79,
-        0x1B, 0x75, 0x1B, 0x75, 0x37, 0x70, 0x37, 0x70, 0x7A, 0x6A, 0x7A, 0x6A, 0xF4, 0x63, 0xF4, 0x63, 0xAE, 0x5C,
-        0xAE, 0x5C, 0xB8, 0x54, 0xB8, 0x54, 0x20, 0x4C, 0x20, 0x4C, 0xF6, 0x42, 0xF6, 0x42, 0x4C, 0x39, 0x4C, 0x39,
-        0x35, 0x2F, 0x35, 0x2F, 0xC4, 0x24, 0xC4, 0x24, 0x0D, 0x1A, 0x0D, 0x1A, 0x23, 0x0F, 0x23, 0x0F, 0x1E, 0x04,
-        0x1E, 0x04, 0x10, 0xF9, 0x10, 0xF9, 0x10, 0xEE, 0x10, 0xEE, 0x32, 0xE3, 0x32, 0xE3, 0x8A, 0xD8, 0x8A, 0xD8,
-        0x2E, 0xCE, 0x2E, 0xCE, 0x31, 0xC4, 0x31, 0xC4, 0xA6, 0xBA, 0xA6, 0xBA, 0xA0, 0xB1, 0xA0, 0xB1, 0x2F, 0xA9,
-        0x2F, 0xA9, 0x65, 0xA1, 0x65, 0xA1, 0x4F, 0x9A, 0x4F, 0x9A, 0xFB, 0x93, 0xFB, 0x93, 0x75, 0x8E, 0x75, 0x8E,
-        0xC8, 0x89, 0xC8, 0x89, 0xFD, 0x85, 0xFD, 0x85, 0x1B, 0x83, 0x1B, 0x83, 0x27, 0x81, 0x27, 0x81, 0x26, 0x80,
-        0x26, 0x80, 0x18, 0x80, 0x18, 0x80, 0x00, 0x81, 0x00, 0x81, 0xD9, 0x82, 0xD9, 0x82, 0xA2, 0x85, 0xA2, 0x85,
-        0x54, 0x89, 0x54, 0x89, 0xE9, 0x8D, 0xE9, 0x8D, 0x57, 0x93, 0x57, 0x93, 0x96, 0x99, 0x96, 0x99, 0x97, 0xA0,
-        0x97, 0xA0, 0x4F, 0xA8, 0x4F, 0xA8, 0xAF, 0xB0, 0xAF, 0xB0, 0xA6, 0xB9, 0xA6, 0xB9, 0x23, 0xC3, 0x23, 0xC3,
-        0x14, 0xCD, 0x14, 0xCD, 0x67, 0xD7, 0x67, 0xD7, 0x07, 0xE2, 0x07, 0xE2, 0xE0, 0xEC, 0xE0, 0xEC, 0xDE, 0xF7,
-        0xDE, 0xF7, 0xEB, 0x02, 0xEB, 0x02, 0xF3, 0x0D, 0xF3, 0x0D, 0xE1, 0x18, 0xE1, 0x18, 0x9E, 0x23, 0x9E, 0x23,
-        0x18, 0x2E, 0x18, 0x2E, 0x39, 0x38, 0x39, 0x38, 0xF0, 0x41, 0xF0, 0x41, 0x29, 0x4B, 0x29, 0x4B, 0xD1, 0x53,
-        0xD1, 0x53, 0xDA, 0x5B, 0xDA, 0x5B, 0x33, 0x63, 0x33, 0x63, 0xD0, 0x69, 0xD0, 0x69, 0xA1, 0x6F, 0xA1, 0x6F,
-        0x9F, 0x74, 0x9F, 0x74, 0xBC, 0x78, 0xBC, 0x78, 0xF5, 0x7B, 0xF5, 0x7B, 0x3F, 0x7E, 0x3F, 0x7E, 0x99, 0x7F,
-        0x99, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x71, 0x7F, 0x71, 0x7F, 0xEF, 0x7D, 0xEF, 0x7D, 0x7D, 0x7B, 0x7D, 0x7B,
-        0x1E, 0x78, 0x1E, 0x78, 0xDB, 0x73, 0xDB, 0x73, 0xBB, 0x6E, 0xBB, 0x6E, 0xC7, 0x68, 0xC7, 0x68, 0x0B, 0x62,
-        0x0B, 0x62, 0x93, 0x5A, 0x93, 0x5A, 0x6F, 0x52, 0x6F, 0x52, 0xAE, 0x49, 0xAE, 0x49, 0x5F, 0x40, 0x5F, 0x40,
-        0x96, 0x36, 0x96, 0x36, 0x64, 0x2C, 0x64, 0x2C, 0xDE, 0x21, 0xDE, 0x21, 0x17, 0x17, 0x17, 0x17, 0x23, 0x0C,
-        0x23, 0x0C, 0x1A, 0x01, 0x1A, 0x01, 0x0E, 0xF6, 0x0E, 0xF6, 0x14, 0xEB, 0x14, 0xEB, 0x43, 0xE0, 0x43, 0xE0,
-        0xAE, 0xD5, 0xAE, 0xD5, 0x6A, 0xCB, 0x6A, 0xCB, 0x8B, 0xC1, 0x8B, 0xC1, 0x22, 0xB8, 0x22, 0xB8, 0x43, 0xAF,
-        0x43, 0xAF, 0xFE, 0xA6, 0xFE, 0xA6, 0x63, 0x9F, 0x63, 0x9F, 0x81, 0x98, 0x81, 0x98, 0x64, 0x92, 0x64, 0x92,
-        0x19, 0x8D, 0x19, 0x8D, 0xA9, 0x88, 0xA9, 0x88, 0x1D, 0x85, 0x1D, 0x85, 0x7A, 0x82, 0x7A, 0x82, 0xC9, 0x80,
-        0xC9, 0x80, 0x0A, 0x80, 0x0A, 0x80, 0x40, 0x80, 0x40, 0x80, 0x68, 0x81, 0x68, 0x81, 0x84, 0x83, 0x84, 0x83,
-        0x8D, 0x86, 0x8D, 0x86, 0x7E, 0x8A, 0x7E, 0x8A, 0x4F, 0x8F, 0x4F, 0x8F, 0xF7, 0x94, 0xF7, 0x94, 0x6C, 0x9B,
-        0x6C, 0x9B, 0xA1, 0xA2, 0xA1, 0xA2, 0x88, 0xAA, 0x88, 0xAA, 0x12, 0xB3, 0x12, 0xB3, 0x2F, 0xBC, 0x2F, 0xBC,
-        0xCE, 0xC5, 0xCE, 0xC5, 0xDC, 0xCF, 0xDC, 0xCF, 0x46, 0xDA, 0x46, 0xDA, 0xF8, 0xE4, 0xF8, 0xE4, 0xDD, 0xEF,
-        0xDD, 0xEF, 0xE1, 0xFA, 0xE1, 0xFA, 0xEE, 0x05, 0xEE, 0x05, 0xF2, 0x10, 0xF2, 0x10, 0xD4, 0x1B, 0xD4, 0x1B,
-        0x81, 0x26, 0x81, 0x26, 0xE4, 0x30, 0xE4, 0x30, 0xEB, 0x3A, 0xEB, 0x3A, 0x81, 0x44, 0x81, 0x44, 0x94, 0x4D,
-        0x94, 0x4D, 0x13, 0x56, 0x13, 0x56, 0xED, 0x5D, 0xED, 0x5D, 0x14, 0x65, 0x14, 0x65, 0x7B, 0x6B, 0x7B, 0x6B,
-        0x13, 0x71, 0x13, 0x71, 0xD5, 0x75, 0xD5, 0x75, 0xB4, 0x79, 0xB4, 0x79, 0xAC, 0x7C, 0xAC, 0x7C, 0xB5, 0x7E,
-        0xB5, 0x7E, 0xCD, 0x7F, 0xCD, 0x7F, 0xF1, 0x7F, 0xF1, 0x7F, 0x1F, 0x7F, 0x1F, 0x7F, 0x5C, 0x7D, 0x5C, 0x7D,
-        0xA9, 0x7A, 0xA9, 0x7A, 0x0C, 0x77, 0x0C, 0x77, 0x8B, 0x72, 0x8B, 0x72, 0x30, 0x6D, 0x30, 0x6D, 0x04, 0x67,
-        0x04, 0x67, 0x14, 0x60, 0x14, 0x60, 0x6B, 0x58, 0x6B, 0x58, 0x1B, 0x50, 0x1B, 0x50, 0x31, 0x47, 0x31, 0x47,
-        0xBF, 0x3D, 0xBF, 0x3D, 0xD7, 0x33, 0xD7, 0x33, 0x8D, 0x29, 0x8D, 0x29, 0xF3, 0x1E, 0xF3, 0x1E, 0x1E, 0x14,
-        0x1E, 0x14, 0x22, 0x09, 0x22, 0x09, 0x16, 0xFE, 0x16, 0xFE, 0x0D, 0xF3, 0x0D, 0xF3, 0x1D, 0xE8, 0x1D, 0xE8,
-        0x5A, 0xDD, 0x5A, 0xDD, 0xD8, 0xD2, 0xD8, 0xD2, 0xAE, 0xC8, 0xAE, 0xC8, 0xED, 0xBE, 0xED, 0xBE, 0xA9, 0xB5,
-        0xA9, 0xB5, 0xF1, 0xAC, 0xF1, 0xAC, 0xDA, 0xA4, 0xDA, 0xA4, 0x70, 0x9D, 0x70, 0x9D, 0xC2, 0x96, 0xC2, 0x96,
-        0xDD, 0x90, 0xDD, 0x90, 0xCD, 0x8B, 0xCD, 0x8B, 0x9A, 0x87, 0x9A, 0x87, 0x4D, 0x84, 0x4D, 0x84, 0xEC, 0x81,
-        0xEC, 0x81, 0x7D, 0x80, 0x7D, 0x80, 0x00, 0x80, 0x00, 0x80, 0x78, 0x80, 0x78, 0x80, 0xE4, 0x81, 0xE4, 0x81,
-        0x40, 0x84, 0x40, 0x84, 0x89, 0x87, 0x89, 0x87, 0xB8, 0x8B, 0xB8, 0x8B, 0xC5, 0x90, 0xC5, 0x90, 0xA6, 0x96,
-        0xA6, 0x96, 0x51, 0x9D, 0x51, 0x9D, 0xB7, 0xA4, 0xB7, 0xA4, 0xCD, 0xAC, 0xCD, 0xAC, 0x81, 0xB5, 0x81, 0xB5,
-        0xC3, 0xBE, 0xC3, 0xBE, 0x82, 0xC8, 0x82, 0xC8, 0xAB, 0xD2, 0xAB, 0xD2, 0x2B, 0xDD, 0x2B, 0xDD, 0xEC, 0xE7,
-        0xEC, 0xE7, 0xDD, 0xF2, 0xDD, 0xF2, 0xE5, 0xFD, 0xE5, 0xFD, 0xF1, 0x08, 0xF1, 0x08, 0xED, 0x13, 0xED, 0x13,
-        0xC3, 0x1E, 0xC3, 0x1E, 0x5E, 0x29, 0x5E, 0x29, 0xAB, 0x33, 0xAB, 0x33, 0x94, 0x3D, 0x94, 0x3D, 0x08, 0x47,
-        0x08, 0x47, 0xF4, 0x4F, 0xF4, 0x4F, 0x48, 0x58, 0x48, 0x58, 0xF3, 0x5F, 0xF3, 0x5F, 0xE7, 0x66, 0xE7, 0x66,
-        0x16, 0x6D, 0x16, 0x6D, 0x75, 0x72, 0x75, 0x72, 0xF9, 0x76, 0xF9, 0x76, 0x9B, 0x7A, 0x9B, 0x7A, 0x52, 0x7D,
-        0x52, 0x7D, 0x1A, 0x7F, 0x1A, 0x7F, 0xEF, 0x7F, 0xEF, 0x7F, 0xCF, 0x7F, 0xCF, 0x7F, 0xBC, 0x7E, 0xBC, 0x7E,
-        0xB7, 0x7C, 0xB7, 0x7C, 0xC3, 0x79, 0xC3, 0x79, 0xE7, 0x75, 0xE7, 0x75, 0x2A, 0x71, 0x2A, 0x71, 0x95, 0x6B,
-        0x95, 0x6B, 0x33, 0x65, 0x33, 0x65, 0x0E, 0x5E, 0x0E, 0x5E, 0x37, 0x56, 0x37, 0x56, 0xBB, 0x4D, 0xBB, 0x4D,
-        0xAA, 0x44, 0xAA, 0x44, 0x16, 0x3B, 0x16, 0x3B, 0x12, 0x31, 0x12, 0x31, 0xB0, 0x26, 0xB0, 0x26, 0x03, 0x1C,
-        0x03, 0x1C, 0x22, 0x11, 0x22, 0x11, 0x20, 0x06, 0x20, 0x06, 0x12, 0xFB, 0x12, 0xFB, 0x0E, 0xF0, 0x0E, 0xF0,
-        0x28, 0xE5, 0x28, 0xE5, 0x75, 0xDA, 0x75, 0xDA, 0x0A, 0xD0, 0x0A, 0xD0, 0xFA, 0xC5, 0xFA, 0xC5, 0x59, 0xBC,
-        0x59, 0xBC, 0x3A, 0xB3, 0x3A, 0xB3, 0xAD, 0xAA, 0xAD, 0xAA, 0xC2, 0xA2, 0xC2, 0xA2, 0x8A, 0x9B, 0x8A, 0x9B,
-        0x12, 0x95, 0x12, 0x95, 0x66, 0x8F, 0x66, 0x8F, 0x91, 0x8A, 0x91, 0x8A, 0x9D, 0x86, 0x9D, 0x86, 0x8F, 0x83,
-        0x8F, 0x83, 0x71, 0x81, 0x71, 0x81, 0x42, 0x80, 0x42, 0x80, 0x09, 0x80, 0x09, 0x80, 0xC3, 0x80, 0xC3, 0x80,
-        0x71, 0x82, 0x71, 0x82, 0x0E, 0x85, 0x0E, 0x85, 0x97, 0x88, 0x97, 0x88, 0x03, 0x8D, 0x03, 0x8D, 0x4B, 0x92,
-        0x4B, 0x92, 0x64, 0x98, 0x64, 0x98, 0x43, 0x9F, 0x43, 0x9F, 0xDB, 0xA6, 0xDB, 0xA6, 0x1D, 0xAF, 0x1D, 0xAF,
-        0xFA, 0xB7, 0xFA, 0xB7, 0x60, 0xC1, 0x60, 0xC1, 0x3E, 0xCB, 0x3E, 0xCB, 0x80, 0xD5, 0x80, 0xD5, 0x14, 0xE0,
-        0x14, 0xE0, 0xE4, 0xEA, 0xE4, 0xEA, 0xDD, 0xF5, 0xDD, 0xF5, 0xE9, 0x00, 0xE9, 0x00, 0xF3, 0x0B, 0xF3, 0x0B,
-        0xE7, 0x16, 0xE7, 0x16, 0xAE, 0x21, 0xAE, 0x21, 0x36, 0x2C, 0x36, 0x2C, 0x69, 0x36, 0x69, 0x36, 0x35, 0x40,
-        0x35, 0x40, 0x85, 0x49, 0x85, 0x49, 0x4A, 0x52, 0x4A, 0x52, 0x71, 0x5A, 0x71, 0x5A, 0xEB, 0x61, 0xEB, 0x61,
-        0xAA, 0x68, 0xAA, 0x68, 0xA2, 0x6E, 0xA2, 0x6E, 0xC6, 0x73, 0xC6, 0x73, 0x0E, 0x78, 0x0E, 0x78, 0x70, 0x7B,
-        0x70, 0x7B, 0xE7, 0x7D, 0xE7, 0x7D, 0x6C, 0x7F, 0x6C, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F,
-        0x47, 0x7E, 0x47, 0x7E, 0x00, 0x7C, 0x00, 0x7C, 0xCD, 0x78, 0xCD, 0x78, 0xB2, 0x74, 0xB2, 0x74, 0xBA, 0x6F,
-        0xBA, 0x6F, 0xEB, 0x69, 0xEB, 0x69, 0x53, 0x63, 0x53, 0x63, 0xFC, 0x5B, 0xFC, 0x5B, 0xF6, 0x53, 0xF6, 0x53,
-        0x50, 0x4B, 0x50, 0x4B, 0x1A, 0x42, 0x1A, 0x42, 0x66, 0x38, 0x66, 0x38, 0x46, 0x2E, 0x46, 0x2E, 0xCD, 0x23,
-        0xCD, 0x23, 0x10, 0x19, 0x10, 0x19, 0x24, 0x0E, 0x24, 0x0E, 0x1C, 0x03, 0x1C, 0x03, 0x10, 0xF8, 0x10, 0xF8,
-        0x11, 0xED, 0x11, 0xED, 0x37, 0xE2, 0x37, 0xE2, 0x95, 0xD7, 0x95, 0xD7, 0x41, 0xCD, 0x41, 0xCD, 0x4E, 0xC3,
-        0x4E, 0xC3, 0xCE, 0xB9, 0xCE, 0xB9, 0xD5, 0xB0, 0xD5, 0xB0, 0x73, 0xA8, 0x73, 0xA8, 0xB8, 0xA0, 0xB8, 0xA0,
-        0xB3, 0x99, 0xB3, 0x99, 0x71, 0x93, 0x71, 0x93, 0xFF, 0x8D, 0xFF, 0x8D, 0x67, 0x89, 0x67, 0x89, 0xB0, 0x85,
-        0xB0, 0x85, 0xE4, 0x82, 0xE4, 0x82, 0x05, 0x81, 0x05, 0x81, 0x1B, 0x80, 0x1B, 0x80, 0x23, 0x80, 0x23, 0x80,
-        0x21, 0x81, 0x21, 0x81, 0x10, 0x83, 0x10, 0x83, 0xEE, 0x85, 0xEE, 0x85, 0xB5, 0x89, 0xB5, 0x89, 0x5E, 0x8E,
-        0x5E, 0x8E, 0xE0, 0x93, 0xE0, 0x93, 0x31, 0x9A, 0x31, 0x9A, 0x44, 0xA1, 0x44, 0xA1, 0x0B, 0xA9, 0x0B, 0xA9,
-        0x79, 0xB1, 0x79, 0xB1, 0x7D, 0xBA, 0x7D, 0xBA, 0x06, 0xC4, 0x06, 0xC4, 0x01, 0xCE, 0x01, 0xCE, 0x5B, 0xD8,
-        0x5B, 0xD8, 0x01, 0xE3, 0x01, 0xE3, 0xDF, 0xED, 0xDF, 0xED, 0xE0, 0xF8, 0xE0, 0xF8, 0xED, 0x03, 0xED, 0x03,
-        0xF3, 0x0E, 0xF3, 0x0E, 0xDD, 0x19, 0xDD, 0x19, 0x95, 0x24, 0x95, 0x24, 0x07, 0x2F, 0x07, 0x2F, 0x20, 0x39,
-        0x20, 0x39, 0xCC, 0x42, 0xCC, 0x42, 0xF8, 0x4B, 0xF8, 0x4B, 0x93, 0x54, 0x93, 0x54, 0x8D, 0x5C, 0x8D, 0x5C,
-        0xD5, 0x63, 0xD5, 0x63, 0x60, 0x6A, 0x60, 0x6A, 0x1F, 0x70, 0x1F, 0x70, 0x08, 0x75, 0x08, 0x75, 0x11, 0x79,
-        0x11, 0x79, 0x34, 0x7C, 0x34, 0x7C, 0x68, 0x7E, 0x68, 0x7E, 0xAD, 0x7F, 0xAD, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F,
-        0x58, 0x7F, 0x58, 0x7F, 0xC0, 0x7D, 0xC0, 0x7D, 0x38, 0x7B, 0x38, 0x7B, 0xC5, 0x77, 0xC5, 0x77, 0x6D, 0x73,
-        0x6D, 0x73, 0x39, 0x6E, 0x39, 0x6E, 0x32, 0x68, 0x32, 0x68, 0x65, 0x61, 0x65, 0x61, 0xDD, 0x59, 0xDD, 0x59,
-        0xAA, 0x51, 0xAA, 0x51, 0xDB, 0x48, 0xDB, 0x48, 0x80, 0x3F, 0x80, 0x3F, 0xAD, 0x35, 0xAD, 0x35, 0x72, 0x2B,
-        0x72, 0x2B, 0xE5, 0x20, 0xE5, 0x20, 0x19, 0x16, 0x19, 0x16, 0x23, 0x0B, 0x23, 0x0B, 0x18, 0x00, 0x18, 0x00,
-        0x0D, 0xF5, 0x0D, 0xF5, 0x17, 0xEA, 0x17, 0xEA, 0x4A, 0xDF, 0x4A, 0xDF, 0xBC, 0xD4, 0xBC, 0xD4, 0x80, 0xCA,
-        0x80, 0xCA, 0xAA, 0xC0, 0xAA, 0xC0, 0x4E, 0xB7, 0x4E, 0xB7, 0x7C, 0xAE, 0x7C, 0xAE, 0x47, 0xA6, 0x47, 0xA6,
-        0xBC, 0x9E, 0xBC, 0x9E, 0xEB, 0x97, 0xEB, 0x97, 0xE0, 0x91, 0xE0, 0x91, 0xA8, 0x8C, 0xA8, 0x8C, 0x4C, 0x88,
-        0x4C, 0x88, 0xD5, 0x84, 0xD5, 0x84, 0x49, 0x82, 0x49, 0x82, 0xAE, 0x80, 0xAE, 0x80, 0x05, 0x80, 0x05, 0x80,
-        0x51, 0x80, 0x51, 0x80, 0x90, 0x81, 0x90, 0x81, 0xC1, 0x83, 0xC1, 0x83, 0xDF, 0x86, 0xDF, 0x86, 0xE5, 0x8A,
-        0xE5, 0x8A, 0xCA, 0x8F, 0xCA, 0x8F, 0x85, 0x95, 0x85, 0x95, 0x0C, 0x9C, 0x0C, 0x9C, 0x52, 0xA3, 0x52, 0xA3,
-        0x48, 0xAB, 0x48, 0xAB, 0xE1, 0xB3, 0xE1, 0xB3, 0x0A, 0xBD, 0x0A, 0xBD, 0xB4, 0xC6, 0xB4, 0xC6, 0xCB, 0xD0,
-        0xCB, 0xD0, 0x3C, 0xDB, 0x3C, 0xDB, 0xF4, 0xE5, 0xF4, 0xE5, 0xDD, 0xF0, 0xDD, 0xF0, 0xE3, 0xFB, 0xE3, 0xFB,
-        0xEF, 0x06, 0xEF, 0x06, 0xF0, 0x11, 0xF0, 0x11, 0xCF, 0x1C, 0xCF, 0x1C, 0x76, 0x27, 0x76, 0x27, 0xD2, 0x31,
-        0xD2, 0x31, 0xCF, 0x3B, 0xCF, 0x3B, 0x5A, 0x45, 0x5A, 0x45, 0x60, 0x4E, 0x60, 0x4E, 0xD1, 0x56, 0xD1, 0x56,
-        0x9B, 0x5E, 0x9B, 0x5E, 0xB2, 0x65, 0xB2, 0x65, 0x05, 0x6C, 0x05, 0x6C, 0x8B, 0x71, 0x8B, 0x71, 0x38, 0x76,
-        0x38, 0x76, 0x03, 0x7A, 0x03, 0x7A, 0xE5, 0x7C, 0xE5, 0x7C, 0xD9, 0x7E, 0xD9, 0x7E, 0xDA, 0x7F, 0xDA, 0x7F,
-        0xE7, 0x7F, 0xE7, 0x7F, 0x00, 0x7F, 0x00, 0x7F, 0x27, 0x7D, 0x27, 0x7D, 0x5E, 0x7A, 0x5E, 0x7A, 0xAC, 0x76,
-        0xAC, 0x76, 0x17, 0x72, 0x17, 0x72, 0xA9, 0x6C, 0xA9, 0x6C, 0x6A, 0x66, 0x6A, 0x66, 0x69, 0x5F, 0x69, 0x5F,
-        0xB1, 0x57, 0xB1, 0x57, 0x51, 0x4F, 0x51, 0x4F, 0x5A, 0x46, 0x5A, 0x46, 0xDD, 0x3C, 0xDD, 0x3C, 0xEC, 0x32,
-        0xEC, 0x32, 0x99, 0x28, 0x99, 0x28, 0xF9, 0x1D, 0xF9, 0x1D, 0x20, 0x13, 0x20, 0x13, 0x21, 0x08, 0x21, 0x08,
-        0x15, 0xFD, 0x15, 0xFD, 0x0D, 0xF2, 0x0D, 0xF2, 0x20, 0xE7, 0x20, 0xE7, 0x62, 0xDC, 0x62, 0xDC, 0xE8, 0xD1,
-        0xE8, 0xD1, 0xC7, 0xC7, 0xC7, 0xC7, 0x10, 0xBE, 0x10, 0xBE, 0xD8, 0xB4, 0xD8, 0xB4, 0x2F, 0xAC, 0x2F, 0xAC,
-        0x26, 0xA4, 0x26, 0xA4, 0xCD, 0x9C, 0xCD, 0x9C, 0x30, 0x96, 0x30, 0x96, 0x5F, 0x90, 0x5F, 0x90, 0x62, 0x8B,
-        0x62, 0x8B, 0x44, 0x87, 0x44, 0x87, 0x0C, 0x84, 0x0C, 0x84, 0xC1, 0x81, 0xC1, 0x81, 0x67, 0x80, 0x67, 0x80,
-        0x01, 0x80, 0x01, 0x80, 0x8F, 0x80, 0x8F, 0x80, 0x11, 0x82, 0x11, 0x82, 0x83, 0x84, 0x83, 0x84, 0xE1, 0x87,
-        0xE1, 0x87, 0x24, 0x8C, 0x24, 0x8C, 0x46, 0x91, 0x46, 0x91, 0x39, 0x97, 0x39, 0x97, 0xF5, 0x9D, 0xF5, 0x9D,
-        0x6D, 0xA5, 0x6D, 0xA5, 0x91, 0xAD, 0x91, 0xAD, 0x53, 0xB6, 0x53, 0xB6, 0xA1, 0xBF, 0xA1, 0xBF, 0x6A, 0xC9,
-        0x6A, 0xC9, 0x9C, 0xD3, 0x9C, 0xD3, 0x22, 0xDE, 0x22, 0xDE, 0xEA, 0xE8, 0xEA, 0xE8, 0xDD, 0xF3, 0xDD, 0xF3,
-        0xE6, 0xFE, 0xE6, 0xFE, 0xF2, 0x09, 0xF2, 0x09, 0xEB, 0x14, 0xEB, 0x14, 0xBD, 0x1F, 0xBD, 0x1F, 0x52, 0x2A,
-        0x52, 0x2A, 0x96, 0x34, 0x96, 0x34, 0x75, 0x3E, 0x75, 0x3E, 0xDD, 0x47, 0xDD, 0x47, 0xBD, 0x50, 0xBD, 0x50,
-        0x02, 0x59, 0x02, 0x59, 0x9D, 0x60, 0x9D, 0x60, 0x7F, 0x67, 0x7F, 0x67, 0x9C, 0x6D, 0x9C, 0x6D, 0xE7, 0x72,
-        0xE7, 0x72, 0x57, 0x77, 0x57, 0x77, 0xE4, 0x7A, 0xE4, 0x7A, 0x86, 0x7D, 0x86, 0x7D, 0x37, 0x7F, 0x37, 0x7F,
-        0xF6, 0x7F, 0xF6, 0x7F, 0xC0, 0x7F, 0xC0, 0x7F, 0x97, 0x7E, 0x97, 0x7E, 0x7C, 0x7C, 0x7C, 0x7C, 0x73, 0x79,
-        0x73, 0x79, 0x82, 0x75, 0x82, 0x75, 0xB1, 0x70, 0xB1, 0x70, 0x09, 0x6B, 0x09, 0x6B, 0x94, 0x64, 0x94, 0x64,
-        0x5F, 0x5D, 0x5F, 0x5D, 0x78, 0x55, 0x78, 0x55, 0xED, 0x4C, 0xED, 0x4C, 0xD1, 0x43, 0xD1, 0x43, 0x32, 0x3A,
-        0x32, 0x3A, 0x24, 0x30, 0x24, 0x30, 0xBA, 0x25, 0xBA, 0x25, 0x08, 0x1B, 0x08, 0x1B, 0x23, 0x10, 0x23, 0x10,
-        0x1E, 0x05, 0x1E, 0x05, 0x11, 0xFA, 0x11, 0xFA, 0x0F, 0xEF, 0x0F, 0xEF, 0x2C, 0xE4, 0x2C, 0xE4, 0x7F, 0xD9,
-        0x7F, 0xD9, 0x1B, 0xCF, 0x1B, 0xCF, 0x15, 0xC5, 0x15, 0xC5, 0x7F, 0xBB, 0x7F, 0xBB, 0x6C, 0xB2, 0x6C, 0xB2,
-        0xED, 0xA9, 0xED, 0xA9, 0x13, 0xA2, 0x13, 0xA2, 0xEC, 0x9A, 0xEC, 0x9A, 0x85, 0x94, 0x85, 0x94, 0xED, 0x8E,
-        0xED, 0x8E, 0x2C, 0x8A, 0x2C, 0x8A, 0x4C, 0x86, 0x4C, 0x86, 0x54, 0x83, 0x54, 0x83, 0x4B, 0x81, 0x4B, 0x81,
-        0x34, 0x80, 0x34, 0x80, 0x10, 0x80, 0x10, 0x80, 0xE1, 0x80, 0xE1, 0x80, 0xA4, 0x82, 0xA4, 0x82, 0x57, 0x85,
-        0x57, 0x85, 0xF4, 0x88, 0xF4, 0x88, 0x75, 0x8D, 0x75, 0x8D, 0xD0, 0x92, 0xD0, 0x92, 0xFC, 0x98, 0xFC, 0x98,
-        0xED, 0x9F, 0xED, 0x9F, 0x94, 0xA7, 0x94, 0xA7, 0xE5, 0xAF, 0xE5, 0xAF, 0xD0, 0xB8, 0xD0, 0xB8, 0x41, 0xC2,
-        0x41, 0xC2, 0x29, 0xCC, 0x29, 0xCC, 0x73, 0xD6, 0x73, 0xD6, 0x0D, 0xE1, 0x0D, 0xE1, 0xE2, 0xEB, 0xE2, 0xEB,
-        0xDE, 0xF6, 0xDE, 0xF6, 0xEA, 0x01, 0xEA, 0x01, 0xF3, 0x0C, 0xF3, 0x0C, 0xE4, 0x17, 0xE4, 0x17, 0xA6, 0x22,
-        0xA6, 0x22, 0x27, 0x2D, 0x27, 0x2D, 0x52, 0x37, 0x52, 0x37, 0x13, 0x41, 0x13, 0x41, 0x57, 0x4A, 0x57, 0x4A,
-        0x0E, 0x53, 0x0E, 0x53, 0x26, 0x5B, 0x26, 0x5B, 0x90, 0x62, 0x90, 0x62, 0x3E, 0x69, 0x3E, 0x69, 0x23, 0x6F,
-        0x23, 0x6F, 0x33, 0x74, 0x33, 0x74, 0x66, 0x78, 0x66, 0x78, 0xB3, 0x7B, 0xB3, 0x7B, 0x14, 0x7E, 0x14, 0x7E,
-        0x83, 0x7F, 0x83, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x88, 0x7F, 0x88, 0x7F, 0x1C, 0x7E, 0x1C, 0x7E, 0xBF, 0x7B,
-        0xBF, 0x7B, 0x77, 0x78, 0x77, 0x78, 0x48, 0x74, 0x48, 0x74, 0x3B, 0x6F, 0x3B, 0x6F, 0x5A, 0x69, 0x5A, 0x69,
-        0xAF, 0x62, 0xAF, 0x62, 0x49, 0x5B, 0x49, 0x5B, 0x33, 0x53, 0x33, 0x53, 0x80, 0x4A, 0x80, 0x4A, 0x3D, 0x41,
-        0x3D, 0x41, 0x7E, 0x37, 0x7E, 0x37, 0x55, 0x2D, 0x55, 0x2D, 0xD6, 0x22, 0xD6, 0x22, 0x14, 0x18, 0x14, 0x18,
-        0x24, 0x0D, 0x24, 0x0D, 0x1B, 0x02, 0x1B, 0x02, 0x0E, 0xF7, 0x0E, 0xF7, 0x13, 0xEC, 0x13, 0xEC, 0x3D, 0xE1,
-        0x3D, 0xE1, 0xA2, 0xD6, 0xA2, 0xD6, 0x55, 0xCC, 0x55, 0xCC, 0x6C, 0xC2, 0x6C, 0xC2, 0xF8, 0xB8, 0xF8, 0xB8,
-        0x0C, 0xB0, 0x0C, 0xB0, 0xB8, 0xA7, 0xB8, 0xA7, 0x0D, 0xA0, 0x0D, 0xA0, 0x19, 0x99, 0x19, 0x99, 0xEA, 0x92,
-        0xEA, 0x92, 0x8B, 0x8D, 0x8B, 0x8D, 0x07, 0x89, 0x07, 0x89, 0x65, 0x85, 0x65, 0x85, 0xAE, 0x82, 0xAE, 0x82,
-        0xE6, 0x80, 0xE6, 0x80, 0x11, 0x80, 0x11, 0x80, 0x30, 0x80, 0x30, 0x80, 0x44, 0x81, 0x44, 0x81, 0x49, 0x83,
-        0x49, 0x83, 0x3D, 0x86, 0x3D, 0x86, 0x18, 0x8A, 0x18, 0x8A, 0xD6, 0x8E, 0xD6, 0x8E, 0x6B, 0x94, 0x6B, 0x94,
-        0xCD, 0x9A, 0xCD, 0x9A, 0xF2, 0xA1, 0xF2, 0xA1, 0xC9, 0xA9, 0xC9, 0xA9, 0x45, 0xB2, 0x45, 0xB2, 0x55, 0xBB,
-        0x55, 0xBB, 0xE9, 0xC4, 0xE9, 0xC4, 0xEE, 0xCE, 0xEE, 0xCE, 0x50, 0xD9, 0x50, 0xD9, 0xFC, 0xE3, 0xFC, 0xE3,
-        0xDE, 0xEE, 0xDE, 0xEE, 0xE0, 0xF9, 0xE0, 0xF9, 0xEE, 0x04, 0xEE, 0x04, 0xF2, 0x0F, 0xF2, 0x0F, 0xD9, 0x1A,
-        0xD9, 0x1A, 0x8B, 0x25, 0x8B, 0x25, 0xF6, 0x2F, 0xF6, 0x2F, 0x06, 0x3A, 0x06, 0x3A, 0xA7, 0x43, 0xA7, 0x43,
-        0xC6, 0x4C, 0xC6, 0x4C, 0x54, 0x55, 0x54, 0x55, 0x3E, 0x5D, 0x3E, 0x5D, 0x76, 0x64, 0x76, 0x64, 0xEE, 0x6A,
-        0xEE, 0x6A, 0x9A, 0x70, 0x9A, 0x70, 0x6F, 0x75, 0x6F, 0x75, 0x63, 0x79, 0x63, 0x79, 0x71, 0x7C, 0x71, 0x7C,
-        0x90, 0x7E, 0x90, 0x7E, 0xBE, 0x7F, 0xBE, 0x7F, 0xF7, 0x7F, 0xF7, 0x7F, 0x3C, 0x7F, 0x3C, 0x7F, 0x8F, 0x7D,
-        0x8F, 0x7D, 0xF1, 0x7A, 0xF1, 0x7A, 0x69, 0x77, 0x69, 0x77, 0xFD, 0x72, 0xFD, 0x72, 0xB5, 0x6D, 0xB5, 0x6D,
-        0x9C, 0x67, 0x9C, 0x67, 0xBD, 0x60, 0xBD, 0x60, 0x25, 0x59, 0x25, 0x59, 0xE3, 0x50, 0xE3, 0x50, 0x06, 0x48,
-        0x06, 0x48, 0xA0, 0x3E, 0xA0, 0x3E, 0xC3, 0x34, 0xC3, 0x34, 0x80, 0x2A, 0x80, 0x2A, 0xEC, 0x1F, 0xEC, 0x1F,
-        0x1C, 0x15, 0x1C, 0x15, 0x23, 0x0A, 0x23, 0x0A, 0x18, 0xFF, 0x18, 0xFF, 0x0D, 0xF4, 0x0D, 0xF4, 0x19, 0xE9,
-        0x19, 0xE9, 0x51, 0xDE, 0x51, 0xDE, 0xCA, 0xD3, 0xCA, 0xD3, 0x97, 0xC9, 0x97, 0xC9, 0xCB, 0xBF, 0xCB, 0xBF,
-        0x7B, 0xB6, 0x7B, 0xB6, 0xB6, 0xAD, 0xB6, 0xAD, 0x8F, 0xA5, 0x8F, 0xA5, 0x15, 0x9E, 0x15, 0x9E, 0x55, 0x97,
-        0x55, 0x97, 0x5E, 0x91, 0x5E, 0x91, 0x39, 0x8C, 0x39, 0x8C, 0xF2, 0x87, 0xF2, 0x87, 0x90, 0x84, 0x90, 0x84,
-        0x1A, 0x82, 0x1A, 0x82, 0x94, 0x80, 0x94, 0x80, 0x01, 0x80, 0x01, 0x80, 0x64, 0x80, 0x64, 0x80, 0xB9, 0x81,
-        0xB9, 0x81, 0x00, 0x84, 0x00, 0x84, 0x33, 0x87, 0x33, 0x87, 0x4E, 0x8B, 0x4E, 0x8B, 0x46, 0x90, 0x46, 0x90,
-        0x15, 0x96, 0x15, 0x96, 0xAD, 0x9C, 0xAD, 0x9C, 0x04, 0xA4, 0x04, 0xA4, 0x09, 0xAC, 0x09, 0xAC, 0xB0, 0xB4,
-        0xB0, 0xB4, 0xE7, 0xBD, 0xE7, 0xBD, 0x9A, 0xC7, 0x9A, 0xC7, 0xBA, 0xD1, 0xBA, 0xD1, 0x33, 0xDC, 0x33, 0xDC,
-        0xF0, 0xE6, 0xF0, 0xE6, 0xDC, 0xF1, 0xDC, 0xF1, 0xE4, 0xFC, 0xE4, 0xFC, 0xF1, 0x07, 0xF1, 0x07, 0xEF, 0x12,
-        0xEF, 0x12, 0xC9, 0x1D, 0xC9, 0x1D, 0x6A, 0x28, 0x6A, 0x28, 0xBF, 0x32, 0xBF, 0x32, 0xB2, 0x3C, 0xB2, 0x3C,
-        0x31, 0x46, 0x31, 0x46, 0x2B, 0x4F, 0x2B, 0x4F, 0x8D, 0x57, 0x8D, 0x57, 0x48, 0x5F, 0x48, 0x5F, 0x4D, 0x66,
-        0x4D, 0x66, 0x8E, 0x6C, 0x8E, 0x6C, 0x01, 0x72, 0x01, 0x72, 0x9A, 0x76, 0x9A, 0x76, 0x50, 0x7A, 0x50, 0x7A,
-        0x1C, 0x7D, 0x1C, 0x7D, 0xFA, 0x7E, 0xFA, 0x7E, 0xE5, 0x7F, 0xE5, 0x7F, 0xDD, 0x7F, 0xDD, 0x7F, 0xDF, 0x7E,
-        0xDF, 0x7E, 0xF0, 0x7C, 0xF0, 0x7C, 0x12, 0x7A, 0x12, 0x7A, 0x4B, 0x76, 0x4B, 0x76, 0xA1, 0x71, 0xA1, 0x71,
-        0x20, 0x6C, 0x20, 0x6C, 0xCF, 0x65, 0xCF, 0x65, 0xBC, 0x5E, 0xBC, 0x5E, 0xF4, 0x56, 0xF4, 0x56, 0x87, 0x4E,
-        0x87, 0x4E, 0x83, 0x45, 0x83, 0x45, 0xFA, 0x3B, 0xFA, 0x3B, 0xFF, 0x31, 0xFF, 0x31, 0xA5, 0x27, 0xA5, 0x27,
-        0xFE, 0x1C, 0xFE, 0x1C, 0x21, 0x12, 0x21, 0x12, 0x21, 0x07, 0x21, 0x07, 0x14, 0xFC, 0x14, 0xFC, 0x0D, 0xF1,
-        0x0D, 0xF1, 0x23, 0xE6, 0x23, 0xE6, 0x6B, 0xDB, 0x6B, 0xDB, 0xF8, 0xD0, 0xF8, 0xD0, 0xE0, 0xC6, 0xE0, 0xC6,
-        0x34, 0xBD, 0x34, 0xBD, 0x08, 0xB4, 0x08, 0xB4, 0x6D, 0xAB, 0x6D, 0xAB, 0x73, 0xA3, 0x73, 0xA3, 0x2B, 0x9C,
-        0x2B, 0x9C, 0xA1, 0x95, 0xA1, 0x95, 0xE1, 0x8F, 0xE1, 0x8F, 0xF8, 0x8A, 0xF8, 0x8A, 0xEF, 0x86, 0xEF, 0x86,
-        0xCC, 0x83, 0xCC, 0x83, 0x98, 0x81, 0x98, 0x81, 0x54, 0x80, 0x54, 0x80, 0x04, 0x80, 0x04, 0x80, 0xA8, 0x80,
-        0xA8, 0x80, 0x40, 0x82, 0x40, 0x82, 0xC8, 0x84, 0xC8, 0x84, 0x3B, 0x88, 0x3B, 0x88, 0x93, 0x8C, 0x93, 0x8C,
-        0xC7, 0x91, 0xC7, 0x91, 0xCE, 0x97, 0xCE, 0x97, 0x9C, 0x9E, 0x9C, 0x9E, 0x23, 0xA6, 0x23, 0xA6, 0x56, 0xAE,
-        0x56, 0xAE, 0x25, 0xB7, 0x25, 0xB7, 0x80, 0xC0, 0x80, 0xC0, 0x53, 0xCA, 0x53, 0xCA, 0x8E, 0xD4, 0x8E, 0xD4,
-        0x1B, 0xDF, 0x1B, 0xDF, 0xE6, 0xE9, 0xE6, 0xE9, 0xDD, 0xF4, 0xDD, 0xF4, 0xE8, 0xFF, 0xE8, 0xFF, 0xF2, 0x0A,
-        0xF2, 0x0A, 0xE9, 0x15, 0xE9, 0x15, 0xB6, 0x20, 0xB6, 0x20, 0x44, 0x2B, 0x44, 0x2B, 0x80, 0x35, 0x80, 0x35,
-        0x55, 0x3F, 0x55, 0x3F, 0xB2, 0x48, 0xB2, 0x48, 0x84, 0x51, 0x84, 0x51, 0xBA, 0x59, 0xBA, 0x59, 0x45, 0x61,
-        0x45, 0x61, 0x16, 0x68, 0x16, 0x68, 0x20, 0x6E, 0x20, 0x6E, 0x58, 0x73, 0x58, 0x73, 0xB4, 0x77, 0xB4, 0x77,
-        0x2B, 0x7B, 0x2B, 0x7B, 0xB7, 0x7D, 0xB7, 0x7D, 0x52, 0x7F, 0x52, 0x7F, 0xFB, 0x7F, 0xFB, 0x7F, 0xAF, 0x7F,
-        0xAF, 0x7F, 0x70, 0x7E, 0x70, 0x7E, 0x3F, 0x7C, 0x3F, 0x7C, 0x21, 0x79, 0x21, 0x79, 0x1B, 0x75, 0x1B, 0x75,
-        0x37, 0x70, 0x37, 0x70, 0x7A, 0x6A, 0x7A, 0x6A, 0xF4, 0x63, 0xF4, 0x63, 0xAE, 0x5C, 0xAE, 0x5C, 0xB8, 0x54,
-        0xB8, 0x54, 0x20, 0x4C, 0x20, 0x4C, 0xF6, 0x42, 0xF6, 0x42, 0x4C, 0x39, 0x4C, 0x39, 0x35, 0x2F, 0x35, 0x2F,
-        0xC4, 0x24, 0xC4, 0x24, 0x0D, 0x1A, 0x0D, 0x1A, 0x23, 0x0F, 0x23, 0x0F, 0x1E, 0x04, 0x1E, 0x04, 0x10, 0xF9,
-        0x10, 0xF9, 0x10, 0xEE, 0x10, 0xEE, 0x32, 0xE3, 0x32, 0xE3, 0x8A, 0xD8, 0x8A, 0xD8, 0x2E, 0xCE, 0x2E, 0xCE,
-        0x31, 0xC4, 0x31, 0xC4, 0xA6, 0xBA, 0xA6, 0xBA, 0xA0, 0xB1, 0xA0, 0xB1, 0x2F, 0xA9, 0x2F, 0xA9, 0x65, 0xA1,
-        0x65, 0xA1, 0x4F, 0x9A, 0x4F, 0x9A, 0xFB, 0x93, 0xFB, 0x93, 0x75, 0x8E, 0x75, 0x8E, 0xC8, 0x89, 0xC8, 0x89,
-        0xFD, 0x85, 0xFD, 0x85, 0x1B, 0x83, 0x1B, 0x83, 0x27, 0x81, 0x27, 0x81, 0x26, 0x80, 0x26, 0x80, 0x18, 0x80,
-        0x18, 0x80, 0x00, 0x81, 0x00, 0x81, 0xD9, 0x82, 0xD9, 0x82, 0xA2, 0x85, 0xA2, 0x85, 0x54, 0x89, 0x54, 0x89,
-        0xE9, 0x8D, 0xE9, 0x8D, 0x57, 0x93, 0x57, 0x93, 0x96, 0x99, 0x96, 0x99, 0x97, 0xA0, 0x97, 0xA0, 0x4F, 0xA8,
-        0x4F, 0xA8, 0xAF, 0xB0, 0xAF, 0xB0, 0xA6, 0xB9, 0xA6, 0xB9, 0x23, 0xC3, 0x23, 0xC3, 0x14, 0xCD, 0x14, 0xCD,
-        0x67, 0xD7, 0x67, 0xD7, 0x07, 0xE2, 0x07, 0xE2, 0xE0, 0xEC, 0xE0, 0xEC, 0xDE, 0xF7, 0xDE, 0xF7, 0xEB, 0x02,
-        0xEB, 0x02, 0xF3, 0x0D, 0xF3, 0x0D, 0xE1, 0x18, 0xE1, 0x18, 0x9E, 0x23, 0x9E, 0x23, 0x18, 0x2E, 0x18, 0x2E,
-        0x39, 0x38, 0x39, 0x38, 0xF0, 0x41, 0xF0, 0x41, 0x29, 0x4B, 0x29, 0x4B, 0xD1, 0x53, 0xD1, 0x53, 0xDA, 0x5B,
-        0xDA, 0x5B, 0x33, 0x63, 0x33, 0x63, 0xD0, 0x69, 0xD0, 0x69, 0xA1, 0x6F, 0xA1, 0x6F, 0x9F, 0x74, 0x9F, 0x74,
-        0xBC, 0x78, 0xBC, 0x78, 0xF5, 0x7B, 0xF5, 0x7B, 0x3F, 0x7E, 0x3F, 0x7E, 0x99, 0x7F, 0x99, 0x7F, 0xFF, 0x7F,
-        0xFF, 0x7F, 0x71, 0x7F, 0x71, 0x7F, 0xEF, 0x7D, 0xEF, 0x7D, 0x7D, 0x7B, 0x7D, 0x7B, 0x1E, 0x78, 0x1E, 0x78,
-        0xDB, 0x73, 0xDB, 0x73, 0xBB, 0x6E, 0xBB, 0x6E, 0xC7, 0x68, 0xC7, 0x68, 0x0B, 0x62, 0x0B, 0x62, 0x93, 0x5A,
-        0x93, 0x5A, 0x6F, 0x52, 0x6F, 0x52, 0xAE, 0x49, 0xAE, 0x49, 0x5F, 0x40, 0x5F, 0x40, 0x96, 0x36, 0x96, 0x36,
-        0x64, 0x2C, 0x64, 0x2C, 0xDE, 0x21, 0xDE, 0x21, 0x17, 0x17, 0x17, 0x17, 0x23, 0x0C, 0x23, 0x0C, 0x1A, 0x01,
-        0x1A, 0x01, 0x0E, 0xF6, 0x0E, 0xF6, 0x14, 0xEB, 0x14, 0xEB, 0x43, 0xE0, 0x43, 0xE0, 0xAE, 0xD5, 0xAE, 0xD5,
-        0x6A, 0xCB, 0x6A, 0xCB, 0x8B, 0xC1, 0x8B, 0xC1, 0x22, 0xB8, 0x22, 0xB8, 0x43, 0xAF, 0x43, 0xAF, 0xFE, 0xA6,
-        0xFE, 0xA6, 0x63, 0x9F, 0x63, 0x9F, 0x81, 0x98, 0x81, 0x98, 0x64, 0x92, 0x64, 0x92, 0x19, 0x8D, 0x19, 0x8D,
-        0xA9, 0x88, 0xA9, 0x88, 0x1D, 0x85, 0x1D, 0x85, 0x7A, 0x82, 0x7A, 0x82, 0xC9, 0x80, 0xC9, 0x80, 0x0A, 0x80,
-        0x0A, 0x80, 0x40, 0x80, 0x40, 0x80, 0x68, 0x81, 0x68, 0x81, 0x84, 0x83, 0x84, 0x83, 0x8D, 0x86, 0x8D, 0x86,
-        0x7E, 0x8A, 0x7E, 0x8A, 0x4F, 0x8F, 0x4F, 0x8F, 0xF7, 0x94, 0xF7, 0x94, 0x6C, 0x9B, 0x6C, 0x9B, 0xA1, 0xA2,
-        0xA1, 0xA2, 0x88, 0xAA, 0x88, 0xAA, 0x12, 0xB3, 0x12, 0xB3, 0x2F, 0xBC, 0x2F, 0xBC, 0xCE, 0xC5, 0xCE, 0xC5,
-        0xDC, 0xCF, 0xDC, 0xCF, 0x46, 0xDA, 0x46, 0xDA, 0xF8, 0xE4, 0xF8, 0xE4, 0xDD, 0xEF, 0xDD, 0xEF, 0xE1, 0xFA,
-        0xE1, 0xFA, 0xEE, 0x05, 0xEE, 0x05, 0xF2, 0x10, 0xF2, 0x10, 0xD4, 0x1B, 0xD4, 0x1B, 0x81, 0x26, 0x81, 0x26,
-        0xE4, 0x30, 0xE4, 0x30, 0xEB, 0x3A, 0xEB, 0x3A, 0x81, 0x44, 0x81, 0x44, 0x94, 0x4D, 0x94, 0x4D, 0x13, 0x56,
-        0x13, 0x56, 0xED, 0x5D, 0xED, 0x5D, 0x14, 0x65, 0x14, 0x65, 0x7B, 0x6B, 0x7B, 0x6B, 0x13, 0x71, 0x13, 0x71,
-        0xD5, 0x75, 0xD5, 0x75, 0xB4, 0x79, 0xB4, 0x79, 0xAC, 0x7C, 0xAC, 0x7C, 0xB5, 0x7E, 0xB5, 0x7E, 0xCD, 0x7F,
-        0xCD, 0x7F, 0xF1, 0x7F, 0xF1, 0x7F, 0x1F, 0x7F, 0x1F, 0x7F, 0x5C, 0x7D, 0x5C, 0x7D, 0xA9, 0x7A, 0xA9, 0x7A,
-        0x0C, 0x77, 0x0C, 0x77, 0x8B, 0x72, 0x8B, 0x72, 0x30, 0x6D, 0x30, 0x6D, 0x04, 0x67, 0x04, 0x67, 0x14, 0x60,
-        0x14, 0x60, 0x6B, 0x58, 0x6B, 0x58, 0x1B, 0x50, 0x1B, 0x50, 0x31, 0x47, 0x31, 0x47, 0xBF, 0x3D, 0xBF, 0x3D,
-        0xD7, 0x33, 0xD7, 0x33, 0x8D, 0x29, 0x8D, 0x29, 0xF3, 0x1E, 0xF3, 0x1E, 0x1E, 0x14, 0x1E, 0x14, 0x22, 0x09,
-        0x22, 0x09, 0x16, 0xFE, 0x16, 0xFE, 0x0D, 0xF3, 0x0D, 0xF3, 0x1D, 0xE8, 0x1D, 0xE8, 0x5A, 0xDD, 0x5A, 0xDD,
-        0xD8, 0xD2, 0xD8, 0xD2, 0xAE, 0xC8, 0xAE, 0xC8, 0xED, 0xBE, 0xED, 0xBE, 0xA9, 0xB5, 0xA9, 0xB5, 0xF1, 0xAC,
-        0xF1, 0xAC, 0xDA, 0xA4, 0xDA, 0xA4, 0x70, 0x9D, 0x70, 0x9D, 0xC2, 0x96, 0xC2, 0x96, 0xDD, 0x90, 0xDD, 0x90,
-        0xCD, 0x8B, 0xCD, 0x8B, 0x9A, 0x87, 0x9A, 0x87, 0x4D, 0x84, 0x4D, 0x84, 0xEC, 0x81, 0xEC, 0x81, 0x7D, 0x80,
-        0x7D, 0x80, 0x00, 0x80, 0x00, 0x80, 0x78, 0x80, 0x78, 0x80, 0xE4, 0x81, 0xE4, 0x81, 0x40, 0x84, 0x40, 0x84,
-        0x89, 0x87, 0x89, 0x87, 0xB8, 0x8B, 0xB8, 0x8B, 0xC5, 0x90, 0xC5, 0x90, 0xA6, 0x96, 0xA6, 0x96, 0x51, 0x9D,
-        0x51, 0x9D, 0xB7, 0xA4, 0xB7, 0xA4, 0xCD, 0xAC, 0xCD, 0xAC, 0x81, 0xB5, 0x81, 0xB5, 0xC3, 0xBE, 0xC3, 0xBE,
-        0x82, 0xC8, 0x82, 0xC8, 0xAB, 0xD2, 0xAB, 0xD2, 0x2B, 0xDD, 0x2B, 0xDD, 0xEC, 0xE7, 0xEC, 0xE7, 0xDD, 0xF2,
-        0xDD, 0xF2, 0xE5, 0xFD, 0xE5, 0xFD, 0xF1, 0x08, 0xF1, 0x08, 0xED, 0x13, 0xED, 0x13, 0xC3, 0x1E, 0xC3, 0x1E,
-        0x5E, 0x29, 0x5E, 0x29, 0xAB, 0x33, 0xAB, 0x33, 0x94, 0x3D, 0x94, 0x3D, 0x08, 0x47, 0x08, 0x47, 0xF4, 0x4F,
-        0xF4, 0x4F, 0x48, 0x58, 0x48, 0x58, 0xF3, 0x5F, 0xF3, 0x5F, 0xE7, 0x66, 0xE7, 0x66, 0x16, 0x6D, 0x16, 0x6D,
-        0x75, 0x72, 0x75, 0x72, 0xF9, 0x76, 0xF9, 0x76, 0x9B, 0x7A, 0x9B, 0x7A, 0x52, 0x7D, 0x52, 0x7D, 0x1A, 0x7F,
-        0x1A, 0x7F, 0xEF, 0x7F, 0xEF, 0x7F, 0xCF, 0x7F, 0xCF, 0x7F, 0xBC, 0x7E, 0xBC, 0x7E, 0xB7, 0x7C, 0xB7, 0x7C,
-        0xC3, 0x79, 0xC3, 0x79, 0xE7, 0x75, 0xE7, 0x75, 0x2A, 0x71, 0x2A, 0x71, 0x95, 0x6B, 0x95, 0x6B, 0x33, 0x65,
-        0x33, 0x65, 0x0E, 0x5E, 0x0E, 0x5E, 0x37, 0x56, 0x37, 0x56, 0xBB, 0x4D, 0xBB, 0x4D, 0xAA, 0x44, 0xAA, 0x44,
-        0x16, 0x3B, 0x16, 0x3B, 0x12, 0x31, 0x12, 0x31, 0xB0, 0x26, 0xB0, 0x26, 0x03, 0x1C, 0x03, 0x1C, 0x22, 0x11,
-        0x22, 0x11, 0x20, 0x06, 0x20, 0x06, 0x12, 0xFB, 0x12, 0xFB, 0x0E, 0xF0, 0x0E, 0xF0, 0x28, 0xE5, 0x28, 0xE5,
-        0x75, 0xDA, 0x75, 0xDA, 0x0A, 0xD0, 0x0A, 0xD0, 0xFA, 0xC5, 0xFA, 0xC5, 0x59, 0xBC, 0x59, 0xBC, 0x3A, 0xB3,
-        0x3A, 0xB3, 0xAD, 0xAA, 0xAD, 0xAA, 0xC2, 0xA2, 0xC2, 0xA2, 0x8A, 0x9B, 0x8A, 0x9B, 0x12, 0x95, 0x12, 0x95,
-        0x66, 0x8F, 0x66, 0x8F, 0x91, 0x8A, 0x91, 0x8A, 0x9D, 0x86, 0x9D, 0x86, 0x8F, 0x83, 0x8F, 0x83, 0x71, 0x81,
-        0x71, 0x81, 0x42, 0x80, 0x42, 0x80, 0x09, 0x80, 0x09, 0x80, 0xC3, 0x80, 0xC3, 0x80, 0x71, 0x82, 0x71, 0x82,
-        0x0E, 0x85, 0x0E, 0x85, 0x97, 0x88, 0x97, 0x88, 0x03, 0x8D, 0x03, 0x8D, 0x4B, 0x92, 0x4B, 0x92, 0x64, 0x98,
-        0x64, 0x98, 0x43, 0x9F, 0x43, 0x9F, 0xDB, 0xA6, 0xDB, 0xA6, 0x1D, 0xAF, 0x1D, 0xAF, 0xFA, 0xB7, 0xFA, 0xB7,
-        0x60, 0xC1, 0x60, 0xC1, 0x3E, 0xCB, 0x3E, 0xCB, 0x80, 0xD5, 0x80, 0xD5, 0x14, 0xE0, 0x14, 0xE0, 0xE4, 0xEA,
-        0xE4, 0xEA, 0xDD, 0xF5, 0xDD, 0xF5, 0xE9, 0x00, 0xE9, 0x00, 0xF3, 0x0B, 0xF3, 0x0B, 0xE7, 0x16, 0xE7, 0x16,
-        0xAE, 0x21, 0xAE, 0x21, 0x36, 0x2C, 0x36, 0x2C, 0x69, 0x36, 0x69, 0x36, 0x35, 0x40, 0x35, 0x40, 0x85, 0x49,
-        0x85, 0x49, 0x4A, 0x52, 0x4A, 0x52, 0x71, 0x5A, 0x71, 0x5A, 0xEB, 0x61, 0xEB, 0x61, 0xAA, 0x68, 0xAA, 0x68,
-        0xA2, 0x6E, 0xA2, 0x6E, 0xC6, 0x73, 0xC6, 0x73, 0x0E, 0x78, 0x0E, 0x78, 0x70, 0x7B, 0x70, 0x7B, 0xE7, 0x7D,
-        0xE7, 0x7D, 0x6C, 0x7F, 0x6C, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x47, 0x7E, 0x47, 0x7E,
-        0x00, 0x7C, 0x00, 0x7C, 0xCD, 0x78, 0xCD, 0x78, 0xB2, 0x74, 0xB2, 0x74, 0xBA, 0x6F, 0xBA, 0x6F, 0xEB, 0x69,
-        0xEB, 0x69, 0x53, 0x63, 0x53, 0x63, 0xFC, 0x5B, 0xFC, 0x5B, 0xF6, 0x53, 0xF6, 0x53, 0x50, 0x4B, 0x50, 0x4B,
-        0x1A, 0x42, 0x1A, 0x42, 0x66, 0x38, 0x66, 0x38, 0x46, 0x2E, 0x46, 0x2E, 0xCD, 0x23, 0xCD, 0x23, 0x10, 0x19,
-        0x10, 0x19, 0x24, 0x0E, 0x24, 0x0E, 0x1C, 0x03, 0x1C, 0x03, 0x10, 0xF8, 0x10, 0xF8, 0x11, 0xED, 0x11, 0xED,
-        0x37, 0xE2, 0x37, 0xE2, 0x95, 0xD7, 0x95, 0xD7, 0x41, 0xCD, 0x41, 0xCD, 0x4E, 0xC3, 0x4E, 0xC3, 0xCE, 0xB9,
-        0xCE, 0xB9, 0xD5, 0xB0, 0xD5, 0xB0, 0x73, 0xA8, 0x73, 0xA8, 0xB8, 0xA0, 0xB8, 0xA0, 0xB3, 0x99, 0xB3, 0x99,
-        0x71, 0x93, 0x71, 0x93, 0xFF, 0x8D, 0xFF, 0x8D, 0x67, 0x89, 0x67, 0x89, 0xB0, 0x85, 0xB0, 0x85, 0xE4, 0x82,
-        0xE4, 0x82, 0x05, 0x81, 0x05, 0x81, 0x1B, 0x80, 0x1B, 0x80, 0x23, 0x80, 0x23, 0x80, 0x21, 0x81, 0x21, 0x81,
-        0x10, 0x83, 0x10, 0x83, 0xEE, 0x85, 0xEE, 0x85, 0xB5, 0x89, 0xB5, 0x89, 0x5E, 0x8E, 0x5E, 0x8E, 0xE0, 0x93,
-        0xE0, 0x93, 0x31, 0x9A, 0x31, 0x9A, 0x44, 0xA1, 0x44, 0xA1, 0x0B, 0xA9, 0x0B, 0xA9, 0x79, 0xB1, 0x79, 0xB1,
-        0x7D, 0xBA, 0x7D, 0xBA, 0x06, 0xC4, 0x06, 0xC4, 0x01, 0xCE, 0x01, 0xCE, 0x5B, 0xD8, 0x5B, 0xD8, 0x01, 0xE3,
-        0x01, 0xE3, 0xDF, 0xED, 0xDF, 0xED, 0xE0, 0xF8, 0xE0, 0xF8, 0xED, 0x03, 0xED, 0x03, 0xF3, 0x0E, 0xF3, 0x0E,
-        0xDD, 0x19, 0xDD, 0x19, 0x95, 0x24, 0x95, 0x24, 0x07, 0x2F, 0x07, 0x2F, 0x20, 0x39, 0x20, 0x39, 0xCC, 0x42,
-        0xCC, 0x42, 0xF8, 0x4B, 0xF8, 0x4B, 0x93, 0x54, 0x93, 0x54, 0x8D, 0x5C, 0x8D, 0x5C, 0xD5, 0x63, 0xD5, 0x63,
-        0x60, 0x6A, 0x60, 0x6A, 0x1F, 0x70, 0x1F, 0x70, 0x08, 0x75, 0x08, 0x75, 0x11, 0x79, 0x11, 0x79, 0x34, 0x7C,
-        0x34, 0x7C, 0x68, 0x7E, 0x68, 0x7E, 0xAD, 0x7F, 0xAD, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0x58, 0x7F, 0x58, 0x7F,
-        0xC0, 0x7D, 0xC0, 0x7D, 0x38, 0x7B, 0x38, 0x7B, 0xC5, 0x77, 0xC5, 0x77, 0x6D, 0x73, 0x6D, 0x73, 0x39, 0x6E,
-        0x39, 0x6E, 0x32, 0x68, 0x32, 0x68, 0x65, 0x61, 0x65, 0x61, 0xDD, 0x59, 0xDD, 0x59, 0xAA, 0x51, 0xAA, 0x51,
-        0xDB, 0x48, 0xDB, 0x48, 0x80, 0x3F, 0x80, 0x3F, 0xAD, 0x35, 0xAD, 0x35, 0x72, 0x2B, 0x72, 0x2B, 0xE5, 0x20,
-        0xE5, 0x20, 0x19, 0x16, 0x19, 0x16, 0x23, 0x0B, 0x23, 0x0B, 0x18, 0x00, 0x18, 0x00, 0x0D, 0xF5, 0x0D, 0xF5,
-        0x17, 0xEA, 0x17, 0xEA, 0x4A, 0xDF, 0x4A, 0xDF, 0xBC, 0xD4, 0xBC, 0xD4, 0x80, 0xCA, 0x80, 0xCA, 0xAA, 0xC0,
-        0xAA, 0xC0, 0x4E, 0xB7, 0x4E, 0xB7, 0x7C, 0xAE, 0x7C, 0xAE, 0x47, 0xA6, 0x47, 0xA6, 0xBC, 0x9E, 0xBC, 0x9E,
-        0xEB, 0x97, 0xEB, 0x97, 0xE0, 0x91, 0xE0, 0x91, 0xA8, 0x8C, 0xA8, 0x8C, 0x4C, 0x88, 0x4C, 0x88, 0xD5, 0x84,
-        0xD5, 0x84, 0x49, 0x82, 0x49, 0x82, 0xAE, 0x80, 0xAE, 0x80, 0x05, 0x80, 0x05, 0x80, 0x51, 0x80, 0x51, 0x80,
-        0x90, 0x81, 0x90, 0x81, 0xC1, 0x83, 0xC1, 0x83, 0xDF, 0x86, 0xDF, 0x86, 0xE5, 0x8A, 0xE5, 0x8A, 0xCA, 0x8F,
-        0xCA, 0x8F, 0x85, 0x95, 0x85, 0x95, 0x0C, 0x9C, 0x0C, 0x9C, 0x52, 0xA3, 0x52, 0xA3, 0x48, 0xAB, 0x48, 0xAB,
-        0xE1, 0xB3, 0xE1, 0xB3, 0x0A, 0xBD, 0x0A, 0xBD, 0xB4, 0xC6, 0xB4, 0xC6, 0xCB, 0xD0, 0xCB, 0xD0, 0x3C, 0xDB,
-        0x3C, 0xDB, 0xF4, 0xE5, 0xF4, 0xE5, 0xDD, 0xF0, 0xDD, 0xF0, 0xE3, 0xFB, 0xE3, 0xFB, 0xEF, 0x06, 0xEF, 0x06,
-        0xF0, 0x11, 0xF0, 0x11, 0xCF, 0x1C, 0xCF, 0x1C, 0x76, 0x27, 0x76, 0x27, 0xD2, 0x31, 0xD2, 0x31, 0xCF, 0x3B,
-        0xCF, 0x3B, 0x5A, 0x45, 0x5A, 0x45, 0x60, 0x4E, 0x60, 0x4E, 0xD1, 0x56, 0xD1, 0x56, 0x9B, 0x5E, 0x9B, 0x5E,
-        0xB2, 0x65, 0xB2, 0x65, 0x05, 0x6C, 0x05, 0x6C, 0x8B, 0x71, 0x8B, 0x71, 0x38, 0x76, 0x38, 0x76, 0x03, 0x7A,
-        0x03, 0x7A, 0xE5, 0x7C, 0xE5, 0x7C, 0xD9, 0x7E, 0xD9, 0x7E, 0xDA, 0x7F, 0xDA, 0x7F, 0xE7, 0x7F, 0xE7, 0x7F,
-        0x00, 0x7F, 0x00, 0x7F, 0x27, 0x7D, 0x27, 0x7D, 0x5E, 0x7A, 0x5E, 0x7A, 0xAC, 0x76, 0xAC, 0x76, 0x17, 0x72,
-        0x17, 0x72, 0xA9, 0x6C, 0xA9, 0x6C, 0x6A, 0x66, 0x6A, 0x66, 0x69, 0x5F, 0x69, 0x5F, 0xB1, 0x57, 0xB1, 0x57,
-        0x51, 0x4F, 0x51, 0x4F, 0x5A, 0x46, 0x5A, 0x46, 0xDD, 0x3C, 0xDD, 0x3C, 0xEC, 0x32, 0xEC, 0x32, 0x99, 0x28,
-        0x99, 0x28, 0xF9, 0x1D, 0xF9, 0x1D, 0x20, 0x13, 0x20, 0x13, 0x21, 0x08, 0x21, 0x08, 0x15, 0xFD, 0x15, 0xFD,
-        0x0D, 0xF2, 0x0D, 0xF2, 0x20, 0xE7, 0x20, 0xE7, 0x62, 0xDC, 0x62, 0xDC, 0xE8, 0xD1, 0xE8, 0xD1, 0xC7, 0xC7,
-        0xC7, 0xC7, 0x10, 0xBE, 0x10, 0xBE, 0xD8, 0xB4, 0xD8, 0xB4, 0x2F, 0xAC, 0x2F, 0xAC, 0x26, 0xA4, 0x26, 0xA4,
-        0xCD, 0x9C, 0xCD, 0x9C, 0x30, 0x96, 0x30, 0x96, 0x5F, 0x90, 0x5F, 0x90, 0x62, 0x8B, 0x62, 0x8B, 0x44, 0x87,
-        0x44, 0x87, 0x0C, 0x84, 0x0C, 0x84, 0xC1, 0x81, 0xC1, 0x81, 0x67, 0x80, 0x67, 0x80, 0x01, 0x80, 0x01, 0x80,
-        0x8F, 0x80, 0x8F, 0x80, 0x11, 0x82, 0x11, 0x82, 0x83, 0x84, 0x83, 0x84, 0xE1, 0x87, 0xE1, 0x87, 0x24, 0x8C,
-        0x24, 0x8C, 0x46, 0x91, 0x46, 0x91, 0x39, 0x97, 0x39, 0x97, 0xF5, 0x9D, 0xF5, 0x9D, 0x6D, 0xA5, 0x6D, 0xA5,
-        0x91, 0xAD, 0x91, 0xAD, 0x53, 0xB6, 0x53, 0xB6, 0xA1, 0xBF, 0xA1, 0xBF, 0x6A, 0xC9, 0x6A, 0xC9, 0x9C, 0xD3,
-        0x9C, 0xD3, 0x22, 0xDE, 0x22, 0xDE, 0xEA, 0xE8, 0xEA, 0xE8, 0xDD, 0xF3, 0xDD, 0xF3, 0xE6, 0xFE, 0xE6, 0xFE,
-        0xF2, 0x09, 0xF2, 0x09, 0xEB, 0x14, 0xEB, 0x14, 0xBD, 0x1F, 0xBD, 0x1F, 0x52, 0x2A, 0x52, 0x2A, 0x96, 0x34,
-        0x96, 0x34, 0x75, 0x3E, 0x75, 0x3E, 0xDD, 0x47, 0xDD, 0x47, 0xBD, 0x50, 0xBD, 0x50, 0x02, 0x59, 0x02, 0x59,
-        0x9D, 0x60, 0x9D, 0x60, 0x7F, 0x67, 0x7F, 0x67, 0x9C, 0x6D, 0x9C, 0x6D, 0xE7, 0x72, 0xE7, 0x72, 0x57, 0x77,
-        0x57, 0x77, 0xE4, 0x7A, 0xE4, 0x7A, 0x86, 0x7D, 0x86, 0x7D, 0x37, 0x7F, 0x37, 0x7F, 0xF6, 0x7F, 0xF6, 0x7F,
-        0xC0, 0x7F, 0xC0, 0x7F, 0x97, 0x7E, 0x97, 0x7E, 0x7C, 0x7C, 0x7C, 0x7C, 0x73, 0x79, 0x73, 0x79, 0x82, 0x75,
-        0x82, 0x75, 0xB1, 0x70, 0xB1, 0x70, 0x09, 0x6B, 0x09, 0x6B, 0x94, 0x64, 0x94, 0x64, 0x5F, 0x5D, 0x5F, 0x5D,
-        0x78, 0x55, 0x78, 0x55, 0xED, 0x4C, 0xED, 0x4C, 0xD1, 0x43, 0xD1, 0x43, 0x32, 0x3A, 0x32, 0x3A, 0x24, 0x30,
-        0x24, 0x30, 0xBA, 0x25, 0xBA, 0x25, 0x08, 0x1B, 0x08, 0x1B, 0x23, 0x10, 0x23, 0x10, 0x1E, 0x05, 0x1E, 0x05,
-        0x11, 0xFA, 0x11, 0xFA, 0x0F, 0xEF, 0x0F, 0xEF, 0x2C, 0xE4, 0x2C, 0xE4, 0x7F, 0xD9, 0x7F, 0xD9, 0x1B, 0xCF,
-        0x1B, 0xCF, 0x15, 0xC5, 0x15, 0xC5, 0x7F, 0xBB, 0x7F, 0xBB, 0x6C, 0xB2, 0x6C, 0xB2, 0xED, 0xA9, 0xED, 0xA9,
-        0x13, 0xA2, 0x13, 0xA2, 0xEC, 0x9A, 0xEC, 0x9A, 0x85, 0x94, 0x85, 0x94, 0xED, 0x8E, 0xED, 0x8E, 0x2C, 0x8A,
-        0x2C, 0x8A, 0x4C, 0x86, 0x4C, 0x86, 0x54, 0x83, 0x54, 0x83, 0x4B, 0x81, 0x4B, 0x81, 0x34, 0x80, 0x34, 0x80,
-        0x10, 0x80, 0x10, 0x80, 0xE1, 0x80, 0xE1, 0x80, 0xA4, 0x82, 0xA4, 0x82, 0x57, 0x85, 0x57, 0x85, 0xF4, 0x88,
-        0xF4, 0x88, 0x75, 0x8D, 0x75, 0x8D, 0xD0, 0x92, 0xD0, 0x92, 0xFC, 0x98, 0xFC, 0x98, 0xED, 0x9F, 0xED, 0x9F,
-        0x94, 0xA7, 0x94, 0xA7, 0xE5, 0xAF, 0xE5, 0xAF, 0xD0, 0xB8, 0xD0, 0xB8, 0x41, 0xC2, 0x41, 0xC2, 0x29, 0xCC,
-        0x29, 0xCC, 0x73, 0xD6, 0x73, 0xD6, 0x0D, 0xE1, 0x0D, 0xE1, 0xE2, 0xEB, 0xE2, 0xEB, 0xDE, 0xF6, 0xDE, 0xF6,
-        0xEA, 0x01, 0xEA, 0x01, 0xF3, 0x0C, 0xF3, 0x0C, 0xE4, 0x17, 0xE4, 0x17, 0xA6, 0x22, 0xA6, 0x22, 0x27, 0x2D,
-        0x27, 0x2D, 0x52, 0x37, 0x52, 0x37, 0x13, 0x41, 0x13, 0x41, 0x57, 0x4A, 0x57, 0x4A, 0x0E, 0x53, 0x0E, 0x53,
-        0x26, 0x5B, 0x26, 0x5B, 0x90, 0x62, 0x90, 0x62, 0x3E, 0x69, 0x3E, 0x69, 0x23, 0x6F, 0x23, 0x6F, 0x33, 0x74,
-        0x33, 0x74, 0x66, 0x78, 0x66, 0x78, 0xB3, 0x7B, 0xB3, 0x7B, 0x14, 0x7E, 0x14, 0x7E, 0x83, 0x7F, 0x83, 0x7F,
-        0xFF, 0x7F, 0xFF, 0x7F, 0x88, 0x7F, 0x88, 0x7F, 0x1C, 0x7E, 0x1C, 0x7E, 0xBF, 0x7B, 0xBF, 0x7B, 0x77, 0x78,
-        0x77, 0x78, 0x48, 0x74, 0x48, 0x74, 0x3B, 0x6F, 0x3B, 0x6F, 0x5A, 0x69, 0x5A, 0x69, 0xAF, 0x62, 0xAF, 0x62,
-        0x49, 0x5B, 0x49, 0x5B, 0x33, 0x53, 0x33, 0x53, 0x80, 0x4A, 0x80, 0x4A, 0x3D, 0x41, 0x3D, 0x41, 0x7E, 0x37,
-        0x7E, 0x37, 0x55, 0x2D, 0x55, 0x2D, 0xD6, 0x22, 0xD6, 0x22, 0x14, 0x18, 0x14, 0x18, 0x24, 0x0D, 0x24, 0x0D,
-        0x1B, 0x02, 0x1B, 0x02, 0x0E, 0xF7, 0x0E, 0xF7, 0x13, 0xEC, 0x13, 0xEC, 0x3D, 0xE1, 0x3D, 0xE1, 0xA2, 0xD6,
-        0xA2, 0xD6, 0x55, 0xCC, 0x55, 0xCC, 0x6C, 0xC2, 0x6C, 0xC2, 0xF8, 0xB8, 0xF8, 0xB8, 0x0C, 0xB0, 0x0C, 0xB0,
-        0xB8, 0xA7, 0xB8, 0xA7, 0x0D, 0xA0, 0x0D, 0xA0, 0x19, 0x99, 0x19, 0x99, 0xEA, 0x92, 0xEA, 0x92, 0x8B, 0x8D,
-        0x8B, 0x8D, 0x07, 0x89, 0x07, 0x89, 0x65, 0x85, 0x65, 0x85, 0xAE, 0x82, 0xAE, 0x82, 0xE6, 0x80, 0xE6, 0x80,
-        0x11, 0x80, 0x11, 0x80, 0x30, 0x80, 0x30, 0x80, 0x44, 0x81, 0x44, 0x81, 0x49, 0x83, 0x49, 0x83, 0x3D, 0x86,
-        0x3D, 0x86, 0x18, 0x8A, 0x18, 0x8A, 0xD6, 0x8E, 0xD6, 0x8E, 0x6B, 0x94, 0x6B, 0x94, 0xCD, 0x9A, 0xCD, 0x9A,
-        0xF2, 0xA1, 0xF2, 0xA1, 0xC9, 0xA9, 0xC9, 0xA9, 0x45, 0xB2, 0x45, 0xB2, 0x55, 0xBB, 0x55, 0xBB, 0xE9, 0xC4,
-        0xE9, 0xC4, 0xEE, 0xCE, 0xEE, 0xCE, 0x50, 0xD9, 0x50, 0xD9, 0xFC, 0xE3, 0xFC, 0xE3, 0xDE, 0xEE, 0xDE, 0xEE,
-        0xE0, 0xF9, 0xE0, 0xF9, 0xEE, 0x04, 0xEE, 0x04, 0xF2, 0x0F, 0xF2, 0x0F, 0xD9, 0x1A, 0xD9, 0x1A, 0x8B, 0x25,
-        0x8B, 0x25, 0xF6, 0x2F, 0xF6, 0x2F, 0x06, 0x3A, 0x06, 0x3A, 0xA7, 0x43, 0xA7, 0x43, 0xC6, 0x4C, 0xC6, 0x4C,
-        0x54, 0x55, 0x54, 0x55, 0x3E, 0x5D, 0x3E, 0x5D, 0x76, 0x64, 0x76, 0x64, 0xEE, 0x6A, 0xEE, 0x6A, 0x9A, 0x70,
-        0x9A, 0x70, 0x6F, 0x75, 0x6F, 0x75, 0x63, 0x79, 0x63, 0x79, 0x71, 0x7C, 0x71, 0x7C, 0x90, 0x7E, 0x90, 0x7E,
-        0xBE, 0x7F, 0xBE, 0x7F, 0xF7, 0x7F, 0xF7, 0x7F, 0x3C, 0x7F, 0x3C, 0x7F, 0x8F, 0x7D, 0x8F, 0x7D, 0xF1, 0x7A,
-        0xF1, 0x7A, 0x69, 0x77, 0x69, 0x77, 0xFD, 0x72, 0xFD, 0x72, 0xB5, 0x6D, 0xB5, 0x6D, 0x9C, 0x67, 0x9C, 0x67,
-        0xBD, 0x60, 0xBD, 0x60, 0x25, 0x59, 0x25, 0x59, 0xE3, 0x50, 0xE3, 0x50, 0x06, 0x48, 0x06, 0x48, 0xA0, 0x3E,
-        0xA0, 0x3E, 0xC3, 0x34, 0xC3, 0x34, 0x80, 0x2A, 0x80, 0x2A, 0xEC, 0x1F, 0xEC, 0x1F, 0x1C, 0x15, 0x1C, 0x15,
-        0x23, 0x0A, 0x23, 0x0A, 0x18, 0xFF, 0x18, 0xFF, 0x0D, 0xF4, 0x0D, 0xF4, 0x19, 0xE9, 0x19, 0xE9, 0x51, 0xDE,
-        0x51, 0xDE, 0xCA, 0xD3, 0xCA, 0xD3, 0x97, 0xC9, 0x97, 0xC9, 0xCB, 0xBF, 0xCB, 0xBF, 0x7B, 0xB6, 0x7B, 0xB6,
-        0xB6, 0xAD, 0xB6, 0xAD, 0x8F, 0xA5, 0x8F, 0xA5, 0x15, 0x9E, 0x15, 0x9E, 0x55, 0x97, 0x55, 0x97, 0x5E, 0x91,
-        0x5E, 0x91, 0x39, 0x8C, 0x39, 0x8C, 0xF2, 0x87, 0xF2, 0x87, 0x90, 0x84, 0x90, 0x84, 0x1A, 0x82, 0x1A, 0x82,
-        0x94, 0x80, 0x94, 0x80, 0x01, 0x80, 0x01, 0x80, 0x64, 0x80, 0x64, 0x80, 0xB9, 0x81, 0xB9, 0x81, 0x00, 0x84,
-        0x00, 0x84, 0x33, 0x87, 0x33, 0x87, 0x4E, 0x8B, 0x4E, 0x8B, 0x46, 0x90, 0x46, 0x90, 0x15, 0x96, 0x15, 0x96,
-        0xAD, 0x9C, 0xAD, 0x9C, 0x04, 0xA4, 0x04, 0xA4, 0x09, 0xAC, 0x09, 0xAC, 0xB0, 0xB4, 0xB0, 0xB4, 0xE7, 0xBD,
-        0xE7, 0xBD, 0x9A, 0xC7, 0x9A, 0xC7, 0xBA, 0xD1, 0xBA, 0xD1, 0x33, 0xDC, 0x33, 0xDC, 0xF0, 0xE6, 0xF0, 0xE6,
-        0xDC, 0xF1, 0xDC, 0xF1, 0xE4, 0xFC, 0xE4, 0xFC, 0xF1, 0x07, 0xF1, 0x07, 0xEF, 0x12, 0xEF, 0x12, 0xC9, 0x1D,
-        0xC9, 0x1D, 0x6A, 0x28, 0x6A, 0x28, 0xBF, 0x32, 0xBF, 0x32, 0xB2, 0x3C, 0xB2, 0x3C, 0x31, 0x46, 0x31, 0x46,
-        0x2B, 0x4F, 0x2B, 0x4F, 0x8D, 0x57, 0x8D, 0x57, 0x48, 0x5F, 0x48, 0x5F, 0x4D, 0x66, 0x4D, 0x66, 0x8E, 0x6C,
-        0x8E, 0x6C, 0x01, 0x72, 0x01, 0x72, 0x9A, 0x76, 0x9A, 0x76, 0x50, 0x7A, 0x50, 0x7A, 0x1C, 0x7D, 0x1C, 0x7D,
-        0xFA, 0x7E, 0xFA, 0x7E, 0xE5, 0x7F, 0xE5, 0x7F, 0xDD, 0x7F, 0xDD, 0x7F, 0xDF, 0x7E, 0xDF, 0x7E, 0xF0, 0x7C,
-        0xF0, 0x7C, 0x12, 0x7A, 0x12, 0x7A, 0x4B, 0x76, 0x4B, 0x76, 0xA1, 0x71, 0xA1, 0x71, 0x20, 0x6C, 0x20, 0x6C,
-        0xCF, 0x65, 0xCF, 0x65, 0xBC, 0x5E, 0xBC, 0x5E, 0xF4, 0x56, 0xF4, 0x56, 0x87, 0x4E, 0x87, 0x4E, 0x83, 0x45,
-        0x83, 0x45, 0xFA, 0x3B, 0xFA, 0x3B, 0xFF, 0x31, 0xFF, 0x31, 0xA5, 0x27, 0xA5, 0x27, 0xFE, 0x1C, 0xFE, 0x1C,
-        0x21, 0x12, 0x21, 0x12, 0x21, 0x07, 0x21, 0x07, 0x14, 0xFC, 0x14, 0xFC, 0x0D, 0xF1, 0x0D, 0xF1, 0x23, 0xE6,
-        0x23, 0xE6, 0x6B, 0xDB, 0x6B, 0xDB, 0xF8, 0xD0, 0xF8, 0xD0, 0xE0, 0xC6, 0xE0, 0xC6, 0x34, 0xBD, 0x34, 0xBD,
-        0x08, 0xB4, 0x08, 0xB4, 0x6D, 0xAB, 0x6D, 0xAB, 0x73, 0xA3, 0x73, 0xA3, 0x2B, 0x9C, 0x2B, 0x9C, 0xA1, 0x95,
-        0xA1, 0x95, 0xE1, 0x8F, 0xE1, 0x8F, 0xF8, 0x8A, 0xF8, 0x8A, 0xEF, 0x86, 0xEF, 0x86, 0xCC, 0x83, 0xCC, 0x83,
-        0x98, 0x81, 0x98, 0x81, 0x54, 0x80, 0x54, 0x80, 0x04, 0x80, 0x04, 0x80, 0xA8, 0x80, 0xA8, 0x80, 0x40, 0x82,
-        0x40, 0x82, 0xC8, 0x84, 0xC8, 0x84, 0x3B, 0x88, 0x3B, 0x88, 0x93, 0x8C, 0x93, 0x8C, 0xC7, 0x91, 0xC7, 0x91,
-        0xCE, 0x97, 0xCE, 0x97, 0x9C, 0x9E, 0x9C, 0x9E, 0x23, 0xA6, 0x23, 0xA6, 0x56, 0xAE, 0x56, 0xAE, 0x25, 0xB7,
-        0x25, 0xB7, 0x80, 0xC0, 0x80, 0xC0, 0x53, 0xCA, 0x53, 0xCA, 0x8E, 0xD4, 0x8E, 0xD4, 0x1B, 0xDF, 0x1B, 0xDF,
-        0xE6, 0xE9, 0xE6, 0xE9, 0xDD, 0xF4, 0xDD, 0xF4, 0xE8, 0xFF, 0xE8, 0xFF, 0xF2, 0x0A, 0xF2, 0x0A, 0xE9, 0x15,
-        0xE9, 0x15, 0xB6, 0x20, 0xB6, 0x20, 0x44, 0x2B, 0x44, 0x2B, 0x80, 0x35, 0x80, 0x35, 0x55, 0x3F, 0x55, 0x3F,
-        0xB2, 0x48, 0xB2, 0x48, 0x84, 0x51, 0x84, 0x51, 0xBA, 0x59, 0xBA, 0x59, 0x45, 0x61, 0x45, 0x61, 0x16, 0x68,
-        0x16, 0x68, 0x20, 0x6E, 0x20, 0x6E, 0x58, 0x73, 0x58, 0x73, 0xB4, 0x77, 0xB4, 0x77, 0x2B, 0x7B, 0x2B, 0x7B,
-        0xB7, 0x7D, 0xB7, 0x7D, 0x52, 0x7F, 0x52, 0x7F, 0xFB, 0x7F, 0xFB, 0x7F, 0xAF, 0x7F, 0xAF, 0x7F, 0x70, 0x7E,
-        0x70, 0x7E, 0x3F, 0x7C, 0x3F, 0x7C, 0x21, 0x79, 0x21, 0x79, 0x1B, 0x75, 0x1B, 0x75, 0x37, 0x70, 0x37, 0x70,
-        0x7A, 0x6A, 0x7A, 0x6A, 0xF4, 0x63, 0xF4, 0x63, 0xAE, 0x5C, 0xAE, 0x5C, 0xB8, 0x54, 0xB8, 0x54, 0x20, 0x4C,
-        0x20, 0x4C, 0xF6, 0x42, 0xF6, 0x42, 0x4C, 0x39, 0x4C, 0x39, 0x35, 0x2F, 0x35, 0x2F, 0xC4, 0x24, 0xC4, 0x24,
-        0x0D, 0x1A, 0x0D, 0x1A, 0x23, 0x0F, 0x23, 0x0F, 0x1E, 0x04, 0x1E, 0x04, 0x10, 0xF9, 0x10, 0xF9, 0x10, 0xEE,
-        0x10, 0xEE, 0x32, 0xE3, 0x32, 0xE3, 0x8A, 0xD8, 0x8A, 0xD8, 0x2E, 0xCE, 0x2E, 0xCE, 0x31, 0xC4, 0x31, 0xC4,
-        0xA6, 0xBA, 0xA6, 0xBA, 0xA0, 0xB1, 0xA0, 0xB1, 0x2F, 0xA9, 0x2F, 0xA9, 0x65, 0xA1, 0x65, 0xA1, 0x4F, 0x9A,
-        0x4F, 0x9A, 0xFB, 0x93, 0xFB, 0x93, 0x75, 0x8E, 0x75, 0x8E, 0xC8, 0x89, 0xC8, 0x89, 0xFD, 0x85, 0xFD, 0x85,
-        0x1B, 0x83, 0x1B, 0x83, 0x27, 0x81, 0x27, 0x81, 0x26, 0x80, 0x26, 0x80, 0x18, 0x80, 0x18, 0x80, 0x00, 0x81,
-        0x00, 0x81, 0xD9, 0x82, 0xD9, 0x82, 0xA2, 0x85, 0xA2, 0x85, 0x54, 0x89, 0x54, 0x89, 0xE9, 0x8D, 0xE9, 0x8D,
-        0x57, 0x93, 0x57, 0x93, 0x96, 0x99, 0x96, 0x99, 0x97, 0xA0, 0x97, 0xA0, 0x4F, 0xA8, 0x4F, 0xA8, 0xAF, 0xB0,
-        0xAF, 0xB0, 0xA6, 0xB9, 0xA6, 0xB9, 0x23, 0xC3, 0x23, 0xC3, 0x14, 0xCD, 0x14, 0xCD, 0x67, 0xD7, 0x67, 0xD7,
-        0x07, 0xE2, 0x07, 0xE2, 0xE0, 0xEC, 0xE0, 0xEC, 0xDE, 0xF7, 0xDE, 0xF7, 0xEB, 0x02, 0xEB, 0x02, 0xF3, 0x0D,
-        0xF3, 0x0D, 0xE1, 0x18, 0xE1, 0x18, 0x9E, 0x23, 0x9E, 0x23, 0x18, 0x2E, 0x18, 0x2E, 0x39, 0x38, 0x39, 0x38,
-        0xF0, 0x41, 0xF0, 0x41, 0x29, 0x4B, 0x29, 0x4B, 0xD1, 0x53, 0xD1, 0x53, 0xDA, 0x5B, 0xDA, 0x5B, 0x33, 0x63,
-        0x33, 0x63, 0xD0, 0x69, 0xD0, 0x69, 0xA1, 0x6F, 0xA1, 0x6F, 0x9F, 0x74, 0x9F, 0x74, 0xBC, 0x78, 0xBC, 0x78,
-        0xF5, 0x7B, 0xF5, 0x7B, 0x3F, 0x7E, 0x3F, 0x7E, 0x99, 0x7F, 0x99, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x71, 0x7F,
-        0x71, 0x7F, 0xEF, 0x7D, 0xEF, 0x7D, 0x7D, 0x7B, 0x7D, 0x7B, 0x1E, 0x78, 0x1E, 0x78, 0xDB, 0x73, 0xDB, 0x73,
-        0xBB, 0x6E, 0xBB, 0x6E, 0xC7, 0x68, 0xC7, 0x68, 0x0B, 0x62, 0x0B, 0x62, 0x93, 0x5A, 0x93, 0x5A, 0x6F, 0x52,
-        0x6F, 0x52, 0xAE, 0x49, 0xAE, 0x49, 0x5F, 0x40, 0x5F, 0x40, 0x96, 0x36, 0x96, 0x36, 0x64, 0x2C, 0x64, 0x2C,
-        0xDE, 0x21, 0xDE, 0x21, 0x17, 0x17, 0x17, 0x17, 0x23, 0x0C, 0x23, 0x0C, 0x1A, 0x01, 0x1A, 0x01, 0x0E, 0xF6,
-        0x0E, 0xF6, 0x14, 0xEB, 0x14, 0xEB, 0x43, 0xE0, 0x43, 0xE0, 0xAE, 0xD5, 0xAE, 0xD5, 0x6A, 0xCB, 0x6A, 0xCB,
-        0x8B, 0xC1, 0x8B, 0xC1, 0x22, 0xB8, 0x22, 0xB8, 0x43, 0xAF, 0x43, 0xAF, 0xFE, 0xA6, 0xFE, 0xA6, 0x63, 0x9F,
-        0x63, 0x9F, 0x81, 0x98, 0x81, 0x98, 0x64, 0x92, 0x64, 0x92, 0x19, 0x8D, 0x19, 0x8D, 0xA9, 0x88, 0xA9, 0x88,
-        0x1D, 0x85, 0x1D, 0x85, 0x7A, 0x82, 0x7A, 0x82, 0xC9, 0x80, 0xC9, 0x80, 0x0A, 0x80, 0x0A, 0x80, 0x40, 0x80,
-        0x40, 0x80, 0x68, 0x81, 0x68, 0x81, 0x84, 0x83, 0x84, 0x83, 0x8D, 0x86, 0x8D, 0x86, 0x7E, 0x8A, 0x7E, 0x8A,
-        0x4F, 0x8F, 0x4F, 0x8F, 0xF7, 0x94, 0xF7, 0x94, 0x6C, 0x9B, 0x6C, 0x9B, 0xA1, 0xA2, 0xA1, 0xA2, 0x88, 0xAA,
-        0x88, 0xAA, 0x12, 0xB3, 0x12, 0xB3, 0x2F, 0xBC, 0x2F, 0xBC, 0xCE, 0xC5, 0xCE, 0xC5, 0xDC, 0xCF, 0xDC, 0xCF,
-        0x46, 0xDA, 0x46, 0xDA, 0xF8, 0xE4, 0xF8, 0xE4, 0xDD, 0xEF, 0xDD, 0xEF, 0xE1, 0xFA, 0xE1, 0xFA, 0xEE, 0x05,
-        0xEE, 0x05, 0xF2, 0x10, 0xF2, 0x10, 0xD4, 0x1B, 0xD4, 0x1B, 0x81, 0x26, 0x81, 0x26, 0xE4, 0x30, 0xE4, 0x30,
-        0xEB, 0x3A, 0xEB, 0x3A, 0x81, 0x44, 0x81, 0x44, 0x94, 0x4D, 0x94, 0x4D, 0x13, 0x56, 0x13, 0x56, 0xED, 0x5D,
-        0xED, 0x5D, 0x14, 0x65, 0x14, 0x65, 0x7B, 0x6B, 0x7B, 0x6B, 0x13, 0x71, 0x13, 0x71, 0xD5, 0x75, 0xD5, 0x75,
-        0xB4, 0x79, 0xB4, 0x79, 0xAC, 0x7C, 0xAC, 0x7C, 0xB5, 0x7E, 0xB5, 0x7E, 0xCD, 0x7F, 0xCD, 0x7F, 0xF1, 0x7F,
-        0xF1, 0x7F, 0x1F, 0x7F, 0x1F, 0x7F, 0x5C, 0x7D, 0x5C, 0x7D, 0xA9, 0x7A, 0xA9, 0x7A, 0x0C, 0x77, 0x0C, 0x77,
-        0x8B, 0x72, 0x8B, 0x72, 0x30, 0x6D, 0x30, 0x6D, 0x04, 0x67, 0x04, 0x67, 0x14, 0x60, 0x14, 0x60, 0x6B, 0x58,
-        0x6B, 0x58, 0x1B, 0x50, 0x1B, 0x50, 0x31, 0x47, 0x31, 0x47, 0xBF, 0x3D, 0xBF, 0x3D, 0xD7, 0x33, 0xD7, 0x33,
-        0x8D, 0x29, 0x8D, 0x29, 0xF3, 0x1E, 0xF3, 0x1E, 0x1E, 0x14, 0x1E, 0x14, 0x22, 0x09, 0x22, 0x09, 0x16, 0xFE,
-        0x16, 0xFE, 0x0D, 0xF3, 0x0D, 0xF3, 0x1D, 0xE8, 0x1D, 0xE8, 0x5A, 0xDD, 0x5A, 0xDD, 0xD8, 0xD2, 0xD8, 0xD2,
-        0xAE, 0xC8, 0xAE, 0xC8, 0xED, 0xBE, 0xED, 0xBE, 0xA9, 0xB5, 0xA9, 0xB5, 0xF1, 0xAC, 0xF1, 0xAC, 0xDA, 0xA4,
-        0xDA, 0xA4, 0x70, 0x9D, 0x70, 0x9D, 0xC2, 0x96, 0xC2, 0x96, 0xDD, 0x90, 0xDD, 0x90, 0xCD, 0x8B, 0xCD, 0x8B,
-        0x9A, 0x87, 0x9A, 0x87, 0x4D, 0x84, 0x4D, 0x84, 0xEC, 0x81, 0xEC, 0x81, 0x7D, 0x80, 0x7D, 0x80, 0x00, 0x80,
-        0x00, 0x80, 0x78, 0x80, 0x78, 0x80, 0xE4, 0x81, 0xE4, 0x81, 0x40, 0x84, 0x40, 0x84, 0x89, 0x87, 0x89, 0x87,
-        0xB8, 0x8B, 0xB8, 0x8B, 0xC5, 0x90, 0xC5, 0x90, 0xA6, 0x96, 0xA6, 0x96, 0x51, 0x9D, 0x51, 0x9D, 0xB7, 0xA4,
-        0xB7, 0xA4, 0xCD, 0xAC, 0xCD, 0xAC, 0x81, 0xB5, 0x81, 0xB5, 0xC3, 0xBE, 0xC3, 0xBE, 0x82, 0xC8, 0x82, 0xC8,
-        0xAB, 0xD2, 0xAB, 0xD2, 0x2B, 0xDD, 0x2B, 0xDD, 0xEC, 0xE7, 0xEC, 0xE7, 0xDD, 0xF2, 0xDD, 0xF2, 0xE5, 0xFD,
-        0xE5, 0xFD, 0xF1, 0x08, 0xF1, 0x08, 0xED, 0x13, 0xED, 0x13, 0xC3, 0x1E, 0xC3, 0x1E, 0x5E, 0x29, 0x5E, 0x29,
-        0xAB, 0x33, 0xAB, 0x33, 0x94, 0x3D, 0x94, 0x3D, 0x08, 0x47, 0x08, 0x47, 0xF4, 0x4F, 0xF4, 0x4F, 0x48, 0x58,
-        0x48, 0x58, 0xF3, 0x5F, 0xF3, 0x5F, 0xE7, 0x66, 0xE7, 0x66, 0x16, 0x6D, 0x16, 0x6D, 0x75, 0x72, 0x75, 0x72,
-        0xF9, 0x76, 0xF9, 0x76, 0x9B, 0x7A, 0x9B, 0x7A, 0x52, 0x7D, 0x52, 0x7D, 0x1A, 0x7F, 0x1A, 0x7F, 0xEF, 0x7F,
-        0xEF, 0x7F, 0xCF, 0x7F, 0xCF, 0x7F, 0xBC, 0x7E, 0xBC, 0x7E, 0xB7, 0x7C, 0xB7, 0x7C, 0xC3, 0x79, 0xC3, 0x79,
-        0xE7, 0x75, 0xE7, 0x75, 0x2A, 0x71, 0x2A, 0x71, 0x95, 0x6B, 0x95, 0x6B, 0x33, 0x65, 0x33, 0x65, 0x0E, 0x5E,
-        0x0E, 0x5E, 0x37, 0x56, 0x37, 0x56, 0xBB, 0x4D, 0xBB, 0x4D, 0xAA, 0x44, 0xAA, 0x44, 0x16, 0x3B, 0x16, 0x3B,
-        0x12, 0x31, 0x12, 0x31, 0xB0, 0x26, 0xB0, 0x26, 0x03, 0x1C, 0x03, 0x1C, 0x22, 0x11, 0x22, 0x11, 0x20, 0x06,
-        0x20, 0x06, 0x12, 0xFB, 0x12, 0xFB, 0x0E, 0xF0, 0x0E, 0xF0, 0x28, 0xE5, 0x28, 0xE5, 0x75, 0xDA, 0x75, 0xDA,
-        0x0A, 0xD0, 0x0A, 0xD0, 0xFA, 0xC5, 0xFA, 0xC5, 0x59, 0xBC, 0x59, 0xBC, 0x3A, 0xB3, 0x3A, 0xB3, 0xAD, 0xAA,
-        0xAD, 0xAA, 0xC2, 0xA2, 0xC2, 0xA2, 0x8A, 0x9B, 0x8A, 0x9B, 0x12, 0x95, 0x12, 0x95, 0x66, 0x8F, 0x66, 0x8F,
-        0x91, 0x8A, 0x91, 0x8A, 0x9D, 0x86, 0x9D, 0x86, 0x8F, 0x83, 0x8F, 0x83, 0x71, 0x81, 0x71, 0x81, 0x42, 0x80,
-        0x42, 0x80, 0x09, 0x80, 0x09, 0x80, 0xC3, 0x80, 0xC3, 0x80, 0x71, 0x82, 0x71, 0x82, 0x0E, 0x85, 0x0E, 0x85,
-        0x97, 0x88, 0x97, 0x88, 0x03, 0x8D, 0x03, 0x8D, 0x4B, 0x92, 0x4B, 0x92, 0x64, 0x98, 0x64, 0x98, 0x43, 0x9F,
-        0x43, 0x9F, 0xDB, 0xA6, 0xDB, 0xA6, 0x1D, 0xAF, 0x1D, 0xAF, 0xFA, 0xB7, 0xFA, 0xB7, 0x60, 0xC1, 0x60, 0xC1,
-        0x3E, 0xCB, 0x3E, 0xCB, 0x80, 0xD5, 0x80, 0xD5, 0x14, 0xE0, 0x14, 0xE0, 0xE4, 0xEA, 0xE4, 0xEA, 0xDD, 0xF5,
-        0xDD, 0xF5, 0xE9, 0x00, 0xE9, 0x00, 0xF3, 0x0B, 0xF3, 0x0B, 0xE7, 0x16, 0xE7, 0x16, 0xAE, 0x21, 0xAE, 0x21,
-        0x36, 0x2C, 0x36, 0x2C, 0x69, 0x36, 0x69, 0x36, 0x35, 0x40, 0x35, 0x40, 0x85, 0x49, 0x85, 0x49, 0x4A, 0x52,
-        0x4A, 0x52, 0x71, 0x5A, 0x71, 0x5A, 0xEB, 0x61, 0xEB, 0x61, 0xAA, 0x68, 0xAA, 0x68, 0xA2, 0x6E, 0xA2, 0x6E,
-        0xC6, 0x73, 0xC6, 0x73, 0x0E, 0x78, 0x0E, 0x78, 0x70, 0x7B, 0x70, 0x7B, 0xE7, 0x7D, 0xE7, 0x7D, 0x6C, 0x7F,
-        0x6C, 0x7F, 0xFE, 0x7F, 0xFE, 0x7F, 0x9C, 0x7F, 0x9C, 0x7F, 0x47, 0x7E, 0x47, 0x7E, 0x00, 0x7C, 0x00, 0x7C,
-        0xCD, 0x78, 0xCD, 0x78, 0xB2, 0x74, 0xB2, 0x74, 0xBA, 0x6F, 0xBA, 0x6F, 0xEB, 0x69, 0xEB, 0x69, 0x53, 0x63,
-        0x53, 0x63, 0xFC, 0x5B, 0xFC, 0x5B, 0xF6, 0x53, 0xF6, 0x53, 0x50, 0x4B, 0x50, 0x4B, 0x1A, 0x42, 0x1A, 0x42,
-        0x66, 0x38, 0x66, 0x38, 0x46, 0x2E, 0x46, 0x2E, 0xCD, 0x23, 0xCD, 0x23, 0x10, 0x19, 0x10, 0x19, 0x24, 0x0E,
-        0x24, 0x0E, 0x1C, 0x03, 0x1C, 0x03, 0x10, 0xF8, 0x10, 0xF8, 0x11, 0xED, 0x11, 0xED, 0x37, 0xE2, 0x37, 0xE2,
-        0x95, 0xD7, 0x95, 0xD7, 0x41, 0xCD, 0x41, 0xCD, 0x4E, 0xC3, 0x4E, 0xC3, 0xCE, 0xB9, 0xCE, 0xB9, 0xD5, 0xB0,
-        0xD5, 0xB0, 0x73, 0xA8, 0x73, 0xA8, 0xB8, 0xA0, 0xB8, 0xA0, 0xB3, 0x99, 0xB3, 0x99, 0x71, 0x93, 0x71, 0x93,
-        0xFF, 0x8D, 0xFF, 0x8D, 0x67, 0x89, 0x67, 0x89, 0xB0, 0x85, 0xB0, 0x85, 0xE4, 0x82, 0xE4, 0x82, 0x05, 0x81,
-        0x05, 0x81, 0x1B, 0x80, 0x1B, 0x80, 0x23, 0x80, 0x23, 0x80, 0x21, 0x81, 0x21, 0x81, 0x10, 0x83, 0x10, 0x83,
-        0xEE, 0x85, 0xEE, 0x85, 0xB5, 0x89, 0xB5, 0x89, 0x5E, 0x8E, 0x5E, 0x8E, 0xE0, 0x93, 0xE0, 0x93, 0x31, 0x9A,
-        0x31, 0x9A, 0x44, 0xA1, 0x44, 0xA1, 0x0B, 0xA9, 0x0B, 0xA9, 0x79, 0xB1, 0x79, 0xB1, 0x7D, 0xBA, 0x7D, 0xBA,
-        0x06, 0xC4, 0x06, 0xC4, 0x01, 0xCE, 0x01, 0xCE, 0x5B, 0xD8, 0x5B, 0xD8, 0x01, 0xE3, 0x01, 0xE3, 0xDF, 0xED,
-        0xDF, 0xED, 0xE0, 0xF8, 0xE0, 0xF8, 0xED, 0x03, 0xED, 0x03, 0xF3, 0x0E, 0xF3, 0x0E, 0xDD, 0x19, 0xDD, 0x19,
-        0x95, 0x24, 0x95, 0x24, 0x07, 0x2F, 0x07, 0x2F, 0x20, 0x39, 0x20, 0x39, 0xCC, 0x42, 0xCC, 0x42, 0xF8, 0x4B,
-        0xF8, 0x4B, 0x93, 0x54, 0x93, 0x54, 0x8D, 0x5C, 0x8D, 0x5C, 0xD5, 0x63, 0xD5, 0x63, 0x60, 0x6A, 0x60, 0x6A,
-        0x1F, 0x70, 0x1F, 0x70, 0x08, 0x75, 0x08, 0x75, 0x11, 0x79, 0x11, 0x79, 0x34, 0x7C, 0x34, 0x7C, 0x68, 0x7E,
-        0x68, 0x7E, 0xAD, 0x7F, 0xAD, 0x7F, 0xFC, 0x7F, 0xFC, 0x7F, 0x58, 0x7F, 0x58, 0x7F, 0xC0, 0x7D, 0xC0, 0x7D,
-        0x38, 0x7B, 0x38, 0x7B, 0xC5, 0x77, 0xC5, 0x77, 0x6D, 0x73, 0x6D, 0x73, 0x39, 0x6E, 0x39, 0x6E, 0x32, 0x68,
-        0x32, 0x68, 0x65, 0x61, 0x65, 0x61, 0xDD, 0x59, 0xDD, 0x59, 0xAA, 0x51, 0xAA, 0x51, 0xDB, 0x48, 0xDB, 0x48,
-        0x80, 0x3F, 0x80, 0x3F, 0xAD, 0x35, 0xAD, 0x35, 0x72, 0x2B, 0x72, 0x2B, 0xE5, 0x20, 0xE5, 0x20, 0x19, 0x16,
-        0x19, 0x16, 0x23, 0x0B, 0x23, 0x0B, 0x18, 0x00, 0x18, 0x00, 0x0D, 0xF5, 0x0D, 0xF5, 0x17, 0xEA, 0x17, 0xEA,
-        0x4A, 0xDF, 0x4A, 0xDF, 0xBC, 0xD4, 0xBC, 0xD4, 0x80, 0xCA, 0x80, 0xCA, 0xAA, 0xC0, 0xAA, 0xC0, 0x4E, 0xB7,
-        0x4E, 0xB7, 0x7C, 0xAE, 0x7C, 0xAE, 0x47, 0xA6, 0x47, 0xA6, 0xBC, 0x9E, 0xBC, 0x9E, 0xEB, 0x97, 0xEB, 0x97,
-        0xE0, 0x91, 0xE0, 0x91, 0xA8, 0x8C, 0xA8, 0x8C, 0x4C, 0x88, 0x4C, 0x88, 0xD5, 0x84, 0xD5, 0x84, 0x49, 0x82,
-        0x49, 0x82, 0xAE, 0x80, 0xAE, 0x80, 0x05, 0x80, 0x05, 0x80, 0x51, 0x80, 0x51, 0x80, 0x90, 0x81, 0x90, 0x81,
-        0xC1, 0x83, 0xC1, 0x83, 0xDF, 0x86, 0xDF, 0x86, 0xE5, 0x8A, 0xE5, 0x8A, 0xCA, 0x8F, 0xCA, 0x8F, 0x85, 0x95,
-        0x85, 0x95, 0x0C, 0x9C, 0x0C, 0x9C, 0x52, 0xA3, 0x52, 0xA3, 0x48, 0xAB, 0x48, 0xAB, 0xE1, 0xB3, 0xE1, 0xB3,
-        0x0A, 0xBD, 0x0A, 0xBD, 0xB4, 0xC6, 0xB4, 0xC6, 0xCB, 0xD0, 0xCB, 0xD0, 0x3C, 0xDB, 0x3C, 0xDB, 0xF4, 0xE5,
-        0xF4, 0xE5, 0xDD, 0xF0, 0xDD, 0xF0, 0xE3, 0xFB, 0xE3, 0xFB, 0xEF, 0x06, 0xEF, 0x06, 0xF0, 0x11, 0xF0, 0x11,
-        0xCF, 0x1C, 0xCF, 0x1C, 0x76, 0x27, 0x76, 0x27, 0xD2, 0x31, 0xD2, 0x31, 0xCF, 0x3B, 0xCF, 0x3B, 0x5A, 0x45,
-        0x5A, 0x45, 0x60, 0x4E, 0x60, 0x4E, 0xD1, 0x56, 0xD1, 0x56, 0x9B, 0x5E, 0x9B, 0x5E, 0xB2, 0x65, 0xB2, 0x65,
-        0x05, 0x6C, 0x05, 0x6C, 0x8B, 0x71, 0x8B, 0x71, 0x38, 0x76, 0x38, 0x76, 0x03, 0x7A, 0x03, 0x7A, 0xE5, 0x7C,
-        0xE5, 0x7C, 0xD9, 0x7E, 0xD9, 0x7E, 0xDA, 0x7F, 0xDA, 0x7F, 0xE7, 0x7F, 0xE7, 0x7F, 0x00, 0x7F, 0x00, 0x7F,
-        0x27, 0x7D, 0x27, 0x7D, 0x5E, 0x7A, 0x5E, 0x7A, 0xAC, 0x76, 0xAC, 0x76, 0x17, 0x72, 0x17, 0x72, 0xA9, 0x6C,
-        0xA9, 0x6C, 0x6A, 0x66, 0x6A, 0x66, 0x69, 0x5F, 0x69, 0x5F, 0xB1, 0x57, 0xB1, 0x57, 0x51, 0x4F, 0x51, 0x4F,
-        0x5A, 0x46, 0x5A, 0x46, 0xDD, 0x3C, 0xDD, 0x3C, 0xEC, 0x32, 0xEC, 0x32, 0x99, 0x28, 0x99, 0x28, 0xF9, 0x1D,
-        0xF9, 0x1D, 0x20, 0x13, 0x20, 0x13, 0x21, 0x08, 0x21, 0x08, 0x15, 0xFD, 0x15, 0xFD, 0x0D, 0xF2, 0x0D, 0xF2,
-        0x20, 0xE7, 0x20, 0xE7, 0x62, 0xDC, 0x62, 0xDC, 0xE8, 0xD1, 0xE8, 0xD1, 0xC7, 0xC7, 0xC7, 0xC7, 0x10, 0xBE,
-        0x10, 0xBE, 0xD8, 0xB4, 0xD8, 0xB4, 0x2F, 0xAC, 0x2F, 0xAC, 0x26, 0xA4, 0x26, 0xA4, 0xCD, 0x9C, 0xCD, 0x9C,
-        0x30, 0x96, 0x30, 0x96, 0x5F, 0x90, 0x5F, 0x90, 0x62, 0x8B, 0x62, 0x8B, 0x44, 0x87, 0x44, 0x87, 0x0C, 0x84,
-        0x0C, 0x84, 0xC1, 0x81, 0xC1, 0x81, 0x67, 0x80, 0x67, 0x80, 0x01, 0x80, 0x01, 0x80, 0x8F, 0x80, 0x8F, 0x80,
-        0x11, 0x82, 0x11, 0x82, 0x83, 0x84, 0x83, 0x84, 0xE1, 0x87, 0xE1, 0x87, 0x24, 0x8C, 0x24, 0x8C, 0x46, 0x91,
-        0x46, 0x91, 0x39, 0x97, 0x39, 0x97, 0xF5, 0x9D, 0xF5, 0x9D, 0x6D, 0xA5, 0x6D, 0xA5, 0x91, 0xAD, 0x91, 0xAD,
-        0x53, 0xB6, 0x53, 0xB6, 0xA1, 0xBF, 0xA1, 0xBF, 0x6A, 0xC9, 0x6A, 0xC9, 0x9C, 0xD3, 0x9C, 0xD3, 0x22, 0xDE,
-        0x22, 0xDE, 0xEA, 0xE8, 0xEA, 0xE8, 0xDD, 0xF3, 0xDD, 0xF3, 0xE6, 0xFE, 0xE6, 0xFE, 0xF2, 0x09, 0xF2, 0x09,
-        0xEB, 0x14, 0xEB, 0x14, 0xBD, 0x1F, 0xBD, 0x1F, 0x52, 0x2A, 0x52, 0x2A, 0x96, 0x34, 0x96, 0x34, 0x75, 0x3E,
-        0x75, 0x3E, 0xDD, 0x47, 0xDD, 0x47, 0xBD, 0x50, 0xBD, 0x50, 0x02, 0x59, 0x02, 0x59, 0x9D, 0x60, 0x9D, 0x60,
-        0x7F, 0x67, 0x7F, 0x67, 0x9C, 0x6D, 0x9C, 0x6D, 0xE7, 0x72, 0xE7, 0x72, 0x57, 0x77, 0x57, 0x77, 0xE4, 0x7A,
-        0xE4, 0x7A, 0x86, 0x7D, 0x86, 0x7D, 0x37, 0x7F, 0x37, 0x7F, 0xF6, 0x7F, 0xF6, 0x7F, 0xC0, 0x7F, 0xC0, 0x7F,
-        0x97, 0x7E, 0x97, 0x7E, 0x7C, 0x7C, 0x7C, 0x7C, 0x73, 0x79, 0x73, 0x79, 0x82, 0x75, 0x82, 0x75, 0xB1, 0x70,
-        0xB1, 0x70, 0x09, 0x6B, 0x09, 0x6B, 0x94, 0x64, 0x94, 0x64, 0x5F, 0x5D, 0x5F, 0x5D, 0x78, 0x55, 0x78, 0x55,
-        0xED, 0x4C, 0xED, 0x4C, 0xD1, 0x43, 0xD1, 0x43, 0x32, 0x3A, 0x32, 0x3A, 0x24, 0x30, 0x24, 0x30, 0xBA, 0x25,
-        0xBA, 0x25, 0x08, 0x1B, 0x08, 0x1B, 0x23, 0x10, 0x23, 0x10, 0x1E, 0x05, 0x1E, 0x05, 0x11, 0xFA, 0x11, 0xFA,
-        0x0F, 0xEF, 0x0F, 0xEF, 0x2C, 0xE4, 0x2C, 0xE4, 0x7F, 0xD9, 0x7F, 0xD9, 0x1B, 0xCF, 0x1B, 0xCF, 0x15, 0xC5,
-        0x15, 0xC5, 0x7F, 0xBB, 0x7F, 0xBB, 0x6C, 0xB2, 0x6C, 0xB2, 0xED, 0xA9, 0xED, 0xA9, 0x13, 0xA2, 0x13, 0xA2,
-        0xEC, 0x9A, 0xEC, 0x9A, 0x85, 0x94, 0x85, 0x94, 0xED, 0x8E, 0xED, 0x8E, 0x2C, 0x8A, 0x2C, 0x8A, 0x4C, 0x86,
-        0x4C, 0x86, 0x54, 0x83, 0x54, 0x83, 0x4B, 0x81, 0x4B, 0x81, 0x34, 0x80, 0x34, 0x80, 0x10, 0x80, 0x10, 0x80,
-        0xE1, 0x80, 0xE1, 0x80, 0xA4, 0x82, 0xA4, 0x82, 0x57, 0x85, 0x57, 0x85, 0xF4, 0x88, 0xF4, 0x88, 0x75, 0x8D,
-        0x75, 0x8D, 0xD0, 0x92, 0xD0, 0x92, 0xFC, 0x98, 0xFC, 0x98, 0xED, 0x9F, 0xED, 0x9F, 0x94, 0xA7, 0x94, 0xA7,
-        0xE5, 0xAF, 0xE5, 0xAF, 0xD0, 0xB8, 0xD0, 0xB8, 0x41, 0xC2, 0x41, 0xC2, 0x29, 0xCC, 0x29, 0xCC, 0x73, 0xD6,
-        0x73, 0xD6, 0x0D, 0xE1, 0x0D, 0xE1, 0xE2, 0xEB, 0xE2, 0xEB, 0xDE, 0xF6, 0xDE, 0xF6, 0xEA, 0x01, 0xEA, 0x01,
-        0xF3, 0x0C, 0xF3, 0x0C, 0xE4, 0x17, 0xE4, 0x17, 0xA6, 0x22, 0xA6, 0x22, 0x27, 0x2D, 0x27, 0x2D, 0x52, 0x37,
-        0x52, 0x37, 0x13, 0x41, 0x13, 0x41, 0x57, 0x4A, 0x57, 0x4A, 0x0E, 0x53, 0x0E, 0x53, 0x26, 0x5B, 0x26, 0x5B,
-        0x90, 0x62, 0x90, 0x62, 0x3E, 0x69, 0x3E, 0x69, 0x23, 0x6F, 0x23, 0x6F, 0x33, 0x74, 0x33, 0x74, 0x66, 0x78,
-        0x66, 0x78, 0xB3, 0x7B, 0xB3, 0x7B, 0x14, 0x7E, 0x14, 0x7E, 0x83, 0x7F, 0x83, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F,
-        0x88, 0x7F, 0x88, 0x7F, 0x1C, 0x7E, 0x1C, 0x7E, 0xBF, 0x7B, 0xBF, 0x7B, 0x77, 0x78, 0x77, 0x78, 0x48, 0x74,
-        0x48, 0x74, 0x3B, 0x6F, 0x3B, 0x6F, 0x5A, 0x69, 0x5A, 0x69, 0xAF, 0x62, 0xAF, 0x62, 0x49, 0x5B, 0x49, 0x5B,
-        0x33, 0x53, 0x33, 0x53, 0x80, 0x4A, 0x80, 0x4A, 0x3D, 0x41, 0x3D, 0x41, 0x7E, 0x37, 0x7E, 0x37, 0x55, 0x2D,
-        0x55, 0x2D, 0xD6, 0x22, 0xD6, 0x22, 0x14, 0x18, 0x14, 0x18, 0x24, 0x0D, 0x24, 0x0D, 0x1B, 0x02, 0x1B, 0x02,
-        0x0E, 0xF7, 0x0E, 0xF7, 0x13, 0xEC, 0x13, 0xEC, 0x3D, 0xE1, 0x3D, 0xE1, 0xA2, 0xD6, 0xA2, 0xD6, 0x55, 0xCC,
-        0x55, 0xCC, 0x6C, 0xC2, 0x6C, 0xC2, 0xF8, 0xB8, 0xF8, 0xB8, 0x0C, 0xB0, 0x0C, 0xB0, 0xB8, 0xA7, 0xB8, 0xA7,
-        0x0D, 0xA0, 0x0D, 0xA0, 0x19, 0x99, 0x19, 0x99, 0xEA, 0x92, 0xEA, 0x92, 0x8B, 0x8D, 0x8B, 0x8D, 0x07, 0x89,
-        0x07, 0x89, 0x65, 0x85, 0x65, 0x85, 0xAE, 0x82, 0xAE, 0x82, 0xE6, 0x80, 0xE6, 0x80, 0x11, 0x80, 0x11, 0x80,
-        0x30, 0x80, 0x30, 0x80, 0x44, 0x81, 0x44, 0x81, 0x49, 0x83, 0x49, 0x83, 0x3D, 0x86, 0x3D, 0x86, 0x18, 0x8A,
-        0x18, 0x8A, 0xD6, 0x8E, 0xD6, 0x8E, 0x6B, 0x94, 0x6B, 0x94, 0xCD, 0x9A, 0xCD, 0x9A, 0xF2, 0xA1, 0xF2, 0xA1,
-        0xC9, 0xA9, 0xC9, 0xA9, 0x45, 0xB2, 0x45, 0xB2, 0x55, 0xBB, 0x55, 0xBB, 0xE9, 0xC4, 0xE9, 0xC4, 0xEE, 0xCE,
-        0xEE, 0xCE, 0x50, 0xD9, 0x50, 0xD9, 0xFC, 0xE3, 0xFC, 0xE3, 0xDE, 0xEE, 0xDE, 0xEE, 0xE0, 0xF9, 0xE0, 0xF9,
-        0xEE, 0x04, 0xEE, 0x04, 0xF2, 0x0F, 0xF2, 0x0F, 0xD9, 0x1A, 0xD9, 0x1A, 0x8B, 0x25, 0x8B, 0x25, 0xF6, 0x2F,
-        0xF6, 0x2F, 0x06, 0x3A, 0x06, 0x3A, 0xA7, 0x43, 0xA7, 0x43, 0xC6, 0x4C, 0xC6, 0x4C, 0x54, 0x55, 0x54, 0x55,
-        0x3E, 0x5D, 0x3E, 0x5D, 0x76, 0x64, 0x76, 0x64, 0xEE, 0x6A, 0xEE, 0x6A, 0x9A, 0x70, 0x9A, 0x70, 0x6F, 0x75,
-        0x6F, 0x75, 0x63, 0x79, 0x63, 0x79, 0x71, 0x7C, 0x71, 0x7C, 0x90, 0x7E, 0x90, 0x7E, 0xBE, 0x7F, 0xBE, 0x7F,
-        0xF7, 0x7F, 0xF7, 0x7F, 0x3C, 0x7F, 0x3C, 0x7F, 0x8F, 0x7D, 0x8F, 0x7D, 0xF1, 0x7A, 0xF1, 0x7A, 0x69, 0x77,
-        0x69, 0x77, 0xFD, 0x72, 0xFD, 0x72, 0xB5, 0x6D, 0xB5, 0x6D, 0x9C, 0x67, 0x9C, 0x67, 0xBD, 0x60, 0xBD, 0x60,
-        0x25, 0x59, 0x25, 0x59, 0xE3, 0x50, 0xE3, 0x50, 0x06, 0x48, 0x06, 0x48, 0xA0, 0x3E, 0xA0, 0x3E, 0xC3, 0x34,
-        0xC3, 0x34, 0x80, 0x2A, 0x80, 0x2A, 0xEC, 0x1F, 0xEC, 0x1F, 0x1C, 0x15, 0x1C, 0x15, 0x23, 0x0A, 0x23, 0x0A,
-        0x18, 0xFF, 0x18, 0xFF, 0x0D, 0xF4, 0x0D, 0xF4, 0x19, 0xE9, 0x19, 0xE9, 0x51, 0xDE, 0x51, 0xDE, 0xCA, 0xD3,
-        0xCA, 0xD3, 0x97, 0xC9, 0x97, 0xC9, 0xCB, 0xBF, 0xCB, 0xBF, 0x7B, 0xB6, 0x7B, 0xB6, 0xB6, 0xAD, 0xB6, 0xAD,
-        0x8F, 0xA5, 0x8F, 0xA5, 0x15, 0x9E, 0x15, 0x9E, 0x55, 0x97, 0x55, 0x97, 0x5E, 0x91, 0x5E, 0x91, 0x39, 0x8C,
-        0x39, 0x8C, 0xF2, 0x87, 0xF2, 0x87, 0x90, 0x84, 0x90, 0x84, 0x1A, 0x82, 0x1A, 0x82, 0x94, 0x80, 0x94, 0x80,
-        0x01, 0x80, 0x01, 0x80, 0x64, 0x80, 0x64, 0x80, 0xB9, 0x81, 0xB9, 0x81, 0x00, 0x84, 0x00, 0x84, 0x33, 0x87,
-        0x33, 0x87, 0x4E, 0x8B, 0x4E, 0x8B, 0x46, 0x90, 0x46, 0x90, 0x15, 0x96, 0x15, 0x96, 0xAD, 0x9C, 0xAD, 0x9C,
-        0x04, 0xA4, 0x04, 0xA4, 0x09, 0xAC, 0x09, 0xAC, 0xB0, 0xB4, 0xB0, 0xB4, 0xE7, 0xBD, 0xE7, 0xBD, 0x9A, 0xC7,
-        0x9A, 0xC7, 0xBA, 0xD1, 0xBA, 0xD1, 0x33, 0xDC, 0x33, 0xDC, 0xF0, 0xE6, 0xF0, 0xE6, 0xDC, 0xF1, 0xDC, 0xF1,
-        0xE4, 0xFC, 0xE4, 0xFC, 0xF1, 0x07, 0xF1, 0x07, 0xEF, 0x12, 0xEF, 0x12, 0xC9, 0x1D, 0xC9, 0x1D, 0x6A, 0x28,
-        0x6A, 0x28, 0xBF, 0x32, 0xBF, 0x32, 0xB2, 0x3C, 0xB2, 0x3C, 0x31, 0x46, 0x31, 0x46, 0x2B, 0x4F, 0x2B, 0x4F,
-        0x8D, 0x57, 0x8D, 0x57, 0x48, 0x5F, 0x48, 0x5F, 0x4D, 0x66, 0x4D, 0x66, 0x8E, 0x6C, 0x8E, 0x6C, 0x01, 0x72,
-        0x01, 0x72, 0x9A, 0x76, 0x9A, 0x76, 0x50, 0x7A, 0x50, 0x7A, 0x1C, 0x7D, 0x1C, 0x7D, 0xFA, 0x7E, 0xFA, 0x7E,
-        0xE5, 0x7F, 0xE5, 0x7F, 0xDD, 0x7F, 0xDD, 0x7F, 0xDF, 0x7E, 0xDF, 0x7E, 0xF0, 0x7C, 0xF0, 0x7C, 0x12, 0x7A,
-        0x12, 0x7A, 0x4B, 0x76, 0x4B, 0x76, 0xA1, 0x71, 0xA1, 0x71, 0x20, 0x6C, 0x20, 0x6C, 0xCF, 0x65, 0xCF, 0x65,
-        0xBC, 0x5E, 0xBC, 0x5E, 0xF4, 0x56, 0xF4, 0x56, 0x87, 0x4E, 0x87, 0x4E, 0x83, 0x45, 0x83, 0x45, 0xFA, 0x3B,
-        0xFA, 0x3B, 0xFF, 0x31, 0xFF, 0x31, 0xA5, 0x27, 0xA5, 0x27, 0xFE, 0x1C, 0xFE, 0x1C, 0x21, 0x12, 0x21, 0x12,
-        0x21, 0x07, 0x21, 0x07, 0x14, 0xFC, 0x14, 0xFC, 0x0D, 0xF1, 0x0D, 0xF1, 0x23, 0xE6, 0x23, 0xE6, 0x6B, 0xDB,
-        0x6B, 0xDB, 0xF8, 0xD0, 0xF8, 0xD0, 0xE0, 0xC6, 0xE0, 0xC6, 0x34, 0xBD, 0x34, 0xBD, 0x08, 0xB4, 0x08, 0xB4,
-        0x6D, 0xAB, 0x6D, 0xAB, 0x73, 0xA3, 0x73, 0xA3, 0x2B, 0x9C, 0x2B, 0x9C, 0xA1, 0x95, 0xA1, 0x95, 0xE1, 0x8F,
-        0xE1, 0x8F, 0xF8, 0x8A, 0xF8, 0x8A, 0xEF, 0x86, 0xEF, 0x86, 0xCC, 0x83, 0xCC, 0x83, 0x98, 0x81, 0x98, 0x81,
-        0x54, 0x80, 0x54, 0x80, 0x04, 0x80, 0x04, 0x80, 0xA8, 0x80, 0xA8, 0x80, 0x40, 0x82, 0x40, 0x82, 0xC8, 0x84,
-        0xC8, 0x84, 0x3B, 0x88, 0x3B, 0x88, 0x93, 0x8C, 0x93, 0x8C, 0xC7, 0x91, 0xC7, 0x91, 0xCE, 0x97, 0xCE, 0x97,
-        0x9C, 0x9E, 0x9C, 0x9E, 0x23, 0xA6, 0x23, 0xA6, 0x56, 0xAE, 0x56, 0xAE, 0x25, 0xB7, 0x25, 0xB7, 0x80, 0xC0,
-        0x80, 0xC0, 0x53, 0xCA, 0x53, 0xCA, 0x8E, 0xD4, 0x8E, 0xD4, 0x1B, 0xDF, 0x1B, 0xDF, 0xE6, 0xE9, 0xE6, 0xE9,
-        0xDD, 0xF4, 0xDD, 0xF4, 0xE8, 0xFF, 0xE8, 0xFF, 0xF2, 0x0A, 0xF2, 0x0A, 0xE9, 0x15, 0xE9, 0x15, 0xB6, 0x20,
-        0xB6, 0x20, 0x44, 0x2B, 0x44, 0x2B, 0x80, 0x35, 0x80, 0x35, 0x55, 0x3F, 0x55, 0x3F, 0xB2, 0x48, 0xB2, 0x48,
-        0x84, 0x51, 0x84, 0x51, 0xBA, 0x59, 0xBA, 0x59, 0x45, 0x61, 0x45, 0x61, 0x16, 0x68, 0x16, 0x68, 0x20, 0x6E,
-        0x20, 0x6E, 0x58, 0x73, 0x58, 0x73, 0xB4, 0x77, 0xB4, 0x77, 0x2B, 0x7B, 0x2B, 0x7B, 0xB7, 0x7D, 0xB7, 0x7D,
-        0x52, 0x7F, 0x52, 0x7F, 0xFB, 0x7F, 0xFB, 0x7F, 0xAF, 0x7F, 0xAF, 0x7F, 0x70, 0x7E, 0x70, 0x7E, 0x3F, 0x7C,
-        0x3F, 0x7C, 0x21, 0x79, 0x21, 0x79, 0x1B, 0x75, 0x1B, 0x75, 0x37, 0x70, 0x37, 0x70, 0x7A, 0x6A, 0x7A, 0x6A,
-        0xF4, 0x63, 0xF4, 0x63, 0xAE, 0x5C, 0xAE, 0x5C, 0xB8, 0x54, 0xB8, 0x54, 0x20, 0x4C, 0x20, 0x4C, 0xF6, 0x42,
-        0xF6, 0x42, 0x4C, 0x39, 0x4C, 0x39, 0x35, 0x2F, 0x35, 0x2F, 0xC4, 0x24, 0xC4, 0x24, 0x0D, 0x1A, 0x0D, 0x1A,
-        0x23, 0x0F, 0x23, 0x0F, 0x1E, 0x04, 0x1E, 0x04, 0x10, 0xF9, 0x10, 0xF9, 0x10, 0xEE, 0x10, 0xEE, 0x32, 0xE3,
-        0x32, 0xE3, 0x8A, 0xD8, 0x8A, 0xD8, 0x2E, 0xCE, 0x2E, 0xCE, 0x31, 0xC4, 0x31, 0xC4, 0xA6, 0xBA, 0xA6, 0xBA,
-        0xA0, 0xB1, 0xA0, 0xB1, 0x2F, 0xA9, 0x2F, 0xA9, 0x65, 0xA1, 0x65, 0xA1, 0x4F, 0x9A, 0x4F, 0x9A, 0xFB, 0x93,
-        0xFB, 0x93, 0x75, 0x8E, 0x75, 0x8E, 0xC8, 0x89, 0xC8, 0x89, 0xFD, 0x85, 0xFD, 0x85, 0x1B, 0x83, 0x1B, 0x83,
-        0x27, 0x81, 0x27, 0x81, 0x26, 0x80, 0x26, 0x80, 0x18, 0x80, 0x18, 0x80, 0x00, 0x81, 0x00, 0x81, 0xD9, 0x82,
-        0xD9, 0x82, 0xA2, 0x85, 0xA2, 0x85, 0x54, 0x89, 0x54, 0x89, 0xE9, 0x8D, 0xE9, 0x8D, 0x57, 0x93, 0x57, 0x93,
-        0x96, 0x99, 0x96, 0x99, 0x97, 0xA0, 0x97, 0xA0, 0x4F, 0xA8, 0x4F, 0xA8, 0xAF, 0xB0, 0xAF, 0xB0, 0xA6, 0xB9,
-        0xA6, 0xB9, 0x23, 0xC3, 0x23, 0xC3, 0x14, 0xCD, 0x14, 0xCD, 0x67, 0xD7, 0x67, 0xD7, 0x07, 0xE2, 0x07, 0xE2,
-        0xE0, 0xEC, 0xE0, 0xEC, 0xDE, 0xF7, 0xDE, 0xF7, 0xEB, 0x02, 0xEB, 0x02, 0xF3, 0x0D, 0xF3, 0x0D, 0xE1, 0x18,
-        0xE1, 0x18, 0x9E, 0x23, 0x9E, 0x23, 0x18, 0x2E, 0x18, 0x2E, 0x39, 0x38, 0x39, 0x38, 0xF0, 0x41, 0xF0, 0x41,
-        0x29, 0x4B, 0x29, 0x4B, 0xD1, 0x53, 0xD1, 0x53, 0xDA, 0x5B, 0xDA, 0x5B, 0x33, 0x63, 0x33, 0x63, 0xD0, 0x69,
-        0xD0, 0x69, 0xA1, 0x6F, 0xA1, 0x6F, 0x9F, 0x74, 0x9F, 0x74, 0xBC, 0x78, 0xBC, 0x78, 0xF5, 0x7B, 0xF5, 0x7B,
-        0x3F, 0x7E, 0x3F, 0x7E, 0x99, 0x7F, 0x99, 0x7F, 0xFF, 0x7F, 0xFF, 0x7F, 0x71, 0x7F, 0x71, 0x7F, 0xEF, 0x7D,
-        0xEF, 0x7D, 0x7D, 0x7B, 0x7D, 0x7B, 0x1E, 0x78, 0x1E, 0x78, 0xDB, 0x73, 0xDB, 0x73, 0xBB, 0x6E, 0xBB, 0x6E,
-        0xC7, 0x68, 0xC7, 0x68, 0x0B, 0x62, 0x0B, 0x62, 0x93, 0x5A, 0x93, 0x5A, 0x6F, 0x52, 0x6F, 0x52, 0xAE, 0x49,
-        0xAE, 0x49, 0x5F, 0x40, 0x5F, 0x40, 0x96, 0x36, 0x96, 0x36, 0x64, 0x2C, 0x64, 0x2C, 0xDE, 0x21, 0xDE, 0x21,
-        0x17, 0x17, 0x17, 0x17, 0x23, 0x0C, 0x23, 0x0C, 0x1A, 0x01, 0x1A, 0x01, 0x0E, 0xF6, 0x0E, 0xF6, 0x14, 0xEB,
-        0x14, 0xEB, 0x43, 0xE0, 0x43, 0xE0, 0xAE, 0xD5, 0xAE, 0xD5, 0x6A, 0xCB, 0x6A, 0xCB, 0x8B, 0xC1, 0x8B, 0xC1,
-        0x22, 0xB8, 0x22, 0xB8, 0x43, 0xAF, 0x43, 0xAF, 0xFE, 0xA6, 0xFE, 0xA6, 0x63, 0x9F, 0x63, 0x9F, 0x81, 0x98,
-        0x81, 0x98, 0x64, 0x92, 0x64, 0x92, 0x19, 0x8D, 0x19, 0x8D, 0xA9, 0x88, 0xA9, 0x88, 0x1D, 0x85, 0x1D, 0x85,
-        0x7A, 0x82, 0x7A, 0x82, 0xC9, 0x80, 0xC9, 0x80, 0x0A, 0x80, 0x0A, 0x80, 0x40, 0x80, 0x40, 0x80, 0x68, 0x81,
-        0x68, 0x81, 0x84, 0x83, 0x84, 0x83, 0x8D, 0x86, 0x8D, 0x86, 0x7E, 0x8A, 0x7E, 0x8A, 0x4F, 0x8F, 0x4F, 0x8F,
-        0xF7, 0x94, 0xF7, 0x94, 0x6C, 0x9B, 0x6C, 0x9B, 0xA1, 0xA2, 0xA1, 0xA2, 0x88, 0xAA, 0x88, 0xAA, 0x12, 0xB3,
-        0x12, 0xB3, 0x2F, 0xBC, 0x2F, 0xBC, 0xCE, 0xC5, 0xCE, 0xC5, 0xDC, 0xCF, 0xDC, 0xCF, 0x46, 0xDA, 0x46, 0xDA,
-        0xF8, 0xE4, 0xF8, 0xE4, 0xDD, 0xEF, 0xDD, 0xEF, 0xE1, 0xFA, 0xE1, 0xFA, 0xEE, 0x05, 0xEE, 0x05, 0xF2, 0x10,
-        0xF2, 0x10, 0xD4, 0x1B, 0xD4, 0x1B, 0x81, 0x26, 0x81, 0x26, 0xE4, 0x30, 0xE4, 0x30, 0xEB, 0x3A, 0xEB, 0x3A,
-        0x81, 0x44, 0x81, 0x44, 0x94, 0x4D, 0x94, 0x4D, 0x13, 0x56, 0x13, 0x56, 0xED, 0x5D, 0xED, 0x5D, 0x14, 0x65,
-        0x14, 0x65, 0x7B, 0x6B, 0x7B, 0x6B, 0x13, 0x71, 0x13, 0x71, 0xD5, 0x75, 0xD5, 0x75, 0xB4, 0x79, 0xB4, 0x79,
-        0xAC, 0x7C, 0xAC, 0x7C, 0xB5, 0x7E, 0xB5, 0x7E, 0xCD, 0x7F, 0xCD, 0x7F, 0xF1, 0x7F, 0xF1, 0x7F, 0x1F, 0x7F,
-        0x1F, 0x7F, 0x5C, 0x7D, 0x5C, 0x7D, 0xA9, 0x7A, 0xA9, 0x7A, 0x0C, 0x77, 0x0C, 0x77, 0x8B, 0x72, 0x8B, 0x72,
-        0x30, 0x6D, 0x30, 0x6D, 0x04, 0x67, 0x04, 0x67, 0x14, 0x60, 0x14, 0x60, 0x6B, 0x58, 0x6B, 0x58, 0x1B, 0x50,
-        0x1B, 0x50, 0x31, 0x47, 0x31, 0x47, 0xBF, 0x3D, 0xBF, 0x3D, 0xD7, 0x33, 0xD7, 0x33, 0x8D, 0x29, 0x8D, 0x29,
-        0xF3, 0x1E, 0xF3, 0x1E, 0x1E, 0x14, 0x1E, 0x14, 0x22, 0x09, 0x22, 0x09, 0x16, 0xFE, 0x16, 0xFE, 0x0D, 0xF3,
-        0x0D, 0xF3, 0x1D, 0xE8, 0x1D, 0xE8, 0x5A, 0xDD, 0x5A, 0xDD, 0xD8, 0xD2, 0xD8, 0xD2, 0xAE, 0xC8, 0xAE, 0xC8,
-        0xED, 0xBE, 0xED, 0xBE, 0xA9, 0xB5, 0xA9, 0xB5, 0xF1, 0xAC, 0xF1, 0xAC, 0xDA, 0xA4, 0xDA, 0xA4, 0x70, 0x9D,
-        0x70, 0x9D, 0xC2, 0x96, 0xC2, 0x96, 0xDD, 0x90, 0xDD, 0x90, 0xCD, 0x8B, 0xCD, 0x8B, 0x9A, 0x87, 0x9A, 0x87,
-        0x4D, 0x84, 0x4D, 0x84, 0xEC, 0x81, 0xEC, 0x81, 0x7D, 0x80, 0x7D, 0x80, 0x00, 0x80, 0x00, 0x80, 0x78, 0x80,
-        0x78, 0x80, 0xE4, 0x81, 0xE4, 0x81, 0x40, 0x84, 0x40, 0x84, 0x89, 0x87, 0x89, 0x87, 0xB8, 0x8B, 0xB8, 0x8B,
-        0xC5, 0x90, 0xC5, 0x90, 0xA6, 0x96, 0xA6, 0x96, 0x51, 0x9D, 0x51, 0x9D, 0xB7, 0xA4, 0xB7, 0xA4, 0xCD, 0xAC,
-        0xCD, 0xAC, 0x81, 0xB5, 0x81, 0xB5, 0xC3, 0xBE, 0xC3, 0xBE, 0x82, 0xC8, 0x82, 0xC8, 0xAB, 0xD2, 0xAB, 0xD2,
-        0x2B, 0xDD, 0x2B, 0xDD, 0xEC, 0xE7, 0xEC, 0xE7, 0xDD, 0xF2, 0xDD, 0xF2, 0xE5, 0xFD, 0xE5, 0xFD, 0xF1, 0x08,
-        0xF1, 0x08, 0xED, 0x13, 0xED, 0x13, 0xC3, 0x1E, 0xC3, 0x1E, 0x5E, 0x29, 0x5E, 0x29, 0xAB, 0x33, 0xAB, 0x33,
-        0x94, 0x3D, 0x94, 0x3D, 0x08, 0x47, 0x08, 0x47,
-};
@@ -34,90 +34,1824 @@
 #include <linux/kernel.h>
 #include <linux/platform_device.h>
 #include <linux/init.h>
+#include <linux/kthread.h>
+#include <linux/mutex.h>
+#include <linux/sched.h>
 #include <linux/slab.h>
+#include <linux/seqlock.h>
+#include <linux/math64.h>
+#include <linux/timerqueue.h>
+#include <linux/workqueue.h>
+#include <linux/uaccess.h>
+#include <linux/fixp-arith.h>
+#include <linux/gcd.h>
+#include <linux/mm.h>
+#include <asm/unaligned.h>
 #include <sound/core.h>
+#include <sound/control.h>
+#include <sound/info.h>
 #include <sound/initval.h>
 #include <sound/pcm.h>
+#include <sound/timer.h>
 
-#include "music_gen.h"
+MODULE_AUTHOR("Bram Vlerick <vlerickb@gmail.com>");
+MODULE_DESCRIPTION("PCM Sound generator");
+MODULE_LICENSE("GPL");
+MODULE_SUPPORTED_DEVICE("{{ALSA,PCM Sound generator}}");
+
+static struct platform_device *device;
+
+#define MAX_PCM_DEVICES		8
+#define MAX_PCM_SUBSTREAMS	128
+
+static int timer_backend;
+module_param(timer_backend, int, 0444);
+MODULE_PARM_DESC(timer_backend,
+                "Default timer backend (0 = hrtimer, 1 = system timer, 2 = kthread, 3 = shared tick)");
+static int pcm_devs = 1;
+module_param(pcm_devs, int, 0444);
+MODULE_PARM_DESC(pcm_devs, "PCM devices (1-8)");
+static int pcm_substreams = 1;
+module_param(pcm_substreams, int, 0444);
+MODULE_PARM_DESC(pcm_substreams,
+                "Playback and capture substreams per PCM device (1-128)");
+static int timer_slack = 5;
+module_param(timer_slack, int, 0444);
+MODULE_PARM_DESC(timer_slack,
+                "Allowed period timer slack in percent, lets wakeups coalesce");
+static bool loopback;
+module_param(loopback, bool, 0444);
+MODULE_PARM_DESC(loopback,
+                "Capture substreams record the playback substream of the same number");
+static int buffer_max_kb = 4096;
+module_param(buffer_max_kb, int, 0444);
+MODULE_PARM_DESC(buffer_max_kb, "Largest PCM buffer in KiB, vmalloc backed");
+static int prealloc_kb = 64;
+module_param(prealloc_kb, int, 0444);
+MODULE_PARM_DESC(prealloc_kb, "Buffer preallocated per substream in KiB");
+static int clock_rate = 48000;
+module_param(clock_rate, int, 0444);
+MODULE_PARM_DESC(clock_rate,
+                "Tick rate of the card's ALSA timer, one tick per frame");
+static bool deferred_fill;
+module_param(deferred_fill, bool, 0444);
+MODULE_PARM_DESC(deferred_fill,
+                "Synthesize capture periods in worker threads, not the timer callback");
+static int fill_periods = 2;
+module_param(fill_periods, int, 0444);
+MODULE_PARM_DESC(fill_periods,
+                "Periods the fill workers keep generated ahead of the position");
+
+static struct workqueue_struct *soundgen_fill_wq;
+
+
+struct soundgen_stats;
+struct soundgen_loop;
+
+/* Card wide timer servicing every substream of the shared tick backend */
+struct soundgen_tick {
+        spinlock_t lock;
+        struct hrtimer timer;
+        struct timerqueue_head queue;	/* substreams by next deadline */
+};
+
+/* The period grid exported as an ALSA timer device */
+struct soundgen_timer {
+        struct snd_timer *timer;
+        struct hrtimer hrt;
+        bool in_callback;
+};
+
+struct snd_card_soundgen {
+        struct snd_card *card;
+        struct snd_pcm *pcm[MAX_PCM_DEVICES];
+        struct snd_pcm_hardware pcm_hw;
+        struct soundgen_stats *stats;	/* one per substream */
+        unsigned int num_stats;
+        struct soundgen_loop *loops;	/* one per substream pair */
+        ktime_t epoch;		/* origin of the shared period grid */
+        struct soundgen_tick tick;
+        struct soundgen_timer clock_timer;
+        spinlock_t mixer_lock;
+        int waveform;
+        int frequency;
+        int amplitude;
+        int timer_backend;
+        int sink_meter;
+};
+
+/**
+ * Generator stuff
+ */
+
+enum soundgen_waveform {
+        SOUNDGEN_WAVE_SINE,
+        SOUNDGEN_WAVE_SQUARE,
+        SOUNDGEN_WAVE_SAW,
+        SOUNDGEN_WAVE_NOISE,
+        SOUNDGEN_WAVE_TABLE,
+};
+
+static const char * const soundgen_waveform_names[] = {
+        "Sine", "Square", "Sawtooth", "Noise", "Table",
+};
+
+#define SOUNDGEN_FREQ_MIN	1
+#define SOUNDGEN_FREQ_MAX	20000
+#define SOUNDGEN_FREQ_DEFAULT	440
+#define SOUNDGEN_AMPL_DEFAULT	80
+
+#define SOUNDGEN_SINE_BITS	10
+#define SOUNDGEN_SINE_SIZE	(1 << SOUNDGEN_SINE_BITS)
+#define SOUNDGEN_NOISE_SEED	0x1badf00d
+#define SOUNDGEN_GEN_CHUNK	128
+#define SOUNDGEN_COPY_BOUNCE	512	/* bytes staged per user copy */
+#define SOUNDGEN_TABLE_HARMONICS 8
+#define SOUNDGEN_WAVETABLE_MAX	(256 * 1024)	/* bytes per cached loop */
+
+/* One full sine period, full scale s32 */
+static s32 soundgen_sine[SOUNDGEN_SINE_SIZE];
+/* One period of the "Table" waveform, a band limited sawtooth */
+static s32 soundgen_table[SOUNDGEN_SINE_SIZE];
+
+struct soundgen_wavetable;
+
+/* Stores count mono samples into channels interleaved slots each */
+typedef void (*soundgen_writer_t)(void *dst, const s32 *buf,
+                unsigned int count, unsigned int channels);
+
+/*
+ * Per substream oscillator state. The phase is a 0.32 fixed-point
+ * fraction of one waveform period, so wrapping is free.
+ */
+struct soundgen_gen {
+        u32 phase;
+        u32 noise;
+        soundgen_writer_t write;
+        const struct soundgen_wavetable *wt;	/* cached loop, or NULL */
+        bool wt_active;		/* settings match wt, output comes from it */
+        unsigned int table_pos;	/* sample index into wt */
+        s32 *render;		/* SOUNDGEN_GEN_CHUNK samples of scratch */
+};
+
+/*
+ * Scratch of the copy and fill paths, allocated at open so that they
+ * keep their buffers off the stack. A substream runs one of them at a
+ * time.
+ */
+struct soundgen_scratch {
+        s32 render[SOUNDGEN_GEN_CHUNK];
+        u8 bounce[SOUNDGEN_COPY_BOUNCE];
+};
+
+static s64 soundgen_table_sum(unsigned int i)
+{
+        s64 sum = 0;
+        unsigned int n;
+
+        for (n = 1; n <= SOUNDGEN_TABLE_HARMONICS; n++)
+                sum += soundgen_sine[(i * n) % SOUNDGEN_SINE_SIZE] / (s32)n;
+        return sum;
+}
+
+static void soundgen_tables_init(void)
+{
+        s64 peak = 1;
+        int i;
+
+        for (i = 0; i < SOUNDGEN_SINE_SIZE; i++)
+                soundgen_sine[i] = fixp_sin32_rad(i, SOUNDGEN_SINE_SIZE);
+
+        for (i = 0; i < SOUNDGEN_SINE_SIZE; i++)
+                peak = max(peak, abs(soundgen_table_sum(i)));
+        for (i = 0; i < SOUNDGEN_SINE_SIZE; i++)
+                soundgen_table[i] = clamp_t(s64,
+                                div64_s64(soundgen_table_sum(i) * (1 << 30),
+                                        peak) * 2,
+                                -S32_MAX, S32_MAX);
+}
+
+/* Full scale s32 to IEEE 754 single in [-1.0, 1.0), without the FPU */
+static inline u32 soundgen_s32_to_float(s32 sample)
+{
+        u32 sign = 0, mag = sample, exp;
+
+        if (!sample)
+                return 0;
+        if (sample < 0) {
+                sign = 0x80000000U;
+                mag = -(u32)sample;
+        }
+        exp = fls(mag) - 1;
+        if (exp >= 23)
+                mag >>= exp - 23;
+        else
+                mag <<= 23 - exp;
+        return sign | ((exp + 127 - 31) << 23) | (mag & 0x7fffff);
+}
+
+#define soundgen_conv_s8(x)	((s8)((x) >> 24))
+#define soundgen_conv_s16(x)	cpu_to_le16((u16)((x) >> 16))
+#define soundgen_conv_s24(x)	cpu_to_le32((u32)((x) >> 8))
+#define soundgen_conv_s32(x)	cpu_to_le32((u32)(x))
+#define soundgen_conv_float(x)	cpu_to_le32(soundgen_s32_to_float(x))
+
+/*
+ * One store loop per format, so the sample is narrowed once and then
+ * copied to every channel at its native width.
+ */
+#define SOUNDGEN_WRITER(fmt, type) \
+static void soundgen_write_##fmt(void *dst, const s32 *buf, \
+                unsigned int count, unsigned int channels) \
+{ \
+        type *p = dst; \
+        type v; \
+        unsigned int i, ch; \
+\
+        for (i = 0; i < count; i++) { \
+                v = soundgen_conv_##fmt(buf[i]); \
+                for (ch = 0; ch < channels; ch++) \
+                        *p++ = v; \
+        } \
+}
+
+SOUNDGEN_WRITER(s8, s8)
+SOUNDGEN_WRITER(s16, __le16)
+SOUNDGEN_WRITER(s24, __le32)
+SOUNDGEN_WRITER(s32, __le32)
+SOUNDGEN_WRITER(float, __le32)
+
+static soundgen_writer_t soundgen_writer(snd_pcm_format_t format)
+{
+        switch (format) {
+        case SNDRV_PCM_FORMAT_S8:
+                return soundgen_write_s8;
+        case SNDRV_PCM_FORMAT_S16_LE:
+                return soundgen_write_s16;
+        case SNDRV_PCM_FORMAT_S24_LE:
+                return soundgen_write_s24;
+        case SNDRV_PCM_FORMAT_S32_LE:
+                return soundgen_write_s32;
+        case SNDRV_PCM_FORMAT_FLOAT_LE:
+                return soundgen_write_float;
+        default:
+                return NULL;
+        }
+}
+
+static int soundgen_gen_reset(struct soundgen_gen *gen,
+                struct snd_pcm_runtime *runtime)
+{
+        gen->phase = 0;
+        gen->noise = SOUNDGEN_NOISE_SEED;
+        gen->wt_active = false;
+        gen->table_pos = 0;
+        gen->write = soundgen_writer(runtime->format);
+        if (!gen->write) {
+                pr_err("Unsupported format %d\n", runtime->format);
+                return -EINVAL;
+        }
+        return 0;
+}
+
+static inline s32 soundgen_gain(s32 sample, u32 gain)
+{
+        return (s32)(((s64)sample * gain) >> 16);
+}
+
+/* Render count mono samples in full scale s32 */
+static void soundgen_gen_render(struct soundgen_gen *gen, int waveform,
+                u32 inc, u32 gain, s32 *buf, unsigned int count)
+{
+        u32 phase = gen->phase;
+        u32 x = gen->noise;
+        unsigned int i;
+
+        switch (waveform) {
+        case SOUNDGEN_WAVE_SINE:
+                for (i = 0; i < count; i++, phase += inc)
+                        buf[i] = soundgen_gain(soundgen_sine[phase >>
+                                        (32 - SOUNDGEN_SINE_BITS)], gain);
+                break;
+        case SOUNDGEN_WAVE_SQUARE:
+                for (i = 0; i < count; i++, phase += inc)
+                        buf[i] = soundgen_gain(phase < 0x80000000U ?
+                                        S32_MAX : -S32_MAX, gain);
+                break;
+        case SOUNDGEN_WAVE_SAW:
+                for (i = 0; i < count; i++, phase += inc)
+                        buf[i] = soundgen_gain((s32)(phase + 0x80000000U),
+                                        gain);
+                break;
+        case SOUNDGEN_WAVE_NOISE:
+                /* xorshift32, seeded on prepare so runs are repeatable */
+                for (i = 0; i < count; i++) {
+                        x ^= x << 13;
+                        x ^= x >> 17;
+                        x ^= x << 5;
+                        buf[i] = soundgen_gain((s32)x, gain);
+                }
+                break;
+        case SOUNDGEN_WAVE_TABLE:
+                for (i = 0; i < count; i++, phase += inc)
+                        buf[i] = soundgen_gain(soundgen_table[phase >>
+                                        (32 - SOUNDGEN_SINE_BITS)], gain);
+                break;
+        }
+        gen->phase = phase;
+        gen->noise = x;
+}
+
+/* Generator settings, sampled once per fill or copy */
+struct soundgen_params {
+        int waveform;
+        unsigned int frequency;	/* the value inc was derived from */
+        u32 inc;
+        u32 gain;
+};
+
+static void soundgen_gen_params(struct snd_pcm_substream *substream,
+                struct soundgen_params *sp)
+{
+        struct snd_card_soundgen *chip = snd_pcm_substream_chip(substream);
+
+        sp->waveform = READ_ONCE(chip->waveform);
+        sp->frequency = READ_ONCE(chip->frequency);
+        sp->inc = div_u64((u64)sp->frequency << 32, substream->runtime->rate);
+        sp->gain = READ_ONCE(chip->amplitude) * 65536 / 100;
+}
+
+/*
+ * Wavetable cache
+ *
+ * A periodic waveform at frequency f repeats exactly every
+ * rate / gcd(rate, f) samples. That loop is rendered once in the
+ * stream's sample format and shared by every substream prepared with
+ * the same settings, so steady state fills are plain copies. Tables are
+ * picked up on prepare; while the controls differ from the table the
+ * oscillator takes over.
+ */
+struct soundgen_wavetable {
+        struct list_head list;
+        unsigned int refs;
+        int waveform;
+        u32 inc;
+        u32 gain;
+        unsigned int rate;
+        snd_pcm_format_t format;
+        unsigned int len;	/* samples in one loop */
+        unsigned int width;	/* bytes per sample */
+        u8 data[];
+};
+
+static LIST_HEAD(soundgen_wavetables);
+static DEFINE_MUTEX(soundgen_wavetables_lock);
+
+static struct soundgen_wavetable *
+soundgen_wavetable_build(struct snd_pcm_runtime *runtime,
+                const struct soundgen_params *sp, unsigned int len, s32 *buf)
+{
+        struct soundgen_wavetable *wt;
+        struct soundgen_gen gen = { .noise = SOUNDGEN_NOISE_SEED };
+        unsigned int width = snd_pcm_format_physical_width(runtime->format) / 8;
+        unsigned int pos, count;
+
+        gen.write = soundgen_writer(runtime->format);
+        if (!gen.write || (size_t)len * width > SOUNDGEN_WAVETABLE_MAX)
+                return NULL;
+        wt = kvzalloc(struct_size(wt, data, len * width), GFP_KERNEL);
+        if (!wt)
+                return NULL;
+        wt->refs = 1;
+        wt->waveform = sp->waveform;
+        wt->inc = sp->inc;
+        wt->gain = sp->gain;
+        wt->rate = runtime->rate;
+        wt->format = runtime->format;
+        wt->len = len;
+        wt->width = width;
+        for (pos = 0; pos < len; pos += count) {
+                count = min_t(unsigned int, len - pos, SOUNDGEN_GEN_CHUNK);
+                soundgen_gen_render(&gen, sp->waveform, sp->inc, sp->gain,
+                                buf, count);
+                gen.write(wt->data + pos * width, buf, count, 1);
+        }
+        return wt;
+}
+
+/* render is scratch for building a missing table */
+static const struct soundgen_wavetable *
+soundgen_wavetable_get(struct snd_pcm_runtime *runtime,
+                const struct soundgen_params *sp, s32 *render)
+{
+        struct soundgen_wavetable *wt;
+
+        if (sp->waveform == SOUNDGEN_WAVE_NOISE)
+                return NULL;
+
+        mutex_lock(&soundgen_wavetables_lock);
+        list_for_each_entry(wt, &soundgen_wavetables, list) {
+                if (wt->waveform == sp->waveform && wt->inc == sp->inc &&
+                    wt->gain == sp->gain && wt->rate == runtime->rate &&
+                    wt->format == runtime->format) {
+                        wt->refs++;
+                        goto out;
+                }
+        }
+        wt = soundgen_wavetable_build(runtime, sp,
+                        runtime->rate / gcd(runtime->rate, sp->frequency),
+                        render);
+        if (wt)
+                list_add(&wt->list, &soundgen_wavetables);
+out:
+        mutex_unlock(&soundgen_wavetables_lock);
+        return wt;
+}
+
+static void soundgen_wavetable_put(const struct soundgen_wavetable *cwt)
+{
+        struct soundgen_wavetable *wt = (struct soundgen_wavetable *)cwt;
+
+        if (!wt)
+                return;
+        mutex_lock(&soundgen_wavetables_lock);
+        if (!--wt->refs) {
+                list_del(&wt->list);
+                kvfree(wt);
+        }
+        mutex_unlock(&soundgen_wavetables_lock);
+}
+
+/* Swap the generator's table for one matching the current settings */
+static void soundgen_wavetable_attach(struct snd_pcm_substream *substream,
+                struct soundgen_gen *gen)
+{
+        struct soundgen_params sp;
+
+        soundgen_wavetable_put(gen->wt);
+        gen->wt = NULL;
+        gen->wt_active = false;
+        if (substream->stream != SNDRV_PCM_STREAM_CAPTURE || loopback)
+                return;
+        soundgen_gen_params(substream, &sp);
+        gen->wt = soundgen_wavetable_get(substream->runtime, &sp,
+                        gen->render);
+}
+
+/*
+ * Follow the controls: use the table while they match it, moving
+ * between table position and oscillator phase on every switch.
+ */
+static bool soundgen_wavetable_sync(struct soundgen_gen *gen,
+                const struct soundgen_params *sp)
+{
+        const struct soundgen_wavetable *wt = gen->wt;
+        bool match = wt && wt->waveform == sp->waveform &&
+                wt->inc == sp->inc && wt->gain == sp->gain;
+
+        if (match == gen->wt_active)
+                return match;
+        if (match)
+                gen->table_pos = gen->phase / wt->inc % wt->len;
+        else
+                gen->phase = gen->table_pos * wt->inc;
+        gen->wt_active = match;
+        return match;
+}
+
+/* Store count preformatted mono samples into channels slots each */
+static void soundgen_wavetable_write(const struct soundgen_wavetable *wt,
+                unsigned int pos, void *dst, unsigned int count,
+                unsigned int channels)
+{
+        const u8 *src = wt->data + pos * wt->width;
+        unsigned int i, c;
+
+        if (channels == 1) {
+                memcpy(dst, src, count * wt->width);
+                return;
+        }
+        switch (wt->width) {
+        case 1:
+                for (i = 0; i < count; i++)
+                        for (c = 0; c < channels; c++)
+                                *(u8 *)dst++ = src[i];
+                break;
+        case 2:
+                for (i = 0; i < count; i++)
+                        for (c = 0; c < channels; c++, dst += 2)
+                                *(u16 *)dst = ((const u16 *)src)[i];
+                break;
+        case 4:
+                for (i = 0; i < count; i++)
+                        for (c = 0; c < channels; c++, dst += 4)
+                                *(u32 *)dst = ((const u32 *)src)[i];
+                break;
+        }
+}
+
+/*
+ * Produce up to count frames at dst, from the table when it is active
+ * and from the oscillator otherwise. Returns the frames produced.
+ */
+static unsigned int soundgen_gen_produce(struct soundgen_gen *gen,
+                const struct soundgen_params *sp, void *dst,
+                unsigned int count, unsigned int channels)
+{
+        const struct soundgen_wavetable *wt = gen->wt;
+
+        if (soundgen_wavetable_sync(gen, sp)) {
+                count = min(count, wt->len - gen->table_pos);
+                soundgen_wavetable_write(wt, gen->table_pos, dst, count,
+                                channels);
+                gen->table_pos += count;
+                if (gen->table_pos == wt->len)
+                        gen->table_pos = 0;
+                return count;
+        }
+        count = min_t(unsigned int, count, SOUNDGEN_GEN_CHUNK);
+        soundgen_gen_render(gen, sp->waveform, sp->inc, sp->gain,
+                        gen->render, count);
+        gen->write(dst, gen->render, count, channels);
+        return count;
+}
+
+/* Non-interleaved rings hold one block of buffer_size samples per channel */
+static bool soundgen_noninterleaved(struct snd_pcm_runtime *runtime)
+{
+        return runtime->access == SNDRV_PCM_ACCESS_RW_NONINTERLEAVED ||
+                runtime->access == SNDRV_PCM_ACCESS_MMAP_NONINTERLEAVED;
+}
+
+static u8 *soundgen_channel_ptr(struct snd_pcm_runtime *runtime,
+                unsigned int channel, snd_pcm_uframes_t pos)
+{
+        return runtime->dma_area + samples_to_bytes(runtime,
+                        channel * runtime->buffer_size + pos);
+}
+
+/*
+ * Non-mmap devices move their data in the copy callbacks, so the timer
+ * backends leave the DMA ring alone. With loopback the ring carries the
+ * looped frames and stays in use.
+ */
+static bool soundgen_ringless(struct snd_pcm_substream *substream)
+{
+        return !loopback && (substream->pcm->device & 2);
+}
+
+/*
+ * Synthesize frames into the DMA ring starting at frame pos, wrapping
+ * at buffer_size. Generator settings are sampled once per call so the
+ * controls can change while the stream runs. A non-interleaved ring
+ * gets channel 0 generated and copied into the other channel blocks.
+ */
+static void soundgen_gen_fill(struct snd_pcm_substream *substream,
+                struct soundgen_gen *gen, snd_pcm_uframes_t pos,
+                snd_pcm_uframes_t frames)
+{
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        bool nonint = soundgen_noninterleaved(runtime);
+        struct soundgen_params sp;
+        unsigned int count, ch;
+        u8 *dst;
+
+        soundgen_gen_params(substream, &sp);
+        while (frames) {
+                count = min(frames, runtime->buffer_size - pos);
+                if (nonint) {
+                        dst = soundgen_channel_ptr(runtime, 0, pos);
+                        count = soundgen_gen_produce(gen, &sp, dst, count, 1);
+                        for (ch = 1; ch < runtime->channels; ch++)
+                                memcpy(soundgen_channel_ptr(runtime, ch, pos),
+                                                dst, samples_to_bytes(runtime,
+                                                        count));
+                } else {
+                        count = soundgen_gen_produce(gen, &sp,
+                                        runtime->dma_area +
+                                        frames_to_bytes(runtime, pos),
+                                        count, runtime->channels);
+                }
+                pos += count;
+                if (pos == runtime->buffer_size)
+                        pos = 0;
+                frames -= count;
+        }
+}
+
+/*
+ * Synthesize frames straight into a read() buffer: all channels for an
+ * interleaved transfer (channel < 0), one channel otherwise. User
+ * buffers are staged through bounce, SOUNDGEN_COPY_BOUNCE bytes of the
+ * substream's scratch.
+ */
+static int soundgen_gen_copy(struct snd_pcm_substream *substream,
+                struct soundgen_gen *gen, int channel, void *dst,
+                snd_pcm_uframes_t frames, bool user, u8 *bounce)
+{
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        unsigned int channels = channel < 0 ? runtime->channels : 1;
+        size_t unit = samples_to_bytes(runtime, channels);
+        unsigned int chunk = SOUNDGEN_COPY_BOUNCE / unit;
+        struct soundgen_params sp;
+        unsigned int count;
+
+        soundgen_gen_params(substream, &sp);
+        while (frames) {
+                if (user) {
+                        count = soundgen_gen_produce(gen, &sp, bounce,
+                                        min_t(snd_pcm_uframes_t, frames,
+                                                chunk), channels);
+                        if (copy_to_user((void __user *)dst, bounce,
+                                                count * unit))
+                                return -EFAULT;
+                } else {
+                        count = soundgen_gen_produce(gen, &sp, dst,
+                                        min_t(snd_pcm_uframes_t, frames,
+                                                UINT_MAX), channels);
+                }
+                dst += count * unit;
+                frames -= count;
+        }
+        return 0;
+}
+
+/*
+ * Stream clock of the time based backends. The timer side publishes the
+ * start time and the bound of generated frames under a seqlock, and the
+ * pointer callbacks only read that snapshot, so applications polling
+ * avail never spin on a lock the timer callback holds. Elapsed time is
+ * turned into frames with a multiplier set up at prepare instead of a
+ * 64 bit division per call. The epoch is taken at open and stands in
+ * for a free running link counter: unlike base it is not moved by
+ * stop and start.
+ */
+struct soundgen_clock {
+        seqlock_t lock;
+        ktime_t epoch;
+        ktime_t base;
+        u64 filled;		/* the pointer does not pass this frame */
+        u32 mult;		/* frames per ns, scaled by 2^shift */
+        u32 shift;
+};
+
+static void soundgen_clock_init(struct soundgen_clock *clk)
+{
+        seqlock_init(&clk->lock);
+        clk->epoch = ktime_get();
+}
+
+/*
+ * The shift keeps mult in (2^30, 2^31], a rate error below one part in
+ * 2^30 at any rate. mult is rounded up, like the division it replaces,
+ * so a period deadline always yields the full period.
+ */
+static void soundgen_clock_prepare(struct soundgen_clock *clk,
+                unsigned int rate)
+{
+        clk->shift = 31 + ilog2(NSEC_PER_SEC / rate);
+        clk->mult = div_u64(((u64)rate << clk->shift) + NSEC_PER_SEC - 1,
+                        NSEC_PER_SEC);
+}
+
+/* Frames passed between the start and now, for the timer side */
+static u64 soundgen_clock_frames(struct soundgen_clock *clk, ktime_t now)
+{
+        return mul_u64_u32_shr(ktime_to_ns(ktime_sub(now, clk->base)),
+                        clk->mult, clk->shift);
+}
+
+static void soundgen_clock_start(struct soundgen_clock *clk, ktime_t base,
+                u64 filled)
+{
+        unsigned long flags;
+
+        write_seqlock_irqsave(&clk->lock, flags);
+        clk->base = base;
+        clk->filled = filled;
+        write_sequnlock_irqrestore(&clk->lock, flags);
+}
+
+static void soundgen_clock_publish(struct soundgen_clock *clk, u64 filled)
+{
+        unsigned long flags;
+
+        write_seqlock_irqsave(&clk->lock, flags);
+        clk->filled = filled;
+        write_sequnlock_irqrestore(&clk->lock, flags);
+}
+
+static snd_pcm_uframes_t soundgen_clock_pointer(struct soundgen_clock *clk,
+                struct snd_pcm_runtime *runtime)
+{
+        unsigned int seq;
+        u64 frames;
+        u32 pos;
+
+        do {
+                seq = read_seqbegin(&clk->lock);
+                frames = min(soundgen_clock_frames(clk, ktime_get()),
+                                clk->filled);
+        } while (read_seqretry(&clk->lock, seq));
+        div_u64_rem(frames, runtime->buffer_size, &pos);
+        return pos;
+}
+
+/*
+ * Time since the start, or since open for an absolute link timestamp,
+ * for the audio timestamp API, with the monotonic time it was taken at
+ * in *now. Both come from one clock read, so the pair is exact whatever
+ * the timer latency was.
+ */
+static ktime_t soundgen_clock_link_time(struct soundgen_clock *clk,
+                bool absolute, ktime_t *now)
+{
+        unsigned int seq;
+        ktime_t link;
+
+        do {
+                seq = read_seqbegin(&clk->lock);
+                *now = ktime_get();
+                link = ktime_sub(*now, absolute ? clk->epoch : clk->base);
+        } while (read_seqretry(&clk->lock, seq));
+        return link;
+}
+
+/* Duration of one period, rounded up to the next nanosecond */
+static ktime_t soundgen_period_time(struct snd_pcm_runtime *runtime)
+{
+        unsigned int period = runtime->period_size;
+        unsigned int rate = runtime->rate;
+        long sec;
+        unsigned long nsecs;
+
+        sec = period / rate;
+        period %= rate;
+        nsecs = div_u64((u64)period * 1000000000UL + rate - 1, rate);
+        return ktime_set(sec, nsecs);
+}
+
+/*
+ * Synthesize up to the absolute frame target. Time based backends keep
+ * at least one period written ahead of the position, so the interpolated
+ * pointer never runs into data that has not been generated yet. The
+ * caller publishes *filled to the pointer callbacks.
+ */
+static void soundgen_fill_ahead(struct snd_pcm_substream *substream,
+                struct soundgen_gen *gen, u64 *filled, u64 target)
+{
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        u64 from = *filled;
+        u32 pos;
+
+        if (target <= from)
+                return;
+        if (target - from > runtime->buffer_size)
+                from = target - runtime->buffer_size;
+        div_u64_rem(from, runtime->buffer_size, &pos);
+        soundgen_gen_fill(substream, gen, pos, target - from);
+        smp_wmb();
+        WRITE_ONCE(*filled, target);
+}
+
+/**
+ * End of generator stuff
+ */
+
+/**
+ * Statistics stuff
+ *
+ * Per substream timing of the period callbacks, kept across open/close
+ * and reset on prepare. Exported in /proc/asound/cardX/soundgen_stats.
+ */
+
+/* Bucket 0 is < 1 us, bucket n is [2^(n-1), 2^n) us, the last one is open */
+#define SOUNDGEN_HIST_BUCKETS	16
+
+/*
+ * Running meters of the playback sink. Levels are sample magnitudes
+ * scaled to 15 bits, whatever the format.
+ */
+struct soundgen_meter {
+        u64 frames;		/* frames metered, positions the checksum */
+        u64 checksum;
+        u32 peak;
+        u64 sumsq;
+        u64 samples;
+};
+
+struct soundgen_counters {
+        const char *backend;
+        u64 period_ns;
+        u64 last_frames;	/* position at the previous callback */
+        u64 callbacks;
+        u64 latency_min;	/* ns between deadline and callback */
+        u64 latency_max;
+        u64 latency_sum;
+        u64 missed_periods;
+        u64 overruns;		/* extra periods skipped by re-arming */
+        u64 xruns;
+        u64 hist[SOUNDGEN_HIST_BUCKETS];
+        /* playback sink */
+        u64 sink_frames;	/* frames consumed since prepare */
+        u64 sink_bytes;
+        ktime_t sink_first;	/* time of the first and last consumption */
+        ktime_t sink_last;
+        struct soundgen_meter meter;
+};
+
+struct soundgen_stats {
+        spinlock_t lock;
+        int device;
+        int stream;
+        int subdevice;
+        struct soundgen_counters c;
+};
+
+static struct soundgen_stats *
+soundgen_stats_get(struct snd_pcm_substream *substream)
+{
+        struct snd_card_soundgen *chip = snd_pcm_substream_chip(substream);
+
+        return &chip->stats[(substream->pcm->device * 2 + substream->stream) *
+                pcm_substreams + substream->number];
+}
+
+static void soundgen_stats_reset(struct soundgen_stats *stats,
+                const char *backend, ktime_t period_time)
+{
+        unsigned long flags;
+
+        spin_lock_irqsave(&stats->lock, flags);
+        memset(&stats->c, 0, sizeof(stats->c));
+        stats->c.backend = backend;
+        stats->c.period_ns = ktime_to_ns(period_time);
+        stats->c.latency_min = U64_MAX;
+        spin_unlock_irqrestore(&stats->lock, flags);
+}
+
+/*
+ * Account one period callback that ran late_ns after its deadline, with
+ * the stream at absolute frame position frames.
+ */
+static void soundgen_stats_period(struct soundgen_stats *stats,
+                struct snd_pcm_runtime *runtime, s64 late_ns, u64 frames)
+{
+        unsigned long flags;
+        u64 late = max_t(s64, late_ns, 0);
+        u64 periods;
+        int bucket;
+
+        bucket = min_t(int, fls64(div_u64(late, NSEC_PER_USEC)),
+                        SOUNDGEN_HIST_BUCKETS - 1);
+        spin_lock_irqsave(&stats->lock, flags);
+        periods = div_u64(frames - stats->c.last_frames, runtime->period_size);
+        if (periods > 1)
+                stats->c.missed_periods += periods - 1;
+        stats->c.last_frames = frames;
+        stats->c.callbacks++;
+        stats->c.latency_min = min(stats->c.latency_min, late);
+        stats->c.latency_max = max(stats->c.latency_max, late);
+        stats->c.latency_sum += late;
+        stats->c.hist[bucket]++;
+        spin_unlock_irqrestore(&stats->lock, flags);
+}
+
+static void soundgen_stats_overrun(struct soundgen_stats *stats,
+                u64 periods)
+{
+        unsigned long flags;
+
+        if (periods <= 1)
+                return;
+        spin_lock_irqsave(&stats->lock, flags);
+        stats->c.overruns += periods - 1;
+        spin_unlock_irqrestore(&stats->lock, flags);
+}
+
+/* Call after snd_pcm_period_elapsed() to catch the xrun it detected */
+static void soundgen_stats_check_xrun(struct soundgen_stats *stats,
+                struct snd_pcm_runtime *runtime)
+{
+        unsigned long flags;
+
+        if (READ_ONCE(runtime->status->state) != SNDRV_PCM_STATE_XRUN)
+                return;
+        spin_lock_irqsave(&stats->lock, flags);
+        stats->c.xruns++;
+        spin_unlock_irqrestore(&stats->lock, flags);
+}
+
+static void soundgen_sink_proc_read(struct snd_info_buffer *buffer,
+                const struct soundgen_counters *c)
+{
+        s64 span = ktime_to_ns(ktime_sub(c->sink_last, c->sink_first));
+
+        snd_iprintf(buffer, "  sink_frames: %llu\n", c->sink_frames);
+        snd_iprintf(buffer, "  sink_bytes: %llu\n", c->sink_bytes);
+        if (span > 0)
+                snd_iprintf(buffer, "  sink_rate: %llu\n",
+                                div64_u64(c->sink_frames * NSEC_PER_SEC,
+                                        span));
+        snd_iprintf(buffer, "  sink_checksum: 0x%016llx\n",
+                        c->meter.checksum);
+        if (c->meter.samples)
+                snd_iprintf(buffer, "  sink_level: peak %u rms %llu\n",
+                                c->meter.peak,
+                                int_sqrt64(div64_u64(c->meter.sumsq,
+                                                c->meter.samples)));
+}
+
+static void soundgen_stats_proc_read(struct snd_info_entry *entry,
+                struct snd_info_buffer *buffer)
+{
+        struct snd_card_soundgen *chip = entry->private_data;
+        struct soundgen_stats *stats;
+        struct soundgen_counters snap;
+        unsigned int i, b;
+
+        for (i = 0; i < chip->num_stats; i++) {
+                stats = &chip->stats[i];
+                spin_lock_irq(&stats->lock);
+                snap = stats->c;
+                spin_unlock_irq(&stats->lock);
+
+                snd_iprintf(buffer, "pcm%d%c sub%d\n", stats->device,
+                                stats->stream == SNDRV_PCM_STREAM_PLAYBACK ?
+                                'p' : 'c', stats->subdevice);
+                if (!snap.backend) {
+                        snd_iprintf(buffer, "  not prepared\n");
+                        continue;
+                }
+                snd_iprintf(buffer, "  backend: %s\n", snap.backend);
+                snd_iprintf(buffer, "  period_ns: %llu\n", snap.period_ns);
+                snd_iprintf(buffer, "  callbacks: %llu\n", snap.callbacks);
+                if (snap.callbacks)
+                        snd_iprintf(buffer,
+                                        "  latency_ns: min %llu avg %llu max %llu\n",
+                                        snap.latency_min,
+                                        div64_u64(snap.latency_sum,
+                                                snap.callbacks),
+                                        snap.latency_max);
+                snd_iprintf(buffer, "  missed_periods: %llu\n",
+                                snap.missed_periods);
+                snd_iprintf(buffer, "  overruns: %llu\n", snap.overruns);
+                snd_iprintf(buffer, "  xruns: %llu\n", snap.xruns);
+                snd_iprintf(buffer, "  lateness_us:");
+                for (b = 0; b < SOUNDGEN_HIST_BUCKETS; b++)
+                        snd_iprintf(buffer, " %llu", snap.hist[b]);
+                snd_iprintf(buffer, "\n");
+                if (stats->stream == SNDRV_PCM_STREAM_PLAYBACK)
+                        soundgen_sink_proc_read(buffer, &snap);
+        }
+}
+
+static int snd_soundgen_new_stats(struct snd_card_soundgen *soundgen_card,
+                unsigned int count)
+{
+        unsigned int i;
+
+        soundgen_card->stats = kcalloc(count, sizeof(*soundgen_card->stats),
+                        GFP_KERNEL);
+        if (!soundgen_card->stats)
+                return -ENOMEM;
+        soundgen_card->num_stats = count;
+        for (i = 0; i < count; i++) {
+                spin_lock_init(&soundgen_card->stats[i].lock);
+                soundgen_card->stats[i].device = i / pcm_substreams / 2;
+                soundgen_card->stats[i].stream = i / pcm_substreams % 2;
+                soundgen_card->stats[i].subdevice = i % pcm_substreams;
+        }
+        return snd_card_ro_proc_new(soundgen_card->card, "soundgen_stats",
+                        soundgen_card, soundgen_stats_proc_read);
+}
+
+/**
+ * End of statistics stuff
+ */
+
+/**
+ * Sink stuff
+ *
+ * Playback substreams are a null sink: frames are consumed at the
+ * nominal rate and never copied. Consumption is counted and, when the
+ * Sink Meter control asks for it, checksummed or metered straight from
+ * the DMA ring a 64-bit word at a time.
+ */
+
+enum soundgen_sink_meter {
+        SOUNDGEN_METER_OFF,
+        SOUNDGEN_METER_CHECKSUM,
+        SOUNDGEN_METER_LEVEL,
+};
+
+static const char * const soundgen_meter_names[] = {
+        "Off", "Checksum", "Peak/RMS",
+};
+
+typedef void (*soundgen_meter_t)(struct soundgen_meter *m, const u8 *p,
+                size_t bytes);
+
+/*
+ * Additive checksum of the stream bytes, each weighted by its absolute
+ * byte offset modulo 8. Rotating every word by its offset keeps the
+ * result independent of how the stream was split between calls.
+ */
+static u64 soundgen_checksum(u64 sum, const u8 *p, size_t bytes, u64 offset)
+{
+        unsigned int rot = (offset & 7) * 8;
+        u64 w = 0;
+
+        for (; bytes >= 8; bytes -= 8, p += 8)
+                sum += rol64(get_unaligned_le64(p), rot);
+        if (bytes) {
+                memcpy(&w, p, bytes);
+                sum += rol64(le64_to_cpu(w), rot);
+        }
+        return sum;
+}
+
+/* Magnitude of an IEEE single, in full scale s32 units */
+static inline u32 soundgen_float_mag(u32 bits)
+{
+        int shift = (int)((bits >> 23) & 0xff) - 119;
+        u32 mant = (bits & 0x7fffff) | 0x800000;
+
+        if (shift >= 8)
+                return S32_MAX;
+        if (shift <= -24)
+                return 0;
+        return shift >= 0 ? mant << shift : mant >> -shift;
+}
+
+static inline u32 soundgen_abs32(s32 v)
+{
+        return v < 0 ? -(u32)v : v;
+}
+
+#define soundgen_mag_s8(x)	(soundgen_abs32((s8)(x)) << 24)
+#define soundgen_mag_s16(x)	(soundgen_abs32((s16)(x)) << 16)
+#define soundgen_mag_s24(x)	(soundgen_abs32(sign_extend32(x, 23)) << 8)
+#define soundgen_mag_s32(x)	soundgen_abs32((s32)(x))
+#define soundgen_mag_float(x)	soundgen_float_mag(x)
+
+/*
+ * Peak and sum of squares over little-endian samples of the given
+ * width. Whole words are split into lanes in registers; a trailing
+ * partial word is zero padded, which never raises either meter.
+ */
+#define SOUNDGEN_METER(fmt, bits) \
+static void soundgen_meter_##fmt(struct soundgen_meter *m, const u8 *p, \
+                size_t bytes) \
+{ \
+        u32 peak = m->peak, level; \
+        u64 sumsq = m->sumsq, w; \
+        size_t n; \
+        unsigned int i; \
+\
+        m->samples += bytes / ((bits) / 8); \
+        for (; bytes; bytes -= n, p += n) { \
+                n = min_t(size_t, bytes, 8); \
+                if (n == 8) { \
+                        w = get_unaligned_le64(p); \
+                } else { \
+                        w = 0; \
+                        memcpy(&w, p, n); \
+                        w = le64_to_cpu(w); \
+                } \
+                for (i = 0; i < 64; i += (bits)) { \
+                        level = soundgen_mag_##fmt((u32)(w >> i)) >> 16; \
+                        peak = max(peak, level); \
+                        sumsq += level * level; \
+                } \
+        } \
+        m->peak = peak; \
+        m->sumsq = sumsq; \
+}
+
+SOUNDGEN_METER(s8, 8)
+SOUNDGEN_METER(s16, 16)
+SOUNDGEN_METER(s24, 32)
+SOUNDGEN_METER(s32, 32)
+SOUNDGEN_METER(float, 32)
+
+static soundgen_meter_t soundgen_meter_fn(snd_pcm_format_t format)
+{
+        switch (format) {
+        case SNDRV_PCM_FORMAT_S8:
+                return soundgen_meter_s8;
+        case SNDRV_PCM_FORMAT_S16_LE:
+                return soundgen_meter_s16;
+        case SNDRV_PCM_FORMAT_S24_LE:
+                return soundgen_meter_s24;
+        case SNDRV_PCM_FORMAT_S32_LE:
+                return soundgen_meter_s32;
+        case SNDRV_PCM_FORMAT_FLOAT_LE:
+                return soundgen_meter_float;
+        default:
+                return NULL;
+        }
+}
+
+/*
+ * Meter one contiguous span. offset is the stream byte offset of p; for
+ * non-interleaved data it counts within the channel, so every channel
+ * checksums the same way.
+ */
+static void soundgen_meter_run(struct snd_pcm_runtime *runtime,
+                struct soundgen_meter *m, int mode, const u8 *p,
+                size_t bytes, u64 offset)
+{
+        soundgen_meter_t meter;
+
+        if (mode == SOUNDGEN_METER_CHECKSUM) {
+                m->checksum = soundgen_checksum(m->checksum, p, bytes, offset);
+        } else if (mode == SOUNDGEN_METER_LEVEL) {
+                meter = soundgen_meter_fn(runtime->format);
+                if (meter)
+                        meter(m, p, bytes);
+        }
+}
+
+/*
+ * Consume frames from the DMA ring starting at frame pos, wrapping at
+ * buffer_size. The meters are computed outside the stats lock; only one
+ * context consumes a given substream at a time. Ringless substreams are
+ * metered in the copy callback instead and only counted here.
+ */
+static void soundgen_sink_consume(struct snd_pcm_substream *substream,
+                struct soundgen_stats *stats, snd_pcm_uframes_t pos,
+                snd_pcm_uframes_t frames)
+{
+        struct snd_card_soundgen *chip = snd_pcm_substream_chip(substream);
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        int mode = READ_ONCE(chip->sink_meter);
+        bool metered = mode != SOUNDGEN_METER_OFF &&
+                !soundgen_ringless(substream);
+        struct soundgen_meter m;
+        unsigned long flags;
+        snd_pcm_uframes_t count, left = frames;
+        ktime_t now = ktime_get();
+        unsigned int ch;
+
+        if (metered) {
+                spin_lock_irqsave(&stats->lock, flags);
+                m = stats->c.meter;
+                spin_unlock_irqrestore(&stats->lock, flags);
+        }
+
+        while (metered && left) {
+                count = min(left, runtime->buffer_size - pos);
+                if (soundgen_noninterleaved(runtime)) {
+                        for (ch = 0; ch < runtime->channels; ch++)
+                                soundgen_meter_run(runtime, &m, mode,
+                                                soundgen_channel_ptr(runtime,
+                                                        ch, pos),
+                                                samples_to_bytes(runtime,
+                                                        count),
+                                                samples_to_bytes(runtime,
+                                                        m.frames));
+                } else {
+                        soundgen_meter_run(runtime, &m, mode,
+                                        runtime->dma_area +
+                                        frames_to_bytes(runtime, pos),
+                                        frames_to_bytes(runtime, count),
+                                        frames_to_bytes(runtime, m.frames));
+                }
+                m.frames += count;
+                pos += count;
+                if (pos == runtime->buffer_size)
+                        pos = 0;
+                left -= count;
+        }
+
+        spin_lock_irqsave(&stats->lock, flags);
+        if (!stats->c.sink_frames)
+                stats->c.sink_first = now;
+        stats->c.sink_last = now;
+        stats->c.sink_frames += frames;
+        stats->c.sink_bytes += frames_to_bytes(runtime, frames);
+        if (metered)
+                stats->c.meter = m;
+        spin_unlock_irqrestore(&stats->lock, flags);
+}
+
+/*
+ * Meter a write() buffer of a ringless playback substream. Nothing is
+ * copied at all while the meter is off. The frame position advances
+ * with the last channel of a non-interleaved transfer.
+ */
+static int soundgen_sink_copy(struct snd_pcm_substream *substream,
+                struct soundgen_stats *stats, int channel, void *src,
+                unsigned long bytes, bool user, u8 *bounce)
+{
+        struct snd_card_soundgen *chip = snd_pcm_substream_chip(substream);
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        int mode = READ_ONCE(chip->sink_meter);
+        size_t unit = channel < 0 ? frames_to_bytes(runtime, 1) :
+                samples_to_bytes(runtime, 1);
+        struct soundgen_meter m;
+        unsigned long flags;
+        unsigned long n, done;
+        const u8 *p;
+
+        if (mode == SOUNDGEN_METER_OFF)
+                return 0;
+
+        spin_lock_irqsave(&stats->lock, flags);
+        m = stats->c.meter;
+        spin_unlock_irqrestore(&stats->lock, flags);
+
+        for (done = 0; done < bytes; done += n) {
+                n = min_t(unsigned long, bytes - done, SOUNDGEN_COPY_BOUNCE);
+                p = src + done;
+                if (user) {
+                        if (copy_from_user(bounce,
+                                           (const void __user *)p, n))
+                                return -EFAULT;
+                        p = bounce;
+                }
+                soundgen_meter_run(runtime, &m, mode, p, n,
+                                m.frames * unit + done);
+        }
+        if (channel < 0 || channel == runtime->channels - 1)
+                m.frames += bytes / unit;
+
+        spin_lock_irqsave(&stats->lock, flags);
+        stats->c.meter = m;
+        spin_unlock_irqrestore(&stats->lock, flags);
+        return 0;
+}
+
+/*
+ * Move a time based stream to absolute frame position frames. Capture
+ * is synthesized one period ahead, playback consumes what the position
+ * moved over. Both report one period past the position in *filled, which
+ * bounds the interpolated pointer until the next callback.
+ */
+static void soundgen_pcm_advance(struct snd_pcm_substream *substream,
+                struct soundgen_gen *gen, struct soundgen_stats *stats,
+                u64 *filled, u64 frames)
+{
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        unsigned long flags;
+        u64 from;
+        u32 pos;
+
+        if (substream->stream == SNDRV_PCM_STREAM_CAPTURE) {
+                if (soundgen_ringless(substream))
+                        WRITE_ONCE(*filled, frames + runtime->period_size);
+                else
+                        soundgen_fill_ahead(substream, gen, filled,
+                                        frames + runtime->period_size);
+                return;
+        }
+
+        spin_lock_irqsave(&stats->lock, flags);
+        from = stats->c.sink_frames;
+        /* a stall longer than the ring only meters its last lap */
+        if (frames > from + runtime->buffer_size) {
+                stats->c.sink_bytes += frames_to_bytes(runtime,
+                                frames - runtime->buffer_size - from);
+                from = frames - runtime->buffer_size;
+                stats->c.sink_frames = from;
+        }
+        spin_unlock_irqrestore(&stats->lock, flags);
+        if (frames > from) {
+                div_u64_rem(from, runtime->buffer_size, &pos);
+                soundgen_sink_consume(substream, stats, pos, frames - from);
+        }
+        WRITE_ONCE(*filled, frames + runtime->period_size);
+}
+
+/**
+ * End of sink stuff
+ */
+
+/**
+ * Timer stuff
+ */
+
+struct soundgen_backend_ops {
+        int (*create)(struct snd_pcm_substream *);
+        void (*free)(struct snd_pcm_substream *);
+        int (*prepare)(struct snd_pcm_substream *);
+        int (*start)(struct snd_pcm_substream *);
+        int (*stop)(struct snd_pcm_substream *);
+        snd_pcm_uframes_t (*pointer)(struct snd_pcm_substream *);
+};
+
+/*
+ * Capture synthesis handed from the timer callback to soundgen_fill_wq
+ * with deferred_fill. The callback only sets the target, the worker
+ * fills up to it and publishes the new bound to the pointer.
+ */
+struct soundgen_fill {
+        struct work_struct work;
+        spinlock_t lock;
+        bool enabled;		/* between trigger start and stop */
+        u64 target;		/* absolute frame to fill up to */
+        u64 *filled;		/* the backend's fill position */
+        struct snd_pcm_substream *substream;
+};
+
+/*
+ * Start of every backend's private data, so the PCM callbacks reach the
+ * ops and the generator whatever backend the substream runs on.
+ */
+struct soundgen_pcm_head {
+        const struct soundgen_backend_ops *backend_ops;
+        struct soundgen_gen gen;
+        struct soundgen_gen replay;	/* gen before the current copy */
+        struct soundgen_clock *clock;	/* NULL if not time based */
+        struct soundgen_fill fill;
+        struct soundgen_scratch *scratch;
+};
+
+#define get_soundgen_head(substream) \
+        ((struct soundgen_pcm_head *)(substream)->runtime->private_data)
+
+/*
+ * First frame a deferred fill must not reach: one ring past the oldest
+ * frame the application has not read. ALSA's hardware pointer is the
+ * last position we reported, less than a ring behind *filled, so its
+ * absolute frame follows from the ring offsets.
+ */
+static u64 soundgen_fill_limit(struct snd_pcm_substream *substream,
+                u64 filled)
+{
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        snd_pcm_uframes_t avail, hw_pos;
+        unsigned long flags;
+        u32 pos;
+        u64 hw;
+
+        snd_pcm_stream_lock_irqsave(substream, flags);
+        hw_pos = runtime->status->hw_ptr % runtime->buffer_size;
+        avail = snd_pcm_capture_avail(runtime);
+        snd_pcm_stream_unlock_irqrestore(substream, flags);
+
+        div_u64_rem(filled, runtime->buffer_size, &pos);
+        hw = filled - (pos + runtime->buffer_size - hw_pos) %
+                runtime->buffer_size;
+        if (avail >= runtime->buffer_size)
+                return hw;
+        return hw + runtime->buffer_size - avail;
+}
+
+static void soundgen_fill_work(struct work_struct *work)
+{
+        struct soundgen_fill *fill = container_of(work, struct soundgen_fill,
+                        work);
+        struct soundgen_pcm_head *head = container_of(fill,
+                        struct soundgen_pcm_head, fill);
+        unsigned long flags;
+        u64 target, *filled;
+
+        spin_lock_irqsave(&fill->lock, flags);
+        target = fill->target;
+        filled = fill->filled;
+        spin_unlock_irqrestore(&fill->lock, flags);
+
+        target = min(target, soundgen_fill_limit(fill->substream, *filled));
+        soundgen_fill_ahead(fill->substream, &head->gen, filled, target);
+        soundgen_clock_publish(head->clock, *filled);
+}
+
+static void soundgen_fill_init(struct snd_pcm_substream *substream)
+{
+        struct soundgen_fill *fill = &get_soundgen_head(substream)->fill;
+
+        INIT_WORK(&fill->work, soundgen_fill_work);
+        spin_lock_init(&fill->lock);
+        fill->substream = substream;
+}
+
+static void soundgen_fill_enable(struct snd_pcm_substream *substream,
+                bool enabled)
+{
+        struct soundgen_fill *fill = &get_soundgen_head(substream)->fill;
+        unsigned long flags;
+
+        spin_lock_irqsave(&fill->lock, flags);
+        fill->enabled = enabled;
+        spin_unlock_irqrestore(&fill->lock, flags);
+}
+
+/* Wait for the worker before the ring or the generator is reset */
+static void soundgen_fill_sync(struct snd_pcm_substream *substream)
+{
+        soundgen_fill_enable(substream, false);
+        cancel_work_sync(&get_soundgen_head(substream)->fill.work);
+}
+
+/*
+ * Queue the fill of a capture stream moved to frames. Returns false if
+ * the caller has to fill itself. The workers aim fill_periods ahead;
+ * soundgen_fill_limit() keeps them off frames not read yet.
+ */
+static bool soundgen_fill_queue(struct snd_pcm_substream *substream,
+                struct soundgen_pcm_head *head, u64 *filled, u64 frames)
+{
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        struct soundgen_fill *fill = &head->fill;
+        unsigned long flags;
+        u64 ahead;
+
+        if (!soundgen_fill_wq ||
+            substream->stream != SNDRV_PCM_STREAM_CAPTURE ||
+            soundgen_ringless(substream))
+                return false;
+
+        ahead = min_t(u64, (u64)fill_periods * runtime->period_size,
+                        runtime->buffer_size - runtime->period_size);
+        ahead = max_t(u64, ahead, runtime->period_size);
+
+        spin_lock_irqsave(&fill->lock, flags);
+        if (fill->enabled) {
+                fill->target = frames + ahead;
+                fill->filled = filled;
+                queue_work(soundgen_fill_wq, &fill->work);
+        }
+        spin_unlock_irqrestore(&fill->lock, flags);
+        return true;
+}
+
+/*
+ * Period bookkeeping of the time based backends: move the stream to
+ * absolute frame frames and publish the new bound to the pointer, or
+ * leave both to the fill workers.
+ */
+static void soundgen_pcm_update(struct snd_pcm_substream *substream,
+                struct soundgen_pcm_head *head, struct soundgen_stats *stats,
+                u64 *filled, u64 frames)
+{
+        if (soundgen_fill_queue(substream, head, filled, frames))
+                return;
+        soundgen_pcm_advance(substream, &head->gen, stats, filled, frames);
+        soundgen_clock_publish(head->clock, *filled);
+}
+
+
+/*
+ * Period deadlines of all substreams sit on one card wide grid, so
+ * streams with the same period expire together and are handled from a
+ * single timer interrupt. The slack lets the timer core merge the rest
+ * with whatever else is due in that window.
+ */
+static ktime_t soundgen_grid_deadline(struct snd_card_soundgen *chip,
+                ktime_t now, ktime_t period_time)
+{
+        u64 period = ktime_to_ns(period_time);
+        u64 n;
+
+        n = div64_u64(ktime_to_ns(ktime_sub(now, chip->epoch)), period) + 1;
+        return ktime_add_ns(chip->epoch, n * period);
+}
+
+static ktime_t soundgen_first_deadline(struct snd_pcm_substream *substream,
+                ktime_t now, ktime_t period_time)
+{
+        return soundgen_grid_deadline(snd_pcm_substream_chip(substream), now,
+                        period_time);
+}
+
+static u64 soundgen_timer_slack(ktime_t period_time)
+{
+        return div_u64(ktime_to_ns(period_time) * timer_slack, 100);
+}
+
+/*
+ * loopback interface
+ *
+ * With loopback set, playback and capture substreams of the same number
+ * share one DMA buffer. The playback runs on its timer backend like any
+ * sink; the capture has no timer of its own and follows the playback's
+ * position, so the frames written by the playback application are the
+ * frames the capture application reads, without a copy in between.
+ * While the playback is stopped the capture position does not move.
+ *
+ * The playback application may write up to a buffer ahead of the
+ * playback position, over frames the capture has not read yet. Capture
+ * is only allowed to trail the playback's appl_ptr by buffer_size: at
+ * every playback period the capture position is moved along and a
+ * capture that fell further behind is stopped with an XRUN. Frames
+ * overwritten between two periods can still reach a late reader.
+ */
+
+struct soundgen_loop {
+        spinlock_t lock;		/* protects capture */
+        struct snd_pcm_substream *capture;
+        bool capture_running;
+        snd_pcm_uframes_t pos;		/* last playback position */
+        struct mutex mutex;		/* protects the buffer and params */
+        struct snd_dma_buffer dmab;
+        unsigned int users;
+        snd_pcm_format_t format;
+        unsigned int rate;
+        unsigned int channels;
+        snd_pcm_uframes_t period_size;
+        snd_pcm_uframes_t buffer_size;
+};
+
+struct soundgen_loop_pcm {
+        /* head must be the first item */
+        struct soundgen_pcm_head head;
+        struct soundgen_loop *loop;
+        struct soundgen_stats *stats;
+};
+
+static struct soundgen_loop *
+soundgen_loop_get(struct snd_pcm_substream *substream)
+{
+        struct snd_card_soundgen *chip = snd_pcm_substream_chip(substream);
+
+        return &chip->loops[substream->pcm->device * pcm_substreams +
+                substream->number];
+}
+
+/*
+ * Use instead of snd_pcm_period_elapsed() in the timer backends. A
+ * looped capture is signalled from the playback's period callback. The
+ * loop lock keeps the capture from closing meanwhile; capture trigger
+ * and pointer never take it, so it can be held across the call.
+ */
+static void soundgen_period_elapsed(struct snd_pcm_substream *substream)
+{
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        struct soundgen_loop *loop;
+        snd_pcm_uframes_t room;
+        unsigned long flags;
+
+        /*
+         * In cases of XRUN and draining, this calls .trigger to stop PCM
+         * substream.
+         */
+        snd_pcm_period_elapsed(substream);
+        if (!loopback || substream->stream != SNDRV_PCM_STREAM_PLAYBACK)
+                return;
+
+        /* the playback application may write room frames ahead */
+        loop = soundgen_loop_get(substream);
+        snd_pcm_stream_lock_irqsave(substream, flags);
+        WRITE_ONCE(loop->pos, runtime->status->hw_ptr % runtime->buffer_size);
+        room = snd_pcm_playback_avail(runtime);
+        snd_pcm_stream_unlock_irqrestore(substream, flags);
+
+        spin_lock_irqsave(&loop->lock, flags);
+        if (loop->capture && READ_ONCE(loop->capture_running)) {
+                struct snd_pcm_substream *capture = loop->capture;
+                struct soundgen_loop_pcm *dpcm =
+                        capture->runtime->private_data;
+
+                snd_pcm_period_elapsed(capture);
+                snd_pcm_stream_lock(capture);
+                if (snd_pcm_running(capture) &&
+                    snd_pcm_capture_avail(capture->runtime) > room)
+                        snd_pcm_stop(capture, SNDRV_PCM_STATE_XRUN);
+                snd_pcm_stream_unlock(capture);
+                soundgen_stats_check_xrun(dpcm->stats, capture->runtime);
+        }
+        spin_unlock_irqrestore(&loop->lock, flags);
+}
 
-MODULE_AUTHOR("Bram Vlerick <vlerickb@gmail.com>");
-MODULE_DESCRIPTION("PCM Sound generator");
-MODULE_LICENSE("GPL");
-MODULE_SUPPORTED_DEVICE("{{ALSA,PCM Sound generator}}");
+/* Called from the PCM pointer callback of a looped playback */
+static void soundgen_loop_update(struct snd_pcm_substream *substream,
+                snd_pcm_uframes_t pos)
+{
+        if (loopback && substream->stream == SNDRV_PCM_STREAM_PLAYBACK)
+                WRITE_ONCE(soundgen_loop_get(substream)->pos, pos);
+}
 
-static struct platform_device *device;
+/* Restrict a newly opened side to what the other side configured */
+static int soundgen_loop_constrain(struct snd_pcm_substream *substream)
+{
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        struct soundgen_loop *loop = soundgen_loop_get(substream);
+        int err = 0;
+
+        mutex_lock(&loop->mutex);
+        if (!loop->users)
+                goto out;
+        err = snd_pcm_hw_constraint_mask64(runtime,
+                        SNDRV_PCM_HW_PARAM_FORMAT,
+                        pcm_format_to_bits(loop->format));
+        if (err < 0)
+                goto out;
+        err = snd_pcm_hw_constraint_single(runtime, SNDRV_PCM_HW_PARAM_RATE,
+                        loop->rate);
+        if (err < 0)
+                goto out;
+        err = snd_pcm_hw_constraint_single(runtime,
+                        SNDRV_PCM_HW_PARAM_CHANNELS, loop->channels);
+        if (err < 0)
+                goto out;
+        err = snd_pcm_hw_constraint_single(runtime,
+                        SNDRV_PCM_HW_PARAM_PERIOD_SIZE, loop->period_size);
+        if (err < 0)
+                goto out;
+        err = snd_pcm_hw_constraint_single(runtime,
+                        SNDRV_PCM_HW_PARAM_BUFFER_SIZE, loop->buffer_size);
+out:
+        mutex_unlock(&loop->mutex);
+        return err;
+}
 
+static void soundgen_loop_detach(struct snd_pcm_substream *substream)
+{
+        struct soundgen_loop *loop = soundgen_loop_get(substream);
 
-struct snd_card_soundgen {
-        struct snd_card *card;
-        struct snd_pcm *pcm;
-        struct snd_pcm_hardware pcm_hw;
-};
+        mutex_lock(&loop->mutex);
+        if (substream->runtime->dma_buffer_p == &loop->dmab) {
+                snd_pcm_set_runtime_buffer(substream, NULL);
+                if (!--loop->users)
+                        snd_dma_free_pages(&loop->dmab);
+        }
+        mutex_unlock(&loop->mutex);
+}
 
-/**
- * Timer stuff
- */
+/* The first side allocates the shared buffer, the second one must match */
+static int soundgen_loop_attach(struct snd_pcm_substream *substream,
+                struct snd_pcm_hw_params *params)
+{
+        struct soundgen_loop *loop = soundgen_loop_get(substream);
+        int err = 0;
+
+        soundgen_loop_detach(substream);
+        mutex_lock(&loop->mutex);
+        if (loop->users) {
+                if (params_format(params) != loop->format ||
+                    params_rate(params) != loop->rate ||
+                    params_channels(params) != loop->channels ||
+                    params_period_size(params) != loop->period_size ||
+                    params_buffer_size(params) != loop->buffer_size) {
+                        err = -EBUSY;
+                        goto out;
+                }
+        } else {
+                err = snd_dma_alloc_pages(SNDRV_DMA_TYPE_VMALLOC, NULL,
+                                params_buffer_bytes(params), &loop->dmab);
+                if (err < 0)
+                        goto out;
+                loop->format = params_format(params);
+                loop->rate = params_rate(params);
+                loop->channels = params_channels(params);
+                loop->period_size = params_period_size(params);
+                loop->buffer_size = params_buffer_size(params);
+        }
+        loop->users++;
+        snd_pcm_set_runtime_buffer(substream, &loop->dmab);
+out:
+        mutex_unlock(&loop->mutex);
+        return err;
+}
 
-struct snd_timer_ops {
-        int (*create)(struct snd_pcm_substream *);
-        void (*free)(struct snd_pcm_substream *);
-        int (*prepare)(struct snd_pcm_substream *);
-        int (*start)(struct snd_pcm_substream *);
-        int (*stop)(struct snd_pcm_substream *);
-        snd_pcm_uframes_t (*pointer)(struct snd_pcm_substream *);
+static int soundgen_loop_start(struct snd_pcm_substream *substream)
+{
+        struct soundgen_loop_pcm *dpcm = substream->runtime->private_data;
+
+        WRITE_ONCE(dpcm->loop->capture_running, true);
+        return 0;
+}
+
+static int soundgen_loop_stop(struct snd_pcm_substream *substream)
+{
+        struct soundgen_loop_pcm *dpcm = substream->runtime->private_data;
+
+        WRITE_ONCE(dpcm->loop->capture_running, false);
+        return 0;
+}
+
+static int soundgen_loop_prepare(struct snd_pcm_substream *substream)
+{
+        struct soundgen_loop_pcm *dpcm = substream->runtime->private_data;
+
+        soundgen_stats_reset(dpcm->stats, "loopback",
+                        soundgen_period_time(substream->runtime));
+        return 0;
+}
+
+static snd_pcm_uframes_t
+soundgen_loop_pointer(struct snd_pcm_substream *substream)
+{
+        struct soundgen_loop_pcm *dpcm = substream->runtime->private_data;
+
+        return READ_ONCE(dpcm->loop->pos);
+}
+
+static int soundgen_loop_create(struct snd_pcm_substream *substream)
+{
+        struct soundgen_loop_pcm *dpcm;
+
+        dpcm = kzalloc(sizeof(*dpcm), GFP_KERNEL);
+        if (!dpcm)
+                return -ENOMEM;
+        substream->runtime->private_data = dpcm;
+        dpcm->loop = soundgen_loop_get(substream);
+        dpcm->stats = soundgen_stats_get(substream);
+        spin_lock_irq(&dpcm->loop->lock);
+        dpcm->loop->capture = substream;
+        dpcm->loop->capture_running = false;
+        spin_unlock_irq(&dpcm->loop->lock);
+        return 0;
+}
+
+static void soundgen_loop_free(struct snd_pcm_substream *substream)
+{
+        struct soundgen_loop_pcm *dpcm = substream->runtime->private_data;
+
+        spin_lock_irq(&dpcm->loop->lock);
+        dpcm->loop->capture = NULL;
+        spin_unlock_irq(&dpcm->loop->lock);
+        kfree(dpcm);
+}
+
+static const struct soundgen_backend_ops soundgen_loop_ops = {
+        .create = soundgen_loop_create,
+        .free = soundgen_loop_free,
+        .prepare = soundgen_loop_prepare,
+        .start = soundgen_loop_start,
+        .stop = soundgen_loop_stop,
+        .pointer = soundgen_loop_pointer,
 };
 
+static int snd_soundgen_new_loops(struct snd_card_soundgen *soundgen_card,
+                unsigned int count)
+{
+        unsigned int i;
+
+        soundgen_card->loops = kcalloc(count, sizeof(*soundgen_card->loops),
+                        GFP_KERNEL);
+        if (!soundgen_card->loops)
+                return -ENOMEM;
+        for (i = 0; i < count; i++) {
+                spin_lock_init(&soundgen_card->loops[i].lock);
+                mutex_init(&soundgen_card->loops[i].mutex);
+        }
+        return 0;
+}
 
 /*
  * hrtimer interface
  */
 
 struct dummy_hrtimer_pcm {
-	/* ops must be the first item */
-	const struct snd_timer_ops *timer_ops;
-	ktime_t base_time;
+	/* head must be the first item */
+	struct soundgen_pcm_head head;
+	struct soundgen_clock clock;
 	ktime_t period_time;
 	atomic_t running;
 	struct hrtimer timer;
 	struct snd_pcm_substream *substream;
+	u64 filled;		/* absolute frames written into the ring */
+	struct soundgen_stats *stats;
 };
 
 static enum hrtimer_restart dummy_hrtimer_callback(struct hrtimer *timer)
 {
 	struct dummy_hrtimer_pcm *dpcm;
-        u64 delta;
-	u32 pos;
         struct snd_pcm_runtime *runtime;
+	ktime_t now;
+	u64 delta;
 
 	dpcm = container_of(timer, struct dummy_hrtimer_pcm, timer);
 	if (!atomic_read(&dpcm->running))
 		return HRTIMER_NORESTART;
         runtime = dpcm->substream->runtime;
-	/*
-	 * In cases of XRUN and draining, this calls .trigger to stop PCM
-	 * substream.
-	 */
-	delta = ktime_us_delta(hrtimer_cb_get_time(&dpcm->timer),
-			       dpcm->base_time);
-	delta = div_u64(delta * runtime->rate + 999999, 1000000);
-	div_u64_rem(delta, runtime->buffer_size, &pos);
-        
-        snd_pcm_period_elapsed(dpcm->substream);
+
+	now = hrtimer_cb_get_time(timer);
+	delta = soundgen_clock_frames(&dpcm->clock, now);
+	soundgen_stats_period(dpcm->stats, runtime,
+			      ktime_to_ns(ktime_sub(now,
+					      hrtimer_get_softexpires(timer))),
+			      delta);
+	soundgen_pcm_update(dpcm->substream, &dpcm->head, dpcm->stats,
+			    &dpcm->filled, delta);
+        soundgen_period_elapsed(dpcm->substream);
+	soundgen_stats_check_xrun(dpcm->stats, runtime);
 	if (!atomic_read(&dpcm->running))
 		return HRTIMER_NORESTART;
 
-	hrtimer_forward_now(timer, dpcm->period_time);
+	soundgen_stats_overrun(dpcm->stats,
+			       hrtimer_forward_now(timer, dpcm->period_time));
 	return HRTIMER_RESTART;
 }
 
 static int dummy_hrtimer_start(struct snd_pcm_substream *substream)
 {
 	struct dummy_hrtimer_pcm *dpcm = substream->runtime->private_data;
-        struct snd_pcm_runtime *runtime = substream->runtime;
-        memset(runtime->dma_area,0x99,runtime->dma_bytes); 
-	dpcm->base_time = hrtimer_cb_get_time(&dpcm->timer);
-	hrtimer_start(&dpcm->timer, dpcm->period_time, HRTIMER_MODE_REL_SOFT);
+	ktime_t now;
+
+	dpcm->filled = 0;
+	soundgen_pcm_advance(substream, &dpcm->head.gen, dpcm->stats,
+			     &dpcm->filled, 0);
+	now = hrtimer_cb_get_time(&dpcm->timer);
+	soundgen_clock_start(&dpcm->clock, now, dpcm->filled);
+	hrtimer_start_range_ns(&dpcm->timer,
+			       soundgen_first_deadline(substream, now,
+						       dpcm->period_time),
+			       soundgen_timer_slack(dpcm->period_time),
+			       HRTIMER_MODE_ABS_SOFT);
 	atomic_set(&dpcm->running, 1);
 	return 0;
 }
@@ -142,34 +1876,21 @@ dummy_hrtimer_pointer(struct snd_pcm_substream *substream)
 {
 	struct snd_pcm_runtime *runtime = substream->runtime;
 	struct dummy_hrtimer_pcm *dpcm = runtime->private_data;
-	u64 delta;
-	u32 pos;
 
-	delta = ktime_us_delta(hrtimer_cb_get_time(&dpcm->timer),
-			       dpcm->base_time);
-	delta = div_u64(delta * runtime->rate + 999999, 1000000);
-	div_u64_rem(delta, runtime->buffer_size, &pos);
-        pr_debug("Position: %d\n",pos);
-	return pos;
+	return soundgen_clock_pointer(&dpcm->clock, runtime);
 }
 
 static int dummy_hrtimer_prepare(struct snd_pcm_substream *substream)
 {
 	struct snd_pcm_runtime *runtime = substream->runtime;
 	struct dummy_hrtimer_pcm *dpcm = runtime->private_data;
-	unsigned int period, rate;
-	long sec;
-	unsigned long nsecs;
 
 	dummy_hrtimer_sync(dpcm);
-	period = runtime->period_size;
-	rate = runtime->rate;
-	sec = period / rate;
-	period %= rate;
-	nsecs = div_u64((u64)period * 1000000000UL + rate - 1, rate);
-	dpcm->period_time = ktime_set(sec, nsecs);
+	dpcm->period_time = soundgen_period_time(runtime);
+	soundgen_clock_prepare(&dpcm->clock, runtime->rate);
+	soundgen_stats_reset(dpcm->stats, "hrtimer", dpcm->period_time);
 
-	return 0;
+	return soundgen_gen_reset(&dpcm->head.gen, runtime);
 }
 
 static int dummy_hrtimer_create(struct snd_pcm_substream *substream)
@@ -182,7 +1903,10 @@ static int dummy_hrtimer_create(struct snd_pcm_substream *substream)
 	substream->runtime->private_data = dpcm;
 	hrtimer_init(&dpcm->timer, CLOCK_MONOTONIC, HRTIMER_MODE_REL_SOFT);
 	dpcm->timer.function = dummy_hrtimer_callback;
+	soundgen_clock_init(&dpcm->clock);
+	dpcm->head.clock = &dpcm->clock;
 	dpcm->substream = substream;
+	dpcm->stats = soundgen_stats_get(substream);
 	atomic_set(&dpcm->running, 0);
 	return 0;
 }
@@ -194,7 +1918,7 @@ static void dummy_hrtimer_free(struct snd_pcm_substream *substream)
 	kfree(dpcm);
 }
 
-static const struct snd_timer_ops dummy_hrtimer_ops = {
+static const struct soundgen_backend_ops dummy_hrtimer_ops = {
 	.create =	dummy_hrtimer_create,
 	.free =		dummy_hrtimer_free,
 	.prepare =	dummy_hrtimer_prepare,
@@ -203,12 +1927,12 @@ static const struct snd_timer_ops dummy_hrtimer_ops = {
 	.pointer =	dummy_hrtimer_pointer,
 };
 
-#define get_timer_ops(substream) \
-(*(const struct snd_timer_ops **)(substream)->runtime->private_data)
+#define get_backend_ops(substream) \
+(*(const struct soundgen_backend_ops **)(substream)->runtime->private_data)
 
 struct snd_pcm_timer {
-        /* ops must be the first item */
-        const struct snd_timer_ops *timer_ops;
+        /* head must be the first item */
+        struct soundgen_pcm_head head;
         spinlock_t lock;
         struct timer_list timer;
         unsigned long base_time;
@@ -218,6 +1942,9 @@ struct snd_pcm_timer {
         unsigned int frac_period_size;	/* period_size * HZ */
         unsigned int rate;
         long int elapsed;
+        snd_pcm_uframes_t fill_frames;	/* frames passed but not written yet */
+        snd_pcm_uframes_t pos;		/* position at the last callback */
+        struct soundgen_stats *stats;
         struct snd_pcm_substream *substream;
 };
 
@@ -238,6 +1965,7 @@ static void snd_pcm_timer_update(struct snd_pcm_timer *dpcm)
                 return;
         dpcm->base_time += delta;
         delta *= dpcm->rate;
+        dpcm->fill_frames += (dpcm->frac_pos + delta) / HZ - dpcm->frac_pos / HZ;
         dpcm->frac_pos += delta;
         while (dpcm->frac_pos >= dpcm->frac_buffer_size) {
                 dpcm->frac_pos -= dpcm->frac_buffer_size;
@@ -249,6 +1977,33 @@ static void snd_pcm_timer_update(struct snd_pcm_timer *dpcm)
         dpcm->frac_period_rest -= delta;
 }
 
+/*
+ * Write the frames the hardware pointer moved over since the last fill,
+ * i.e. the region just behind the current position. Everything else in
+ * the ring still belongs to userspace. Playback consumes the same
+ * region instead. Called with dpcm->lock held.
+ */
+static void snd_pcm_timer_fill(struct snd_pcm_timer *dpcm)
+{
+        struct snd_pcm_runtime *runtime = dpcm->substream->runtime;
+        snd_pcm_uframes_t frames, pos;
+
+        frames = min_t(snd_pcm_uframes_t, dpcm->fill_frames,
+                        runtime->buffer_size);
+        dpcm->fill_frames = 0;
+        if (!frames)
+                return;
+
+        pos = (dpcm->frac_pos / HZ + runtime->buffer_size - frames) %
+                runtime->buffer_size;
+        if (dpcm->substream->stream == SNDRV_PCM_STREAM_PLAYBACK)
+                soundgen_sink_consume(dpcm->substream, dpcm->stats, pos,
+                                frames);
+        else if (!soundgen_ringless(dpcm->substream))
+                soundgen_gen_fill(dpcm->substream, &dpcm->head.gen, pos,
+                                frames);
+}
+
 static int snd_pcm_timer_start(struct snd_pcm_substream *substream)
 {
         struct snd_pcm_timer *dpcm = substream->runtime->private_data;
@@ -259,101 +2014,537 @@ static int snd_pcm_timer_start(struct snd_pcm_substream *substream)
         return 0;
 }
 
-static int snd_pcm_timer_stop(struct snd_pcm_substream *substream)
-{ 
-        struct snd_pcm_timer *dpcm = substream->runtime->private_data;
-        spin_lock(&dpcm->lock);
-        del_timer(&dpcm->timer);
-        spin_unlock(&dpcm->lock);
+static int snd_pcm_timer_stop(struct snd_pcm_substream *substream)
+{ 
+        struct snd_pcm_timer *dpcm = substream->runtime->private_data;
+        spin_lock(&dpcm->lock);
+        del_timer(&dpcm->timer);
+        spin_unlock(&dpcm->lock);
+        return 0;
+}
+
+static int snd_pcm_timer_prepare(struct snd_pcm_substream *substream)
+{
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        struct snd_pcm_timer *dpcm = runtime->private_data;
+
+        dpcm->frac_pos = 0;
+        dpcm->rate = runtime->rate;
+        dpcm->frac_buffer_size = runtime->buffer_size * HZ;
+        dpcm->frac_period_size = runtime->period_size * HZ;
+        dpcm->frac_period_rest = dpcm->frac_period_size;
+        dpcm->elapsed = 0;
+        dpcm->fill_frames = 0;
+        dpcm->pos = 0;
+
+        pr_debug("%d\n", dpcm->frac_pos); 
+        pr_debug("%d\n", dpcm->rate); 
+        pr_debug("%d\n", dpcm->frac_buffer_size); 
+        pr_debug("%d\n", dpcm->frac_period_size); 
+        pr_debug("%d\n", dpcm->frac_period_rest); 
+        pr_debug("%ld\n", dpcm->elapsed); 
+
+        soundgen_stats_reset(dpcm->stats, "System Timer",
+                        soundgen_period_time(runtime));
+        return soundgen_gen_reset(&dpcm->head.gen, runtime);
+}
+
+static void snd_pcm_timer_callback(struct timer_list *t)
+{
+        struct snd_pcm_timer *dpcm = from_timer(dpcm, t, timer);
+        unsigned long flags;
+        int elapsed = 0;
+
+        pr_debug("Systimer callback\n");
+
+        spin_lock_irqsave(&dpcm->lock, flags);
+        snd_pcm_timer_update(dpcm);
+        snd_pcm_timer_rearm(dpcm);
+        elapsed = dpcm->elapsed;
+        dpcm->elapsed = 0;
+        pr_debug("elapsed = %d\n",elapsed);
+        snd_pcm_timer_fill(dpcm);
+        WRITE_ONCE(dpcm->pos, dpcm->frac_pos / HZ);
+        spin_unlock_irqrestore(&dpcm->lock, flags);
+        if (elapsed)
+                soundgen_period_elapsed(dpcm->substream);
+}
+
+/*
+ * The position only moves in the callback, which also fills what it
+ * passed, so the pointer reads it without the lock and the stream is
+ * flagged SNDRV_PCM_INFO_BATCH.
+ */
+static snd_pcm_uframes_t snd_pcm_timer_pointer(struct 
+                snd_pcm_substream *substream)
+{
+        struct snd_pcm_timer *dpcm = substream->runtime->private_data;
+
+        return READ_ONCE(dpcm->pos);
+}
+
+static int snd_pcm_timer_create(struct snd_pcm_substream *substream)
+{
+        struct snd_pcm_timer *dpcm;
+        int err;
+
+        dpcm = kzalloc(sizeof(*dpcm), GFP_KERNEL);
+        if (!dpcm)
+                return -ENOMEM;
+        substream->runtime->private_data = dpcm;
+        timer_setup(&dpcm->timer, snd_pcm_timer_callback, 0);
+        spin_lock_init(&dpcm->lock);
+        dpcm->stats = soundgen_stats_get(substream);
+        dpcm->substream = substream;
+        /* frac_buffer_size must fit */
+        err = snd_pcm_hw_constraint_minmax(substream->runtime,
+                        SNDRV_PCM_HW_PARAM_BUFFER_SIZE, 1, UINT_MAX / HZ);
+        if (err < 0)
+                kfree(dpcm);
+        return err;
+}
+
+static void snd_pcm_timer_free(struct snd_pcm_substream *substream)
+{
+        struct snd_pcm_timer *dpcm = substream->runtime->private_data;
+
+        del_timer_sync(&dpcm->timer);
+        kfree(dpcm);
+}
+
+static const struct soundgen_backend_ops snd_pcm_timer_ops = {
+        .create = snd_pcm_timer_create,
+        .free = snd_pcm_timer_free,
+        .prepare = snd_pcm_timer_prepare,
+        .start = snd_pcm_timer_start,
+        .stop = snd_pcm_timer_stop,
+        .pointer = snd_pcm_timer_pointer,
+};
+
+/*
+ * kthread interface
+ *
+ * A SCHED_FIFO thread per substream sleeping on absolute hrtimer
+ * deadlines. Unlike the softirq hrtimer it cannot be delayed behind
+ * other softirq work, which matters for sub-millisecond periods.
+ */
+
+struct soundgen_kthread_pcm {
+        /* head must be the first item */
+        struct soundgen_pcm_head head;
+        spinlock_t lock;
+        struct task_struct *thread;
+        struct soundgen_clock clock;
+        ktime_t period_time;
+        ktime_t next_time;	/* absolute deadline of the next period */
+        atomic_t running;
+        bool busy;		/* a tick is filling outside the lock */
+        u64 filled;		/* absolute frames written into the ring */
+        struct soundgen_stats *stats;
+        struct snd_pcm_substream *substream;
+};
+
+/*
+ * Fill the next period and move the deadline past now. Returns false if
+ * the stream was stopped meanwhile. Only the clock is read under the
+ * lock; the fill runs with interrupts on and publishes filled through
+ * the clock's seqlock, while busy lets prepare wait for it.
+ */
+static bool soundgen_kthread_tick(struct soundgen_kthread_pcm *dpcm)
+{
+        struct snd_pcm_runtime *runtime = dpcm->substream->runtime;
+        ktime_t now, deadline;
+        u64 delta, periods = 0;
+
+        spin_lock_irq(&dpcm->lock);
+        if (!atomic_read(&dpcm->running)) {
+                spin_unlock_irq(&dpcm->lock);
+                return false;
+        }
+        dpcm->busy = true;
+        now = ktime_get();
+        delta = soundgen_clock_frames(&dpcm->clock, now);
+        deadline = dpcm->next_time;
+        spin_unlock_irq(&dpcm->lock);
+
+        soundgen_stats_period(dpcm->stats, runtime,
+                        ktime_to_ns(ktime_sub(now, deadline)), delta);
+        soundgen_pcm_update(dpcm->substream, &dpcm->head, dpcm->stats,
+                        &dpcm->filled, delta);
+
+        spin_lock_irq(&dpcm->lock);
+        do {
+                dpcm->next_time = ktime_add(dpcm->next_time,
+                                dpcm->period_time);
+                periods++;
+        } while (!ktime_after(dpcm->next_time, now));
+        dpcm->busy = false;
+        spin_unlock_irq(&dpcm->lock);
+        wake_up_var(&dpcm->busy);
+        soundgen_stats_overrun(dpcm->stats, periods);
+        return true;
+}
+
+static int soundgen_kthread_fn(void *data)
+{
+        struct soundgen_kthread_pcm *dpcm = data;
+        ktime_t expires;
+
+        while (!kthread_should_stop()) {
+                set_current_state(TASK_INTERRUPTIBLE);
+                if (!atomic_read(&dpcm->running)) {
+                        schedule();
+                        continue;
+                }
+
+                spin_lock_irq(&dpcm->lock);
+                expires = dpcm->next_time;
+                spin_unlock_irq(&dpcm->lock);
+                /* start/stop wake us early, re-evaluate the deadline */
+                schedule_hrtimeout_range(&expires,
+                                soundgen_timer_slack(dpcm->period_time),
+                                HRTIMER_MODE_ABS);
+                if (!atomic_read(&dpcm->running) ||
+                    ktime_before(ktime_get(), expires))
+                        continue;
+
+                if (!soundgen_kthread_tick(dpcm))
+                        continue;
+                soundgen_period_elapsed(dpcm->substream);
+                soundgen_stats_check_xrun(dpcm->stats,
+                                dpcm->substream->runtime);
+        }
+        __set_current_state(TASK_RUNNING);
+        return 0;
+}
+
+static int soundgen_kthread_start(struct snd_pcm_substream *substream)
+{
+        struct soundgen_kthread_pcm *dpcm = substream->runtime->private_data;
+        ktime_t now;
+
+        spin_lock(&dpcm->lock);
+        dpcm->filled = 0;
+        soundgen_pcm_advance(substream, &dpcm->head.gen, dpcm->stats,
+                        &dpcm->filled, 0);
+        now = ktime_get();
+        soundgen_clock_start(&dpcm->clock, now, dpcm->filled);
+        dpcm->next_time = soundgen_first_deadline(substream, now,
+                        dpcm->period_time);
+        spin_unlock(&dpcm->lock);
+        atomic_set(&dpcm->running, 1);
+        wake_up_process(dpcm->thread);
+        return 0;
+}
+
+static int soundgen_kthread_stop(struct snd_pcm_substream *substream)
+{
+        struct soundgen_kthread_pcm *dpcm = substream->runtime->private_data;
+
+        atomic_set(&dpcm->running, 0);
+        wake_up_process(dpcm->thread);
+        return 0;
+}
+
+static int soundgen_kthread_prepare(struct snd_pcm_substream *substream)
+{
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        struct soundgen_kthread_pcm *dpcm = runtime->private_data;
+
+        /* wait for a tick that passed its running check */
+        atomic_set(&dpcm->running, 0);
+        spin_lock_irq(&dpcm->lock);
+        spin_unlock_irq(&dpcm->lock);
+        wait_var_event(&dpcm->busy, !READ_ONCE(dpcm->busy));
+
+        dpcm->period_time = soundgen_period_time(runtime);
+        soundgen_clock_prepare(&dpcm->clock, runtime->rate);
+        soundgen_stats_reset(dpcm->stats, "kthread", dpcm->period_time);
+        return soundgen_gen_reset(&dpcm->head.gen, runtime);
+}
+
+static snd_pcm_uframes_t
+soundgen_kthread_pointer(struct snd_pcm_substream *substream)
+{
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        struct soundgen_kthread_pcm *dpcm = runtime->private_data;
+
+        return soundgen_clock_pointer(&dpcm->clock, runtime);
+}
+
+static int soundgen_kthread_create(struct snd_pcm_substream *substream)
+{
+        struct soundgen_kthread_pcm *dpcm;
+
+        dpcm = kzalloc(sizeof(*dpcm), GFP_KERNEL);
+        if (!dpcm)
+                return -ENOMEM;
+        spin_lock_init(&dpcm->lock);
+        soundgen_clock_init(&dpcm->clock);
+        dpcm->head.clock = &dpcm->clock;
+        atomic_set(&dpcm->running, 0);
+        dpcm->substream = substream;
+        dpcm->stats = soundgen_stats_get(substream);
+        dpcm->thread = kthread_create(soundgen_kthread_fn, dpcm,
+                        "soundgen/%d:%d:%d", substream->pcm->card->number,
+                        substream->pcm->device, substream->number);
+        if (IS_ERR(dpcm->thread)) {
+                int err = PTR_ERR(dpcm->thread);
+
+                kfree(dpcm);
+                return err;
+        }
+        sched_set_fifo(dpcm->thread);
+        substream->runtime->private_data = dpcm;
+        wake_up_process(dpcm->thread);
+        return 0;
+}
+
+static void soundgen_kthread_free(struct snd_pcm_substream *substream)
+{
+        struct soundgen_kthread_pcm *dpcm = substream->runtime->private_data;
+
+        kthread_stop(dpcm->thread);
+        kfree(dpcm);
+}
+
+static const struct soundgen_backend_ops soundgen_kthread_ops = {
+        .create = soundgen_kthread_create,
+        .free = soundgen_kthread_free,
+        .prepare = soundgen_kthread_prepare,
+        .start = soundgen_kthread_start,
+        .stop = soundgen_kthread_stop,
+        .pointer = soundgen_kthread_pointer,
+};
+
+/*
+ * shared tick interface
+ *
+ * All substreams using this backend are queued by their next period
+ * deadline on one hrtimer per card. A single callback services every
+ * substream that is due, or due within its slack, in deadline order,
+ * so the wakeup rate no longer grows with the number of streams.
+ */
+
+struct soundgen_tick_pcm {
+        /* head must be the first item */
+        struct soundgen_pcm_head head;
+        struct soundgen_tick *tick;
+        struct timerqueue_node node;	/* expires is the next deadline */
+        struct list_head due;
+        bool queued;
+        struct soundgen_clock clock;
+        ktime_t period_time;
+        ktime_t deadline;		/* deadline being serviced */
+        u64 periods;			/* periods it covers */
+        u64 filled;		/* absolute frames written into the ring */
+        struct soundgen_stats *stats;
+        struct snd_pcm_substream *substream;
+};
+
+/* Arm the card timer for the earliest queued deadline, tick->lock held */
+static void soundgen_tick_arm(struct soundgen_tick *tick)
+{
+        struct timerqueue_node *node = timerqueue_getnext(&tick->queue);
+        struct soundgen_tick_pcm *dpcm;
+
+        if (!node)
+                return;
+        dpcm = container_of(node, struct soundgen_tick_pcm, node);
+        hrtimer_start_range_ns(&tick->timer, node->expires,
+                        soundgen_timer_slack(dpcm->period_time),
+                        HRTIMER_MODE_ABS_SOFT);
+}
+
+static enum hrtimer_restart soundgen_tick_callback(struct hrtimer *timer)
+{
+        struct soundgen_tick *tick = container_of(timer, struct soundgen_tick,
+                        timer);
+        struct soundgen_tick_pcm *dpcm, *tmp;
+        struct timerqueue_node *node;
+        struct snd_pcm_runtime *runtime;
+        unsigned long flags;
+        LIST_HEAD(due);
+        ktime_t now;
+        u64 delta;
+
+        now = hrtimer_cb_get_time(timer);
+        spin_lock_irqsave(&tick->lock, flags);
+        while ((node = timerqueue_getnext(&tick->queue))) {
+                dpcm = container_of(node, struct soundgen_tick_pcm, node);
+                if (ktime_after(node->expires, ktime_add_ns(now,
+                                soundgen_timer_slack(dpcm->period_time))))
+                        break;
+                timerqueue_del(&tick->queue, node);
+                dpcm->deadline = node->expires;
+                dpcm->periods = 0;
+                do {
+                        node->expires = ktime_add(node->expires,
+                                        dpcm->period_time);
+                        dpcm->periods++;
+                } while (!ktime_after(node->expires, now));
+                timerqueue_add(&tick->queue, node);
+                list_add_tail(&dpcm->due, &due);
+        }
+        spin_unlock_irqrestore(&tick->lock, flags);
+
+        /*
+         * Stopping a substream takes tick->lock, so the PCM core is called
+         * without it. Closing waits for this callback in soundgen_tick_sync()
+         * before the substream can go away.
+         */
+        list_for_each_entry_safe(dpcm, tmp, &due, due) {
+                list_del(&dpcm->due);
+                if (!READ_ONCE(dpcm->queued))
+                        continue;
+                runtime = dpcm->substream->runtime;
+                delta = soundgen_clock_frames(&dpcm->clock, now);
+                soundgen_stats_period(dpcm->stats, runtime,
+                                ktime_to_ns(ktime_sub(now, dpcm->deadline)),
+                                delta);
+                soundgen_pcm_update(dpcm->substream, &dpcm->head,
+                                dpcm->stats, &dpcm->filled, delta);
+                soundgen_period_elapsed(dpcm->substream);
+                soundgen_stats_check_xrun(dpcm->stats, runtime);
+                soundgen_stats_overrun(dpcm->stats, dpcm->periods);
+        }
+
+        spin_lock_irqsave(&tick->lock, flags);
+        soundgen_tick_arm(tick);
+        spin_unlock_irqrestore(&tick->lock, flags);
+        return HRTIMER_NORESTART;
+}
+
+/* Wait for a running callback, then re-arm for whoever is still queued */
+static void soundgen_tick_sync(struct soundgen_tick *tick)
+{
+        hrtimer_cancel(&tick->timer);
+        spin_lock_irq(&tick->lock);
+        soundgen_tick_arm(tick);
+        spin_unlock_irq(&tick->lock);
+}
+
+static int soundgen_tick_start(struct snd_pcm_substream *substream)
+{
+        struct soundgen_tick_pcm *dpcm = substream->runtime->private_data;
+        struct soundgen_tick *tick = dpcm->tick;
+        ktime_t now;
+
+        dpcm->filled = 0;
+        soundgen_pcm_advance(substream, &dpcm->head.gen, dpcm->stats,
+                        &dpcm->filled, 0);
+        now = ktime_get();
+        soundgen_clock_start(&dpcm->clock, now, dpcm->filled);
+
+        spin_lock(&tick->lock);
+        dpcm->node.expires = soundgen_first_deadline(substream, now,
+                        dpcm->period_time);
+        WRITE_ONCE(dpcm->queued, true);
+        if (timerqueue_add(&tick->queue, &dpcm->node))
+                soundgen_tick_arm(tick);
+        spin_unlock(&tick->lock);
         return 0;
 }
 
-static int snd_pcm_timer_prepare(struct snd_pcm_substream *substream)
+static int soundgen_tick_stop(struct snd_pcm_substream *substream)
 {
-        struct snd_pcm_runtime *runtime = substream->runtime;
-        struct snd_pcm_timer *dpcm = runtime->private_data;
-
-        dpcm->frac_pos = 0;
-        dpcm->rate = runtime->rate;
-        dpcm->frac_buffer_size = runtime->buffer_size * HZ;
-        dpcm->frac_period_size = runtime->period_size * HZ;
-        dpcm->frac_period_rest = dpcm->frac_period_size;
-        dpcm->elapsed = 0;
-
-        pr_debug("%d\n", dpcm->frac_pos); 
-        pr_debug("%d\n", dpcm->rate); 
-        pr_debug("%d\n", dpcm->frac_buffer_size); 
-        pr_debug("%d\n", dpcm->frac_period_size); 
-        pr_debug("%d\n", dpcm->frac_period_rest); 
-        pr_debug("%ld\n", dpcm->elapsed); 
+        struct soundgen_tick_pcm *dpcm = substream->runtime->private_data;
+        struct soundgen_tick *tick = dpcm->tick;
 
+        spin_lock(&tick->lock);
+        if (dpcm->queued) {
+                timerqueue_del(&tick->queue, &dpcm->node);
+                WRITE_ONCE(dpcm->queued, false);
+        }
+        spin_unlock(&tick->lock);
         return 0;
 }
 
-static void snd_pcm_timer_callback(struct timer_list *t)
+static int soundgen_tick_prepare(struct snd_pcm_substream *substream)
 {
-        pr_info("Systimer callback\n");
-        struct snd_pcm_timer *dpcm = from_timer(dpcm, t, timer);
-        unsigned long flags;
-        int elapsed = 0;
-
-        spin_lock_irqsave(&dpcm->lock, flags);
-        snd_pcm_timer_update(dpcm);
-        snd_pcm_timer_rearm(dpcm);
-        elapsed = dpcm->elapsed;
-        dpcm->elapsed = 0;
-        pr_debug("elapsed = %d\n",elapsed);
-       
-        // This needs an algorithm to check the current position,
-        // update the offset and copy data to the correct offset.
-        memcpy(dpcm->substream->runtime->dma_area,
-               music, dpcm->substream->runtime->dma_bytes);
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        struct soundgen_tick_pcm *dpcm = runtime->private_data;
 
-        spin_unlock_irqrestore(&dpcm->lock, flags);
-        if (elapsed)
-                snd_pcm_period_elapsed(dpcm->substream);
+        soundgen_tick_sync(dpcm->tick);
+        dpcm->period_time = soundgen_period_time(runtime);
+        soundgen_clock_prepare(&dpcm->clock, runtime->rate);
+        soundgen_stats_reset(dpcm->stats, "shared tick", dpcm->period_time);
+        return soundgen_gen_reset(&dpcm->head.gen, runtime);
 }
 
-static snd_pcm_uframes_t snd_pcm_timer_pointer(struct 
-                snd_pcm_substream *substream)
+static snd_pcm_uframes_t
+soundgen_tick_pointer(struct snd_pcm_substream *substream)
 {
-        struct snd_pcm_timer *dpcm = substream->runtime->private_data;
-        snd_pcm_uframes_t pos;
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        struct soundgen_tick_pcm *dpcm = runtime->private_data;
 
-        spin_lock(&dpcm->lock);
-        snd_pcm_timer_update(dpcm);
-        pos = dpcm->frac_pos / HZ;
-        pr_debug("Pointer pos %ld\n",pos);
-        spin_unlock(&dpcm->lock);
-        return pos;
+        return soundgen_clock_pointer(&dpcm->clock, runtime);
 }
 
-static int snd_pcm_timer_create(struct snd_pcm_substream *substream)
+static int soundgen_tick_create(struct snd_pcm_substream *substream)
 {
-        struct snd_pcm_timer *dpcm;
+        struct snd_card_soundgen *chip = snd_pcm_substream_chip(substream);
+        struct soundgen_tick_pcm *dpcm;
 
         dpcm = kzalloc(sizeof(*dpcm), GFP_KERNEL);
         if (!dpcm)
                 return -ENOMEM;
         substream->runtime->private_data = dpcm;
-        timer_setup(&dpcm->timer, snd_pcm_timer_callback, 0);
-        spin_lock_init(&dpcm->lock);
+        dpcm->tick = &chip->tick;
+        timerqueue_init(&dpcm->node);
+        INIT_LIST_HEAD(&dpcm->due);
+        soundgen_clock_init(&dpcm->clock);
+        dpcm->head.clock = &dpcm->clock;
+        dpcm->stats = soundgen_stats_get(substream);
         dpcm->substream = substream;
         return 0;
 }
 
-static void snd_pcm_timer_free(struct snd_pcm_substream *substream)
+static void soundgen_tick_free(struct snd_pcm_substream *substream)
 {
-        kfree(substream->runtime->private_data);
+        struct soundgen_tick_pcm *dpcm = substream->runtime->private_data;
+
+        soundgen_tick_stop(substream);
+        soundgen_tick_sync(dpcm->tick);
+        kfree(dpcm);
 }
 
-static const struct snd_timer_ops snd_pcm_timer_ops = {
-        .create = snd_pcm_timer_create,
-        .free = snd_pcm_timer_free,
-        .prepare = snd_pcm_timer_prepare,
-        .start = snd_pcm_timer_start,
-        .stop = snd_pcm_timer_stop,
-        .pointer = snd_pcm_timer_pointer,
+static const struct soundgen_backend_ops soundgen_tick_ops = {
+        .create = soundgen_tick_create,
+        .free = soundgen_tick_free,
+        .prepare = soundgen_tick_prepare,
+        .start = soundgen_tick_start,
+        .stop = soundgen_tick_stop,
+        .pointer = soundgen_tick_pointer,
+};
+
+static void soundgen_tick_init(struct soundgen_tick *tick)
+{
+        spin_lock_init(&tick->lock);
+        timerqueue_init_head(&tick->queue);
+        hrtimer_init(&tick->timer, CLOCK_MONOTONIC, HRTIMER_MODE_ABS_SOFT);
+        tick->timer.function = soundgen_tick_callback;
+}
+
+enum soundgen_backend {
+        SOUNDGEN_BACKEND_HRTIMER,
+        SOUNDGEN_BACKEND_SYSTIMER,
+        SOUNDGEN_BACKEND_KTHREAD,
+        SOUNDGEN_BACKEND_TICK,
+};
+
+static const struct soundgen_backend_ops *soundgen_backends[] = {
+        [SOUNDGEN_BACKEND_HRTIMER] = &dummy_hrtimer_ops,
+        [SOUNDGEN_BACKEND_SYSTIMER] = &snd_pcm_timer_ops,
+        [SOUNDGEN_BACKEND_KTHREAD] = &soundgen_kthread_ops,
+        [SOUNDGEN_BACKEND_TICK] = &soundgen_tick_ops,
+};
+
+static const char * const soundgen_backend_names[] = {
+        [SOUNDGEN_BACKEND_HRTIMER] = "hrtimer",
+        [SOUNDGEN_BACKEND_SYSTIMER] = "System Timer",
+        [SOUNDGEN_BACKEND_KTHREAD] = "Kthread",
+        [SOUNDGEN_BACKEND_TICK] = "Shared Tick",
 };
 
 
@@ -365,15 +2556,17 @@ static const struct snd_pcm_hardware snd_soundgen_hw = {
         .info = (SNDRV_PCM_INFO_MMAP | SNDRV_PCM_INFO_INTERLEAVED |
                         SNDRV_PCM_INFO_BLOCK_TRANSFER | 
                         SNDRV_PCM_INFO_MMAP_VALID),
-        .formats = SNDRV_PCM_FMTBIT_S8,
-        .rates = SNDRV_PCM_RATE_8000,
+        .formats = (SNDRV_PCM_FMTBIT_S8 | SNDRV_PCM_FMTBIT_S16_LE |
+                        SNDRV_PCM_FMTBIT_S24_LE | SNDRV_PCM_FMTBIT_S32_LE |
+                        SNDRV_PCM_FMTBIT_FLOAT_LE),
+        .rates = SNDRV_PCM_RATE_CONTINUOUS | SNDRV_PCM_RATE_8000_192000,
         .rate_min = 8000,
-        .rate_max = 8000,
+        .rate_max = 192000,
         .channels_min = 1,
-        .channels_max = 1,
-        .buffer_bytes_max = 32768,
+        .channels_max = 8,
+        .buffer_bytes_max = 64 * 1024,	/* raised to buffer_max_kb */
         .period_bytes_min = 64,
-        .period_bytes_max = 32768,
+        .period_bytes_max = 64 * 1024,
         .periods_min = 1,
         .periods_max = 1024,
         .fifo_size = 0,
@@ -387,22 +2580,39 @@ static int soundgen_pcm_open(struct snd_pcm_substream *substream)
 {
         int err;
         struct snd_card_soundgen *chip = snd_pcm_substream_chip(substream);
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        const struct soundgen_backend_ops *ops;
+        struct soundgen_pcm_head *head;
+
         if (!chip) {
                 pr_info("Failed to retrieve chip\n");
                 return -1;
         }
-        struct snd_pcm_runtime *runtime = substream->runtime;
         pr_info("Opening PCM\n");
 
-        err = dummy_hrtimer_ops.create(substream);
+        if (loopback && substream->stream == SNDRV_PCM_STREAM_CAPTURE)
+                ops = &soundgen_loop_ops;
+        else
+                ops = soundgen_backends[READ_ONCE(chip->timer_backend)];
+        err = ops->create(substream);
         if (err < 0) {
                 pr_err("Failed to create timer\n");
-                return -1;
+                return err;
         }
 
-        get_timer_ops(substream) = &dummy_hrtimer_ops;
+        get_backend_ops(substream) = ops;
+        soundgen_fill_init(substream);
+        head = get_soundgen_head(substream);
+        head->scratch = kmalloc(sizeof(*head->scratch), GFP_KERNEL);
+        if (!head->scratch) {
+                ops->free(substream);
+                return -ENOMEM;
+        }
+        head->gen.render = head->scratch->render;
 
         runtime->hw = snd_soundgen_hw;
+        runtime->hw.buffer_bytes_max = (size_t)buffer_max_kb * 1024;
+        runtime->hw.period_bytes_max = runtime->hw.buffer_bytes_max;
         chip->pcm_hw = runtime->hw;
 
         if (substream->pcm->device & 1) {
@@ -412,6 +2622,23 @@ static int soundgen_pcm_open(struct snd_pcm_substream *substream)
         if (substream->pcm->device & 2)
                 runtime->hw.info &= ~(SNDRV_PCM_INFO_MMAP |
                                 SNDRV_PCM_INFO_MMAP_VALID);
+        if (ops == &snd_pcm_timer_ops)
+                runtime->hw.info |= SNDRV_PCM_INFO_BATCH;
+        if (get_soundgen_head(substream)->clock)
+                runtime->hw.info |= SNDRV_PCM_INFO_HAS_LINK_ATIME |
+                        SNDRV_PCM_INFO_HAS_LINK_ABSOLUTE_ATIME;
+
+        if (loopback) {
+                /* the looped capture only moves on playback periods */
+                if (substream->stream == SNDRV_PCM_STREAM_CAPTURE)
+                        runtime->hw.info |= SNDRV_PCM_INFO_BATCH;
+                err = soundgen_loop_constrain(substream);
+                if (err < 0) {
+                        kfree(head->scratch);
+                        ops->free(substream);
+                        return err;
+                }
+        }
 
         return 0;
 }
@@ -419,7 +2646,9 @@ static int soundgen_pcm_open(struct snd_pcm_substream *substream)
 static int soundgen_pcm_close(struct snd_pcm_substream *substream)
 {
         pr_info("Closing PCM\n");
-        get_timer_ops(substream)->free(substream);
+        soundgen_wavetable_put(get_soundgen_head(substream)->gen.wt);
+        kfree(get_soundgen_head(substream)->scratch);
+        get_backend_ops(substream)->free(substream);
         return 0;
 }
 
@@ -428,6 +2657,8 @@ static int soundgen_pcm_hw_params(struct snd_pcm_substream *substream,
 {
         pr_info("HW Params\n");
         pr_debug("Buffer size %d\n", params_buffer_bytes(params));
+        if (loopback)
+                return soundgen_loop_attach(substream, params);
         return snd_pcm_lib_malloc_pages(substream,
                         params_buffer_bytes(params));
 }
@@ -435,12 +2666,19 @@ static int soundgen_pcm_hw_params(struct snd_pcm_substream *substream,
 static int soundgen_pcm_hw_free(struct snd_pcm_substream *substream)
 {
         pr_info("HW free\n");
+        soundgen_fill_sync(substream);
+        if (loopback) {
+                soundgen_loop_detach(substream);
+                return 0;
+        }
         return snd_pcm_lib_free_pages(substream);
 }
 
 static int soundgen_pcm_prepare(struct snd_pcm_substream *substream)
 {
         struct snd_pcm_runtime *runtime = substream->runtime;
+        int err;
+
         pr_info("PCM Prepare\n");
 
         pr_debug("Format %d\n", runtime->format);
@@ -449,7 +2687,12 @@ static int soundgen_pcm_prepare(struct snd_pcm_substream *substream)
         pr_debug("Buffer size %ld\n", runtime->buffer_size);
         pr_debug("Period size %ld\n", runtime->period_size);
 
-        return get_timer_ops(substream)->prepare(substream);
+        soundgen_fill_sync(substream);
+        err = get_backend_ops(substream)->prepare(substream);
+        if (err < 0)
+                return err;
+        soundgen_wavetable_attach(substream, &get_soundgen_head(substream)->gen);
+        return 0;
 }
 
 static int soundgen_pcm_trigger(struct snd_pcm_substream *substream, int cmd)
@@ -459,17 +2702,67 @@ static int soundgen_pcm_trigger(struct snd_pcm_substream *substream, int cmd)
         switch (cmd) {
                 case SNDRV_PCM_TRIGGER_START:
                         /* do something to start the PCM engine */
-                        return get_timer_ops(substream)->start(substream);
+                        soundgen_fill_enable(substream, true);
+                        return get_backend_ops(substream)->start(substream);
                 case SNDRV_PCM_TRIGGER_STOP:
-                        return get_timer_ops(substream)->stop(substream); 
+                        soundgen_fill_enable(substream, false);
+                        return get_backend_ops(substream)->stop(substream); 
         }
         return -EINVAL;
 }
 
 static snd_pcm_uframes_t soundgen_pcm_pointer(struct snd_pcm_substream *substream)
 {
+        snd_pcm_uframes_t pos;
+
         //pr_info("PCM Pointer\n");
-        return get_timer_ops(substream)->pointer(substream);
+        pos = get_backend_ops(substream)->pointer(substream);
+        soundgen_loop_update(substream, pos);
+        return pos;
+}
+
+/*
+ * Link timestamps are read from the stream clock of the time based
+ * backends. Other requests, and the backends without a clock, are
+ * demoted to the core's estimate from the hardware pointer.
+ */
+static int soundgen_pcm_get_time_info(struct snd_pcm_substream *substream,
+                struct timespec64 *system_ts, struct timespec64 *audio_ts,
+                struct snd_pcm_audio_tstamp_config *audio_tstamp_config,
+                struct snd_pcm_audio_tstamp_report *audio_tstamp_report)
+{
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        struct soundgen_clock *clk = get_soundgen_head(substream)->clock;
+        ktime_t now, link;
+
+        if (!clk || (audio_tstamp_config->type_requested !=
+                                SNDRV_PCM_AUDIO_TSTAMP_TYPE_LINK &&
+                        audio_tstamp_config->type_requested !=
+                                SNDRV_PCM_AUDIO_TSTAMP_TYPE_LINK_ABSOLUTE)) {
+                audio_tstamp_report->actual_type =
+                        SNDRV_PCM_AUDIO_TSTAMP_TYPE_DEFAULT;
+                return 0;
+        }
+
+        link = soundgen_clock_link_time(clk,
+                        audio_tstamp_config->type_requested ==
+                        SNDRV_PCM_AUDIO_TSTAMP_TYPE_LINK_ABSOLUTE, &now);
+        switch (runtime->tstamp_type) {
+        case SNDRV_PCM_TSTAMP_TYPE_GETTIMEOFDAY:
+                now = ktime_mono_to_real(now);
+                break;
+        case SNDRV_PCM_TSTAMP_TYPE_MONOTONIC_RAW:
+                /* no conversion from monotonic, read it right after */
+                now = ktime_get_raw();
+                break;
+        }
+        *system_ts = ktime_to_timespec64(now);
+        *audio_ts = ktime_to_timespec64(link);
+
+        audio_tstamp_report->actual_type = audio_tstamp_config->type_requested;
+        audio_tstamp_report->accuracy_report = 1;
+        audio_tstamp_report->accuracy = hrtimer_resolution;
+        return 0;
 }
 
 #ifdef DEBUG
@@ -485,7 +2778,98 @@ int soundgen_pcm_ioctl_wrap(struct snd_pcm_substream *substream,
 }
 #endif
 
-static const struct snd_pcm_ops snd_soundgen_capture_ops = {
+/*
+ * read()/write() path of the non-mmap devices. Capture is synthesized
+ * straight into the caller's buffer and playback is metered from it, so
+ * neither touches the DMA ring. pos is only needed for loopback, where
+ * the ring is shared with the other direction.
+ */
+static int soundgen_pcm_copy(struct snd_pcm_substream *substream,
+                int channel, unsigned long pos, void *buf,
+                unsigned long bytes, bool user)
+{
+        struct snd_pcm_runtime *runtime = substream->runtime;
+        struct soundgen_pcm_head *head = get_soundgen_head(substream);
+        u8 *bounce = head->scratch->bounce;
+        struct soundgen_gen replay;
+        u8 *ring;
+
+        if (loopback) {
+                ring = runtime->dma_area + pos;
+                if (channel >= 0)
+                        ring += channel * (runtime->dma_bytes /
+                                        runtime->channels);
+                if (substream->stream == SNDRV_PCM_STREAM_PLAYBACK) {
+                        if (!user)
+                                memcpy(ring, buf, bytes);
+                        else if (copy_from_user(ring,
+                                                (const void __user *)buf,
+                                                bytes))
+                                return -EFAULT;
+                } else {
+                        if (!user)
+                                memcpy(buf, ring, bytes);
+                        else if (copy_to_user((void __user *)buf, ring,
+                                                bytes))
+                                return -EFAULT;
+                }
+                return 0;
+        }
+
+        if (substream->stream == SNDRV_PCM_STREAM_PLAYBACK)
+                return soundgen_sink_copy(substream,
+                                soundgen_stats_get(substream), channel, buf,
+                                bytes, user, bounce);
+
+        if (channel < 0)
+                return soundgen_gen_copy(substream, &head->gen, channel, buf,
+                                bytes_to_frames(runtime, bytes), user,
+                                bounce);
+        /* every channel of a non-interleaved read gets the same frames */
+        if (channel == 0) {
+                head->replay = head->gen;
+                return soundgen_gen_copy(substream, &head->gen, channel, buf,
+                                bytes_to_samples(runtime, bytes), user,
+                                bounce);
+        }
+        replay = head->replay;
+        return soundgen_gen_copy(substream, &replay, channel, buf,
+                        bytes_to_samples(runtime, bytes), user, bounce);
+}
+
+static int soundgen_pcm_copy_user(struct snd_pcm_substream *substream,
+                int channel, unsigned long pos, void __user *dst,
+                unsigned long bytes)
+{
+        return soundgen_pcm_copy(substream, channel, pos, (__force void *)dst,
+                        bytes, true);
+}
+
+static int soundgen_pcm_copy_kernel(struct snd_pcm_substream *substream,
+                int channel, unsigned long pos, void *buf,
+                unsigned long bytes)
+{
+        return soundgen_pcm_copy(substream, channel, pos, buf, bytes, false);
+}
+
+static const struct snd_pcm_ops snd_soundgen_pcm_ops = {
+        .open = soundgen_pcm_open,
+        .close = soundgen_pcm_close,
+#ifdef DEBUG
+        .ioctl = soundgen_pcm_ioctl_wrap,
+#else
+        .ioctl = snd_pcm_lib_ioctl,
+#endif
+        .hw_params = soundgen_pcm_hw_params,
+        .hw_free = soundgen_pcm_hw_free,
+        .prepare = soundgen_pcm_prepare,
+        .trigger = soundgen_pcm_trigger,
+        .pointer = soundgen_pcm_pointer,
+        .get_time_info = soundgen_pcm_get_time_info,
+};
+
+/* Devices without mmap (device & 2) */
+static const struct snd_pcm_ops snd_soundgen_copy_ops = {
         .open = soundgen_pcm_open,
         .close = soundgen_pcm_close,
 #ifdef DEBUG
@@ -497,27 +2881,40 @@ static const struct snd_pcm_ops snd_soundgen_capture_ops = {
         .hw_free = soundgen_pcm_hw_free,
         .prepare = soundgen_pcm_prepare,
         .trigger = soundgen_pcm_trigger,
-        .pointer = soundgen_pcm_pointer
+        .pointer = soundgen_pcm_pointer,
+        .get_time_info = soundgen_pcm_get_time_info,
+        .copy_user = soundgen_pcm_copy_user,
+        .copy_kernel = soundgen_pcm_copy_kernel,
 };
 
-static int snd_soundgen_new_pcm(struct snd_card_soundgen *soundgen_card)
+static int snd_soundgen_new_pcm(struct snd_card_soundgen *soundgen_card,
+                int device, int substreams)
 {
+        const struct snd_pcm_ops *ops;
         struct snd_pcm *pcm;
         int err;
 
-        err = snd_pcm_new(soundgen_card->card, "Soundgen PCM", 0, 0,
-                        1, &pcm);
+        err = snd_pcm_new(soundgen_card->card, "Soundgen PCM", device,
+                        substreams, substreams, &pcm);
         if (err < 0) {
                 return err;
         }
-        snd_pcm_set_ops(pcm, SNDRV_PCM_STREAM_CAPTURE,
-                        &snd_soundgen_capture_ops);
+        ops = device & 2 ? &snd_soundgen_copy_ops : &snd_soundgen_pcm_ops;
+        snd_pcm_set_ops(pcm, SNDRV_PCM_STREAM_PLAYBACK, ops);
+        snd_pcm_set_ops(pcm, SNDRV_PCM_STREAM_CAPTURE, ops);
         pcm->private_data = soundgen_card;
         strcpy(pcm->name, "Soundgen PCM");
-        soundgen_card->pcm = pcm;
-        snd_pcm_lib_preallocate_pages_for_all(pcm, SNDRV_DMA_TYPE_CONTINUOUS,
-                        snd_dma_continuous_data(GFP_KERNEL),
-                        0, (64*1024));
+        soundgen_card->pcm[device] = pcm;
+        /*
+         * vmalloc backed, so buffers of several MiB need no physically
+         * contiguous memory. Looped pairs allocate their shared buffer
+         * in hw_params.
+         */
+        if (!loopback)
+                snd_pcm_lib_preallocate_pages_for_all(pcm,
+                                SNDRV_DMA_TYPE_VMALLOC, NULL,
+                                (size_t)prealloc_kb * 1024,
+                                (size_t)buffer_max_kb * 1024);
         return 0;
 }
 
@@ -525,12 +2922,347 @@ static int snd_soundgen_new_pcm(struct snd_card_soundgen *soundgen_card)
  * End of PCM Stuff
  */
 
+/**
+ * Clock timer stuff
+ *
+ * The card's period grid as an ALSA timer. One tick is one frame at
+ * clock_rate and the deadlines are the ones a stream at that rate with
+ * a period of the requested ticks runs on, so an audio server can drive
+ * its cycle from this timer alone and still wake together with the PCM
+ * periods. Modelled on the core hrtimer timer.
+ */
+
+static ktime_t soundgen_timer_period(unsigned long ticks)
+{
+        return ns_to_ktime(div_u64((u64)ticks * NSEC_PER_SEC +
+                                clock_rate - 1, clock_rate));
+}
+
+static enum hrtimer_restart soundgen_timer_callback(struct hrtimer *hrt)
+{
+        struct snd_card_soundgen *chip = container_of(hrt,
+                        struct snd_card_soundgen, clock_timer.hrt);
+        struct soundgen_timer *st = &chip->clock_timer;
+        struct snd_timer *t = st->timer;
+        enum hrtimer_restart ret = HRTIMER_NORESTART;
+        unsigned long ticks, flags;
+        ktime_t period;
+        u64 periods;
+
+        spin_lock_irqsave(&t->lock, flags);
+        if (!t->running)
+                goto out;
+        st->in_callback = true;
+        ticks = t->sticks;
+        spin_unlock_irqrestore(&t->lock, flags);
+
+        /* deadlines missed on the way are reported as extra ticks */
+        periods = hrtimer_forward_now(hrt, soundgen_timer_period(ticks));
+        snd_timer_interrupt(t, periods * ticks);
+
+        spin_lock_irqsave(&t->lock, flags);
+        if (t->running) {
+                /* the core restarted us with a new period meanwhile */
+                if (t->sticks != ticks) {
+                        period = soundgen_timer_period(t->sticks);
+                        hrtimer_set_expires_range_ns(hrt,
+                                        soundgen_grid_deadline(chip,
+                                                hrtimer_cb_get_time(hrt),
+                                                period),
+                                        soundgen_timer_slack(period));
+                }
+                ret = HRTIMER_RESTART;
+        }
+        st->in_callback = false;
+out:
+        spin_unlock_irqrestore(&t->lock, flags);
+        return ret;
+}
+
+/* Called with t->lock held */
+static int soundgen_timer_start(struct snd_timer *t)
+{
+        struct snd_card_soundgen *chip = snd_timer_chip(t);
+        struct soundgen_timer *st = &chip->clock_timer;
+        ktime_t period = soundgen_timer_period(t->sticks);
+
+        if (st->in_callback)
+                return 0;
+        hrtimer_try_to_cancel(&st->hrt);
+        hrtimer_start_range_ns(&st->hrt,
+                        soundgen_grid_deadline(chip, ktime_get(), period),
+                        soundgen_timer_slack(period), HRTIMER_MODE_ABS_SOFT);
+        return 0;
+}
+
+static int soundgen_timer_stop(struct snd_timer *t)
+{
+        struct snd_card_soundgen *chip = snd_timer_chip(t);
+        struct soundgen_timer *st = &chip->clock_timer;
+
+        if (st->in_callback)
+                return 0;
+        hrtimer_try_to_cancel(&st->hrt);
+        return 0;
+}
+
+static int soundgen_timer_close(struct snd_timer *t)
+{
+        struct snd_card_soundgen *chip = snd_timer_chip(t);
+
+        hrtimer_cancel(&chip->clock_timer.hrt);
+        return 0;
+}
+
+static int soundgen_timer_precise_resolution(struct snd_timer *t,
+                unsigned long *num, unsigned long *den)
+{
+        *num = 1;
+        *den = clock_rate;
+        return 0;
+}
+
+static const struct snd_timer_hardware soundgen_timer_hw = {
+        .flags = SNDRV_TIMER_HW_AUTO | SNDRV_TIMER_HW_WORK,
+        .close = soundgen_timer_close,
+        .start = soundgen_timer_start,
+        .stop = soundgen_timer_stop,
+        .precise_resolution = soundgen_timer_precise_resolution,
+};
+
+static void soundgen_timer_init(struct soundgen_timer *st)
+{
+        hrtimer_init(&st->hrt, CLOCK_MONOTONIC, HRTIMER_MODE_ABS_SOFT);
+        st->hrt.function = soundgen_timer_callback;
+}
+
+static int snd_soundgen_new_timer(struct snd_card_soundgen *soundgen_card)
+{
+        struct soundgen_timer *st = &soundgen_card->clock_timer;
+        struct snd_timer_id tid = {
+                .dev_class = SNDRV_TIMER_CLASS_CARD,
+                .dev_sclass = SNDRV_TIMER_SCLASS_NONE,
+                .card = soundgen_card->card->number,
+        };
+        struct snd_timer *timer;
+        int err;
+
+        err = snd_timer_new(soundgen_card->card, "Soundgen", &tid, &timer);
+        if (err < 0)
+                return err;
+        strcpy(timer->name, "Soundgen clock");
+        timer->private_data = soundgen_card;
+        timer->hw = soundgen_timer_hw;
+        timer->hw.resolution = DIV_ROUND_CLOSEST(NSEC_PER_SEC, clock_rate);
+        timer->hw.ticks = clock_rate;	/* periods up to one second */
+        st->timer = timer;
+        return 0;
+}
+
+/**
+ * End of Clock timer stuff
+ */
+
+/**
+ * Mixer stuff
+ */
+
+/* Enumerated controls backed by an int field of the chip */
+struct soundgen_enum_ctl {
+        size_t offset;
+        const char * const *texts;
+        unsigned int items;
+};
+
+#define SOUNDGEN_ENUM(xname, xctl) \
+{ .iface = SNDRV_CTL_ELEM_IFACE_MIXER, .name = xname, \
+  .info = soundgen_enum_info, \
+  .get = soundgen_enum_get, .put = soundgen_enum_put, \
+  .private_value = (unsigned long)&(xctl) }
+
+static const struct soundgen_enum_ctl soundgen_waveform_ctl = {
+        .offset = offsetof(struct snd_card_soundgen, waveform),
+        .texts = soundgen_waveform_names,
+        .items = ARRAY_SIZE(soundgen_waveform_names),
+};
+
+static const struct soundgen_enum_ctl soundgen_meter_ctl = {
+        .offset = offsetof(struct snd_card_soundgen, sink_meter),
+        .texts = soundgen_meter_names,
+        .items = ARRAY_SIZE(soundgen_meter_names),
+};
+
+/* Only affects substreams opened after the change */
+static const struct soundgen_enum_ctl soundgen_backend_ctl = {
+        .offset = offsetof(struct snd_card_soundgen, timer_backend),
+        .texts = soundgen_backend_names,
+        .items = ARRAY_SIZE(soundgen_backend_names),
+};
+
+static int soundgen_enum_info(struct snd_kcontrol *kcontrol,
+                struct snd_ctl_elem_info *uinfo)
+{
+        const struct soundgen_enum_ctl *ctl =
+                (const struct soundgen_enum_ctl *)kcontrol->private_value;
+
+        return snd_ctl_enum_info(uinfo, 1, ctl->items, ctl->texts);
+}
+
+static int soundgen_enum_get(struct snd_kcontrol *kcontrol,
+                struct snd_ctl_elem_value *ucontrol)
+{
+        struct snd_card_soundgen *chip = snd_kcontrol_chip(kcontrol);
+        const struct soundgen_enum_ctl *ctl =
+                (const struct soundgen_enum_ctl *)kcontrol->private_value;
+
+        spin_lock_irq(&chip->mixer_lock);
+        ucontrol->value.enumerated.item[0] =
+                *(int *)((char *)chip + ctl->offset);
+        spin_unlock_irq(&chip->mixer_lock);
+        return 0;
+}
+
+static int soundgen_enum_put(struct snd_kcontrol *kcontrol,
+                struct snd_ctl_elem_value *ucontrol)
+{
+        struct snd_card_soundgen *chip = snd_kcontrol_chip(kcontrol);
+        const struct soundgen_enum_ctl *ctl =
+                (const struct soundgen_enum_ctl *)kcontrol->private_value;
+        int *field = (int *)((char *)chip + ctl->offset);
+        unsigned int item = ucontrol->value.enumerated.item[0];
+        int change;
+
+        if (item >= ctl->items)
+                return -EINVAL;
+        spin_lock_irq(&chip->mixer_lock);
+        change = *field != item;
+        WRITE_ONCE(*field, item);
+        spin_unlock_irq(&chip->mixer_lock);
+        return change;
+}
+
+/* Integer controls backed by an int field of the chip */
+struct soundgen_int_ctl {
+        size_t offset;
+        int min;
+        int max;
+};
+
+#define SOUNDGEN_INT(xname, xctl) \
+{ .iface = SNDRV_CTL_ELEM_IFACE_MIXER, .name = xname, \
+  .info = soundgen_int_info, \
+  .get = soundgen_int_get, .put = soundgen_int_put, \
+  .private_value = (unsigned long)&(xctl) }
+
+static const struct soundgen_int_ctl soundgen_frequency_ctl = {
+        .offset = offsetof(struct snd_card_soundgen, frequency),
+        .min = SOUNDGEN_FREQ_MIN,
+        .max = SOUNDGEN_FREQ_MAX,
+};
+
+static const struct soundgen_int_ctl soundgen_amplitude_ctl = {
+        .offset = offsetof(struct snd_card_soundgen, amplitude),
+        .min = 0,
+        .max = 100,
+};
+
+static int soundgen_int_info(struct snd_kcontrol *kcontrol,
+                struct snd_ctl_elem_info *uinfo)
+{
+        const struct soundgen_int_ctl *ctl =
+                (const struct soundgen_int_ctl *)kcontrol->private_value;
+
+        uinfo->type = SNDRV_CTL_ELEM_TYPE_INTEGER;
+        uinfo->count = 1;
+        uinfo->value.integer.min = ctl->min;
+        uinfo->value.integer.max = ctl->max;
+        return 0;
+}
+
+static int soundgen_int_get(struct snd_kcontrol *kcontrol,
+                struct snd_ctl_elem_value *ucontrol)
+{
+        struct snd_card_soundgen *chip = snd_kcontrol_chip(kcontrol);
+        const struct soundgen_int_ctl *ctl =
+                (const struct soundgen_int_ctl *)kcontrol->private_value;
+
+        spin_lock_irq(&chip->mixer_lock);
+        ucontrol->value.integer.value[0] =
+                *(int *)((char *)chip + ctl->offset);
+        spin_unlock_irq(&chip->mixer_lock);
+        return 0;
+}
+
+static int soundgen_int_put(struct snd_kcontrol *kcontrol,
+                struct snd_ctl_elem_value *ucontrol)
+{
+        struct snd_card_soundgen *chip = snd_kcontrol_chip(kcontrol);
+        const struct soundgen_int_ctl *ctl =
+                (const struct soundgen_int_ctl *)kcontrol->private_value;
+        int *field = (int *)((char *)chip + ctl->offset);
+        long val = ucontrol->value.integer.value[0];
+        int change;
+
+        if (val < ctl->min || val > ctl->max)
+                return -EINVAL;
+        spin_lock_irq(&chip->mixer_lock);
+        change = *field != val;
+        WRITE_ONCE(*field, val);
+        spin_unlock_irq(&chip->mixer_lock);
+        return change;
+}
+
+static const struct snd_kcontrol_new snd_soundgen_controls[] = {
+        SOUNDGEN_ENUM("Generator Waveform", soundgen_waveform_ctl),
+        SOUNDGEN_INT("Generator Frequency", soundgen_frequency_ctl),
+        SOUNDGEN_INT("Generator Amplitude", soundgen_amplitude_ctl),
+        SOUNDGEN_ENUM("Timer Backend", soundgen_backend_ctl),
+        SOUNDGEN_ENUM("Sink Meter", soundgen_meter_ctl),
+};
+
+static int snd_soundgen_new_mixer(struct snd_card_soundgen *soundgen_card)
+{
+        struct snd_card *card = soundgen_card->card;
+        unsigned int i;
+        int err;
+
+        spin_lock_init(&soundgen_card->mixer_lock);
+        soundgen_card->waveform = SOUNDGEN_WAVE_SINE;
+        soundgen_card->frequency = SOUNDGEN_FREQ_DEFAULT;
+        soundgen_card->amplitude = SOUNDGEN_AMPL_DEFAULT;
+        soundgen_card->timer_backend = timer_backend;
+        soundgen_card->sink_meter = SOUNDGEN_METER_OFF;
+        strcpy(card->mixername, "Soundgen Mixer");
+
+        for (i = 0; i < ARRAY_SIZE(snd_soundgen_controls); i++) {
+                err = snd_ctl_add(card, snd_ctl_new1(&snd_soundgen_controls[i],
+                                        soundgen_card));
+                if (err < 0)
+                        return err;
+        }
+        return 0;
+}
+
+/**
+ * End of Mixer stuff
+ */
+
 /**
  * Generic ALSA stuff
  */
+static void snd_soundgen_card_free(struct snd_card *card)
+{
+        struct snd_card_soundgen *soundgen = card->private_data;
+
+        hrtimer_cancel(&soundgen->tick.timer);
+        hrtimer_cancel(&soundgen->clock_timer.hrt);
+        kfree(soundgen->loops);
+        kfree(soundgen->stats);
+}
+
 static int snd_soundgen_driver_probe(struct platform_device *devptr)
 {
-        int err;
+        int err, dev;
         struct snd_card *card;
         struct snd_card_soundgen *soundgen;
 
@@ -546,17 +3278,50 @@ static int snd_soundgen_driver_probe(struct platform_device *devptr)
         /* Link new snd_card and our snd_card_soundgen together */
         soundgen = card->private_data;
         soundgen->card = card;
+        card->private_free = snd_soundgen_card_free;
 
         strcpy(card->driver, "Sound Gen");
         strcpy(card->shortname, "Sound Gen");
         sprintf(card->longname, "Virtual Sound generator");
 
-        err = snd_soundgen_new_pcm(soundgen);
+        soundgen->epoch = ktime_get();
+        soundgen_tick_init(&soundgen->tick);
+        soundgen_timer_init(&soundgen->clock_timer);
+        for (dev = 0; dev < pcm_devs; dev++) {
+                err = snd_soundgen_new_pcm(soundgen, dev, pcm_substreams);
+                if (err < 0) {
+                        dev_err(&devptr->dev, "Failed to create pcm\n");
+                        goto error;
+                }
+        }
+
+        err = snd_soundgen_new_mixer(soundgen);
+        if (err < 0) {
+                dev_err(&devptr->dev, "Failed to create mixer\n");
+                goto error;
+        }
+
+        err = snd_soundgen_new_timer(soundgen);
+        if (err < 0) {
+                dev_err(&devptr->dev, "Failed to create timer\n");
+                goto error;
+        }
+
+        err = snd_soundgen_new_stats(soundgen, pcm_devs * 2 * pcm_substreams);
         if (err < 0) {
-                dev_err(&devptr->dev, "Failed to create pcm\n");
+                dev_err(&devptr->dev, "Failed to create statistics\n");
                 goto error;
         }
 
+        if (loopback) {
+                err = snd_soundgen_new_loops(soundgen,
+                                pcm_devs * pcm_substreams);
+                if (err < 0) {
+                        dev_err(&devptr->dev, "Failed to create loopback\n");
+                        goto error;
+                }
+        }
+
         err = snd_card_register(card);
         if (err < 0) {
                 dev_err(&devptr->dev, "Failed to register soundcard\n");
@@ -600,10 +3365,49 @@ static int __init alsa_soundgen_card_init(void)
 {
         int err;
 
+        if (timer_backend < 0 ||
+            timer_backend >= ARRAY_SIZE(soundgen_backends)) {
+                pr_err("Invalid timer backend %d\n", timer_backend);
+                return -EINVAL;
+        }
+        if (pcm_devs < 1 || pcm_devs > MAX_PCM_DEVICES ||
+            pcm_substreams < 1 || pcm_substreams > MAX_PCM_SUBSTREAMS) {
+                pr_err("Invalid PCM layout %dx%d\n", pcm_devs, pcm_substreams);
+                return -EINVAL;
+        }
+        if (timer_slack < 0 || timer_slack > 100) {
+                pr_err("Invalid timer slack %d%%\n", timer_slack);
+                return -EINVAL;
+        }
+        if (buffer_max_kb < 1 || prealloc_kb < 0 ||
+            prealloc_kb > buffer_max_kb) {
+                pr_err("Invalid buffer sizes %d/%d KiB\n", prealloc_kb,
+                                buffer_max_kb);
+                return -EINVAL;
+        }
+        if (clock_rate < 8000 || clock_rate > 192000) {
+                pr_err("Invalid clock rate %d\n", clock_rate);
+                return -EINVAL;
+        }
+        if (fill_periods < 1) {
+                pr_err("Invalid fill ahead of %d periods\n", fill_periods);
+                return -EINVAL;
+        }
+
+        soundgen_tables_init();
+
+        /* unbound, so the fills of different streams spread over CPUs */
+        if (deferred_fill) {
+                soundgen_fill_wq = alloc_workqueue("soundgen_fill",
+                                WQ_UNBOUND | WQ_HIGHPRI, 0);
+                if (!soundgen_fill_wq)
+                        return -ENOMEM;
+        }
+
         err = platform_driver_register(&snd_soundgen_driver);
         if (err < 0) {
                 pr_err("Faild to register platform driver\n");
-                return err;
+                goto err_wq;
         }
         pr_info("Sound Generator platform device registered\n");
 
@@ -612,16 +3416,24 @@ static int __init alsa_soundgen_card_init(void)
         if (IS_ERR(device)) {
                 pr_err("Failed to register platform device\n");
                 platform_driver_unregister(&snd_soundgen_driver);
-                return PTR_ERR(device);
+                err = PTR_ERR(device);
+                goto err_wq;
         }
 
         return 0;
+
+err_wq:
+        if (soundgen_fill_wq)
+                destroy_workqueue(soundgen_fill_wq);
+        return err;
 }
 
 static void __exit alsa_soundgen_card_exit(void)
 {
         platform_device_unregister(device);
         platform_driver_unregister(&snd_soundgen_driver);        
+        if (soundgen_fill_wq)
+                destroy_workqueue(soundgen_fill_wq);
 }
 
 module_init(alsa_soundgen_card_init)
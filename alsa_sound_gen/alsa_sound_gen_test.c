@@ -1,9 +1,69 @@
+#include <errno.h>
+#include <getopt.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
 
 #include <alsa/asoundlib.h>
 
-int main()
+/*
+ * Without arguments the sound cards are listed. With -D the PCM is
+ * benchmarked over every combination of the given access modes,
+ * formats, rates, period and buffer sizes. Each run prints one JSON
+ * object per line on stdout:
+ *
+ *   frame_rate       frames transferred per second
+ *   wakeups_per_sec  returns from snd_pcm_wait() per second
+ *   cpu_percent      user + system time of this process
+ *   xruns            over/underruns recovered from
+ *   lateness_us      percentiles of how long after a period was ready
+ *                    we got to it, from the excess of avail over
+ *                    avail_min at each wakeup
+ */
+
+#define MAX_LIST	32
+
+/* soundgen's odd devices are non-interleaved only */
+static const struct {
+        const char *name;
+        snd_pcm_access_t access;
+} access_names[] = {
+        { "mmap", SND_PCM_ACCESS_MMAP_INTERLEAVED },
+        { "rw", SND_PCM_ACCESS_RW_INTERLEAVED },
+        { "mmap_ni", SND_PCM_ACCESS_MMAP_NONINTERLEAVED },
+        { "rw_ni", SND_PCM_ACCESS_RW_NONINTERLEAVED },
+};
+#define NACCESS	(sizeof(access_names) / sizeof(access_names[0]))
+
+struct bench_config {
+        const char *device;
+        snd_pcm_stream_t stream;
+        snd_pcm_access_t access;
+        snd_pcm_format_t format;
+        unsigned int rate;
+        unsigned int channels;
+        snd_pcm_uframes_t period_size;
+        snd_pcm_uframes_t buffer_size;
+        double seconds;
+};
+
+struct bench_result {
+        unsigned int rate;
+        snd_pcm_uframes_t period_size;
+        snd_pcm_uframes_t buffer_size;
+        unsigned long long frames;
+        unsigned long wakeups;
+        unsigned long xruns;
+        double elapsed;
+        double cpu;
+        double *lateness;
+        size_t nlateness;
+        size_t cap;
+};
+
+static int list_cards(void)
 {
         int id = -1, err;
         char *name, *longname;
@@ -24,6 +84,446 @@ int main()
                 }
                 printf("Soundcard: %s\n", name);
                 printf("longname: %s\n", longname);
-        } 
+        }
+        return 0;
+}
+
+static double now(void)
+{
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static double cpu_time(void)
+{
+        struct rusage ru;
+
+        getrusage(RUSAGE_SELF, &ru);
+        return ru.ru_utime.tv_sec + ru.ru_utime.tv_usec / 1e6 +
+                ru.ru_stime.tv_sec + ru.ru_stime.tv_usec / 1e6;
+}
+
+static const char *access_name(snd_pcm_access_t access)
+{
+        size_t i;
+
+        for (i = 0; i < NACCESS; i++)
+                if (access_names[i].access == access)
+                        return access_names[i].name;
+        return "unknown";
+}
+
+static int is_mmap(snd_pcm_access_t access)
+{
+        return access == SND_PCM_ACCESS_MMAP_INTERLEAVED ||
+                access == SND_PCM_ACCESS_MMAP_NONINTERLEAVED;
+}
+
+static void record_lateness(struct bench_result *res, double us)
+{
+        size_t cap;
+        double *p;
+
+        if (res->nlateness == res->cap) {
+                cap = res->cap ? res->cap * 2 : 1024;
+                p = realloc(res->lateness, cap * sizeof(*p));
+                if (!p)
+                        return;
+                res->lateness = p;
+                res->cap = cap;
+        }
+        res->lateness[res->nlateness++] = us;
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+        double x = *(const double *)a, y = *(const double *)b;
+
+        return x < y ? -1 : x > y;
+}
+
+static double percentile(const struct bench_result *res, double q)
+{
+        if (!res->nlateness)
+                return 0;
+        return res->lateness[(size_t)(q * (res->nlateness - 1))];
+}
+
+static int set_params(snd_pcm_t *pcm, const struct bench_config *cfg,
+                struct bench_result *res, const char **what)
+{
+        snd_pcm_hw_params_t *hw;
+        snd_pcm_sw_params_t *sw;
+        unsigned int rate = cfg->rate;
+        snd_pcm_uframes_t period = cfg->period_size;
+        snd_pcm_uframes_t buffer = cfg->buffer_size ?
+                cfg->buffer_size : cfg->period_size * 4;
+        int err;
+
+        snd_pcm_hw_params_alloca(&hw);
+        snd_pcm_sw_params_alloca(&sw);
+
+        *what = "snd_pcm_hw_params_any";
+        if ((err = snd_pcm_hw_params_any(pcm, hw)) < 0)
+                return err;
+        *what = "snd_pcm_hw_params_set_access";
+        if ((err = snd_pcm_hw_params_set_access(pcm, hw, cfg->access)) < 0)
+                return err;
+        *what = "snd_pcm_hw_params_set_format";
+        if ((err = snd_pcm_hw_params_set_format(pcm, hw, cfg->format)) < 0)
+                return err;
+        *what = "snd_pcm_hw_params_set_channels";
+        if ((err = snd_pcm_hw_params_set_channels(pcm, hw,
+                                        cfg->channels)) < 0)
+                return err;
+        *what = "snd_pcm_hw_params_set_rate_near";
+        if ((err = snd_pcm_hw_params_set_rate_near(pcm, hw, &rate, NULL)) < 0)
+                return err;
+        *what = "snd_pcm_hw_params_set_period_size_near";
+        if ((err = snd_pcm_hw_params_set_period_size_near(pcm, hw, &period,
+                                        NULL)) < 0)
+                return err;
+        *what = "snd_pcm_hw_params_set_buffer_size_near";
+        if ((err = snd_pcm_hw_params_set_buffer_size_near(pcm, hw,
+                                        &buffer)) < 0)
+                return err;
+        *what = "snd_pcm_hw_params";
+        if ((err = snd_pcm_hw_params(pcm, hw)) < 0)
+                return err;
+        snd_pcm_hw_params_get_period_size(hw, &period, NULL);
+        snd_pcm_hw_params_get_buffer_size(hw, &buffer);
+
+        *what = "snd_pcm_sw_params";
+        if ((err = snd_pcm_sw_params_current(pcm, sw)) < 0)
+                return err;
+        if ((err = snd_pcm_sw_params_set_avail_min(pcm, sw, period)) < 0)
+                return err;
+        /* playback starts once the prefill is in, capture explicitly */
+        if ((err = snd_pcm_sw_params_set_start_threshold(pcm, sw,
+                                        cfg->stream == SND_PCM_STREAM_PLAYBACK ?
+                                        buffer : buffer * 2)) < 0)
+                return err;
+        if ((err = snd_pcm_sw_params(pcm, sw)) < 0)
+                return err;
+
+        res->rate = rate;
+        res->period_size = period;
+        res->buffer_size = buffer;
+        return 0;
+}
+
+/*
+ * Move up to frames frames, silence for playback; returns frames moved.
+ * bufs holds one pointer per channel into buf for non-interleaved rw.
+ */
+static snd_pcm_sframes_t transfer(snd_pcm_t *pcm,
+                const struct bench_config *cfg, void *buf, void **bufs,
+                snd_pcm_uframes_t chunk, snd_pcm_uframes_t frames)
+{
+        const snd_pcm_channel_area_t *areas;
+        snd_pcm_uframes_t offset, n, done = 0;
+        snd_pcm_sframes_t ret;
+        int err;
+
+        while (done < frames) {
+                n = frames - done;
+                if (is_mmap(cfg->access)) {
+                        err = snd_pcm_mmap_begin(pcm, &areas, &offset, &n);
+                        if (err < 0)
+                                return err;
+                        if (cfg->stream == SND_PCM_STREAM_PLAYBACK)
+                                snd_pcm_areas_silence(areas, offset,
+                                                cfg->channels, n, cfg->format);
+                        ret = snd_pcm_mmap_commit(pcm, offset, n);
+                } else {
+                        if (n > chunk)
+                                n = chunk;
+                        if (cfg->access == SND_PCM_ACCESS_RW_NONINTERLEAVED)
+                                ret = cfg->stream == SND_PCM_STREAM_PLAYBACK ?
+                                        snd_pcm_writen(pcm, bufs, n) :
+                                        snd_pcm_readn(pcm, bufs, n);
+                        else if (cfg->stream == SND_PCM_STREAM_PLAYBACK)
+                                ret = snd_pcm_writei(pcm, buf, n);
+                        else
+                                ret = snd_pcm_readi(pcm, buf, n);
+                }
+                if (ret < 0)
+                        return ret;
+                if (ret == 0)
+                        break;
+                done += ret;
+        }
+        return done;
+}
+
+static int recover(snd_pcm_t *pcm, const struct bench_config *cfg,
+                struct bench_result *res, int err)
+{
+        res->xruns++;
+        err = snd_pcm_recover(pcm, err, 1);
+        if (err < 0)
+                return err;
+        if (cfg->stream == SND_PCM_STREAM_CAPTURE)
+                return snd_pcm_start(pcm);
         return 0;
 }
+
+static int run_one(const struct bench_config *cfg, struct bench_result *res,
+                const char **what)
+{
+        snd_pcm_t *pcm;
+        snd_pcm_sframes_t avail, n;
+        double start, cpu;
+        void *buf = NULL, **bufs = NULL;
+        unsigned int ch;
+        int err;
+
+        *what = "snd_pcm_open";
+        err = snd_pcm_open(&pcm, cfg->device, cfg->stream, 0);
+        if (err < 0)
+                return err;
+        err = set_params(pcm, cfg, res, what);
+        if (err < 0)
+                goto out;
+
+        *what = "malloc";
+        buf = calloc(res->period_size, snd_pcm_frames_to_bytes(pcm, 1));
+        bufs = calloc(cfg->channels, sizeof(*bufs));
+        if (!buf || !bufs) {
+                err = -ENOMEM;
+                goto out;
+        }
+        snd_pcm_format_set_silence(cfg->format, buf,
+                        res->period_size * cfg->channels);
+        for (ch = 0; ch < cfg->channels; ch++)
+                bufs[ch] = (char *)buf + ch *
+                        snd_pcm_samples_to_bytes(pcm, res->period_size);
+
+        *what = "start";
+        if (cfg->stream == SND_PCM_STREAM_PLAYBACK)
+                err = transfer(pcm, cfg, buf, bufs, res->period_size,
+                                res->buffer_size);
+        else
+                err = snd_pcm_start(pcm);
+        if (err < 0)
+                goto out;
+
+        *what = "transfer";
+        start = now();
+        cpu = cpu_time();
+        while ((res->elapsed = now() - start) < cfg->seconds) {
+                err = snd_pcm_wait(pcm, 1000);
+                if (err == 0) {
+                        err = -ETIMEDOUT;
+                        goto out;
+                }
+                if (err < 0) {
+                        if ((err = recover(pcm, cfg, res, err)) < 0)
+                                goto out;
+                        continue;
+                }
+                res->wakeups++;
+
+                avail = snd_pcm_avail_update(pcm);
+                if (avail < 0) {
+                        if ((err = recover(pcm, cfg, res, avail)) < 0)
+                                goto out;
+                        continue;
+                }
+                if ((snd_pcm_uframes_t)avail >= res->period_size)
+                        record_lateness(res, (avail - res->period_size) *
+                                        1e6 / res->rate);
+
+                n = transfer(pcm, cfg, buf, bufs, res->period_size, avail);
+                if (n < 0) {
+                        if ((err = recover(pcm, cfg, res, n)) < 0)
+                                goto out;
+                        continue;
+                }
+                res->frames += n;
+        }
+        res->cpu = cpu_time() - cpu;
+        err = 0;
+out:
+        free(bufs);
+        free(buf);
+        snd_pcm_drop(pcm);
+        snd_pcm_close(pcm);
+        return err;
+}
+
+static void report(const struct bench_config *cfg,
+                struct bench_result *res, int err, const char *what)
+{
+        printf("{\"device\":\"%s\",\"stream\":\"%s\",\"access\":\"%s\","
+                        "\"format\":\"%s\",\"rate\":%u,\"channels\":%u,"
+                        "\"period\":%lu,\"buffer\":%lu",
+                        cfg->device, snd_pcm_stream_name(cfg->stream),
+                        access_name(cfg->access),
+                        snd_pcm_format_name(cfg->format),
+                        res->rate ? res->rate : cfg->rate, cfg->channels,
+                        res->period_size ? res->period_size : cfg->period_size,
+                        res->buffer_size ? res->buffer_size : cfg->buffer_size);
+        if (err < 0) {
+                printf(",\"error\":\"%s: %s\"}\n", what, snd_strerror(err));
+                return;
+        }
+
+        qsort(res->lateness, res->nlateness, sizeof(*res->lateness),
+                        cmp_double);
+        printf(",\"seconds\":%.3f,\"frames\":%llu,\"frame_rate\":%.1f,"
+                        "\"wakeups_per_sec\":%.1f,\"cpu_percent\":%.2f,"
+                        "\"xruns\":%lu,\"lateness_us\":{\"p50\":%.1f,"
+                        "\"p90\":%.1f,\"p99\":%.1f,\"p999\":%.1f,"
+                        "\"max\":%.1f}}\n",
+                        res->elapsed, res->frames,
+                        res->frames / res->elapsed,
+                        res->wakeups / res->elapsed,
+                        100.0 * res->cpu / res->elapsed, res->xruns,
+                        percentile(res, 0.5), percentile(res, 0.9),
+                        percentile(res, 0.99), percentile(res, 0.999),
+                        percentile(res, 1.0));
+        fflush(stdout);
+}
+
+static int parse_list(char *arg, unsigned long *out)
+{
+        char *tok, *end;
+        int n = 0;
+
+        for (tok = strtok(arg, ","); tok && n < MAX_LIST;
+                        tok = strtok(NULL, ",")) {
+                out[n] = strtoul(tok, &end, 0);
+                if (*end)
+                        return -1;
+                n++;
+        }
+        return n;
+}
+
+static void usage(const char *prog)
+{
+        fprintf(stderr,
+                "usage: %s                 list sound cards\n"
+                "       %s -D device [options]\n"
+                "  -s playback|capture     stream (capture)\n"
+                "  -a mmap,rw,mmap_ni,rw_ni\n"
+                "                          access modes (mmap,rw)\n"
+                "  -f S16_LE,...           formats (S16_LE)\n"
+                "  -r 48000,...            rates (48000)\n"
+                "  -c channels             channels (2)\n"
+                "  -p 64,256,...           period sizes in frames (1024)\n"
+                "  -b 0,4096,...           buffer sizes, 0 = 4 periods (0)\n"
+                "  -t seconds              duration of each run (2)\n",
+                prog, prog);
+}
+
+int main(int argc, char **argv)
+{
+        struct bench_config cfg = {
+                .stream = SND_PCM_STREAM_CAPTURE,
+                .channels = 2,
+                .seconds = 2,
+        };
+        snd_pcm_access_t access[NACCESS] = {
+                SND_PCM_ACCESS_MMAP_INTERLEAVED,
+                SND_PCM_ACCESS_RW_INTERLEAVED,
+        };
+        snd_pcm_format_t formats[MAX_LIST] = { SND_PCM_FORMAT_S16_LE };
+        unsigned long rates[MAX_LIST] = { 48000 };
+        unsigned long periods[MAX_LIST] = { 1024 };
+        unsigned long buffers[MAX_LIST] = { 0 };
+        int naccess = 2, nformats = 1, nrates = 1, nperiods = 1, nbuffers = 1;
+        int a, f, r, p, b, opt, err, failed = 0;
+        size_t i;
+        struct bench_result res;
+        const char *what;
+        char *tok;
+
+        while ((opt = getopt(argc, argv, "D:s:a:f:r:c:p:b:t:h")) != -1) {
+                switch (opt) {
+                case 'D':
+                        cfg.device = optarg;
+                        break;
+                case 's':
+                        if (!strcmp(optarg, "playback"))
+                                cfg.stream = SND_PCM_STREAM_PLAYBACK;
+                        else if (!strcmp(optarg, "capture"))
+                                cfg.stream = SND_PCM_STREAM_CAPTURE;
+                        else
+                                goto bad;
+                        break;
+                case 'a':
+                        naccess = 0;
+                        for (tok = strtok(optarg, ","); tok &&
+                                        naccess < (int)NACCESS;
+                                        tok = strtok(NULL, ",")) {
+                                for (i = 0; i < NACCESS; i++)
+                                        if (!strcmp(tok, access_names[i].name))
+                                                break;
+                                if (i == NACCESS)
+                                        goto bad;
+                                access[naccess++] = access_names[i].access;
+                        }
+                        break;
+                case 'f':
+                        nformats = 0;
+                        for (tok = strtok(optarg, ","); tok &&
+                                        nformats < MAX_LIST;
+                                        tok = strtok(NULL, ",")) {
+                                formats[nformats] = snd_pcm_format_value(tok);
+                                if (formats[nformats++] ==
+                                                SND_PCM_FORMAT_UNKNOWN)
+                                        goto bad;
+                        }
+                        break;
+                case 'r':
+                        nrates = parse_list(optarg, rates);
+                        break;
+                case 'c':
+                        cfg.channels = strtoul(optarg, NULL, 0);
+                        break;
+                case 'p':
+                        nperiods = parse_list(optarg, periods);
+                        break;
+                case 'b':
+                        nbuffers = parse_list(optarg, buffers);
+                        break;
+                case 't':
+                        cfg.seconds = strtod(optarg, NULL);
+                        break;
+                default:
+                        goto bad;
+                }
+        }
+        if (nrates <= 0 || nperiods <= 0 || nbuffers <= 0 || !naccess ||
+            !nformats || !cfg.channels || cfg.seconds <= 0)
+                goto bad;
+        if (!cfg.device)
+                return list_cards();
+
+        for (a = 0; a < naccess; a++)
+        for (f = 0; f < nformats; f++)
+        for (r = 0; r < nrates; r++)
+        for (p = 0; p < nperiods; p++)
+        for (b = 0; b < nbuffers; b++) {
+                cfg.access = access[a];
+                cfg.format = formats[f];
+                cfg.rate = rates[r];
+                cfg.period_size = periods[p];
+                cfg.buffer_size = buffers[b];
+                memset(&res, 0, sizeof(res));
+                err = run_one(&cfg, &res, &what);
+                report(&cfg, &res, err, what);
+                free(res.lateness);
+                if (err < 0)
+                        failed++;
+        }
+        return failed ? 1 : 0;
+
+bad:
+        usage(argv[0]);
+        return 2;
+}